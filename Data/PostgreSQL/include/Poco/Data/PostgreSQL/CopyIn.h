@@ -0,0 +1,242 @@
+//
+// CopyIn.h
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyIn
+//
+// Definition of the CopyIn class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_PostgreSQL_CopyIn_INCLUDED
+#define SQL_PostgreSQL_CopyIn_INCLUDED
+
+
+#include "Poco/Data/PostgreSQL/PostgreSQL.h"
+#include "Poco/Data/PostgreSQL/SessionHandle.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/DateTime.h"
+#include "Poco/UUID.h"
+#include "Poco/Nullable.h"
+#include "Poco/Exception.h"
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+class PostgreSQL_API CopyIn
+	/// CopyIn loads rows into a table with the PostgreSQL COPY
+	/// protocol (COPY ... FROM STDIN) in binary format.
+	///
+	/// Compared to executing an INSERT statement for every row,
+	/// COPY sends all rows in a single data stream, without a
+	/// round trip per row. Rows are encoded into a buffer, which
+	/// is handed to libpq whenever it is full, so memory usage
+	/// does not depend on the number of rows loaded.
+	///
+	/// Values are appended field by field, in the order of the
+	/// columns given to the constructor. Each value is sent in the
+	/// binary representation of the corresponding PostgreSQL type,
+	/// so the C++ type must match the column type:
+	///
+	///   * Int16 - smallint, Int32 - integer, Int64 - bigint
+	///   * float - real, double - double precision
+	///   * bool - boolean
+	///   * std::string, CLOB - text, varchar, char
+	///   * BLOB - bytea
+	///   * Date - date, Time - time, DateTime - timestamp
+	///   * UUID - uuid
+	///
+	/// Example:
+	///
+	///     CopyIn copy(session, "Person", {"LastName", "FirstName", "Age"});
+	///     copy << "Simpson" << "Bart" << Int32(12);
+	///     copy << "Simpson" << "Lisa" << Int32(10);
+	///     std::size_t rows = copy.finish();
+	///
+	/// or, from column vectors:
+	///
+	///     CopyIn copy(session, "Person", {"LastName", "FirstName", "Age"});
+	///     copy.appendColumns(lastNames, firstNames, ages);
+	///     copy.finish();
+	///
+	/// While the copy is in progress, the session must not be
+	/// used for anything else. If the CopyIn is destroyed before
+	/// finish() has been called, the copy is aborted and no rows
+	/// are inserted.
+{
+public:
+	static const std::size_t DEFAULT_BUFFER_SIZE = 65536;
+
+	CopyIn(Poco::Data::Session& session,
+		const std::string& table,
+		const std::vector<std::string>& columns,
+		std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+		/// Starts copying into the given columns of the given table.
+		///
+		/// Table and column names are used as given; they must be
+		/// quoted by the caller if required.
+		///
+		/// Throws a StatementException if the server rejects
+		/// the COPY command.
+
+	~CopyIn();
+		/// Destroys the CopyIn, aborting the copy if finish()
+		/// has not been called.
+
+	void append(Poco::Int16 value);
+		/// Appends a smallint value.
+
+	void append(Poco::Int32 value);
+		/// Appends an integer value.
+
+	void append(Poco::Int64 value);
+		/// Appends a bigint value.
+
+	void append(float value);
+		/// Appends a real value.
+
+	void append(double value);
+		/// Appends a double precision value.
+
+	void append(bool value);
+		/// Appends a boolean value.
+
+	void append(const std::string& value);
+		/// Appends a text value.
+
+	void append(const char* value);
+		/// Appends a text value.
+
+	void append(const char* value, std::size_t length);
+		/// Appends a text or bytea value.
+
+	void append(const BLOB& value);
+		/// Appends a bytea value.
+
+	void append(const CLOB& value);
+		/// Appends a text value.
+
+	void append(const Date& value);
+		/// Appends a date value.
+
+	void append(const Time& value);
+		/// Appends a time value.
+
+	void append(const Poco::DateTime& value);
+		/// Appends a timestamp value.
+
+	void append(const Poco::UUID& value);
+		/// Appends a uuid value.
+
+	void appendNull();
+		/// Appends a null value.
+
+	template <typename T>
+	void append(const Poco::Nullable<T>& value)
+		/// Appends the value, or null if value is null.
+	{
+		if (value.isNull())
+			appendNull();
+		else
+			append(value.value());
+	}
+
+	template <typename T>
+	CopyIn& operator << (const T& value)
+		/// Appends the value.
+	{
+		append(value);
+		return *this;
+	}
+
+	template <typename... T>
+	void appendColumns(const std::vector<T>&... columns)
+		/// Appends one row for every element of the given vectors,
+		/// one vector per column. All vectors must have the same size.
+	{
+		const std::size_t sizes[] = {columns.size()...};
+		for (std::size_t size: sizes)
+		{
+			if (size != sizes[0])
+				throw Poco::InvalidArgumentException("Column vectors must have the same size");
+		}
+		for (std::size_t row = 0; row < sizes[0]; ++row)
+		{
+			(append(element(columns, row)), ...);
+		}
+	}
+
+	std::size_t finish();
+		/// Completes the copy and returns the number of rows
+		/// inserted.
+		///
+		/// Throws an IllegalStateException if the last row is
+		/// incomplete, and a StatementException if the server
+		/// reports an error, e.g. a constraint violation.
+
+	std::size_t rowCount() const;
+		/// Returns the number of complete rows appended so far.
+
+private:
+	CopyIn(const CopyIn&);
+	CopyIn& operator = (const CopyIn&);
+
+	template <typename T>
+	static const T& element(const std::vector<T>& column, std::size_t row)
+	{
+		return column[row];
+	}
+
+	static bool element(const std::vector<bool>& column, std::size_t row)
+	{
+		return column[row];
+	}
+
+	void beginField(Poco::Int32 length);
+	void endField();
+	void appendRaw(const void* data, std::size_t length);
+	void appendInt16(Poco::Int16 value);
+	void appendInt32(Poco::Int32 value);
+	void appendInt64(Poco::Int64 value);
+	void flush();
+	void abort();
+
+	SessionHandle&  _sessionHandle;
+	std::size_t     _columnCount;
+	std::size_t     _bufferSize;
+	std::string     _buffer;
+	std::size_t     _field;
+	std::size_t     _rowCount;
+	bool            _active;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t CopyIn::rowCount() const
+{
+	return _rowCount;
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
+
+
+#endif // SQL_PostgreSQL_CopyIn_INCLUDED
@@ -0,0 +1,244 @@
+//
+// CopyOut.h
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyOut
+//
+// Definition of the CopyOut class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_PostgreSQL_CopyOut_INCLUDED
+#define SQL_PostgreSQL_CopyOut_INCLUDED
+
+
+#include "Poco/Data/PostgreSQL/PostgreSQL.h"
+#include "Poco/Data/PostgreSQL/SessionHandle.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/DateTime.h"
+#include "Poco/UUID.h"
+#include "Poco/Nullable.h"
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+class PostgreSQL_API CopyOut
+	/// CopyOut reads the result of a query with the PostgreSQL
+	/// COPY protocol (COPY ... TO STDOUT) in binary format.
+	///
+	/// Unlike a regular statement, which receives the complete
+	/// result before the first row can be extracted, CopyOut
+	/// receives the result row by row. Only the current row is
+	/// kept in memory, so arbitrarily large results can be
+	/// processed with constant memory.
+	///
+	/// After next() has returned true, the fields of the current
+	/// row are extracted by position. The binary representation
+	/// does not identify the column type, so the C++ type must
+	/// match the column type, as described for CopyIn. Integer
+	/// and floating-point fields are converted to wider types,
+	/// e.g. an integer column can be extracted into an Int64.
+	///
+	/// Example:
+	///
+	///     CopyOut copy(session, "SELECT LastName, Age FROM Person");
+	///     std::string name;
+	///     Int32 age;
+	///     while (copy.next())
+	///     {
+	///         copy.extract(0, name);
+	///         copy.extract(1, age);
+	///     }
+	///
+	/// or, into column vectors:
+	///
+	///     std::vector<std::string> names;
+	///     std::vector<Int32> ages;
+	///     CopyOut copy(session, "SELECT LastName, Age FROM Person");
+	///     copy.extractColumns(names, ages);
+	///
+	/// While the copy is in progress, the session must not be
+	/// used for anything else. If the CopyOut is destroyed before
+	/// all rows have been read, the remaining rows are discarded.
+{
+public:
+	CopyOut(Poco::Data::Session& session, const std::string& query);
+		/// Starts copying the result of the given query,
+		/// which must be a SELECT, VALUES or similar query,
+		/// or the name of a table.
+		///
+		/// Throws a StatementException if the server rejects
+		/// the COPY command.
+
+	~CopyOut();
+		/// Destroys the CopyOut.
+
+	bool next();
+		/// Reads the next row. Returns false if there
+		/// are no more rows.
+		///
+		/// Throws a StatementException if the server reports
+		/// an error.
+
+	std::size_t fieldCount() const;
+		/// Returns the number of fields in the current row.
+
+	std::size_t rowCount() const;
+		/// Returns the number of rows read so far.
+
+	bool isNull(std::size_t pos) const;
+		/// Returns true if the field at the given position
+		/// of the current row is null.
+
+	bool extract(std::size_t pos, Poco::Int16& value) const;
+		/// Extracts a smallint value.
+		///
+		/// Like all extract() functions, returns false and
+		/// leaves value unchanged if the field is null,
+		/// and throws a DataException if the size of the
+		/// field does not match the type.
+
+	bool extract(std::size_t pos, Poco::Int32& value) const;
+		/// Extracts a smallint or integer value.
+
+	bool extract(std::size_t pos, Poco::Int64& value) const;
+		/// Extracts a smallint, integer or bigint value.
+
+	bool extract(std::size_t pos, float& value) const;
+		/// Extracts a real value.
+
+	bool extract(std::size_t pos, double& value) const;
+		/// Extracts a real or double precision value.
+
+	bool extract(std::size_t pos, bool& value) const;
+		/// Extracts a boolean value.
+
+	bool extract(std::size_t pos, std::string& value) const;
+		/// Extracts a text value, or the raw bytes of any value.
+
+	bool extract(std::size_t pos, BLOB& value) const;
+		/// Extracts a bytea value.
+
+	bool extract(std::size_t pos, CLOB& value) const;
+		/// Extracts a text value.
+
+	bool extract(std::size_t pos, Date& value) const;
+		/// Extracts a date value.
+
+	bool extract(std::size_t pos, Time& value) const;
+		/// Extracts a time value.
+
+	bool extract(std::size_t pos, Poco::DateTime& value) const;
+		/// Extracts a timestamp value.
+
+	bool extract(std::size_t pos, Poco::UUID& value) const;
+		/// Extracts a uuid value.
+
+	template <typename T>
+	bool extract(std::size_t pos, Poco::Nullable<T>& value) const
+		/// Extracts the value, or sets value to null
+		/// if the field is null.
+	{
+		T val;
+		if (extract(pos, val))
+		{
+			value = val;
+			return true;
+		}
+		value.clear();
+		return false;
+	}
+
+	template <typename... T>
+	std::size_t extractColumns(std::vector<T>&... columns)
+		/// Reads all remaining rows and appends the fields to the
+		/// given vectors, one vector per column. Null fields are
+		/// appended as default-constructed values.
+		///
+		/// Returns the number of rows read.
+	{
+		std::size_t rows = 0;
+		while (next())
+		{
+			std::size_t pos = 0;
+			(extractElement(pos++, columns), ...);
+			++rows;
+		}
+		return rows;
+	}
+
+private:
+	CopyOut(const CopyOut&);
+	CopyOut& operator = (const CopyOut&);
+
+	template <typename T>
+	void extractElement(std::size_t pos, std::vector<T>& column) const
+	{
+		column.push_back(T());
+		extract(pos, column.back());
+	}
+
+	void extractElement(std::size_t pos, std::vector<bool>& column) const
+	{
+		bool value = false;
+		extract(pos, value);
+		column.push_back(value);
+	}
+
+	struct Field
+	{
+		const char* pData;
+		Poco::Int32 length;
+	};
+
+	const Field& field(std::size_t pos) const;
+	bool receive();
+	void finish();
+	void clearBuffer();
+
+	SessionHandle&     _sessionHandle;
+	char*              _pBuffer;
+	const char*        _pCurrent;
+	const char*        _pEnd;
+	std::vector<Field> _fields;
+	std::size_t        _rowCount;
+	bool               _headerRead;
+	bool               _active;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t CopyOut::fieldCount() const
+{
+	return _fields.size();
+}
+
+
+inline std::size_t CopyOut::rowCount() const
+{
+	return _rowCount;
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
+
+
+#endif // SQL_PostgreSQL_CopyOut_INCLUDED
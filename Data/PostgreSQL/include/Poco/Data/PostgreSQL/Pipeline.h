@@ -0,0 +1,184 @@
+//
+// Pipeline.h
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  Pipeline
+//
+// Definition of the Pipeline class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_PostgreSQL_Pipeline_INCLUDED
+#define SQL_PostgreSQL_Pipeline_INCLUDED
+
+
+#include "Poco/Data/PostgreSQL/PostgreSQL.h"
+#include "Poco/Data/PostgreSQL/SessionHandle.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Dynamic/Var.h"
+#include "Poco/Nullable.h"
+#include "Poco/ActiveMethod.h"
+#include "Poco/ActiveResult.h"
+#include "Poco/Mutex.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+class PostgreSQL_API Pipeline
+	/// Pipeline sends statements to the server in libpq pipeline
+	/// mode. Statements are queued without waiting for the result
+	/// of the previous statement, and all results are collected
+	/// with a single call to sync(). On a high-latency link, this
+	/// replaces one round trip per statement with one round trip
+	/// per pipeline.
+	///
+	/// Example:
+	///
+	///     Pipeline pipeline(session);
+	///     std::size_t insert = pipeline.prepare("INSERT INTO Person VALUES ($1, $2, $3, $4)");
+	///     pipeline.execute(insert, {"Simpson", "Bart", "Springfield", 12});
+	///     pipeline.execute(insert, {"Simpson", "Lisa", "Springfield", 10});
+	///     pipeline.execute("UPDATE Person SET Age = Age + 1");
+	///     Pipeline::Results results = pipeline.sync();
+	///
+	/// Parameters are passed as Poco::Dynamic::Var and sent in
+	/// text format, except BLOBs, which are sent in binary format.
+	/// An empty Var is sent as NULL.
+	///
+	/// If a statement fails, the remaining statements up to the
+	/// next synchronization point are not executed; their results
+	/// report the error "aborted". To bound the memory held by
+	/// libpq and the server, a synchronization point is inserted
+	/// automatically after maxPending statements. Use an explicit
+	/// transaction to make a pipeline longer than maxPending
+	/// statements atomic.
+	///
+	/// With syncAsync(), the results are collected on a background
+	/// thread, and the caller waits on the returned ActiveResult.
+	/// Until the results are available, all other member functions
+	/// except the destructor throw an InvalidAccessException. The
+	/// destructor waits for the results.
+	///
+	/// While the Pipeline exists, the session must not be used
+	/// for anything else. The Pipeline leaves pipeline mode and
+	/// deallocates its prepared statements when it is destroyed.
+	///
+	/// Requires libpq 14 or newer; with older versions, the
+	/// constructor throws a NotImplementedException.
+{
+public:
+	using Parameters = std::vector<Poco::Dynamic::Var>;
+
+	struct Result
+		/// The result of a statement executed in the pipeline.
+	{
+		bool ok = false;
+			/// True if the statement succeeded.
+
+		std::size_t affectedRows = 0;
+			/// The number of rows affected or returned.
+
+		std::vector<std::string> columns;
+			/// The column names of a statement returning rows.
+
+		std::vector<std::vector<Poco::Nullable<std::string>>> rows;
+			/// The rows returned by the statement, in text format.
+
+		std::string error;
+			/// The error message if the statement failed.
+
+		std::string sqlState;
+			/// The SQLSTATE if the statement failed.
+	};
+
+	using Results = std::vector<Result>;
+
+	static const std::size_t DEFAULT_MAX_PENDING = 1000;
+
+	explicit Pipeline(Poco::Data::Session& session, std::size_t maxPending = DEFAULT_MAX_PENDING);
+		/// Creates the Pipeline and switches the session to
+		/// pipeline mode.
+
+	~Pipeline();
+		/// Waits for a pending syncAsync(), collects any outstanding
+		/// results, leaves pipeline mode and deallocates the prepared
+		/// statements.
+
+	std::size_t prepare(const std::string& sql);
+		/// Queues the preparation of the given statement and
+		/// returns the identifier to pass to execute().
+		///
+		/// If the server rejects the statement, sync() throws
+		/// a StatementException.
+
+	void execute(std::size_t statement, const Parameters& parameters = Parameters());
+		/// Queues the execution of a statement created with
+		/// prepare(), with the given parameters.
+
+	void execute(const std::string& sql, const Parameters& parameters = Parameters());
+		/// Queues the execution of the given statement,
+		/// with the given parameters.
+
+	std::size_t pending() const;
+		/// Returns the number of executions whose results have
+		/// not yet been returned by sync().
+
+	Results sync();
+		/// Sends a synchronization point, waits for the results of
+		/// all queued statements and returns them, one per execute()
+		/// call, in the order of the calls.
+
+	Poco::ActiveResult<Results> syncAsync();
+		/// Like sync(), but collects the results on a background
+		/// thread.
+		///
+		/// Until the results are available, calling any other member
+		/// function throws an InvalidAccessException.
+
+private:
+	Pipeline(const Pipeline&);
+	Pipeline& operator = (const Pipeline&);
+
+	enum Request
+	{
+		REQUEST_PREPARE,
+		REQUEST_EXECUTE
+	};
+
+	void checkIdle() const;
+	Results syncResults();
+	Results runSync();
+	void enqueue(Request request);
+	void syncSegment();
+	void send(int rc);
+
+	SessionHandle&           _sessionHandle;
+	std::size_t              _maxPending;
+	std::vector<std::string> _statementNames;
+	std::vector<Request>     _segment;
+	Results                  _results;
+	std::string              _prepareError;
+	std::string              _prepareSqlState;
+	bool                     _syncing;
+	std::unique_ptr<Poco::ActiveResult<Results>> _pSyncResult;
+	Poco::ActiveMethod<Results, void, Pipeline> _syncAsync;
+	mutable Poco::FastMutex  _mutex;
+};
+
+
+} } } // namespace Poco::Data::PostgreSQL
+
+
+#endif // SQL_PostgreSQL_Pipeline_INCLUDED
@@ -124,6 +124,45 @@ public:
 		/// Returns true if binary extraction is enabled, otherwise false.
 		/// See setBinaryExtraction() for more information.
 
+	void setRowStreaming(const std::string& feature, bool enabled);
+		/// Sets the "rowStreaming" feature. If set, the rows returned by a
+		/// query are received from the server while they are extracted,
+		/// instead of receiving the complete result before the first row
+		/// is extracted. Together with a limit() on the statement, this
+		/// bounds the memory used by a query by the limit, not by the
+		/// size of the result:
+		///
+		///     session.setFeature("rowStreaming", true);
+		///     Statement stmt = (session << "SELECT * FROM Person", into(people), limit(1000));
+		///     while (!stmt.done())
+		///     {
+		///         stmt.execute();
+		///         // process people
+		///     }
+		///
+		/// While a statement is streaming its result, the session cannot
+		/// execute other statements. A streaming statement that is
+		/// executed again or destroyed before all rows have been extracted
+		/// cancels the query, unless a transaction is in progress, in which
+		/// case the remaining rows are received and discarded.
+		///
+		/// The feature applies to statements created after it has been set.
+
+	bool isRowStreaming(const std::string& feature = std::string()) const;
+		/// Returns true if row streaming is enabled, otherwise false.
+		/// See setRowStreaming() for more information.
+
+	void setRowStreamingChunkSize(const std::string& property, const Poco::Any& value);
+		/// Sets the "rowStreamingChunkSize" property (a std::size_t), the
+		/// maximum number of rows received at once when row streaming is
+		/// enabled (default 1000).
+		///
+		/// Requires libpq 17 or newer; with older versions, rows are
+		/// always received one at a time.
+
+	Poco::Any getRowStreamingChunkSize(const std::string& property = std::string()) const;
+		/// Returns the value of the "rowStreamingChunkSize" property.
+
 	SessionHandle& handle();
 		/// Get handle
 
@@ -135,6 +174,8 @@ private:
 	mutable SessionHandle _sessionHandle;
 	std::size_t           _timeout = 0;
 	bool                  _binaryExtraction = false;
+	bool                  _rowStreaming = false;
+	std::size_t           _rowStreamingChunkSize = 1000;
 };
 
 
@@ -179,6 +220,24 @@ inline bool SessionImpl::isBinaryExtraction(const std::string&) const
 }
 
 
+inline void SessionImpl::setRowStreaming(const std::string&, bool enabled)
+{
+	_rowStreaming = enabled;
+}
+
+
+inline bool SessionImpl::isRowStreaming(const std::string&) const
+{
+	return _rowStreaming;
+}
+
+
+inline Poco::Any SessionImpl::getRowStreamingChunkSize(const std::string&) const
+{
+	return _rowStreamingChunkSize;
+}
+
+
 } } } // namespace Poco::Data::PostgreSQL
 
 
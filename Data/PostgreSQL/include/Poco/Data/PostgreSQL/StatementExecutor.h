@@ -22,6 +22,7 @@
 #include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
 #include "Poco/Data/PostgreSQL/SessionHandle.h"
 #include "Poco/Data/MetaColumn.h"
+#include "Poco/Data/StatementCache.h"
 #include <libpq-fe.h>
 #include <string>
 #include <vector>
@@ -43,8 +44,17 @@ public:
 		STMT_EXECUTED
 	};
 
-	explicit StatementExecutor(SessionHandle& aSessionHandle, bool binaryExtraction);
+	explicit StatementExecutor(SessionHandle& aSessionHandle, bool binaryExtraction, bool rowStreaming = false, std::size_t rowStreamingChunkSize = 1,
+		StatementCache* pStatementCache = 0);
 		/// Creates the StatementExecutor.
+		///
+		/// If rowStreaming is true, the rows of a query are received
+		/// from the server as they are fetched, up to rowStreamingChunkSize
+		/// rows at once (libpq 17 or newer; otherwise one row at once).
+		///
+		/// If a StatementCache is given and enabled, the prepared statement
+		/// is taken from the cache by prepare(), and put back into the cache
+		/// when the StatementExecutor is destroyed, instead of being deallocated.
 
 	~StatementExecutor();
 		/// Destroys the StatementExecutor.
@@ -66,7 +76,8 @@ public:
 		/// Fetches the data for the current row
 
 	std::size_t getAffectedRowCount() const;
-		/// get the count of rows affected by the statement
+		/// get the count of rows affected by the statement.
+		/// While rows are streamed, the count of rows received so far.
 
 	std::size_t columnsReturned() const;
 		/// get the count of columns returned by the statement
@@ -82,6 +93,9 @@ public:
 
 private:
 	void clearResults();
+	bool fetchStreamedResult();
+	void cancelStreaming();
+	void checkCachedStatement(PGresult* pPGResult);
 
 	StatementExecutor(const StatementExecutor&);
 	StatementExecutor& operator= (const StatementExecutor&);
@@ -102,6 +116,13 @@ private:
 	OutputParameterVector _outputParameterVector;
 	std::size_t           _currentRow;			// current row of the result
 	std::size_t           _affectedRowCount;
+	bool                  _rowStreaming;
+	std::size_t           _rowStreamingChunkSize;
+	bool                  _streamingActive;     // more streamed results are pending on the connection
+	std::size_t           _resultRowCount;      // count of rows in the current streamed result
+	StatementCache*       _pStatementCache;
+	StatementCache::Entry::Ptr _pCacheEntry;   // the prepared statement, if it can be cached
+	bool                  _cacheable;
 };
 
 
@@ -0,0 +1,319 @@
+//
+// CopyIn.cpp
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyIn
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/PostgreSQL/CopyIn.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
+#include "Poco/Data/PostgreSQL/Utility.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/Timestamp.h"
+#include "Poco/NumberParser.h"
+#include <cstring>
+
+
+namespace
+{
+	// Binary COPY file header: signature, flags field, header extension length.
+	const char COPY_SIGNATURE[] = "PGCOPY\n\377\r\n";
+	const std::size_t COPY_SIGNATURE_LENGTH = 11;
+
+	// PostgreSQL dates and timestamps count from 2000-01-01.
+	const Poco::Int64 POSTGRES_EPOCH_DAYS = 10957;
+	const Poco::Int64 POSTGRES_EPOCH_MICROSECONDS = POSTGRES_EPOCH_DAYS*86400*Poco::Int64(1000000);
+}
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+CopyIn::CopyIn(Poco::Data::Session& session, const std::string& table, const std::vector<std::string>& columns, std::size_t bufferSize):
+	_sessionHandle(*Utility::handle(session)),
+	_columnCount(columns.size()),
+	_bufferSize(bufferSize),
+	_field(0),
+	_rowCount(0),
+	_active(false)
+{
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+	if (columns.empty()) throw Poco::InvalidArgumentException("CopyIn requires at least one column");
+
+	std::string sql("COPY ");
+	sql += table;
+	sql += " (";
+	for (std::vector<std::string>::const_iterator it = columns.begin(); it != columns.end(); ++it)
+	{
+		if (it != columns.begin()) sql += ", ";
+		sql += *it;
+	}
+	sql += ") FROM STDIN (FORMAT binary)";
+
+	PGresult* ptrPGResult = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		ptrPGResult = PQexec(_sessionHandle, sql.c_str());
+	}
+
+	PQResultClear resultClearer(ptrPGResult);
+	if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COPY_IN)
+	{
+		throw StatementException(std::string("postgresql_copy_in error: ") +
+			PQresultErrorMessage(ptrPGResult) + " " + sql,
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+	}
+	_active = true;
+
+	_buffer.reserve(_bufferSize + 1024);
+	_buffer.append(COPY_SIGNATURE, COPY_SIGNATURE_LENGTH);
+	appendInt32(0);
+	appendInt32(0);
+}
+
+
+CopyIn::~CopyIn()
+{
+	try
+	{
+		if (_active) abort();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void CopyIn::append(Poco::Int16 value)
+{
+	beginField(2);
+	appendInt16(value);
+	endField();
+}
+
+
+void CopyIn::append(Poco::Int32 value)
+{
+	beginField(4);
+	appendInt32(value);
+	endField();
+}
+
+
+void CopyIn::append(Poco::Int64 value)
+{
+	beginField(8);
+	appendInt64(value);
+	endField();
+}
+
+
+void CopyIn::append(float value)
+{
+	Poco::Int32 bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	append(bits);
+}
+
+
+void CopyIn::append(double value)
+{
+	Poco::Int64 bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	append(bits);
+}
+
+
+void CopyIn::append(bool value)
+{
+	beginField(1);
+	_buffer += value ? '\1' : '\0';
+	endField();
+}
+
+
+void CopyIn::append(const std::string& value)
+{
+	append(value.data(), value.size());
+}
+
+
+void CopyIn::append(const char* value)
+{
+	append(value, std::strlen(value));
+}
+
+
+void CopyIn::append(const char* value, std::size_t length)
+{
+	beginField(static_cast<Poco::Int32>(length));
+	appendRaw(value, length);
+	endField();
+}
+
+
+void CopyIn::append(const BLOB& value)
+{
+	append(reinterpret_cast<const char*>(value.rawContent()), value.size());
+}
+
+
+void CopyIn::append(const CLOB& value)
+{
+	append(value.rawContent(), value.size());
+}
+
+
+void CopyIn::append(const Date& value)
+{
+	Poco::DateTime dateTime(value.year(), value.month(), value.day());
+	Poco::Int64 days = dateTime.timestamp().epochMicroseconds()/(86400*Poco::Int64(1000000));
+	append(static_cast<Poco::Int32>(days - POSTGRES_EPOCH_DAYS));
+}
+
+
+void CopyIn::append(const Time& value)
+{
+	append(((value.hour()*60 + value.minute())*60 + value.second())*Poco::Int64(1000000));
+}
+
+
+void CopyIn::append(const Poco::DateTime& value)
+{
+	append(value.timestamp().epochMicroseconds() - POSTGRES_EPOCH_MICROSECONDS);
+}
+
+
+void CopyIn::append(const Poco::UUID& value)
+{
+	char bytes[16];
+	value.copyTo(bytes);
+	append(bytes, sizeof(bytes));
+}
+
+
+void CopyIn::appendNull()
+{
+	beginField(-1);
+	endField();
+}
+
+
+std::size_t CopyIn::finish()
+{
+	if (!_active) throw Poco::IllegalStateException("Copy is not in progress");
+	if (_field != 0) throw Poco::IllegalStateException("Last row is incomplete");
+
+	appendInt16(-1);
+	flush();
+
+	_active = false;
+	PGresult* ptrPGResult = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		if (PQputCopyEnd(_sessionHandle, 0) != 1)
+			throw StatementException(std::string("postgresql_copy_in error: ") + PQerrorMessage(_sessionHandle));
+		ptrPGResult = PQgetResult(_sessionHandle);
+		PGresult* ptrNextResult;
+		while ((ptrNextResult = PQgetResult(_sessionHandle)))
+			PQclear(ptrNextResult);
+	}
+
+	PQResultClear resultClearer(ptrPGResult);
+	if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK)
+	{
+		throw StatementException(std::string("postgresql_copy_in error: ") +
+			PQresultErrorMessage(ptrPGResult),
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+	}
+
+	Poco::UInt64 rows = 0;
+	const char* pRowCount = PQcmdTuples(ptrPGResult);
+	if (pRowCount && Poco::NumberParser::tryParseUnsigned64(pRowCount, rows))
+		return static_cast<std::size_t>(rows);
+	return _rowCount;
+}
+
+
+void CopyIn::beginField(Poco::Int32 length)
+{
+	if (!_active) throw Poco::IllegalStateException("Copy is not in progress");
+	if (_field == 0) appendInt16(static_cast<Poco::Int16>(_columnCount));
+	appendInt32(length);
+}
+
+
+void CopyIn::endField()
+{
+	if (++_field == _columnCount)
+	{
+		_field = 0;
+		++_rowCount;
+		if (_buffer.size() >= _bufferSize) flush();
+	}
+}
+
+
+void CopyIn::appendRaw(const void* data, std::size_t length)
+{
+	_buffer.append(static_cast<const char*>(data), length);
+}
+
+
+void CopyIn::appendInt16(Poco::Int16 value)
+{
+	value = Poco::ByteOrder::toNetwork(value);
+	appendRaw(&value, sizeof(value));
+}
+
+
+void CopyIn::appendInt32(Poco::Int32 value)
+{
+	value = Poco::ByteOrder::toNetwork(value);
+	appendRaw(&value, sizeof(value));
+}
+
+
+void CopyIn::appendInt64(Poco::Int64 value)
+{
+	value = Poco::ByteOrder::toNetwork(value);
+	appendRaw(&value, sizeof(value));
+}
+
+
+void CopyIn::flush()
+{
+	if (_buffer.empty()) return;
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	if (PQputCopyData(_sessionHandle, _buffer.data(), static_cast<int>(_buffer.size())) != 1)
+	{
+		throw StatementException(std::string("postgresql_copy_in error: ") + PQerrorMessage(_sessionHandle));
+	}
+	_buffer.clear();
+}
+
+
+void CopyIn::abort()
+{
+	_active = false;
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	PQputCopyEnd(_sessionHandle, "aborted by client");
+	PGresult* ptrPGResult;
+	while ((ptrPGResult = PQgetResult(_sessionHandle)))
+		PQclear(ptrPGResult);
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
@@ -0,0 +1,397 @@
+//
+// CopyOut.cpp
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyOut
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/PostgreSQL/CopyOut.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
+#include "Poco/Data/PostgreSQL/Utility.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Format.h"
+#include <cstring>
+
+
+namespace
+{
+	// Binary COPY file header: signature, flags field, header extension length.
+	const char COPY_SIGNATURE[] = "PGCOPY\n\377\r\n";
+	const std::size_t COPY_SIGNATURE_LENGTH = 11;
+
+	// PostgreSQL dates and timestamps count from 2000-01-01.
+	const Poco::Int64 POSTGRES_EPOCH_DAYS = 10957;
+	const Poco::Int64 POSTGRES_EPOCH_MICROSECONDS = POSTGRES_EPOCH_DAYS*86400*Poco::Int64(1000000);
+
+	template <typename T>
+	T readNetwork(const char* pData)
+	{
+		T value;
+		std::memcpy(&value, pData, sizeof(value));
+		return Poco::ByteOrder::fromNetwork(value);
+	}
+}
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+CopyOut::CopyOut(Poco::Data::Session& session, const std::string& query):
+	_sessionHandle(*Utility::handle(session)),
+	_pBuffer(0),
+	_pCurrent(0),
+	_pEnd(0),
+	_rowCount(0),
+	_headerRead(false),
+	_active(false)
+{
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+	std::string sql("COPY ");
+	if (query.find_first_of(" \t\r\n") == std::string::npos)
+	{
+		sql += query;
+	}
+	else
+	{
+		sql += '(';
+		sql += query;
+		sql += ')';
+	}
+	sql += " TO STDOUT (FORMAT binary)";
+
+	PGresult* ptrPGResult = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		ptrPGResult = PQexec(_sessionHandle, sql.c_str());
+	}
+
+	PQResultClear resultClearer(ptrPGResult);
+	if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COPY_OUT)
+	{
+		throw StatementException(std::string("postgresql_copy_out error: ") +
+			PQresultErrorMessage(ptrPGResult) + " " + sql,
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+	}
+	_active = true;
+}
+
+
+CopyOut::~CopyOut()
+{
+	try
+	{
+		if (_active)
+		{
+			_sessionHandle.cancel();
+			while (receive());
+		}
+	}
+	catch (...)
+	{
+	}
+	clearBuffer();
+}
+
+
+bool CopyOut::next()
+{
+	_fields.clear();
+	if (!_active) return false;
+	if (_pCurrent == _pEnd && !receive()) return false;
+
+	if (!_headerRead)
+	{
+		if (_pEnd - _pCurrent < static_cast<std::ptrdiff_t>(COPY_SIGNATURE_LENGTH + 8) ||
+			std::memcmp(_pCurrent, COPY_SIGNATURE, COPY_SIGNATURE_LENGTH) != 0)
+		{
+			throw DataException("Invalid COPY header");
+		}
+		_pCurrent += COPY_SIGNATURE_LENGTH + 4;
+		Poco::Int32 extensionLength = readNetwork<Poco::Int32>(_pCurrent);
+		_pCurrent += 4;
+		if (extensionLength < 0 || _pEnd - _pCurrent < extensionLength)
+			throw DataException("Invalid COPY header");
+		_pCurrent += extensionLength;
+		_headerRead = true;
+		if (_pCurrent == _pEnd && !receive()) return false;
+	}
+
+	if (_pEnd - _pCurrent < 2) throw DataException("Truncated COPY row");
+	Poco::Int16 count = readNetwork<Poco::Int16>(_pCurrent);
+	_pCurrent += 2;
+	if (count < 0)
+	{
+		// trailer
+		while (receive());
+		return false;
+	}
+
+	for (Poco::Int16 i = 0; i < count; ++i)
+	{
+		if (_pEnd - _pCurrent < 4) throw DataException("Truncated COPY row");
+		Field field;
+		field.length = readNetwork<Poco::Int32>(_pCurrent);
+		_pCurrent += 4;
+		field.pData = _pCurrent;
+		if (field.length > 0)
+		{
+			if (_pEnd - _pCurrent < field.length) throw DataException("Truncated COPY row");
+			_pCurrent += field.length;
+		}
+		_fields.push_back(field);
+	}
+	++_rowCount;
+	return true;
+}
+
+
+bool CopyOut::isNull(std::size_t pos) const
+{
+	return field(pos).length < 0;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Poco::Int16& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 2) throw DataException(Poco::format("Field %z is not a smallint", pos));
+	value = readNetwork<Poco::Int16>(f.pData);
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Poco::Int32& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	switch (f.length)
+	{
+	case 2:
+		value = readNetwork<Poco::Int16>(f.pData);
+		break;
+	case 4:
+		value = readNetwork<Poco::Int32>(f.pData);
+		break;
+	default:
+		throw DataException(Poco::format("Field %z is not an integer", pos));
+	}
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Poco::Int64& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	switch (f.length)
+	{
+	case 2:
+		value = readNetwork<Poco::Int16>(f.pData);
+		break;
+	case 4:
+		value = readNetwork<Poco::Int32>(f.pData);
+		break;
+	case 8:
+		value = readNetwork<Poco::Int64>(f.pData);
+		break;
+	default:
+		throw DataException(Poco::format("Field %z is not a bigint", pos));
+	}
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, float& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 4) throw DataException(Poco::format("Field %z is not a real", pos));
+	Poco::Int32 bits = readNetwork<Poco::Int32>(f.pData);
+	std::memcpy(&value, &bits, sizeof(value));
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, double& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length == 4)
+	{
+		float val;
+		extract(pos, val);
+		value = val;
+		return true;
+	}
+	if (f.length != 8) throw DataException(Poco::format("Field %z is not a double precision", pos));
+	Poco::Int64 bits = readNetwork<Poco::Int64>(f.pData);
+	std::memcpy(&value, &bits, sizeof(value));
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, bool& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 1) throw DataException(Poco::format("Field %z is not a boolean", pos));
+	value = *f.pData != 0;
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, std::string& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	value.assign(f.pData, f.length);
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, BLOB& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	value.assignRaw(reinterpret_cast<const unsigned char*>(f.pData), f.length);
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, CLOB& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	value.assignRaw(f.pData, f.length);
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Date& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 4) throw DataException(Poco::format("Field %z is not a date", pos));
+	Poco::Int64 days = readNetwork<Poco::Int32>(f.pData) + POSTGRES_EPOCH_DAYS;
+	Poco::DateTime dateTime(Poco::Timestamp(days*86400*Poco::Int64(1000000)));
+	value.assign(dateTime.year(), dateTime.month(), dateTime.day());
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Time& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 8) throw DataException(Poco::format("Field %z is not a time", pos));
+	Poco::Int64 seconds = readNetwork<Poco::Int64>(f.pData)/1000000;
+	value.assign(static_cast<int>(seconds/3600), static_cast<int>(seconds/60 % 60), static_cast<int>(seconds % 60));
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Poco::DateTime& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 8) throw DataException(Poco::format("Field %z is not a timestamp", pos));
+	value = Poco::DateTime(Poco::Timestamp(readNetwork<Poco::Int64>(f.pData) + POSTGRES_EPOCH_MICROSECONDS));
+	return true;
+}
+
+
+bool CopyOut::extract(std::size_t pos, Poco::UUID& value) const
+{
+	const Field& f = field(pos);
+	if (f.length < 0) return false;
+	if (f.length != 16) throw DataException(Poco::format("Field %z is not a uuid", pos));
+	value.copyFrom(f.pData);
+	return true;
+}
+
+
+const CopyOut::Field& CopyOut::field(std::size_t pos) const
+{
+	if (pos >= _fields.size())
+		throw Poco::RangeException(Poco::format("Invalid field index: %z", pos));
+	return _fields[pos];
+}
+
+
+bool CopyOut::receive()
+{
+	clearBuffer();
+	if (!_active) return false;
+
+	int length = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		length = PQgetCopyData(_sessionHandle, &_pBuffer, 0);
+	}
+	if (length > 0)
+	{
+		_pCurrent = _pBuffer;
+		_pEnd = _pBuffer + length;
+		return true;
+	}
+	else if (length == -1)
+	{
+		finish();
+		return false;
+	}
+	else
+	{
+		_active = false;
+		throw StatementException(std::string("postgresql_copy_out error: ") + _sessionHandle.lastError());
+	}
+}
+
+
+void CopyOut::finish()
+{
+	_active = false;
+	PGresult* ptrPGResult = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		ptrPGResult = PQgetResult(_sessionHandle);
+		PGresult* ptrNextResult;
+		while ((ptrNextResult = PQgetResult(_sessionHandle)))
+			PQclear(ptrNextResult);
+	}
+
+	PQResultClear resultClearer(ptrPGResult);
+	if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK)
+	{
+		throw StatementException(std::string("postgresql_copy_out error: ") +
+			PQresultErrorMessage(ptrPGResult),
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+	}
+}
+
+
+void CopyOut::clearBuffer()
+{
+	if (_pBuffer)
+	{
+		PQfreemem(_pBuffer);
+		_pBuffer = 0;
+	}
+	_pCurrent = 0;
+	_pEnd = 0;
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
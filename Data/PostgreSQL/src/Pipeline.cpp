@@ -0,0 +1,415 @@
+//
+// Pipeline.cpp
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  Pipeline
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/PostgreSQL/Pipeline.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
+#include "Poco/Data/PostgreSQL/Utility.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/UUID.h"
+#include "Poco/UUIDGenerator.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Format.h"
+#include <algorithm>
+
+
+namespace
+{
+	class ParameterList
+		/// Converts the parameters of a statement into
+		/// the arrays expected by PQsendQueryParams().
+	{
+	public:
+		explicit ParameterList(const Poco::Data::PostgreSQL::Pipeline::Parameters& parameters):
+			_values(parameters.size()),
+			_pointers(parameters.size(), 0),
+			_lengths(parameters.size(), 0),
+			_formats(parameters.size(), 0)
+		{
+			for (std::size_t i = 0; i < parameters.size(); ++i)
+			{
+				const Poco::Dynamic::Var& var = parameters[i];
+				if (var.isEmpty()) continue;
+
+				if (var.type() == typeid(Poco::Data::BLOB))
+				{
+					const Poco::Data::BLOB& blob = var.extract<Poco::Data::BLOB>();
+					_values[i].assign(reinterpret_cast<const char*>(blob.rawContent()), blob.size());
+					_formats[i] = 1;
+				}
+				else if (var.type() == typeid(Poco::Data::Date))
+				{
+					const Poco::Data::Date& date = var.extract<Poco::Data::Date>();
+					_values[i] = Poco::format("%04d-%02d-%02d", date.year(), date.month(), date.day());
+				}
+				else if (var.type() == typeid(Poco::Data::Time))
+				{
+					const Poco::Data::Time& time = var.extract<Poco::Data::Time>();
+					_values[i] = Poco::format("%02d:%02d:%02d", time.hour(), time.minute(), time.second());
+				}
+				else
+				{
+					_values[i] = var.convert<std::string>();
+				}
+				_pointers[i] = _values[i].data();
+				_lengths[i] = static_cast<int>(_values[i].size());
+			}
+		}
+
+		int count() const
+		{
+			return static_cast<int>(_values.size());
+		}
+
+		const char* const* values() const
+		{
+			return _pointers.empty() ? 0 : &_pointers[0];
+		}
+
+		const int* lengths() const
+		{
+			return _lengths.empty() ? 0 : &_lengths[0];
+		}
+
+		const int* formats() const
+		{
+			return _formats.empty() ? 0 : &_formats[0];
+		}
+
+	private:
+		std::vector<std::string> _values;
+		std::vector<const char*> _pointers;
+		std::vector<int>         _lengths;
+		std::vector<int>         _formats;
+	};
+
+
+	void fillResult(PGresult* pPGResult, Poco::Data::PostgreSQL::Pipeline::Result& result)
+	{
+		switch (PQresultStatus(pPGResult))
+		{
+		case PGRES_TUPLES_OK:
+			{
+				int columnCount = PQnfields(pPGResult);
+				int rowCount = PQntuples(pPGResult);
+				result.columns.reserve(columnCount);
+				for (int c = 0; c < columnCount; ++c)
+				{
+					result.columns.push_back(PQfname(pPGResult, c));
+				}
+				result.rows.resize(rowCount);
+				for (int r = 0; r < rowCount; ++r)
+				{
+					result.rows[r].resize(columnCount);
+					for (int c = 0; c < columnCount; ++c)
+					{
+						if (!PQgetisnull(pPGResult, r, c))
+							result.rows[r][c] = std::string(PQgetvalue(pPGResult, r, c), PQgetlength(pPGResult, r, c));
+					}
+				}
+				result.affectedRows = rowCount;
+				result.ok = true;
+			}
+			break;
+		case PGRES_COMMAND_OK:
+			{
+				Poco::UInt64 rows = 0;
+				const char* pRowCount = PQcmdTuples(pPGResult);
+				if (pRowCount && Poco::NumberParser::tryParseUnsigned64(pRowCount, rows))
+					result.affectedRows = static_cast<std::size_t>(rows);
+				result.ok = true;
+			}
+			break;
+		case PGRES_PIPELINE_ABORTED:
+			result.ok = false;
+			result.error = "aborted";
+			break;
+		default:
+			result.ok = false;
+			result.error = PQresultErrorMessage(pPGResult);
+			if (const char* pSQLState = PQresultErrorField(pPGResult, PG_DIAG_SQLSTATE))
+				result.sqlState = pSQLState;
+			break;
+		}
+	}
+}
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+Pipeline::Pipeline(Poco::Data::Session& session, std::size_t maxPending):
+	_sessionHandle(*Utility::handle(session)),
+	_maxPending(maxPending > 0 ? maxPending : 1),
+	_syncing(false),
+	_syncAsync(this, &Pipeline::runSync)
+{
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+#ifdef LIBPQ_HAS_PIPELINING
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	if (PQenterPipelineMode(_sessionHandle) != 1)
+	{
+		throw StatementException(std::string("postgresql_pipeline error: ") + PQerrorMessage(_sessionHandle));
+	}
+#else
+	throw Poco::NotImplementedException("Pipeline mode requires libpq 14 or newer");
+#endif
+}
+
+
+Pipeline::~Pipeline()
+{
+	if (_pSyncResult)
+	{
+		// the background thread uses the Pipeline until it is done
+		_pSyncResult->wait();
+	}
+
+#ifdef LIBPQ_HAS_PIPELINING
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	try
+	{
+		syncSegment();
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		PQexitPipelineMode(_sessionHandle);
+	}
+	catch (...)
+	{
+	}
+	for (std::vector<std::string>::const_iterator it = _statementNames.begin(); it != _statementNames.end(); ++it)
+	{
+		try
+		{
+			// fails for statements the server has rejected
+			_sessionHandle.deallocatePreparedStatement(*it);
+		}
+		catch (...)
+		{
+		}
+	}
+#endif
+}
+
+
+std::size_t Pipeline::prepare(const std::string& sql)
+{
+	Poco::UUIDGenerator& generator = Poco::UUIDGenerator::defaultGenerator();
+	Poco::UUID uuid(generator.create()); // time based
+	std::string statementName = uuid.toString();
+	statementName.insert(0, 1, 'p'); // prepared statement names can't start with a number
+	std::replace(statementName.begin(), statementName.end(), '-', 'p');  // PostgreSQL doesn't like dashes in prepared statement names
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		send(PQsendPrepare(_sessionHandle, statementName.c_str(), sql.c_str(), 0, 0));
+	}
+	_statementNames.push_back(statementName);
+	enqueue(REQUEST_PREPARE);
+	return _statementNames.size() - 1;
+}
+
+
+void Pipeline::execute(std::size_t statement, const Parameters& parameters)
+{
+	ParameterList parameterList(parameters);
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	if (statement >= _statementNames.size())
+		throw Poco::InvalidArgumentException(Poco::format("Invalid statement: %z", statement));
+
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		send(PQsendQueryPrepared(_sessionHandle,
+			_statementNames[statement].c_str(),
+			parameterList.count(),
+			parameterList.values(),
+			parameterList.lengths(),
+			parameterList.formats(),
+			0));
+	}
+	enqueue(REQUEST_EXECUTE);
+}
+
+
+void Pipeline::execute(const std::string& sql, const Parameters& parameters)
+{
+	ParameterList parameterList(parameters);
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		send(PQsendQueryParams(_sessionHandle,
+			sql.c_str(),
+			parameterList.count(),
+			0,
+			parameterList.values(),
+			parameterList.lengths(),
+			parameterList.formats(),
+			0));
+	}
+	enqueue(REQUEST_EXECUTE);
+}
+
+
+std::size_t Pipeline::pending() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	return _results.size() + std::count(_segment.begin(), _segment.end(), REQUEST_EXECUTE);
+}
+
+
+Pipeline::Results Pipeline::sync()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	return syncResults();
+}
+
+
+Poco::ActiveResult<Pipeline::Results> Pipeline::syncAsync()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	checkIdle();
+	_syncing = true;
+	try
+	{
+		_pSyncResult.reset(new Poco::ActiveResult<Results>(_syncAsync()));
+	}
+	catch (...)
+	{
+		_syncing = false;
+		throw;
+	}
+	return *_pSyncResult;
+}
+
+
+void Pipeline::checkIdle() const
+{
+	if (_syncing)
+		throw Poco::InvalidAccessException("Pipeline results are being collected by syncAsync()");
+}
+
+
+Pipeline::Results Pipeline::runSync()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	try
+	{
+		Results results = syncResults();
+		_syncing = false;
+		return results;
+	}
+	catch (...)
+	{
+		_syncing = false;
+		throw;
+	}
+}
+
+
+Pipeline::Results Pipeline::syncResults()
+{
+	syncSegment();
+
+	Results results;
+	results.swap(_results);
+	if (!_prepareError.empty())
+	{
+		std::string error;
+		std::string sqlState;
+		error.swap(_prepareError);
+		sqlState.swap(_prepareSqlState);
+		throw StatementException(std::string("postgresql_stmt_prepare error: ") + error, sqlState.c_str());
+	}
+	return results;
+}
+
+
+void Pipeline::enqueue(Request request)
+{
+	_segment.push_back(request);
+	if (_segment.size() >= _maxPending) syncSegment();
+}
+
+
+void Pipeline::syncSegment()
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	if (_segment.empty()) return;
+
+	std::vector<Request> segment;
+	segment.swap(_segment);
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	send(PQpipelineSync(_sessionHandle));
+
+	for (std::vector<Request>::const_iterator it = segment.begin(); it != segment.end(); ++it)
+	{
+		PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+		if (!ptrPGResult)
+		{
+			throw StatementException(std::string("postgresql_pipeline error: ") + PQerrorMessage(_sessionHandle));
+		}
+
+		Result result;
+		do
+		{
+			PQResultClear resultClearer(ptrPGResult);
+			if (*it == REQUEST_EXECUTE)
+			{
+				fillResult(ptrPGResult, result);
+			}
+			else if (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
+				PQresultStatus(ptrPGResult) != PGRES_PIPELINE_ABORTED &&
+				_prepareError.empty())
+			{
+				_prepareError = PQresultErrorMessage(ptrPGResult);
+				if (const char* pSQLState = PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE))
+					_prepareSqlState = pSQLState;
+			}
+		}
+		while ((ptrPGResult = PQgetResult(_sessionHandle)));
+
+		if (*it == REQUEST_EXECUTE) _results.push_back(result);
+	}
+
+	PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+	PQResultClear resultClearer(ptrPGResult);
+	if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_PIPELINE_SYNC)
+	{
+		throw StatementException(std::string("postgresql_pipeline error: ") + PQerrorMessage(_sessionHandle));
+	}
+#endif
+}
+
+
+void Pipeline::send(int rc)
+{
+	if (rc != 1)
+	{
+		throw StatementException(std::string("postgresql_pipeline error: ") + PQerrorMessage(_sessionHandle));
+	}
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
@@ -23,7 +23,9 @@ namespace PostgreSQL {
 
 PostgreSQLStatementImpl::PostgreSQLStatementImpl(SessionImpl& aSessionImpl):
 	Poco::Data::StatementImpl(aSessionImpl),
-	_statementExecutor(aSessionImpl.handle(), aSessionImpl.isBinaryExtraction()),
+	_statementExecutor(aSessionImpl.handle(), aSessionImpl.isBinaryExtraction(),
+		aSessionImpl.isRowStreaming(), Poco::AnyCast<std::size_t>(aSessionImpl.getRowStreamingChunkSize()),
+		&aSessionImpl.statementCache()),
 	_pBinder(new Binder),
 	_hasNext(NEXT_DONTKNOW)
 {
@@ -145,11 +145,22 @@ void SessionImpl::open(const std::string& aConnectionString)
 	addFeature("binaryExtraction",
 		&SessionImpl::setBinaryExtraction,
 		&SessionImpl::isBinaryExtraction);
+
+	addFeature("rowStreaming",
+		&SessionImpl::setRowStreaming,
+		&SessionImpl::isRowStreaming);
+
+	addProperty("rowStreamingChunkSize",
+		&SessionImpl::setRowStreamingChunkSize,
+		&SessionImpl::getRowStreamingChunkSize);
+
+	addStatementCacheProperties();
 }
 
 
 void SessionImpl::close()
 {
+	statementCache().clear();
 	if (isConnected())
 	{
 		_sessionHandle.disconnect();
@@ -261,4 +272,14 @@ void SessionImpl::setBinaryExtraction(const std::string& feature, bool enabled)
 }
 
 
+void SessionImpl::setRowStreamingChunkSize(const std::string&, const Poco::Any& value)
+{
+	std::size_t chunkSize = Poco::RefAnyCast<std::size_t>(value);
+	if (chunkSize == 0)
+		throw Poco::InvalidArgumentException("rowStreamingChunkSize must be greater than zero");
+
+	_rowStreamingChunkSize = chunkSize;
+}
+
+
 } } } // namespace Poco::Data::PostgreSQL
@@ -22,6 +22,7 @@
 #include "Poco/RegularExpression.h"
 #include <algorithm>
 #include <set>
+#include <cstring>
 
 
 namespace
@@ -64,6 +65,80 @@ namespace
 
 		return placeholderSet.size();
 	}
+
+
+	void throwExecuteError(PGresult* pPGResult)
+	{
+		Poco::Data::PostgreSQL::PQResultClear resultClearer(pPGResult);
+
+		const char* pSeverity	= PQresultErrorField(pPGResult, PG_DIAG_SEVERITY);
+		const char* pSQLState	= PQresultErrorField(pPGResult, PG_DIAG_SQLSTATE);
+		const char* pDetail		= PQresultErrorField(pPGResult, PG_DIAG_MESSAGE_DETAIL);
+		const char* pHint		= PQresultErrorField(pPGResult, PG_DIAG_MESSAGE_HINT);
+		const char* pConstraint	= PQresultErrorField(pPGResult, PG_DIAG_CONSTRAINT_NAME);
+
+		throw Poco::Data::PostgreSQL::StatementException(std::string("postgresql_stmt_execute error: ")
+			+ PQresultErrorMessage (pPGResult)
+			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
+			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
+			+ " Detail: " + (pDetail ? pDetail : "N/A")
+			+ " Hint: " + (pHint   ? pHint   : "N/A")
+			+ " Constraint: " + (pConstraint ? pConstraint : "N/A"),pSQLState);
+	}
+
+
+	class CachedStatement: public Poco::Data::StatementCache::Entry
+		/// A prepared statement in the session's StatementCache,
+		/// with the metadata determined when it was prepared.
+	{
+	public:
+		CachedStatement(Poco::Data::PostgreSQL::SessionHandle& sessionHandle,
+			const std::string& name,
+			std::size_t countPlaceholders,
+			const std::vector<Poco::Data::MetaColumn>& resultColumns):
+			_sessionHandle(sessionHandle),
+			_name(name),
+			_countPlaceholders(countPlaceholders),
+			_resultColumns(resultColumns)
+		{
+		}
+
+		const std::string& name() const
+		{
+			return _name;
+		}
+
+		std::size_t countPlaceholders() const
+		{
+			return _countPlaceholders;
+		}
+
+		const std::vector<Poco::Data::MetaColumn>& resultColumns() const
+		{
+			return _resultColumns;
+		}
+
+	protected:
+		~CachedStatement()
+		{
+			try
+			{
+				if (_sessionHandle.isConnected())
+				{
+					_sessionHandle.deallocatePreparedStatement(_name);
+				}
+			}
+			catch (...)
+			{
+			}
+		}
+
+	private:
+		Poco::Data::PostgreSQL::SessionHandle& _sessionHandle;
+		std::string _name;
+		std::size_t _countPlaceholders;
+		std::vector<Poco::Data::MetaColumn> _resultColumns;
+	};
 } // namespace
 
 
@@ -72,14 +147,21 @@ namespace Data {
 namespace PostgreSQL {
 
 
-StatementExecutor::StatementExecutor(SessionHandle& sessionHandle, bool binaryExtraction):
+StatementExecutor::StatementExecutor(SessionHandle& sessionHandle, bool binaryExtraction, bool rowStreaming, std::size_t rowStreamingChunkSize,
+	StatementCache* pStatementCache):
 	_sessionHandle(sessionHandle),
 	_binaryExtraction(binaryExtraction),
 	_state(STMT_INITED),
 	_pResultHandle(0),
 	_countPlaceholdersInSQLStatement(0),
 	_currentRow(0),
-	_affectedRowCount(0)
+	_affectedRowCount(0),
+	_rowStreaming(rowStreaming),
+	_rowStreamingChunkSize(rowStreamingChunkSize),
+	_streamingActive(false),
+	_resultRowCount(0),
+	_pStatementCache(pStatementCache),
+	_cacheable(false)
 {
 }
 
@@ -88,8 +170,19 @@ StatementExecutor::~StatementExecutor()
 {
 	try
 	{
+		clearResults();
+
+		if (_pCacheEntry)
+		{
+			// the entry deallocates the prepared statement if it is not cached
+			if (_cacheable && _sessionHandle.isConnected())
+			{
+				_pStatementCache->put(_SQLStatement, _pCacheEntry);
+			}
+			_pCacheEntry.reset();
+		}
 		// remove the prepared statement from the session
-		if(_sessionHandle.isConnected() && _state >= STMT_COMPILED)
+		else if(_sessionHandle.isConnected() && _state >= STMT_COMPILED)
 		{
 			_sessionHandle.deallocatePreparedStatement(_preparedStatementName);
 		}
@@ -122,6 +215,24 @@ void StatementExecutor::prepare(const std::string& aSQLStatement)
 	// clear out any result data.  One way or another it is now obsolete.
 	clearResults();
 
+	bool useCache = _pStatementCache && _pStatementCache->isEnabled();
+	if (useCache)
+	{
+		StatementCache::Entry::Ptr pEntry = _pStatementCache->take(aSQLStatement);
+		if (pEntry)
+		{
+			const CachedStatement& cachedStatement = static_cast<const CachedStatement&>(*pEntry);
+			_resultColumns = cachedStatement.resultColumns();
+			_SQLStatement = aSQLStatement;
+			_preparedStatementName = cachedStatement.name();
+			_countPlaceholdersInSQLStatement = cachedStatement.countPlaceholders();
+			_pCacheEntry = pEntry;
+			_cacheable = true;
+			_state = STMT_COMPILED;  // must be last
+			return;
+		}
+	}
+
 	// prepare parameters for the call to PQprepare
 	const char* ptrCSQLStatement = aSQLStatement.c_str();
 	std::size_t countPlaceholdersInSQLStatement = countOfPlaceHoldersInSQLStatement(aSQLStatement);
@@ -189,6 +300,12 @@ void StatementExecutor::prepare(const std::string& aSQLStatement)
 	_SQLStatement = aSQLStatement;
 	_preparedStatementName = statementName;
 	_countPlaceholdersInSQLStatement = countPlaceholdersInSQLStatement;
+	if (useCache)
+	{
+		_pCacheEntry = new CachedStatement(_sessionHandle, statementName, countPlaceholdersInSQLStatement, _resultColumns);
+		_pStatementCache->stamp(*_pCacheEntry);
+		_cacheable = true;
+	}
 	_state = STMT_COMPILED;  // must be last
 }
 
@@ -254,6 +371,39 @@ void StatementExecutor::execute()
 	// clear out any result data.  One way or another it is now obsolete.
 	clearResults();
 
+	if (_rowStreaming && columnsReturned() > 0)
+	{
+		{
+			Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+			if (PQsendQueryPrepared(_sessionHandle,
+				_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+				_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : 0,
+				_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : 0,
+				_binaryExtraction ? 1 : 0) != 1)
+			{
+				throw StatementException(std::string("postgresql_stmt_execute error: ") + PQerrorMessage(_sessionHandle));
+			}
+
+#ifdef LIBPQ_HAS_CHUNK_MODE
+			if (_rowStreamingChunkSize > 1)
+				PQsetChunkedRowsMode(_sessionHandle, static_cast<int>(_rowStreamingChunkSize));
+			else
+				PQsetSingleRowMode(_sessionHandle);
+#else
+			PQsetSingleRowMode(_sessionHandle);
+#endif
+		}
+
+		// receive the first rows, so that errors are reported by execute()
+		_streamingActive = true;
+		fetchStreamedResult();
+
+		_state = STMT_EXECUTED;
+		return;
+	}
+
 	PGresult* ptrPGResult = 0;
 	{
 		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
@@ -271,22 +421,8 @@ void StatementExecutor::execute()
 	if (!ptrPGResult || (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
 		PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK))
 	{
-		PQResultClear resultClearer(ptrPGResult);
-
-		const char* pSeverity	= PQresultErrorField(ptrPGResult, PG_DIAG_SEVERITY);
-		const char* pSQLState	= PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE);
-		const char* pDetail		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_DETAIL);
-		const char* pHint		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_HINT);
-		const char* pConstraint	= PQresultErrorField(ptrPGResult, PG_DIAG_CONSTRAINT_NAME);
-
-                
-		throw StatementException(std::string("postgresql_stmt_execute error: ")
-			+ PQresultErrorMessage (ptrPGResult)
-			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
-			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
-			+ " Detail: " + (pDetail ? pDetail : "N/A")
-			+ " Hint: " + (pHint   ? pHint   : "N/A")
-			+ " Constraint: " + (pConstraint ? pConstraint : "N/A"),pSQLState);
+		checkCachedStatement(ptrPGResult);
+		throwExecuteError(ptrPGResult);
 	}
 
 	_pResultHandle = ptrPGResult;
@@ -345,15 +481,26 @@ bool StatementExecutor::fetch()
 		_outputParameterVector.resize(countColumns);
 	}
 
-	// already retrieved last row?
-	if (_currentRow == getAffectedRowCount())
+	if (_rowStreaming)
 	{
-		return false;
+		// retrieved last row of the current streamed result?
+		if (_currentRow == _resultRowCount && !fetchStreamedResult())
+		{
+			return false;
+		}
 	}
-
-	if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+	else
 	{
-		return false;
+		// already retrieved last row?
+		if (_currentRow == getAffectedRowCount())
+		{
+			return false;
+		}
+
+		if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+		{
+			return false;
+		}
 	}
 
 	for (int i = 0; i < countColumns; ++i)
@@ -371,6 +518,7 @@ bool StatementExecutor::fetch()
 	}
 
 	++_currentRow;
+	if (_rowStreaming) ++_affectedRowCount;
 	return true;
 }
 
@@ -414,11 +562,102 @@ void StatementExecutor::clearResults()
 	// clear out any old result first
 	{
 		PQResultClear resultClearer(_pResultHandle);
+		_pResultHandle = 0;
 	}
 
+	if (_streamingActive) cancelStreaming();
+
 	_outputParameterVector.clear();
 	_affectedRowCount	= 0;
 	_currentRow			= 0;
+	_resultRowCount		= 0;
+}
+
+
+bool StatementExecutor::fetchStreamedResult()
+{
+	{
+		PQResultClear resultClearer(_pResultHandle);
+		_pResultHandle = 0;
+	}
+	_currentRow = 0;
+	_resultRowCount = 0;
+
+	if (!_streamingActive) return false;
+
+	PGresult* ptrPGResult = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		ptrPGResult = PQgetResult(_sessionHandle);
+	}
+
+	if (ptrPGResult)
+	{
+		ExecStatusType status = PQresultStatus(ptrPGResult);
+#ifdef LIBPQ_HAS_CHUNK_MODE
+		if (status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_CHUNK)
+#else
+		if (status == PGRES_SINGLE_TUPLE)
+#endif
+		{
+			_pResultHandle = ptrPGResult;
+			_resultRowCount = static_cast<std::size_t>(PQntuples(ptrPGResult));
+			return true;
+		}
+	}
+
+	// the final result of the query is either an empty result or an error
+	_streamingActive = false;
+	if (!ptrPGResult)
+	{
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + _sessionHandle.lastError());
+	}
+
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		PGresult* ptrNextResult;
+		while ((ptrNextResult = PQgetResult(_sessionHandle)))
+			PQclear(ptrNextResult);
+	}
+
+	if (PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK)
+	{
+		checkCachedStatement(ptrPGResult);
+		throwExecuteError(ptrPGResult);
+	}
+	PQclear(ptrPGResult);
+	return false;
+}
+
+
+void StatementExecutor::cancelStreaming()
+{
+	// Cancelling would abort a transaction in progress,
+	// so in a transaction the remaining rows are discarded.
+	_streamingActive = false;
+	if (!_sessionHandle.isConnected()) return;
+	if (!_sessionHandle.isTransaction()) _sessionHandle.cancel();
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	PGresult* ptrPGResult;
+	while ((ptrPGResult = PQgetResult(_sessionHandle)))
+		PQclear(ptrPGResult);
+}
+
+
+void StatementExecutor::checkCachedStatement(PGresult* pPGResult)
+{
+	// The server rejects a prepared statement whose result columns have been
+	// changed by a schema change (0A000), or which no longer exists (26000).
+	// Either way, the statements in the cache can't be trusted anymore.
+	if (!_pCacheEntry) return;
+
+	const char* pSQLState = PQresultErrorField(pPGResult, PG_DIAG_SQLSTATE);
+	if (pSQLState && (std::strcmp(pSQLState, "0A000") == 0 || std::strcmp(pSQLState, "26000") == 0))
+	{
+		_cacheable = false;
+		_pStatementCache->clear();
+	}
 }
 
 
@@ -18,10 +18,14 @@
 #include "Poco/NamedTuple.h"
 #include "Poco/Exception.h"
 #include "Poco/Data/LOB.h"
+#include "Poco/Data/RecordSet.h"
 #include "Poco/Data/StatementImpl.h"
 #include "Poco/Data/PostgreSQL/Connector.h"
 #include "Poco/Data/PostgreSQL/Utility.h"
 #include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/CopyIn.h"
+#include "Poco/Data/PostgreSQL/CopyOut.h"
+#include "Poco/Data/PostgreSQL/Pipeline.h"
 #include "Poco/Nullable.h"
 #include "Poco/Data/DataException.h"
 #include <iostream>
@@ -32,6 +36,9 @@ using namespace Poco::Data::Keywords;
 using Poco::Data::PostgreSQL::ConnectionException;
 using Poco::Data::PostgreSQL::Utility;
 using Poco::Data::PostgreSQL::StatementException;
+using Poco::Data::PostgreSQL::CopyIn;
+using Poco::Data::PostgreSQL::CopyOut;
+using Poco::Data::PostgreSQL::Pipeline;
 using Poco::format;
 using Poco::NotFoundException;
 using Poco::Int32;
@@ -1069,6 +1076,403 @@ void PostgreSQLTest::testBinaryBLOBStmt()
 	_pExecutor->blobStmt();
 }
 
+void PostgreSQLTest::testCopyIn()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	std::vector<Poco::Int64> ids;
+	std::vector<std::string> names;
+	std::vector<double> scores;
+	std::vector<bool> flags;
+	for (int i = 0; i < 10000; ++i)
+	{
+		ids.push_back(i);
+		names.push_back(format("name %d", i));
+		scores.push_back(i*0.5);
+		flags.push_back(i % 2 == 0);
+	}
+
+	{
+		CopyIn copy(*_pSession, "CopyTest", {"Id", "Name", "Score", "Flag"}, 1024);
+		copy.appendColumns(ids, names, scores, flags);
+		assertTrue (copy.rowCount() == 10000);
+		assertTrue (copy.finish() == 10000);
+	}
+
+	{
+		CopyIn copy(*_pSession, "CopyTest", {"Id", "Name", "Born", "Seen"});
+		copy << Poco::Int64(-1) << "Simpson" << Date(1980, 5, 12) << Poco::DateTime(2023, 1, 2, 3, 4, 5, 6, 7);
+		copy << Poco::Int64(-2) << Nullable<std::string>() << Date(1999, 12, 31) << Poco::DateTime(1970, 1, 1);
+		assertTrue (copy.finish() == 2);
+	}
+
+	std::size_t count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 10002);
+
+	std::string name;
+	double score = 0;
+	bool flag = false;
+	*_pSession << "SELECT Name, Score, Flag FROM CopyTest WHERE Id = 4711", into(name), into(score), into(flag), now;
+	assertTrue (name == "name 4711");
+	assertTrue (score == 2355.5);
+	assertTrue (!flag);
+
+	Date born;
+	Poco::DateTime seen;
+	*_pSession << "SELECT Born, Seen FROM CopyTest WHERE Id = -1", into(born), into(seen), now;
+	assertTrue (born == Date(1980, 5, 12));
+	assertTrue (seen == Poco::DateTime(2023, 1, 2, 3, 4, 5, 6, 7));
+
+	Nullable<std::string> nullName("x");
+	*_pSession << "SELECT Name FROM CopyTest WHERE Id = -2", into(nullName), now;
+	assertTrue (nullName.isNull());
+}
+
+
+void PostgreSQLTest::testCopyInAbort()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	{
+		CopyIn copy(*_pSession, "CopyTest", {"Id", "Name"});
+		copy << Poco::Int64(1) << "one";
+		copy << Poco::Int64(2);
+		try
+		{
+			copy.finish();
+			fail ("incomplete row - must throw");
+		}
+		catch (Poco::IllegalStateException&)
+		{
+		}
+	}
+
+	try
+	{
+		CopyIn copy(*_pSession, "CopyTest", {"Id", "Name"});
+		copy << "not a bigint" << "one";
+		copy.finish();
+		fail ("wrong type - must throw");
+	}
+	catch (StatementException&)
+	{
+	}
+
+	std::size_t count = 1;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 0);
+}
+
+
+void PostgreSQLTest::testCopyOut()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		*_pSession << "INSERT INTO CopyTest (Id, Name, Score, Flag) VALUES ($1, $2, $3, $4)",
+			bind(Poco::Int64(i)), bind(format("name %d", i)), bind(i*0.25), bind(i % 3 == 0), now;
+	}
+	*_pSession << "INSERT INTO CopyTest (Id, Born, Seen) VALUES (-1, '1980-05-12', '2023-01-02 03:04:05.006007')", now;
+
+	{
+		CopyOut copy(*_pSession, "SELECT Id, Name, Score, Flag FROM CopyTest WHERE Id >= 0 ORDER BY Id");
+		std::vector<Poco::Int64> ids;
+		std::vector<std::string> names;
+		std::vector<double> scores;
+		std::vector<bool> flags;
+		assertTrue (copy.extractColumns(ids, names, scores, flags) == 1000);
+		assertTrue (ids[999] == 999);
+		assertTrue (names[12] == "name 12");
+		assertTrue (scores[10] == 2.5);
+		assertTrue (flags[3] && !flags[4]);
+		assertTrue (!copy.next());
+	}
+
+	{
+		CopyOut copy(*_pSession, "SELECT Id, Name, Born, Seen FROM CopyTest WHERE Id = -1");
+		assertTrue (copy.next());
+		assertTrue (copy.fieldCount() == 4);
+		Poco::Int32 id = 0;
+		try
+		{
+			copy.extract(0, id);
+			fail ("bigint into Int32 - must throw");
+		}
+		catch (DataException&)
+		{
+		}
+		Poco::Int64 id64 = 0;
+		assertTrue (copy.extract(0, id64) && id64 == -1);
+		assertTrue (copy.isNull(1));
+		Nullable<std::string> name("x");
+		assertTrue (!copy.extract(1, name));
+		assertTrue (name.isNull());
+		Date born;
+		assertTrue (copy.extract(2, born));
+		assertTrue (born == Date(1980, 5, 12));
+		Poco::DateTime seen;
+		assertTrue (copy.extract(3, seen));
+		assertTrue (seen == Poco::DateTime(2023, 1, 2, 3, 4, 5, 6, 7));
+		assertTrue (!copy.next());
+		assertTrue (copy.rowCount() == 1);
+	}
+
+	{
+		// abandon the copy after the first row
+		CopyOut copy(*_pSession, "CopyTest");
+		assertTrue (copy.next());
+	}
+
+	std::size_t count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 1001);
+}
+
+
+void PostgreSQLTest::testPipeline()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	{
+		Pipeline pipeline(*_pSession, 64);
+		std::size_t insert = pipeline.prepare("INSERT INTO CopyTest (Id, Name, Score, Flag, Born) VALUES ($1, $2, $3, $4, $5)");
+		for (int i = 0; i < 200; ++i)
+		{
+			pipeline.execute(insert, {Poco::Int64(i), format("name %d", i), i*0.5, i % 2 == 0, Poco::Dynamic::Var()});
+		}
+		pipeline.execute(insert, {Poco::Int64(-1), "born", 0.0, false, Date(1980, 5, 12)});
+		pipeline.execute("UPDATE CopyTest SET Score = Score + 1 WHERE Id < $1", {Poco::Int64(10)});
+		pipeline.execute("SELECT Id, Name, Born FROM CopyTest WHERE Id IN (-1, 3) ORDER BY Id");
+		assertTrue (pipeline.pending() == 203);
+
+		Pipeline::Results results = pipeline.sync();
+		assertTrue (pipeline.pending() == 0);
+		assertTrue (results.size() == 203);
+		for (int i = 0; i < 201; ++i)
+		{
+			assertTrue (results[i].ok);
+			assertTrue (results[i].affectedRows == 1);
+		}
+		assertTrue (results[201].ok);
+		assertTrue (results[201].affectedRows == 10);
+
+		const Pipeline::Result& select = results[202];
+		assertTrue (select.ok);
+		assertTrue (select.columns.size() == 3);
+		assertTrue (select.columns[1] == "name");
+		assertTrue (select.rows.size() == 2);
+		assertTrue (select.rows[0][0].value() == "-1");
+		assertTrue (select.rows[0][2].value() == "1980-05-12");
+		assertTrue (select.rows[1][1].value() == "name 3");
+		assertTrue (select.rows[1][2].isNull());
+
+		pipeline.execute("INSERT INTO NoSuchTable VALUES (1)");
+		pipeline.execute(insert, {Poco::Int64(1000), "skipped", 0.0, false, Poco::Dynamic::Var()});
+		results = pipeline.sync();
+		assertTrue (results.size() == 2);
+		assertTrue (!results[0].ok);
+		assertTrue (results[0].sqlState == "42P01");
+		assertTrue (!results[1].ok);
+		assertTrue (results[1].error == "aborted");
+
+		pipeline.prepare("SELECT FROM WHERE");
+		try
+		{
+			pipeline.sync();
+			fail ("invalid statement - must throw");
+		}
+		catch (StatementException&)
+		{
+		}
+	}
+
+	std::size_t count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 201);
+	double score = 0;
+	*_pSession << "SELECT Score FROM CopyTest WHERE Id = 4", into(score), now;
+	assertTrue (score == 3.0);
+}
+
+
+void PostgreSQLTest::testPipelineAsync()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	{
+		Pipeline pipeline(*_pSession);
+		std::size_t insert = pipeline.prepare("INSERT INTO CopyTest (Id, Name) VALUES ($1, $2)");
+		for (int i = 0; i < 100; ++i)
+		{
+			pipeline.execute(insert, {Poco::Int64(i), format("name %d", i)});
+		}
+		pipeline.execute("SELECT COUNT(*) FROM CopyTest");
+
+		Poco::ActiveResult<Pipeline::Results> result = pipeline.syncAsync();
+		result.wait();
+		assertTrue (!result.failed());
+		const Pipeline::Results& results = result.data();
+		assertTrue (results.size() == 101);
+		assertTrue (results[100].rows[0][0].value() == "100");
+	}
+
+	std::size_t count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 100);
+
+	{
+		// the destructor waits for the results
+		Pipeline pipeline(*_pSession);
+		pipeline.execute("DELETE FROM CopyTest");
+		pipeline.syncAsync();
+	}
+
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 0);
+}
+
+
+void PostgreSQLTest::testRowStreaming()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	{
+		CopyIn copy(*_pSession, "CopyTest", {"Id", "Name"});
+		for (int i = 0; i < 1000; ++i)
+		{
+			copy << Poco::Int64(i) << format("name %d", i);
+		}
+		copy.finish();
+	}
+
+	_pSession->setFeature("rowStreaming", true);
+	assertTrue (_pSession->getFeature("rowStreaming"));
+
+	{
+		std::vector<Poco::Int64> ids;
+		std::vector<std::string> names;
+		Statement stmt = (*_pSession << "SELECT Id, Name FROM CopyTest ORDER BY Id", into(ids), into(names), limit(100));
+		std::size_t chunks = 0;
+		std::size_t total = 0;
+		while (!stmt.done())
+		{
+			std::size_t rows = stmt.execute();
+			if (rows == 0) break;
+			assertTrue (rows == 100);
+			assertTrue (ids.size() == 100);
+			assertTrue (ids[0] == Poco::Int64(total));
+			assertTrue (names[99] == format("name %d", int(total + 99)));
+			total += rows;
+			++chunks;
+		}
+		assertTrue (chunks == 10);
+		assertTrue (total == 1000);
+	}
+
+	{
+		Statement stmt = (*_pSession << "SELECT Id, Name FROM CopyTest WHERE Id < 250 ORDER BY Id", limit(100));
+		std::size_t total = 0;
+		while (!stmt.done())
+		{
+			stmt.execute();
+			RecordSet rs(stmt);
+			for (RecordSet::Iterator it = rs.begin(); it != rs.end(); ++it)
+			{
+				assertTrue (it->get(0) == Poco::Int64(total));
+				++total;
+			}
+		}
+		assertTrue (total == 250);
+	}
+
+	{
+		// abandon the statement after the first chunk
+		std::vector<Poco::Int64> ids;
+		Statement stmt = (*_pSession << "SELECT Id FROM CopyTest", into(ids), limit(10));
+		assertTrue (stmt.execute() == 10);
+	}
+
+	std::size_t count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 1000);
+
+	try
+	{
+		// the error is reported by the server after rows have been received
+		std::vector<Poco::Int64> values;
+		*_pSession << "SELECT 1000/(500 - Id) FROM CopyTest", into(values), now;
+		fail ("division by zero - must throw");
+	}
+	catch (StatementException& exc)
+	{
+		assertTrue (std::string(exc.sqlState()) == "22012");
+	}
+
+	count = 0;
+	*_pSession << "SELECT COUNT(*) FROM CopyTest WHERE Id < 10", into(count), now;
+	assertTrue (count == 10);
+
+	_pSession->setFeature("rowStreaming", false);
+}
+
+
+void PostgreSQLTest::testStatementCache()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateCopyTable();
+
+	_pSession->setProperty("statementCacheSize", 16);
+	assertTrue (Poco::AnyCast<std::size_t>(_pSession->getProperty("statementCacheSize")) == 16);
+	Poco::UInt64 hits = Poco::AnyCast<Poco::UInt64>(_pSession->getProperty("statementCacheHits"));
+
+	std::string name("name");
+	for (Poco::Int64 id = 0; id < 10; ++id)
+	{
+		*_pSession << "INSERT INTO CopyTest (Id, Name) VALUES ($1, $2)", use(id), use(name), now;
+	}
+	assertTrue (Poco::AnyCast<Poco::UInt64>(_pSession->getProperty("statementCacheHits")) == hits + 9);
+
+	std::size_t columns = 0;
+	{
+		RecordSet rs1(*_pSession, "SELECT * FROM CopyTest");
+		columns = rs1.columnCount();
+	}
+
+	*_pSession << "ALTER TABLE CopyTest ADD COLUMN Extra INTEGER", now;
+	try
+	{
+		// the cached statement can't return the new column
+		RecordSet rs2(*_pSession, "SELECT * FROM CopyTest");
+		fail ("cached plan must not change result type - must throw");
+	}
+	catch (StatementException& exc)
+	{
+		assertTrue (std::string(exc.sqlState()) == "0A000");
+	}
+
+	RecordSet rs3(*_pSession, "SELECT * FROM CopyTest");
+	assertTrue (rs3.columnCount() == columns + 1);
+	assertTrue (rs3.rowCount() == 10);
+
+	_pSession->setProperty("statementCacheSize", std::size_t(0));
+}
+
+
 void PostgreSQLTest::dropTable(const std::string& tableName)
 {
 	try
@@ -1231,6 +1635,15 @@ void PostgreSQLTest::recreateVectorsTable()
 }
 
 
+void PostgreSQLTest::recreateCopyTable()
+{
+	dropTable("CopyTest");
+	try { *_pSession << "CREATE TABLE CopyTest (Id BIGINT, Name VARCHAR(30), Score DOUBLE PRECISION, Flag BOOLEAN, Born DATE, Seen TIMESTAMP)", now; }
+	catch(ConnectionException& ce){ std::cout << ce.displayText() << std::endl; fail ("recreateCopyTable()"); }
+	catch(StatementException& se){ std::cout << se.displayText() << std::endl; fail ("recreateCopyTable()"); }
+}
+
+
 void PostgreSQLTest::setUp()
 {
 }
@@ -1241,6 +1654,8 @@ void PostgreSQLTest::tearDown()
 	dropTable("Person");
 	dropTable("Strings");
 	_pSession->setFeature("binaryExtraction", false);
+	_pSession->setFeature("rowStreaming", false);
+	_pSession->setProperty("statementCacheSize", std::size_t(0));
 }
 
 
@@ -1323,6 +1738,13 @@ CppUnit::Test* PostgreSQLTest::suite()
 	CppUnit_addTest(pSuite, PostgreSQLTest, testNullableString);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testTupleWithNullable);
         CppUnit_addTest(pSuite, PostgreSQLTest, testSqlState);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testCopyIn);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testCopyInAbort);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testCopyOut);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testPipeline);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testPipelineAsync);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testRowStreaming);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testStatementCache);
 
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinarySimpleAccess);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinaryComplexType);
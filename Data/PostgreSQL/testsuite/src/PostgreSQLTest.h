@@ -116,6 +116,14 @@ public:
 
 	void testSqlState();
 
+	void testCopyIn();
+	void testCopyInAbort();
+	void testCopyOut();
+	void testPipeline();
+	void testPipelineAsync();
+	void testRowStreaming();
+	void testStatementCache();
+
 	void setUp();
 	void tearDown();
 
@@ -140,6 +148,7 @@ private:
 	void recreateVectorsTable();
 	void recreateNullableIntTable();
 	void recreateNullableStringTable();
+	void recreateCopyTable();
 
 	static void dbInfo(Poco::Data::Session& session);
 
@@ -23,6 +23,7 @@
 #include "Poco/Data/SQLite/Extractor.h"
 #include "Poco/Data/StatementImpl.h"
 #include "Poco/Data/MetaColumn.h"
+#include "Poco/Data/StatementCache.h"
 #include "Poco/SharedPtr.h"
 
 
@@ -42,8 +43,12 @@ class SQLite_API SQLiteStatementImpl: public Poco::Data::StatementImpl
 	/// Implements statement functionality needed for SQLite
 {
 public:
-	SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB);
+	SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB, StatementCache* pCache = 0);
 		/// Creates the SQLiteStatementImpl.
+		///
+		/// If a StatementCache is given and enabled, a statement consisting
+		/// of a single SQL statement is taken from the cache when it is compiled,
+		/// and put back into the cache when it is cleared or destroyed.
 
 	~SQLiteStatementImpl();
 		/// Destroys the SQLiteStatementImpl.
@@ -93,7 +98,12 @@ protected:
 
 private:
 	void clear();
-		/// Removes the _pStmt
+		/// Removes the _pStmt, putting it back into the statement cache
+		/// if it has been taken from or may be added to the cache.
+
+	static bool isSchemaStatement(const char* pSql);
+		/// Returns true if the given SQL statement changes the database
+		/// schema, which invalidates the statements in the cache.
 
 	typedef Poco::SharedPtr<Binder>             BinderPtr;
 	typedef Poco::SharedPtr<Extractor>          ExtractorPtr;
@@ -117,6 +127,11 @@ private:
 	bool             _canBind;
 	bool             _isExtracted;
 	bool             _canCompile;
+	StatementCache*  _pCache;
+	StatementCache::Entry::Ptr _pCacheEntry;
+	std::string      _cacheKey;
+	bool             _cacheable;
+	bool             _isSchemaStatement;
 
 	static const int POCO_SQLITE_INV_ROW_CNT;
 };
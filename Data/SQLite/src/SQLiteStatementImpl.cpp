@@ -16,6 +16,7 @@
 #include "Poco/Data/SQLite/Utility.h"
 #include "Poco/Data/SQLite/SQLiteException.h"
 #include "Poco/String.h"
+#include "Poco/Ascii.h"
 #include <cstdlib>
 #include <cstring>
 #if defined(POCO_UNBUNDLED)
@@ -25,6 +26,34 @@
 #endif
 
 
+namespace
+{
+	class CachedStatement: public Poco::Data::StatementCache::Entry
+		/// A prepared statement in the session's StatementCache.
+	{
+	public:
+		explicit CachedStatement(sqlite3_stmt* pStmt):
+			_pStmt(pStmt)
+		{
+		}
+
+		sqlite3_stmt* statement() const
+		{
+			return _pStmt;
+		}
+
+	protected:
+		~CachedStatement()
+		{
+			sqlite3_finalize(_pStmt);
+		}
+
+	private:
+		sqlite3_stmt* _pStmt;
+	};
+}
+
+
 namespace Poco {
 namespace Data {
 namespace SQLite {
@@ -33,7 +62,7 @@ namespace SQLite {
 const int SQLiteStatementImpl::POCO_SQLITE_INV_ROW_CNT = -1;
 
 
-SQLiteStatementImpl::SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB):
+SQLiteStatementImpl::SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB, StatementCache* pCache):
 	StatementImpl(rSession),
 	_pDB(pDB),
 	_pStmt(0),
@@ -42,7 +71,10 @@ SQLiteStatementImpl::SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqli
 	_affectedRowCount(POCO_SQLITE_INV_ROW_CNT),
 	_canBind(false),
 	_isExtracted(false),
-	_canCompile(true)
+	_canCompile(true),
+	_pCache(pCache),
+	_cacheable(false),
+	_isSchemaStatement(false)
 {
 	_columns.resize(1);
 }
@@ -66,6 +98,8 @@ void SQLiteStatementImpl::compileImpl()
 	if (!_pLeftover)
 	{
 		_bindBegin = bindings().begin();
+		// return the statement to the cache before looking it up
+		if (_pCacheEntry) clear();
 	}
 
 	std::string statement(toString());
@@ -76,11 +110,19 @@ void SQLiteStatementImpl::compileImpl()
 	if (0 == std::strlen(pSql))
 		throw InvalidSQLStatementException("Empty statements are illegal");
 
+	bool useCache = !_pLeftover && _pCache && _pCache->isEnabled();
+	StatementCache::Entry::Ptr pCacheEntry;
+	if (useCache) pCacheEntry = _pCache->take(statement);
+
 	int rc = SQLITE_OK;
-	const char* pLeftover = 0;
+	const char* pLeftover = "";
 	bool queryFound = false;
 
-	do
+	if (pCacheEntry)
+	{
+		pStmt = static_cast<CachedStatement*>(pCacheEntry.get())->statement();
+	}
+	else do
 	{
 		rc = sqlite3_prepare_v2(_pDB, pSql, -1, &pStmt, &pLeftover);
 		if (rc != SQLITE_OK)
@@ -111,8 +153,18 @@ void SQLiteStatementImpl::compileImpl()
 	// to compileImpl() shall return false immediately when there are no more statements left.
 	std::string leftOver(pLeftover);
 	trimInPlace(leftOver);
+	bool isSchema = isSchemaStatement(pSql);
+	if (useCache && !pCacheEntry && pStmt && leftOver.empty() && !isSchema)
+	{
+		pCacheEntry = new CachedStatement(pStmt);
+		_pCache->stamp(*pCacheEntry);
+	}
 	clear();
 	_pStmt = pStmt;
+	_pCacheEntry = pCacheEntry;
+	if (_pCacheEntry) _cacheKey = statement;
+	_cacheable = true;
+	_isSchemaStatement = isSchema;
 	if (!leftOver.empty())
 	{
 		_pLeftover = new std::string(leftOver);
@@ -220,13 +272,37 @@ void SQLiteStatementImpl::clear()
 
 	if (_pStmt)
 	{
-		sqlite3_finalize(_pStmt);
+		if (_pCacheEntry)
+		{
+			if (_cacheable && session().isConnected())
+			{
+				sqlite3_reset(_pStmt);
+				sqlite3_clear_bindings(_pStmt);
+				_pCache->put(_cacheKey, _pCacheEntry);
+			}
+			_pCacheEntry.reset(); // finalizes the statement if it has not been cached
+		}
+		else sqlite3_finalize(_pStmt);
 		_pStmt=0;
 	}
 	_pLeftover = 0;
 }
 
 
+bool SQLiteStatementImpl::isSchemaStatement(const char* pSql)
+{
+	while (Poco::Ascii::isSpace(*pSql)) ++pSql;
+	const char* pEnd = pSql;
+	while (Poco::Ascii::isAlpha(*pEnd)) ++pEnd;
+	std::string keyword(pSql, pEnd);
+	return icompare(keyword, "CREATE") == 0 ||
+		icompare(keyword, "DROP") == 0 ||
+		icompare(keyword, "ALTER") == 0 ||
+		icompare(keyword, "ATTACH") == 0 ||
+		icompare(keyword, "DETACH") == 0;
+}
+
+
 bool SQLiteStatementImpl::hasNext()
 {
 	if (_stepCalled)
@@ -248,7 +324,15 @@ bool SQLiteStatementImpl::hasNext()
 		_affectedRowCount += sqlite3_changes(_pDB);
 
 	if (_nextResponse != SQLITE_ROW && _nextResponse != SQLITE_OK && _nextResponse != SQLITE_DONE)
+	{
+		_cacheable = false;
+		if ((_nextResponse & 0xff) == SQLITE_SCHEMA && _pCache) _pCache->clear();
 		Utility::throwException(_pDB, _nextResponse);
+	}
+
+	// cached statements are reprepared by SQLite after a schema change,
+	// but their column metadata would be stale when they are compiled
+	if (_isSchemaStatement && _nextResponse == SQLITE_DONE && _pCache) _pCache->clear();
 
 	_pExtractor->reset();//clear the cached null indicators
 
@@ -62,6 +62,7 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 		&SessionImpl::isAutoCommit);
 	addProperty("connectionTimeout", &SessionImpl::setConnectionTimeout, &SessionImpl::getConnectionTimeout);
 	addProperty(Utility::TRANSACTION_TYPE_PROPERTY_KEY, &SessionImpl::setTransactionType, &SessionImpl::getTransactionType);
+	addStatementCacheProperties();
 }
 
 
@@ -81,7 +82,7 @@ SessionImpl::~SessionImpl()
 Poco::Data::StatementImpl::Ptr SessionImpl::createStatementImpl()
 {
 	poco_check_ptr (_pDB);
-	return new SQLiteStatementImpl(*this, _pDB);
+	return new SQLiteStatementImpl(*this, _pDB, &statementCache());
 }
 
 
@@ -198,6 +199,7 @@ void SessionImpl::open(const std::string& connect)
 
 void SessionImpl::close()
 {
+	statementCache().clear();
 	if (_pDB)
 	{
 		sqlite3_close_v2(_pDB);
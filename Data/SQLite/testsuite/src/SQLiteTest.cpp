@@ -16,6 +16,8 @@
 #include "Poco/Data/LOB.h"
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RecordSet.h"
+#include "Poco/Data/CSVColumnarFormatter.h"
+#include "Poco/Data/JSONColumnarFormatter.h"
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/SQLite/Connector.h"
@@ -43,6 +45,7 @@
 #include "Poco/Stopwatch.h"
 #include "Poco/Delegate.h"
 #include <iostream>
+#include <sstream>
 
 
 using namespace Poco::Data::Keywords;
@@ -50,6 +53,9 @@ using Poco::Data::Session;
 using Poco::Data::Statement;
 using Poco::Data::RecordSet;
 using Poco::Data::Column;
+using Poco::Data::ColumnView;
+using Poco::Data::CSVColumnarFormatter;
+using Poco::Data::JSONColumnarFormatter;
 using Poco::Data::Row;
 using Poco::Data::SQLChannel;
 using Poco::Data::LimitException;
@@ -2083,6 +2089,107 @@ void SQLiteTest::testInternalExtraction()
 }
 
 
+void SQLiteTest::testColumnView()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS Vectors", now;
+	tmp << "CREATE TABLE Vectors (int0 INTEGER, flt0 REAL, str0 VARCHAR)", now;
+	tmp << "INSERT INTO Vectors VALUES (1, 1.5, 'a')", now;
+	tmp << "INSERT INTO Vectors VALUES (NULL, 2.5, NULL)", now;
+	tmp << "INSERT INTO Vectors VALUES (3, NULL, 'c')", now;
+
+	RecordSet rset(tmp, "SELECT * FROM Vectors");
+	ColumnView<Poco::Int64> ints = rset.columnView<Poco::Int64>(0);
+	assertTrue (ints.size() == 3);
+	assertTrue (ints.name() == "int0");
+	assertTrue (ints[0] == 1);
+	assertTrue (ints.isNull(1));
+	assertTrue (ints.value(2) == 3);
+	assertTrue (!ints.isNull(2));
+	assertTrue (ints.data() == 0);
+
+	ColumnView<double> doubles = rset.columnView<double>("FLT0");
+	assertTrue (doubles[1] == 2.5);
+	assertTrue (doubles.isNull(2));
+
+	ColumnView<std::string> strings = rset.columnView<std::string>(2);
+	assertTrue (strings[0] == "a");
+	assertTrue (strings.isNull(1));
+	assertTrue (strings[2] == "c");
+
+	try
+	{
+		strings.value(3);
+		fail ("must throw");
+	}
+	catch (RangeException&) { }
+
+	try
+	{
+		rset.columnView<std::string>(0);
+		fail ("must throw");
+	}
+	catch (BadCastException&) { }
+
+	tmp.setProperty("storage", std::string("vector"));
+	RecordSet vset(tmp, "SELECT * FROM Vectors");
+	ColumnView<Poco::Int64> vints = vset.columnView<Poco::Int64>(0);
+	assertTrue (vints.data() != 0);
+	assertTrue (vints.data()[2] == 3);
+	assertTrue (vints.isNull(1));
+
+	tmp.setProperty("storage", std::string("list"));
+	RecordSet lset(tmp, "SELECT * FROM Vectors");
+	try
+	{
+		lset.columnView<Poco::Int64>(0);
+		fail ("must throw");
+	}
+	catch (InvalidAccessException&) { }
+}
+
+
+void SQLiteTest::testColumnarFormatter()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS Vectors", now;
+	tmp << "CREATE TABLE Vectors (int0 INTEGER, flt0 REAL, str0 VARCHAR)", now;
+	tmp << "INSERT INTO Vectors VALUES (1, 1.5, 'plain')", now;
+	tmp << "INSERT INTO Vectors VALUES (NULL, 2.5, 'a, \"quoted\" text')", now;
+	tmp << "INSERT INTO Vectors VALUES (3, NULL, NULL)", now;
+
+	RecordSet rset(tmp, "SELECT * FROM Vectors");
+
+	CSVColumnarFormatter csv;
+	assertEqual ("int0,flt0,str0\r\n"
+		"1,1.5,plain\r\n"
+		",2.5,\"a, \"\"quoted\"\" text\"\r\n"
+		"3,,\r\n", csv.format(rset));
+
+	CSVColumnarFormatter tsv('\t', false);
+	assertEqual ("1\t1.5\tplain\r\n"
+		"\t2.5\t\"a, \"\"quoted\"\" text\"\r\n"
+		"3\t\t\r\n", tsv.format(rset));
+
+	JSONColumnarFormatter json;
+	assertEqual ("[\n"
+		"{\"int0\":1,\"flt0\":1.5,\"str0\":\"plain\"},\n"
+		"{\"int0\":null,\"flt0\":2.5,\"str0\":\"a, \\\"quoted\\\" text\"},\n"
+		"{\"int0\":3,\"flt0\":null,\"str0\":null}]\n", json.format(rset));
+
+	JSONColumnarFormatter compact(true);
+	assertEqual ("{\"names\":[\"int0\",\"flt0\",\"str0\"],\"values\":[\n"
+		"[1,1.5,\"plain\"],\n"
+		"[null,2.5,\"a, \\\"quoted\\\" text\"],\n"
+		"[3,null,null]]}\n", compact.format(rset));
+
+	std::ostringstream ostr;
+	csv.setBufferSize(1);
+	csv.format(rset, ostr);
+	assertEqual (csv.format(rset), ostr.str());
+}
+
+
 void SQLiteTest::testPrimaryKeyConstraint()
 {
 	Session ses (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -3527,6 +3634,76 @@ void SQLiteTest::testTransactionTypeProperty()
 }
 
 
+void SQLiteTest::testStatementCache()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, ":memory:");
+	assertTrue (AnyCast<std::size_t>(tmp.getProperty("statementCacheSize")) == 0);
+	tmp.setProperty("statementCacheSize", 16);
+	assertTrue (AnyCast<std::size_t>(tmp.getProperty("statementCacheSize")) == 16);
+
+	try
+	{
+		tmp.setProperty("statementCacheHits", Poco::UInt64(0));
+		fail ("must fail");
+	}
+	catch (NotImplementedException&) { }
+
+	tmp << "CREATE TABLE Person (LastName VARCHAR(30), Age INTEGER)", now;
+	std::string lastName("Simpson");
+	for (int age = 0; age < 10; ++age)
+	{
+		tmp << "INSERT INTO Person VALUES (?, ?)", use(lastName), use(age), now;
+	}
+	assertTrue (AnyCast<Poco::UInt64>(tmp.getProperty("statementCacheHits")) == 9);
+	assertTrue (AnyCast<Poco::UInt64>(tmp.getProperty("statementCacheMisses")) == 2);
+	assertTrue (AnyCast<double>(tmp.getProperty("statementCacheHitRatio")) > 0.8);
+
+	int count = 0;
+	Statement stmt = (tmp << "SELECT COUNT(*) FROM Person", into(count));
+	stmt.execute();
+	assertTrue (count == 10);
+	int maxAge = 4;
+	tmp << "DELETE FROM Person WHERE Age > ?", use(maxAge), now;
+	stmt.execute();
+	assertTrue (count == 5);
+
+	RecordSet rs1 (tmp, "SELECT * FROM Person");
+	assertTrue (rs1.columnCount() == 2);
+	tmp << "ALTER TABLE Person ADD COLUMN FirstName VARCHAR(30)", now;
+	RecordSet rs2 (tmp, "SELECT * FROM Person");
+	assertTrue (rs2.columnCount() == 3);
+	assertTrue (rs2.rowCount() == 5);
+
+	tmp.setProperty("statementCacheSize", std::size_t(0));
+	Poco::UInt64 hits = AnyCast<Poco::UInt64>(tmp.getProperty("statementCacheHits"));
+	tmp << "INSERT INTO Person VALUES (?, ?, ?)", use(lastName), use(count), use(lastName), now;
+	tmp << "INSERT INTO Person VALUES (?, ?, ?)", use(lastName), use(count), use(lastName), now;
+	assertTrue (AnyCast<Poco::UInt64>(tmp.getProperty("statementCacheHits")) == hits);
+	tmp << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 7);
+}
+
+
+void SQLiteTest::testStatementCacheSchemaChange()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, ":memory:");
+	tmp.setProperty("statementCacheSize", 16);
+	tmp << "CREATE TABLE Person (LastName VARCHAR(30), Age INTEGER)", now;
+	tmp << "INSERT INTO Person VALUES ('Simpson', 42)", now;
+
+	{
+		// the prepared statement is in use while the schema
+		// change clears the cache, and must not be put back
+		RecordSet rs1 (tmp, "SELECT * FROM Person");
+		assertTrue (rs1.columnCount() == 2);
+		tmp << "ALTER TABLE Person ADD COLUMN FirstName VARCHAR(30)", now;
+	}
+	RecordSet rs2 (tmp, "SELECT * FROM Person");
+	assertTrue (rs2.columnCount() == 3);
+	assertTrue (rs2.rowCount() == 1);
+}
+
+
 void SQLiteTest::setUp()
 {
 }
@@ -3608,6 +3785,8 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testDateTime);
 	CppUnit_addTest(pSuite, SQLiteTest, testUUID);
 	CppUnit_addTest(pSuite, SQLiteTest, testInternalExtraction);
+	CppUnit_addTest(pSuite, SQLiteTest, testColumnView);
+	CppUnit_addTest(pSuite, SQLiteTest, testColumnarFormatter);
 	CppUnit_addTest(pSuite, SQLiteTest, testPrimaryKeyConstraint);
 	CppUnit_addTest(pSuite, SQLiteTest, testNullable);
 	CppUnit_addTest(pSuite, SQLiteTest, testNulls);
@@ -3633,6 +3812,8 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testFTS3);
 	CppUnit_addTest(pSuite, SQLiteTest, testIllegalFilePath);
 	CppUnit_addTest(pSuite, SQLiteTest, testTransactionTypeProperty);
+	CppUnit_addTest(pSuite, SQLiteTest, testStatementCache);
+	CppUnit_addTest(pSuite, SQLiteTest, testStatementCacheSchemaChange);
 
 	return pSuite;
 }
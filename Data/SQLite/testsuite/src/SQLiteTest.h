@@ -106,6 +106,8 @@ public:
 	void testUUID();
 
 	void testInternalExtraction();
+	void testColumnView();
+	void testColumnarFormatter();
 	void testPrimaryKeyConstraint();
 	void testNullable();
 	void testNulls();
@@ -140,6 +142,8 @@ public:
 
 	void testIllegalFilePath();
 	void testTransactionTypeProperty();
+	void testStatementCache();
+	void testStatementCacheSchemaChange();
 
 	void setUp();
 	void tearDown();
@@ -21,6 +21,7 @@
 #include "Poco/Data/Data.h"
 #include "Poco/Data/SessionImpl.h"
 #include "Poco/Data/DataException.h"
+#include "Poco/Data/StatementCache.h"
 #include <map>
 
 
@@ -319,7 +320,81 @@ public:
 		return _sqlParse;
 	}
 
+	void setStatementCacheSize(const std::string&, const Poco::Any& value)
+		/// Sets the capacity of the statement cache.
+		/// Value must be of type std::size_t or int.
+	{
+		if (value.type() == typeid(int))
+		{
+			int capacity = Poco::AnyCast<int>(value);
+			if (capacity < 0) throw InvalidArgumentException("statementCacheSize");
+			_statementCache.setCapacity(static_cast<std::size_t>(capacity));
+		}
+		else _statementCache.setCapacity(Poco::AnyCast<std::size_t>(value));
+	}
+
+	Poco::Any getStatementCacheSize(const std::string& name = "") const
+		/// Returns the capacity of the statement cache.
+	{
+		return _statementCache.getCapacity();
+	}
+
+	Poco::Any getStatementCacheHits(const std::string& name = "") const
+		/// Returns the number of prepared statements reused from the cache.
+	{
+		return _statementCache.hits();
+	}
+
+	Poco::Any getStatementCacheMisses(const std::string& name = "") const
+		/// Returns the number of statements not found in the cache.
+	{
+		return _statementCache.misses();
+	}
+
+	Poco::Any getStatementCacheHitRatio(const std::string& name = "") const
+		/// Returns the ratio of cache hits to cache lookups.
+	{
+		return _statementCache.hitRatio();
+	}
+
+	StatementCache& statementCache()
+		/// Returns the session's statement cache.
+		///
+		/// Connectors that use the cache must clear it before
+		/// the connection is closed.
+	{
+		return _statementCache;
+	}
+
 protected:
+	void addStatementCacheProperties()
+		/// Adds the properties of the session's StatementCache. Must be
+		/// called by the constructors of connectors whose statements use
+		/// the cache; for all other connectors, setting or getting these
+		/// properties throws a NotSupportedException.
+		///
+		/// Adds "statementCacheSize" property and sets it to zero. This property sets the
+		/// capacity of the session's StatementCache, the number of prepared statements kept
+		/// for reuse by statements with the same SQL text. Zero disables the cache.
+		///
+		/// Adds the read-only "statementCacheHits", "statementCacheMisses" (Poco::UInt64) and
+		/// "statementCacheHitRatio" (double) properties, which return the statistics of the
+		/// StatementCache.
+	{
+		addProperty("statementCacheSize",
+			&AbstractSessionImpl<C>::setStatementCacheSize,
+			&AbstractSessionImpl<C>::getStatementCacheSize);
+
+		addProperty("statementCacheHits", 0,
+			&AbstractSessionImpl<C>::getStatementCacheHits);
+
+		addProperty("statementCacheMisses", 0,
+			&AbstractSessionImpl<C>::getStatementCacheMisses);
+
+		addProperty("statementCacheHitRatio", 0,
+			&AbstractSessionImpl<C>::getStatementCacheHitRatio);
+	}
+
 	void addFeature(const std::string& name, FeatureSetter setter, FeatureGetter getter)
 		/// Adds a feature to the map of supported features.
 		///
@@ -395,6 +470,7 @@ private:
 	bool        _sqlParse;
 	bool        _autoCommit;
 	Poco::Any   _handle;
+	StatementCache _statementCache;
 };
 
 
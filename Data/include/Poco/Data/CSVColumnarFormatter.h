@@ -0,0 +1,96 @@
+//
+// CSVColumnarFormatter.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  CSVColumnarFormatter
+//
+// Definition of the CSVColumnarFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_CSVColumnarFormatter_INCLUDED
+#define Data_CSVColumnarFormatter_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/ColumnarFormatter.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+class Data_API CSVColumnarFormatter: public ColumnarFormatter
+	/// A ColumnarFormatter that writes a RecordSet in CSV format,
+	/// as described in RFC 4180.
+	///
+	/// Every row is terminated with CRLF. Fields containing the
+	/// delimiter, a double quote, CR or LF are enclosed in double
+	/// quotes, with embedded double quotes doubled. Null values
+	/// are written as empty fields.
+	///
+	/// Example:
+	///
+	///     RecordSet rs(session, "SELECT * FROM Person");
+	///     CSVColumnarFormatter csv;
+	///     csv.format(rs, ostr);
+{
+public:
+	CSVColumnarFormatter(char delimiter = ',', bool header = true);
+		/// Creates the CSVColumnarFormatter, using the given field
+		/// delimiter. If header is true, the first line contains
+		/// the column names.
+
+	~CSVColumnarFormatter();
+		/// Destroys the CSVColumnarFormatter.
+
+	char getDelimiter() const;
+		/// Returns the field delimiter.
+
+	bool getHeader() const;
+		/// Returns true if the column names are written.
+
+protected:
+	void writeBegin(const std::vector<const std::string*>& names, std::string& out);
+	void writeEnd(std::string& out);
+	void writeRowBegin(std::size_t rowIndex, std::string& out);
+	void writeRowEnd(std::string& out);
+	void writeFieldBegin(std::size_t col, std::string& out);
+	void writeNull(std::string& out);
+	void writeNumber(const char* value, std::size_t length, std::string& out);
+	void writeText(const char* value, std::size_t length, std::string& out);
+	void writeString(const char* value, std::size_t length, std::string& out);
+
+private:
+	char _delimiter;
+	bool _header;
+};
+
+
+///
+/// inlines
+///
+
+
+inline char CSVColumnarFormatter::getDelimiter() const
+{
+	return _delimiter;
+}
+
+
+inline bool CSVColumnarFormatter::getHeader() const
+{
+	return _header;
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_CSVColumnarFormatter_INCLUDED
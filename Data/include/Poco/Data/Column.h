@@ -104,6 +104,12 @@ public:
 		return *_pData;
 	}
 
+	const Container& data() const
+		/// Returns const reference to contained data.
+	{
+		return *_pData;
+	}
+
 	const Type& value(std::size_t row) const
 		/// Returns the field value in specified row.
 	{
@@ -252,6 +258,12 @@ public:
 		return *_pData;
 	}
 
+	const Container& data() const
+		/// Returns const reference to contained data.
+	{
+		return *_pData;
+	}
+
 	const bool& value(std::size_t row) const
 		/// Returns the field value in specified row.
 	{
@@ -392,6 +404,12 @@ public:
 		return *_pData;
 	}
 
+	const Container& data() const
+		/// Returns const reference to contained data.
+	{
+		return *_pData;
+	}
+
 	const T& value(std::size_t row) const
 		/// Returns the field value in specified row.
 		/// This is the std::list specialization and std::list
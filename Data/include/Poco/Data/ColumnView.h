@@ -0,0 +1,127 @@
+//
+// ColumnView.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ColumnView
+//
+// Definition of the ColumnView class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ColumnView_INCLUDED
+#define Data_ColumnView_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/AbstractExtraction.h"
+#include "Poco/Exception.h"
+#include <vector>
+#include <deque>
+
+
+namespace Poco {
+namespace Data {
+
+
+template <class T>
+class ColumnView
+	/// ColumnView provides typed, read-only access to the values
+	/// of a RecordSet column, directly from the container the
+	/// statement has extracted the column into. Unlike
+	/// RecordSet::value(), no Poco::Dynamic::Var is created for
+	/// the values.
+	///
+	/// A ColumnView is obtained with RecordSet::columnView().
+	/// It does not own the data; it remains valid until the
+	/// RecordSet (or the Statement it was created from) is
+	/// reset, re-executed or destroyed.
+	///
+	/// Null values are reported by isNull(); for a null value,
+	/// the container holds a default-constructed value.
+{
+public:
+	using Type = T;
+	using ConstReference = typename std::vector<T>::const_reference;
+
+	ColumnView(const std::vector<T>& data, const AbstractExtraction& extraction, const std::string& name):
+		_pVector(&data),
+		_pDeque(0),
+		_pExtraction(&extraction),
+		_pName(&name)
+		/// Creates the ColumnView for a column extracted into a vector.
+	{
+	}
+
+	ColumnView(const std::deque<T>& data, const AbstractExtraction& extraction, const std::string& name):
+		_pVector(0),
+		_pDeque(&data),
+		_pExtraction(&extraction),
+		_pName(&name)
+		/// Creates the ColumnView for a column extracted into a deque.
+	{
+	}
+
+	std::size_t size() const
+		/// Returns the number of values in the column.
+	{
+		return _pVector ? _pVector->size() : _pDeque->size();
+	}
+
+	ConstReference operator [] (std::size_t row) const
+		/// Returns the value in the given row.
+		/// The row index is not checked.
+	{
+		if (_pVector)
+			return (*_pVector)[row];
+		else
+			return (*_pDeque)[row];
+	}
+
+	ConstReference value(std::size_t row) const
+		/// Returns the value in the given row.
+		/// Throws a RangeException if row is out of range.
+	{
+		if (row >= size())
+			throw RangeException("Invalid row index");
+		return operator [] (row);
+	}
+
+	bool isNull(std::size_t row) const
+		/// Returns true if the value in the given row is null.
+	{
+		return _pExtraction->isNull(row);
+	}
+
+	const T* data() const
+		/// Returns a pointer to the contiguous values if the
+		/// statement uses vector storage, or null otherwise.
+		///
+		/// Not available for bool columns.
+	{
+		return _pVector ? _pVector->data() : 0;
+	}
+
+	const std::string& name() const
+		/// Returns the column name.
+	{
+		return *_pName;
+	}
+
+private:
+	const std::vector<T>* _pVector;
+	const std::deque<T>* _pDeque;
+	const AbstractExtraction* _pExtraction;
+	const std::string* _pName;
+};
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_ColumnView_INCLUDED
@@ -0,0 +1,157 @@
+//
+// ColumnarFormatter.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ColumnarFormatter
+//
+// Definition of the ColumnarFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ColumnarFormatter_INCLUDED
+#define Data_ColumnarFormatter_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/MetaColumn.h"
+#include <ostream>
+#include <string>
+#include <vector>
+#include <memory>
+
+
+namespace Poco {
+namespace Data {
+
+
+class RecordSet;
+
+
+class Data_API ColumnarFormatter
+	/// ColumnarFormatter is the base class for formatters that
+	/// write a complete RecordSet to a stream, reading the values
+	/// through typed column views (see RecordSet::columnView()).
+	///
+	/// Unlike RowFormatter, which receives every row as a vector
+	/// of Poco::Dynamic::Var, a ColumnarFormatter selects a typed
+	/// writer for every column once, and then formats the values
+	/// straight from the extracted data into an output buffer that
+	/// is written to the stream whenever it exceeds the buffer size.
+	/// Formatting a result therefore does not allocate memory per
+	/// value, which matters for results with millions of rows.
+	///
+	/// Values are rendered as follows:
+	///
+	///   * integers and floating-point numbers in their shortest
+	///     decimal representation (NaN and infinity are formatted as null),
+	///   * booleans as true or false,
+	///   * dates as YYYY-MM-DD, times as hh:mm:ss and timestamps
+	///     in ISO 8601 format,
+	///   * UTF-16 strings converted to UTF-8,
+	///   * BLOBs and CLOBs with their raw content,
+	///   * UUIDs in their string representation.
+	///
+	/// The RowFilter of the RecordSet, if any, is honored.
+	///
+	/// Subclasses define the syntax by implementing the protected
+	/// write functions.
+{
+public:
+	static const std::size_t DEFAULT_BUFFER_SIZE = 65536;
+
+	ColumnarFormatter();
+		/// Creates the ColumnarFormatter.
+
+	virtual ~ColumnarFormatter();
+		/// Destroys the ColumnarFormatter.
+
+	void format(const RecordSet& recordSet, std::ostream& ostr);
+		/// Writes all rows of the RecordSet to the given stream.
+		///
+		/// Throws a DataException if a column type is not supported
+		/// and an InvalidAccessException if the statement uses
+		/// list storage.
+
+	std::string format(const RecordSet& recordSet);
+		/// Formats all rows of the RecordSet and returns
+		/// the result as string.
+
+	void setBufferSize(std::size_t size);
+		/// Sets the number of bytes that are collected before
+		/// they are written to the stream.
+
+	std::size_t getBufferSize() const;
+		/// Returns the buffer size.
+
+protected:
+	virtual void writeBegin(const std::vector<const std::string*>& names, std::string& out) = 0;
+		/// Writes the text preceding the first row,
+		/// typically the column names.
+
+	virtual void writeEnd(std::string& out) = 0;
+		/// Writes the text following the last row.
+
+	virtual void writeRowBegin(std::size_t rowIndex, std::string& out) = 0;
+		/// Writes the text preceding a row. The rowIndex
+		/// counts the rows written, starting at zero.
+
+	virtual void writeRowEnd(std::string& out) = 0;
+		/// Writes the text following a row.
+
+	virtual void writeFieldBegin(std::size_t col, std::string& out) = 0;
+		/// Writes the text preceding the value in the given column.
+
+	virtual void writeNull(std::string& out) = 0;
+		/// Writes a null value.
+
+	virtual void writeNumber(const char* value, std::size_t length, std::string& out) = 0;
+		/// Writes the textual representation of a number
+		/// or boolean value.
+
+	virtual void writeText(const char* value, std::size_t length, std::string& out) = 0;
+		/// Writes the textual representation of a date, time
+		/// or UUID value. The text never contains characters
+		/// that need escaping.
+
+	virtual void writeString(const char* value, std::size_t length, std::string& out) = 0;
+		/// Writes a string value, escaping or quoting it
+		/// as required.
+
+private:
+	ColumnarFormatter(const ColumnarFormatter&);
+	ColumnarFormatter& operator = (const ColumnarFormatter&);
+
+	class ColumnWriter;
+
+	template <class T>
+	class TypedColumnWriter;
+
+	using ColumnWriterPtr = std::unique_ptr<ColumnWriter>;
+
+	static ColumnWriterPtr createWriter(const RecordSet& recordSet, std::size_t col);
+
+	std::size_t _bufferSize;
+};
+
+
+///
+/// inlines
+///
+
+
+inline std::size_t ColumnarFormatter::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_ColumnarFormatter_INCLUDED
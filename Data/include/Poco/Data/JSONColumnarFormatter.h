@@ -0,0 +1,88 @@
+//
+// JSONColumnarFormatter.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  JSONColumnarFormatter
+//
+// Definition of the JSONColumnarFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_JSONColumnarFormatter_INCLUDED
+#define Data_JSONColumnarFormatter_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/ColumnarFormatter.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+class Data_API JSONColumnarFormatter: public ColumnarFormatter
+	/// A ColumnarFormatter that writes a RecordSet as JSON.
+	///
+	/// By default, the result is an array with one object per row:
+	///
+	///     [{"LastName":"Simpson","FirstName":"Bart","Age":12},
+	///     {"LastName":"Simpson","FirstName":"Lisa","Age":10}]
+	///
+	/// In compact mode, the column names are written only once
+	/// and every row is an array of values:
+	///
+	///     {"names":["LastName","FirstName","Age"],"values":[
+	///     ["Simpson","Bart",12],
+	///     ["Simpson","Lisa",10]]}
+	///
+	/// Every row starts on a new line. Strings are escaped
+	/// with Poco::toJSON(); null values are written as null.
+{
+public:
+	explicit JSONColumnarFormatter(bool compact = false);
+		/// Creates the JSONColumnarFormatter.
+
+	~JSONColumnarFormatter();
+		/// Destroys the JSONColumnarFormatter.
+
+	bool isCompact() const;
+		/// Returns true if compact mode is enabled.
+
+protected:
+	void writeBegin(const std::vector<const std::string*>& names, std::string& out);
+	void writeEnd(std::string& out);
+	void writeRowBegin(std::size_t rowIndex, std::string& out);
+	void writeRowEnd(std::string& out);
+	void writeFieldBegin(std::size_t col, std::string& out);
+	void writeNull(std::string& out);
+	void writeNumber(const char* value, std::size_t length, std::string& out);
+	void writeText(const char* value, std::size_t length, std::string& out);
+	void writeString(const char* value, std::size_t length, std::string& out);
+
+private:
+	bool _compact;
+	std::vector<std::string> _keys;
+};
+
+
+///
+/// inlines
+///
+
+
+inline bool JSONColumnarFormatter::isCompact() const
+{
+	return _compact;
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_JSONColumnarFormatter_INCLUDED
@@ -54,10 +54,21 @@ public:
 	int idle() const;
 		/// Returns the number of seconds the session has not been used.
 
+	Poco::Timestamp lastUsed() const;
+		/// Returns the last access timestamp.
+
+	void checkout();
+		/// Records the time the session is handed out by the pool.
+
+	Poco::Timestamp::TimeDiff checkedOut() const;
+		/// Returns the number of microseconds since the
+		/// last call to checkout().
+
 private:
 	SessionPool& _owner;
 	Poco::AutoPtr<SessionImpl> _pImpl;
 	Poco::Timestamp _lastUsed;
+	Poco::Timestamp _checkedOut;
 	mutable Poco::FastMutex _mutex;
 };
 
@@ -93,6 +104,31 @@ inline int PooledSessionHolder::idle() const
 }
 
 
+inline Poco::Timestamp PooledSessionHolder::lastUsed() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _lastUsed;
+}
+
+
+inline void PooledSessionHolder::checkout()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_checkedOut.update();
+	_lastUsed = _checkedOut;
+}
+
+
+inline Poco::Timestamp::TimeDiff PooledSessionHolder::checkedOut() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _checkedOut.elapsed();
+}
+
+
 } } // namespace Poco::Data
 
 
@@ -24,6 +24,7 @@
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RowIterator.h"
 #include "Poco/Data/RowFilter.h"
+#include "Poco/Data/ColumnView.h"
 #include "Poco/Data/LOB.h"
 #include "Poco/String.h"
 #include "Poco/Dynamic/Var.h"
@@ -38,6 +39,7 @@ namespace Data {
 
 
 class RowFilter;
+class ColumnarFormatter;
 
 
 class Data_API RecordSet: private Statement
@@ -171,6 +173,26 @@ public:
 	template <class C>
 	const Column<C>& column(std::size_t pos) const;
 
+	template <class T>
+	ColumnView<T> columnView(std::size_t pos) const;
+		/// Returns a typed view of the column at the specified position.
+		/// The view accesses the extracted values directly, without
+		/// creating a Poco::Dynamic::Var for every value, which makes
+		/// it the preferred way to process large results.
+		///
+		/// T must match the column type (see columnType()), e.g.
+		/// Int64 for MetaColumn::FDT_INT64 or std::string for
+		/// MetaColumn::FDT_STRING; otherwise a BadCastException is thrown.
+		/// The view ignores any RowFilter.
+		///
+		/// Throws an InvalidAccessException if the statement
+		/// uses list storage.
+
+	template <class T>
+	ColumnView<T> columnView(const std::string& name) const;
+		/// Returns a typed view of the column with the specified name.
+		/// See columnView(std::size_t) for details.
+
 	Row& row(std::size_t pos);
 		/// Returns reference to row at position pos.
 		/// Rows are lazy-created and cached.
@@ -414,6 +436,7 @@ private:
 
 	friend class RowIterator;
 	friend class RowFilter;
+	friend class ColumnarFormatter;
 };
 
 
@@ -26,7 +26,10 @@
 #include "Poco/Any.h"
 #include "Poco/Timer.h"
 #include "Poco/Mutex.h"
-#include <list>
+#include <atomic>
+#include <deque>
+#include <set>
+#include <vector>
 
 
 namespace Poco {
@@ -50,14 +53,25 @@ class Data_API SessionPool: public RefCountedObject
 	/// the SessionPool attempts to create a new one for the client.
 	/// To avoid excessive creation of SessionImpl objects, a limit
 	/// can be set on the maximum number of objects.
-	/// Sessions found not to be connected to the database are purged
-	/// from the pool whenever one of the following events occurs:
+	/// Idle sessions are kept on a stack, so get() returns the most
+	/// recently used session. On a server handling a request per
+	/// thread, this is usually the session last used by the calling
+	/// thread, with warm caches on both ends of the connection, and
+	/// sessions that are not needed under the current load age out.
 	///
-	///   - JanitorTimer event
-	///   - get() request
-	///   - putBack() request
+	/// To keep get() fast, it does not check whether the session is
+	/// still connected, which for some connectors requires a round
+	/// trip to the server. Instead, sessions are checked when they are
+	/// returned to the pool, and idle sessions that have not been used
+	/// since the previous run of the janitor timer are validated in the
+	/// background by the janitor timer. A session that loses its
+	/// connection while idle may therefore be handed out before the
+	/// janitor detects it. The lock protecting the pool is never held
+	/// while talking to the database.
 	///
-	/// Not connected idle sessions can not exist.
+	/// The pool records histograms of the time spent in get() and of
+	/// the time sessions are in use, for monitoring contention and
+	/// sizing the pool.
 	///
 	/// Usage example:
 	///
@@ -83,12 +97,19 @@ public:
 	~SessionPool();
 		/// Destroys the SessionPool.
 
+	static const int HISTOGRAM_BUCKETS = 32;
+
+	typedef std::vector<Poco::UInt64> Histogram;
+		/// A latency histogram with HISTOGRAM_BUCKETS buckets.
+		/// Bucket 0 counts durations below one microsecond, bucket n
+		/// counts durations from 2^(n-1) up to 2^n microseconds, and
+		/// the last bucket also counts all longer durations.
+
 	Session get();
 		/// Returns a Session.
 		///
-		/// If there are unused sessions available, one of the
-		/// unused sessions is recycled. Otherwise, a new session
-		/// is created.
+		/// If there are unused sessions available, the most recently
+		/// used one is recycled. Otherwise, a new session is created.
 		///
 		/// If the maximum number of sessions for this pool has
 		/// already been created, a SessionPoolExhaustedException
@@ -101,9 +122,13 @@ public:
 		/// value, in which case it is reset back to the pool
 		/// value when the session is reclaimed by the pool.
 	{
-		Session s = get();
-		_addPropertyMap.insert(AddPropertyMap::value_type(s.impl(),
-			std::make_pair(name, s.getProperty(name))));
+		PooledSessionHolderPtr pHolder(checkout());
+		Session s(new PooledSessionImpl(pHolder));
+		PropertyPair previous(name, s.getProperty(name));
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			_addPropertyMap[pHolder->session()] = previous;
+		}
 		s.setProperty(name, value);
 
 		return s;
@@ -155,6 +180,17 @@ public:
 	Poco::Any getProperty(const std::string& name) const;
 		/// Returns the requested property.
 
+	Histogram waitTimeHistogram() const;
+		/// Returns the histogram of the time spent in successful
+		/// get() calls, including the time to create new sessions.
+
+	Histogram checkoutTimeHistogram() const;
+		/// Returns the histogram of the time sessions were in use,
+		/// from get() until they were returned to the pool.
+
+	void resetStatistics();
+		/// Clears both histograms.
+
 	void shutdown();
 		/// Shuts down the session pool.
 
@@ -170,12 +206,11 @@ protected:
 
 	typedef Poco::AutoPtr<PooledSessionHolder>    PooledSessionHolderPtr;
 	typedef Poco::AutoPtr<PooledSessionImpl>      PooledSessionImplPtr;
-	typedef std::list<PooledSessionHolderPtr>     SessionList;
+	typedef std::deque<PooledSessionHolderPtr>    SessionStack;
+	typedef std::set<PooledSessionHolderPtr>      SessionSet;
 	typedef Poco::HashMap<std::string, bool>      FeatureMap;
 	typedef Poco::HashMap<std::string, Poco::Any> PropertyMap;
 
-	void purgeDeadSessions();
-	int deadImpl(SessionList& rSessions);
 	void applySettings(SessionImpl* pImpl);
 	void putBack(PooledSessionHolderPtr pHolder);
 	void onJanitorTimer(Poco::Timer&);
@@ -185,11 +220,17 @@ private:
 	typedef std::pair<std::string, bool> FeaturePair;
 	typedef std::map<SessionImpl*, PropertyPair> AddPropertyMap;
 	typedef std::map<SessionImpl*, FeaturePair> AddFeatureMap;
+	typedef std::atomic<Poco::UInt64> HistogramBuckets[HISTOGRAM_BUCKETS];
 
 	SessionPool(const SessionPool&);
 	SessionPool& operator = (const SessionPool&);
 
-	void closeAll(SessionList& sessionList);
+	PooledSessionHolderPtr checkout();
+	bool restore(PooledSessionHolderPtr pHolder, std::string& error);
+	void validateIdleSessions();
+	static void close(PooledSessionHolderPtr pHolder);
+	static void record(HistogramBuckets& buckets, Poco::Timestamp::TimeDiff microseconds);
+	static Histogram histogram(const HistogramBuckets& buckets);
 
 	std::string       _connector;
 	std::string       _connectionString;
@@ -198,16 +239,20 @@ private:
 	std::atomic<int>  _idleTime;
 	std::atomic<int>  _connTimeout;
 	std::atomic<int>  _nSessions;
-	SessionList       _idleSessions;
-	SessionList       _activeSessions;
+	SessionStack      _idleSessions;   // least recently used at the front
+	SessionSet        _activeSessions;
+	int               _nValidating;
+	Poco::Timestamp   _lastValidation;
 	Poco::Timer       _janitorTimer;
 	FeatureMap        _featureMap;
 	PropertyMap       _propertyMap;
 	std::atomic<bool> _shutdown;
 	AddPropertyMap    _addPropertyMap;
 	AddFeatureMap     _addFeatureMap;
+	HistogramBuckets  _waitTimes;
+	HistogramBuckets  _checkoutTimes;
 	mutable
-	Poco::Mutex _mutex;
+	Poco::FastMutex _mutex;
 
 	friend class PooledSessionImpl;
 };
@@ -0,0 +1,166 @@
+//
+// StatementCache.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  StatementCache
+//
+// Definition of the StatementCache class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_StatementCache_INCLUDED
+#define Data_StatementCache_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Mutex.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+
+
+namespace Poco {
+namespace Data {
+
+
+class Data_API StatementCache
+	/// StatementCache is a least recently used cache of prepared
+	/// statements, keyed by SQL text, owned by a session.
+	///
+	/// Connectors that support the cache take the prepared statement
+	/// for an SQL text out of the cache when a statement is compiled,
+	/// instead of preparing it again, and put it back when the statement
+	/// is destroyed or recompiled. While a prepared statement is in use,
+	/// it is not in the cache, so it is never shared by two statements.
+	///
+	/// A connector stores its prepared statement handle in a subclass
+	/// of StatementCache::Entry, whose destructor releases the handle.
+	/// An entry is released when it is evicted from the cache, when the
+	/// cache is cleared, or when the connector does not put it back,
+	/// e.g. because executing the statement failed.
+	///
+	/// Every entry carries the generation of the cache it was taken
+	/// from or created for (see stamp()). clear() starts a new
+	/// generation, so that an entry that was in use by a statement
+	/// while the cache was cleared is released instead of being put
+	/// back by put().
+	///
+	/// The cache is disabled (has a capacity of zero) by default.
+	/// See AbstractSessionImpl for the session properties controlling
+	/// the cache.
+{
+public:
+	class Data_API Entry: public Poco::RefCountedObject
+		/// The base class for a connector's prepared statement handle.
+	{
+	public:
+		typedef Poco::AutoPtr<Entry> Ptr;
+
+	protected:
+		Entry();
+		virtual ~Entry();
+
+	private:
+		Poco::UInt64 _generation;
+
+		friend class StatementCache;
+	};
+
+	explicit StatementCache(std::size_t capacity = 0);
+		/// Creates the StatementCache with the given capacity.
+
+	~StatementCache();
+		/// Destroys the StatementCache and releases all entries.
+
+	Entry::Ptr take(const std::string& sql);
+		/// Removes the entry for the given SQL text from the cache
+		/// and returns it. Returns a null pointer if there is none.
+
+	void stamp(Entry& entry) const;
+		/// Marks a newly created entry as belonging to the current
+		/// generation of the cache. Connectors must call stamp()
+		/// for every entry they create; put() releases entries
+		/// that have not been stamped.
+
+	void put(const std::string& sql, Entry::Ptr pEntry);
+		/// Adds the entry for the given SQL text to the cache, as the
+		/// most recently used one. If the cache is full, the least
+		/// recently used entry is released. If the cache already
+		/// contains an entry for the SQL text, the capacity is zero,
+		/// or the entry has been taken or created before the last
+		/// call to clear(), the given entry is released.
+
+	void clear();
+		/// Releases all entries, e.g. after a change of the database
+		/// schema has invalidated them, or before the session
+		/// disconnects. Entries that are currently in use are
+		/// released when they are passed to put().
+
+	void setCapacity(std::size_t capacity);
+		/// Sets the maximum number of entries. Releases the least
+		/// recently used entries if the cache contains more.
+
+	std::size_t getCapacity() const;
+		/// Returns the maximum number of entries.
+
+	bool isEnabled() const;
+		/// Returns true if the capacity is greater than zero.
+
+	std::size_t size() const;
+		/// Returns the number of entries.
+
+	Poco::UInt64 hits() const;
+		/// Returns the number of calls to take() that returned an entry.
+
+	Poco::UInt64 misses() const;
+		/// Returns the number of calls to take() that did not
+		/// return an entry.
+
+	double hitRatio() const;
+		/// Returns hits()/(hits() + misses()), or zero if take()
+		/// has not been called.
+
+	void resetStatistics();
+		/// Resets the number of hits and misses.
+
+private:
+	typedef std::pair<std::string, Entry::Ptr> Item;
+	typedef std::list<Item> ItemList;
+	typedef std::unordered_map<std::string, ItemList::iterator> ItemIndex;
+
+	StatementCache(const StatementCache&);
+	StatementCache& operator = (const StatementCache&);
+
+	void evict(std::size_t capacity, ItemList& released);
+
+	ItemList            _items;   // most recently used at the front
+	ItemIndex           _index;
+	std::size_t         _capacity;
+	Poco::UInt64        _generation;
+	Poco::UInt64        _hits;
+	Poco::UInt64        _misses;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline bool StatementCache::isEnabled() const
+{
+	return getCapacity() > 0;
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_StatementCache_INCLUDED
@@ -0,0 +1,113 @@
+//
+// CSVColumnarFormatter.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  CSVColumnarFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/CSVColumnarFormatter.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+CSVColumnarFormatter::CSVColumnarFormatter(char delimiter, bool header):
+	_delimiter(delimiter),
+	_header(header)
+{
+}
+
+
+CSVColumnarFormatter::~CSVColumnarFormatter()
+{
+}
+
+
+void CSVColumnarFormatter::writeBegin(const std::vector<const std::string*>& names, std::string& out)
+{
+	if (!_header) return;
+
+	for (std::size_t col = 0; col < names.size(); ++col)
+	{
+		writeFieldBegin(col, out);
+		writeString(names[col]->data(), names[col]->size(), out);
+	}
+	writeRowEnd(out);
+}
+
+
+void CSVColumnarFormatter::writeEnd(std::string& /*out*/)
+{
+}
+
+
+void CSVColumnarFormatter::writeRowBegin(std::size_t /*rowIndex*/, std::string& /*out*/)
+{
+}
+
+
+void CSVColumnarFormatter::writeRowEnd(std::string& out)
+{
+	out.append("\r\n", 2);
+}
+
+
+void CSVColumnarFormatter::writeFieldBegin(std::size_t col, std::string& out)
+{
+	if (col > 0) out += _delimiter;
+}
+
+
+void CSVColumnarFormatter::writeNull(std::string& /*out*/)
+{
+}
+
+
+void CSVColumnarFormatter::writeNumber(const char* value, std::size_t length, std::string& out)
+{
+	out.append(value, length);
+}
+
+
+void CSVColumnarFormatter::writeText(const char* value, std::size_t length, std::string& out)
+{
+	out.append(value, length);
+}
+
+
+void CSVColumnarFormatter::writeString(const char* value, std::size_t length, std::string& out)
+{
+	const char* end = value + length;
+	const char* it = value;
+	while (it != end && *it != _delimiter && *it != '"' && *it != '\r' && *it != '\n') ++it;
+	if (it == end)
+	{
+		out.append(value, length);
+		return;
+	}
+
+	out += '"';
+	const char* run = value;
+	for (it = value; it != end; ++it)
+	{
+		if (*it == '"')
+		{
+			out.append(run, it - run + 1);
+			out += '"';
+			run = it + 1;
+		}
+	}
+	out.append(run, end - run);
+	out += '"';
+}
+
+
+} } // namespace Poco::Data
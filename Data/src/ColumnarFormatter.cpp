@@ -0,0 +1,305 @@
+//
+// ColumnarFormatter.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  ColumnarFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/ColumnarFormatter.h"
+#include "Poco/Data/RecordSet.h"
+#include "Poco/Data/ColumnView.h"
+#include "Poco/Data/RowFilter.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/Data/DataException.h"
+#include "Poco/DateTime.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/UnicodeConverter.h"
+#include "Poco/UTFString.h"
+#include "Poco/UUID.h"
+#include "Poco/Format.h"
+#include <sstream>
+#include <cmath>
+
+
+namespace Poco {
+namespace Data {
+
+
+class ColumnarFormatter::ColumnWriter
+	/// Writes the values of a single column.
+{
+public:
+	virtual ~ColumnWriter()
+	{
+	}
+
+	virtual void write(ColumnarFormatter& formatter, std::size_t row, std::string& out) = 0;
+		/// Writes the value in the given row.
+
+protected:
+	void writeValue(ColumnarFormatter& formatter, bool value, std::string& out)
+	{
+		if (value)
+			formatter.writeNumber("true", 4, out);
+		else
+			formatter.writeNumber("false", 5, out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, Int8 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<int>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, UInt8 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<unsigned>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, Int16 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<int>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, UInt16 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<unsigned>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, Int32 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<int>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, UInt32 value, std::string& out)
+	{
+		writeFormatted(formatter, static_cast<unsigned>(value), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, Int64 value, std::string& out)
+	{
+		writeFormatted(formatter, value, out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, UInt64 value, std::string& out)
+	{
+		writeFormatted(formatter, value, out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, float value, std::string& out)
+	{
+		if (std::isfinite(value))
+			writeFormatted(formatter, value, out);
+		else
+			formatter.writeNull(out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, double value, std::string& out)
+	{
+		if (std::isfinite(value))
+			writeFormatted(formatter, value, out);
+		else
+			formatter.writeNull(out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const std::string& value, std::string& out)
+	{
+		formatter.writeString(value.data(), value.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const UTF16String& value, std::string& out)
+	{
+		_scratch.clear();
+		Poco::UnicodeConverter::convert(value, _scratch);
+		formatter.writeString(_scratch.data(), _scratch.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const BLOB& value, std::string& out)
+	{
+		formatter.writeString(reinterpret_cast<const char*>(value.rawContent()), value.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const CLOB& value, std::string& out)
+	{
+		formatter.writeString(value.rawContent(), value.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const Date& value, std::string& out)
+	{
+		_scratch.clear();
+		NumberFormatter::append0(_scratch, value.year(), 4);
+		_scratch += '-';
+		NumberFormatter::append0(_scratch, value.month(), 2);
+		_scratch += '-';
+		NumberFormatter::append0(_scratch, value.day(), 2);
+		formatter.writeText(_scratch.data(), _scratch.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const Time& value, std::string& out)
+	{
+		_scratch.clear();
+		NumberFormatter::append0(_scratch, value.hour(), 2);
+		_scratch += ':';
+		NumberFormatter::append0(_scratch, value.minute(), 2);
+		_scratch += ':';
+		NumberFormatter::append0(_scratch, value.second(), 2);
+		formatter.writeText(_scratch.data(), _scratch.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const DateTime& value, std::string& out)
+	{
+		_scratch.clear();
+		DateTimeFormatter::append(_scratch, value, DateTimeFormat::ISO8601_FORMAT);
+		formatter.writeText(_scratch.data(), _scratch.size(), out);
+	}
+
+	void writeValue(ColumnarFormatter& formatter, const UUID& value, std::string& out)
+	{
+		const std::string str = value.toString();
+		formatter.writeText(str.data(), str.size(), out);
+	}
+
+private:
+	template <typename N>
+	void writeFormatted(ColumnarFormatter& formatter, N value, std::string& out)
+	{
+		_scratch.clear();
+		NumberFormatter::append(_scratch, value);
+		formatter.writeNumber(_scratch.data(), _scratch.size(), out);
+	}
+
+	std::string _scratch;
+};
+
+
+template <class T>
+class ColumnarFormatter::TypedColumnWriter: public ColumnarFormatter::ColumnWriter
+	/// Writes the values of a column of type T.
+{
+public:
+	TypedColumnWriter(const ColumnView<T>& view):
+		_view(view)
+	{
+	}
+
+	void write(ColumnarFormatter& formatter, std::size_t row, std::string& out)
+	{
+		if (_view.isNull(row))
+			formatter.writeNull(out);
+		else
+			writeValue(formatter, _view[row], out);
+	}
+
+private:
+	ColumnView<T> _view;
+};
+
+
+ColumnarFormatter::ColumnarFormatter():
+	_bufferSize(DEFAULT_BUFFER_SIZE)
+{
+}
+
+
+ColumnarFormatter::~ColumnarFormatter()
+{
+}
+
+
+void ColumnarFormatter::setBufferSize(std::size_t size)
+{
+	_bufferSize = size;
+}
+
+
+void ColumnarFormatter::format(const RecordSet& recordSet, std::ostream& ostr)
+{
+	const std::size_t columnCount = recordSet.columnCount();
+	std::vector<const std::string*> names;
+	std::vector<ColumnWriterPtr> writers;
+	names.reserve(columnCount);
+	writers.reserve(columnCount);
+	for (std::size_t col = 0; col < columnCount; ++col)
+	{
+		names.push_back(&recordSet.columnName(col));
+		writers.push_back(createWriter(recordSet, col));
+	}
+
+	std::string out;
+	out.reserve(_bufferSize + _bufferSize/4);
+	writeBegin(names, out);
+
+	const std::size_t rowCount = recordSet.extractedRowCount();
+	const bool filtered = recordSet.isFiltered();
+	std::size_t rowIndex = 0;
+	for (std::size_t row = 0; row < rowCount; ++row)
+	{
+		if (filtered && !recordSet.isAllowed(row)) continue;
+
+		writeRowBegin(rowIndex++, out);
+		for (std::size_t col = 0; col < columnCount; ++col)
+		{
+			writeFieldBegin(col, out);
+			writers[col]->write(*this, row, out);
+		}
+		writeRowEnd(out);
+		if (out.size() >= _bufferSize)
+		{
+			ostr.write(out.data(), static_cast<std::streamsize>(out.size()));
+			out.clear();
+		}
+	}
+	writeEnd(out);
+	ostr.write(out.data(), static_cast<std::streamsize>(out.size()));
+}
+
+
+std::string ColumnarFormatter::format(const RecordSet& recordSet)
+{
+	std::ostringstream ostr;
+	format(recordSet, ostr);
+	return ostr.str();
+}
+
+
+ColumnarFormatter::ColumnWriterPtr ColumnarFormatter::createWriter(const RecordSet& recordSet, std::size_t col)
+{
+	switch (recordSet.columnType(col))
+	{
+	case MetaColumn::FDT_BOOL:      return ColumnWriterPtr(new TypedColumnWriter<bool>(recordSet.columnView<bool>(col)));
+	case MetaColumn::FDT_INT8:      return ColumnWriterPtr(new TypedColumnWriter<Int8>(recordSet.columnView<Int8>(col)));
+	case MetaColumn::FDT_UINT8:     return ColumnWriterPtr(new TypedColumnWriter<UInt8>(recordSet.columnView<UInt8>(col)));
+	case MetaColumn::FDT_INT16:     return ColumnWriterPtr(new TypedColumnWriter<Int16>(recordSet.columnView<Int16>(col)));
+	case MetaColumn::FDT_UINT16:    return ColumnWriterPtr(new TypedColumnWriter<UInt16>(recordSet.columnView<UInt16>(col)));
+	case MetaColumn::FDT_INT32:     return ColumnWriterPtr(new TypedColumnWriter<Int32>(recordSet.columnView<Int32>(col)));
+	case MetaColumn::FDT_UINT32:    return ColumnWriterPtr(new TypedColumnWriter<UInt32>(recordSet.columnView<UInt32>(col)));
+	case MetaColumn::FDT_INT64:     return ColumnWriterPtr(new TypedColumnWriter<Int64>(recordSet.columnView<Int64>(col)));
+	case MetaColumn::FDT_UINT64:    return ColumnWriterPtr(new TypedColumnWriter<UInt64>(recordSet.columnView<UInt64>(col)));
+	case MetaColumn::FDT_FLOAT:     return ColumnWriterPtr(new TypedColumnWriter<float>(recordSet.columnView<float>(col)));
+	case MetaColumn::FDT_DOUBLE:    return ColumnWriterPtr(new TypedColumnWriter<double>(recordSet.columnView<double>(col)));
+	case MetaColumn::FDT_STRING:    return ColumnWriterPtr(new TypedColumnWriter<std::string>(recordSet.columnView<std::string>(col)));
+	case MetaColumn::FDT_WSTRING:   return ColumnWriterPtr(new TypedColumnWriter<UTF16String>(recordSet.columnView<UTF16String>(col)));
+	case MetaColumn::FDT_BLOB:      return ColumnWriterPtr(new TypedColumnWriter<BLOB>(recordSet.columnView<BLOB>(col)));
+	case MetaColumn::FDT_CLOB:      return ColumnWriterPtr(new TypedColumnWriter<CLOB>(recordSet.columnView<CLOB>(col)));
+	case MetaColumn::FDT_DATE:      return ColumnWriterPtr(new TypedColumnWriter<Date>(recordSet.columnView<Date>(col)));
+	case MetaColumn::FDT_TIME:      return ColumnWriterPtr(new TypedColumnWriter<Time>(recordSet.columnView<Time>(col)));
+	case MetaColumn::FDT_TIMESTAMP: return ColumnWriterPtr(new TypedColumnWriter<DateTime>(recordSet.columnView<DateTime>(col)));
+	case MetaColumn::FDT_UUID:      return ColumnWriterPtr(new TypedColumnWriter<UUID>(recordSet.columnView<UUID>(col)));
+	case MetaColumn::FDT_JSON:      return ColumnWriterPtr(new TypedColumnWriter<std::string>(recordSet.columnView<std::string>(col)));
+	default:
+		throw DataException(Poco::format("Unsupported type of column %z (%s)", col, recordSet.columnName(col)));
+	}
+}
+
+
+} } // namespace Poco::Data
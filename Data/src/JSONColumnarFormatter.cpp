@@ -0,0 +1,121 @@
+//
+// JSONColumnarFormatter.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  JSONColumnarFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/JSONColumnarFormatter.h"
+#include "Poco/JSONString.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+JSONColumnarFormatter::JSONColumnarFormatter(bool compact):
+	_compact(compact)
+{
+}
+
+
+JSONColumnarFormatter::~JSONColumnarFormatter()
+{
+}
+
+
+void JSONColumnarFormatter::writeBegin(const std::vector<const std::string*>& names, std::string& out)
+{
+	_keys.clear();
+	if (_compact)
+	{
+		out.append("{\"names\":[");
+		for (std::size_t col = 0; col < names.size(); ++col)
+		{
+			if (col > 0) out += ',';
+			toJSON(*names[col], out, JSON_WRAP_STRINGS);
+		}
+		out.append("],\"values\":[");
+	}
+	else
+	{
+		// Object keys are escaped once and then copied into every row.
+		_keys.resize(names.size());
+		for (std::size_t col = 0; col < names.size(); ++col)
+		{
+			if (col > 0) _keys[col] += ',';
+			toJSON(*names[col], _keys[col], JSON_WRAP_STRINGS);
+			_keys[col] += ':';
+		}
+		out += '[';
+	}
+}
+
+
+void JSONColumnarFormatter::writeEnd(std::string& out)
+{
+	if (_compact)
+		out.append("]}\n");
+	else
+		out.append("]\n");
+}
+
+
+void JSONColumnarFormatter::writeRowBegin(std::size_t rowIndex, std::string& out)
+{
+	if (rowIndex > 0) out += ',';
+	out += '\n';
+	out += _compact ? '[' : '{';
+}
+
+
+void JSONColumnarFormatter::writeRowEnd(std::string& out)
+{
+	out += _compact ? ']' : '}';
+}
+
+
+void JSONColumnarFormatter::writeFieldBegin(std::size_t col, std::string& out)
+{
+	if (_compact)
+	{
+		if (col > 0) out += ',';
+	}
+	else out.append(_keys[col]);
+}
+
+
+void JSONColumnarFormatter::writeNull(std::string& out)
+{
+	out.append("null", 4);
+}
+
+
+void JSONColumnarFormatter::writeNumber(const char* value, std::size_t length, std::string& out)
+{
+	out.append(value, length);
+}
+
+
+void JSONColumnarFormatter::writeText(const char* value, std::size_t length, std::string& out)
+{
+	out += '"';
+	out.append(value, length);
+	out += '"';
+}
+
+
+void JSONColumnarFormatter::writeString(const char* value, std::size_t length, std::string& out)
+{
+	toJSON(value, length, out, JSON_WRAP_STRINGS);
+}
+
+
+} } // namespace Poco::Data
@@ -385,6 +385,108 @@ template Data_API const DateTime& RecordSet::value<DateTime>(const std::string&
 template Data_API const UUID& RecordSet::value<UUID>(const std::string& name, std::size_t row, bool useFilter) const;
 
 
+namespace
+{
+	template <class C>
+	bool extractsInto(const AbstractExtraction& extraction)
+	{
+		return dynamic_cast<const InternalExtraction<C>*>(&extraction) ||
+			dynamic_cast<const InternalBulkExtraction<C>*>(&extraction);
+	}
+}
+
+
+template <class T>
+ColumnView<T> RecordSet::columnView(std::size_t pos) const
+	/// Returns a typed view of the column at specified position.
+{
+	const AbstractExtractionVec& rExtractions = extractions();
+	if (pos >= rExtractions.size())
+		throw RangeException(Poco::format("Invalid column index: %z", pos));
+
+	Storage st = storage();
+	if (STORAGE_UNKNOWN == st)
+	{
+		// The container type was taken from the session
+		// when the statement was executed.
+		if (extractsInto<std::vector<T>>(*rExtractions[pos]))
+			st = STORAGE_VECTOR;
+		else if (extractsInto<std::list<T>>(*rExtractions[pos]))
+			st = STORAGE_LIST;
+		else
+			st = STORAGE_DEQUE;
+	}
+
+	switch (st)
+	{
+		case STORAGE_VECTOR:
+		{
+			const Column<std::vector<T>>& col = column<std::vector<T>>(pos);
+			return ColumnView<T>(col.data(), *rExtractions[pos], col.name());
+		}
+		case STORAGE_LIST:
+			throw InvalidAccessException("Column views are not supported for list storage.");
+		case STORAGE_DEQUE:
+		{
+			const Column<std::deque<T>>& col = column<std::deque<T>>(pos);
+			return ColumnView<T>(col.data(), *rExtractions[pos], col.name());
+		}
+		default:
+			throw IllegalStateException("Invalid storage setting.");
+	}
+}
+
+
+template Data_API ColumnView<bool> RecordSet::columnView<bool>(std::size_t pos) const;
+template Data_API ColumnView<Int8> RecordSet::columnView<Int8>(std::size_t pos) const;
+template Data_API ColumnView<UInt8> RecordSet::columnView<UInt8>(std::size_t pos) const;
+template Data_API ColumnView<Int16> RecordSet::columnView<Int16>(std::size_t pos) const;
+template Data_API ColumnView<UInt16> RecordSet::columnView<UInt16>(std::size_t pos) const;
+template Data_API ColumnView<Int32> RecordSet::columnView<Int32>(std::size_t pos) const;
+template Data_API ColumnView<UInt32> RecordSet::columnView<UInt32>(std::size_t pos) const;
+template Data_API ColumnView<Int64> RecordSet::columnView<Int64>(std::size_t pos) const;
+template Data_API ColumnView<UInt64> RecordSet::columnView<UInt64>(std::size_t pos) const;
+template Data_API ColumnView<float> RecordSet::columnView<float>(std::size_t pos) const;
+template Data_API ColumnView<double> RecordSet::columnView<double>(std::size_t pos) const;
+template Data_API ColumnView<std::string> RecordSet::columnView<std::string>(std::size_t pos) const;
+template Data_API ColumnView<UTF16String> RecordSet::columnView<UTF16String>(std::size_t pos) const;
+template Data_API ColumnView<BLOB> RecordSet::columnView<BLOB>(std::size_t pos) const;
+template Data_API ColumnView<CLOB> RecordSet::columnView<CLOB>(std::size_t pos) const;
+template Data_API ColumnView<Date> RecordSet::columnView<Date>(std::size_t pos) const;
+template Data_API ColumnView<Time> RecordSet::columnView<Time>(std::size_t pos) const;
+template Data_API ColumnView<DateTime> RecordSet::columnView<DateTime>(std::size_t pos) const;
+template Data_API ColumnView<UUID> RecordSet::columnView<UUID>(std::size_t pos) const;
+
+
+template <class T>
+ColumnView<T> RecordSet::columnView(const std::string& name) const
+	/// Returns a typed view of the column with specified name.
+{
+	return columnView<T>(metaColumn(name).position());
+}
+
+
+template Data_API ColumnView<bool> RecordSet::columnView<bool>(const std::string& name) const;
+template Data_API ColumnView<Int8> RecordSet::columnView<Int8>(const std::string& name) const;
+template Data_API ColumnView<UInt8> RecordSet::columnView<UInt8>(const std::string& name) const;
+template Data_API ColumnView<Int16> RecordSet::columnView<Int16>(const std::string& name) const;
+template Data_API ColumnView<UInt16> RecordSet::columnView<UInt16>(const std::string& name) const;
+template Data_API ColumnView<Int32> RecordSet::columnView<Int32>(const std::string& name) const;
+template Data_API ColumnView<UInt32> RecordSet::columnView<UInt32>(const std::string& name) const;
+template Data_API ColumnView<Int64> RecordSet::columnView<Int64>(const std::string& name) const;
+template Data_API ColumnView<UInt64> RecordSet::columnView<UInt64>(const std::string& name) const;
+template Data_API ColumnView<float> RecordSet::columnView<float>(const std::string& name) const;
+template Data_API ColumnView<double> RecordSet::columnView<double>(const std::string& name) const;
+template Data_API ColumnView<std::string> RecordSet::columnView<std::string>(const std::string& name) const;
+template Data_API ColumnView<UTF16String> RecordSet::columnView<UTF16String>(const std::string& name) const;
+template Data_API ColumnView<BLOB> RecordSet::columnView<BLOB>(const std::string& name) const;
+template Data_API ColumnView<CLOB> RecordSet::columnView<CLOB>(const std::string& name) const;
+template Data_API ColumnView<Date> RecordSet::columnView<Date>(const std::string& name) const;
+template Data_API ColumnView<Time> RecordSet::columnView<Time>(const std::string& name) const;
+template Data_API ColumnView<DateTime> RecordSet::columnView<DateTime>(const std::string& name) const;
+template Data_API ColumnView<UUID> RecordSet::columnView<UUID>(const std::string& name) const;
+
+
 Poco::Dynamic::Var RecordSet::value(std::size_t col, std::size_t row, bool useFilter) const
 {
 	if (useFilter && isFiltered() && !isAllowed(row))
@@ -30,9 +30,11 @@ SessionPool::SessionPool(const std::string& connector, const std::string& connec
 	_idleTime(idleTime),
 	_connTimeout(connTimeout),
 	_nSessions(0),
+	_nValidating(0),
 	_janitorTimer(1000*idleTime, 1000*idleTime/4),
 	_shutdown(false)
 {
+	resetStatistics();
 	Poco::TimerCallback<SessionPool> callback(*this, &SessionPool::onJanitorTimer);
 	_janitorTimer.start(callback);
 }
@@ -53,9 +55,13 @@ SessionPool::~SessionPool()
 
 Session SessionPool::get(const std::string& name, bool value)
 {
-	Session s = get();
-	_addFeatureMap.insert(AddFeatureMap::value_type(s.impl(),
-		std::make_pair(name, s.getFeature(name))));
+	PooledSessionHolderPtr pHolder(checkout());
+	Session s(new PooledSessionImpl(pHolder));
+	FeaturePair previous(name, s.getFeature(name));
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_addFeatureMap[pHolder->session()] = previous;
+	}
 	s.setFeature(name, value);
 
 	return s;
@@ -64,49 +70,64 @@ Session SessionPool::get(const std::string& name, bool value)
 
 Session SessionPool::get()
 {
-	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+	return Session(new PooledSessionImpl(checkout()));
+}
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	purgeDeadSessions();
 
-	if (_idleSessions.empty())
+SessionPool::PooledSessionHolderPtr SessionPool::checkout()
+{
+	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+
+	Poco::Timestamp start;
+	PooledSessionHolderPtr pHolder;
 	{
-		if (_nSessions < _maxSessions)
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (!_idleSessions.empty())
 		{
-			Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
-			applySettings(newSession.impl());
-			customizeSession(newSession);
-
-			PooledSessionHolderPtr pHolder(new PooledSessionHolder(*this, newSession.impl()));
-			_idleSessions.push_back(pHolder);
-			++_nSessions;
+			pHolder = _idleSessions.back();
+			_idleSessions.pop_back();
+			_activeSessions.insert(pHolder);
+		}
+		else if (_nSessions < _maxSessions)
+		{
+			++_nSessions; // reserve the slot while connecting
 		}
 		else throw SessionPoolExhaustedException(_connector);
 	}
 
-	PooledSessionHolderPtr pHolder(_idleSessions.front());
-	PooledSessionImplPtr pPSI(new PooledSessionImpl(pHolder));
-
-	_activeSessions.push_front(pHolder);
-	_idleSessions.pop_front();
-	return Session(pPSI);
-}
-
-
-void SessionPool::purgeDeadSessions()
-{
-	if (_shutdown) return;
-
-	SessionList::iterator it = _idleSessions.begin();
-	for (; it != _idleSessions.end(); )
+	if (!pHolder)
 	{
-		if (!(*it)->session()->isGood())
+		try
+		{
+			Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
+			applySettings(newSession.impl());
+			customizeSession(newSession);
+			pHolder = new PooledSessionHolder(*this, newSession.impl());
+		}
+		catch (...)
 		{
-			it = _idleSessions.erase(it);
 			--_nSessions;
+			throw;
+		}
+
+		bool isShutdown;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			isShutdown = _shutdown;
+			if (!isShutdown) _activeSessions.insert(pHolder);
+		}
+		if (isShutdown)
+		{
+			// shutdown() has already closed the known sessions
+			// and will not see this one
+			close(pHolder);
+			throw InvalidAccessException("Session pool has been shut down.");
 		}
-		else ++it;
 	}
+
+	pHolder->checkout();
+	record(_waitTimes, start.elapsed());
+	return pHolder;
 }
 
 
@@ -118,15 +139,15 @@ int SessionPool::capacity() const
 
 int SessionPool::used() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
+	Poco::FastMutex::ScopedLock lock(_mutex);
 	return (int) _activeSessions.size();
 }
 
 
 int SessionPool::idle() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	return (int) _idleSessions.size();
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return (int) _idleSessions.size() + _nValidating;
 }
 
 
@@ -138,11 +159,15 @@ int SessionPool::connTimeout() const
 
 int SessionPool::dead()
 {
-	int count = 0;
+	SessionStack activeSessions;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		activeSessions.assign(_activeSessions.begin(), _activeSessions.end());
+	}
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _activeSessions.begin();
-	SessionList::iterator itEnd = _activeSessions.end();
+	int count = 0;
+	SessionStack::iterator it = activeSessions.begin();
+	SessionStack::iterator itEnd = activeSessions.end();
 	for (; it != itEnd; ++it)
 	{
 		if (!(*it)->session()->isGood())
@@ -173,7 +198,7 @@ void SessionPool::setFeature(const std::string& name, bool state)
 	if (_nSessions > 0)
 		throw InvalidAccessException("Features can not be set after the first session was created.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
+	Poco::FastMutex::ScopedLock lock(_mutex);
 	_featureMap.insert(FeatureMap::ValueType(name, state));
 }
 
@@ -183,7 +208,7 @@ bool SessionPool::getFeature(const std::string& name) const
 
 	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
+	Poco::FastMutex::ScopedLock lock(_mutex);
 	FeatureMap::ConstIterator it = _featureMap.find(name);
 
 	if (_featureMap.end() == it)
@@ -200,14 +225,14 @@ void SessionPool::setProperty(const std::string& name, const Poco::Any& value)
 	if (_nSessions > 0)
 		throw InvalidAccessException("Properties can not be set after first session was created.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
+	Poco::FastMutex::ScopedLock lock(_mutex);
 	_propertyMap.insert(PropertyMap::ValueType(name, value));
 }
 
 
 Poco::Any SessionPool::getProperty(const std::string& name) const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
+	Poco::FastMutex::ScopedLock lock(_mutex);
 	PropertyMap::ConstIterator it = _propertyMap.find(name);
 
 	if (_propertyMap.end() == it)
@@ -238,52 +263,87 @@ void SessionPool::putBack(PooledSessionHolderPtr pHolder)
 {
 	if (_shutdown) return;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = std::find(_activeSessions.begin(), _activeSessions.end(), pHolder);
-	if (it != _activeSessions.end())
+	record(_checkoutTimes, pHolder->checkedOut());
+
+	// the session stays in the active set while it is being restored
+	std::string error;
+	bool good = restore(pHolder, error);
 	{
-		try
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		SessionSet::iterator it = _activeSessions.find(pHolder);
+		if (it == _activeSessions.end())
 		{
-			if (pHolder->session()->isGood())
-			{
-				pHolder->session()->reset();
-
-				// reverse settings applied at acquisition time, if any
-				AddPropertyMap::iterator pIt = _addPropertyMap.find(pHolder->session());
-				if (pIt != _addPropertyMap.end())
-					pHolder->session()->setProperty(pIt->second.first, pIt->second.second);
-
-				AddFeatureMap::iterator fIt = _addFeatureMap.find(pHolder->session());
-				if (fIt != _addFeatureMap.end())
-					pHolder->session()->setFeature(fIt->second.first, fIt->second.second);
+			// the pool has been shut down concurrently and has
+			// taken over (and closed) the active sessions
+			if (_shutdown) return;
+			poco_bugcheck_msg("Unknown session passed to SessionPool::putBack()");
+			return;
+		}
+		_activeSessions.erase(it);
 
-				// re-apply the default pool settings
-				applySettings(pHolder->session());
+		if (good && !_shutdown)
+		{
+			pHolder->access();
+			_idleSessions.push_back(pHolder);
+		}
+		else --_nSessions;
+	}
+	if (!error.empty())
+	{
+		poco_bugcheck_msg(error.c_str());
+	}
+}
 
-				pHolder->access();
-				_idleSessions.push_back(pHolder);
-			}
-			else --_nSessions;
 
-			_activeSessions.erase(it);
-		}
-		catch (const Poco::Exception& e)
+bool SessionPool::restore(PooledSessionHolderPtr pHolder, std::string& error)
+{
+	PropertyPair previousProperty;
+	FeaturePair previousFeature;
+	bool hasProperty = false;
+	bool hasFeature = false;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		AddPropertyMap::iterator pIt = _addPropertyMap.find(pHolder->session());
+		if (pIt != _addPropertyMap.end())
 		{
-			--_nSessions;
-			_activeSessions.erase(it);
-			poco_bugcheck_msg(format("Exception in SessionPool::putBack(): %s", e.displayText()).c_str());
+			previousProperty = pIt->second;
+			hasProperty = true;
+			_addPropertyMap.erase(pIt);
 		}
-		catch (...)
+		AddFeatureMap::iterator fIt = _addFeatureMap.find(pHolder->session());
+		if (fIt != _addFeatureMap.end())
 		{
-			--_nSessions;
-			_activeSessions.erase(it);
-			poco_bugcheck_msg("Unknown exception in SessionPool::putBack()");
+			previousFeature = fIt->second;
+			hasFeature = true;
+			_addFeatureMap.erase(fIt);
 		}
 	}
-	else
+
+	try
+	{
+		if (!pHolder->session()->isGood()) return false;
+
+		pHolder->session()->reset();
+
+		// reverse settings applied at acquisition time, if any
+		if (hasProperty)
+			pHolder->session()->setProperty(previousProperty.first, previousProperty.second);
+		if (hasFeature)
+			pHolder->session()->setFeature(previousFeature.first, previousFeature.second);
+
+		// re-apply the default pool settings
+		applySettings(pHolder->session());
+		return true;
+	}
+	catch (const Poco::Exception& e)
 	{
-		poco_bugcheck_msg("Unknown session passed to SessionPool::putBack()");
+		error = format("Exception in SessionPool::putBack(): %s", e.displayText());
 	}
+	catch (...)
+	{
+		error = "Unknown exception in SessionPool::putBack()";
+	}
+	return false;
 }
 
 
@@ -291,23 +351,76 @@ void SessionPool::onJanitorTimer(Poco::Timer&)
 {
 	if (_shutdown) return;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _idleSessions.begin();
-	while (_nSessions > _minSessions && it != _idleSessions.end())
+	SessionStack expired;
 	{
-		if ((*it)->idle() > _idleTime || !(*it)->session()->isGood())
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		SessionStack::iterator it = _idleSessions.begin();
+		while (_nSessions > _minSessions && it != _idleSessions.end())
 		{
-			try
+			if ((*it)->idle() > _idleTime)
 			{
-				(*it)->session()->close();
+				expired.push_back(*it);
+				it = _idleSessions.erase(it);
+				--_nSessions;
 			}
-			catch (...)
+			else ++it;
+		}
+	}
+	std::for_each(expired.begin(), expired.end(), &SessionPool::close);
+
+	validateIdleSessions();
+}
+
+
+void SessionPool::validateIdleSessions()
+{
+	// Sessions used since the previous run are known to work.
+	// The others are taken off the stack one at a time, so that
+	// get() is not blocked while a session is being checked.
+	Poco::Timestamp lastValidation = _lastValidation;
+	_lastValidation.update();
+
+	SessionStack candidates;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		for (SessionStack::iterator it = _idleSessions.begin(); it != _idleSessions.end(); ++it)
+		{
+			if ((*it)->lastUsed() < lastValidation) candidates.push_back(*it);
+		}
+	}
+
+	for (SessionStack::iterator it = candidates.begin(); it != candidates.end(); ++it)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_shutdown) return;
+			SessionStack::iterator idleIt = std::find(_idleSessions.begin(), _idleSessions.end(), *it);
+			if (idleIt == _idleSessions.end()) continue; // checked out meanwhile
+			_idleSessions.erase(idleIt);
+			++_nValidating;
+		}
+
+		bool good = false;
+		try
+		{
+			good = (*it)->session()->isGood();
+		}
+		catch (...)
+		{
+		}
+
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			--_nValidating;
+			if (good && !_shutdown)
 			{
+				// still the least recently used session
+				_idleSessions.push_front(*it);
+				continue;
 			}
-			it = _idleSessions.erase(it);
 			--_nSessions;
 		}
-		else ++it;
+		close(*it);
 	}
 }
 
@@ -315,30 +428,75 @@ void SessionPool::onJanitorTimer(Poco::Timer&)
 void SessionPool::shutdown()
 {
 	if (_shutdown.exchange(true)) return;
-	_shutdown = true;
 	_janitorTimer.stop();
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	closeAll(_idleSessions);
-	closeAll(_activeSessions);
+	SessionStack idleSessions;
+	SessionSet activeSessions;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		idleSessions.swap(_idleSessions);
+		activeSessions.swap(_activeSessions);
+		_nSessions = 0;
+	}
+	std::for_each(idleSessions.begin(), idleSessions.end(), &SessionPool::close);
+	std::for_each(activeSessions.begin(), activeSessions.end(), &SessionPool::close);
 }
 
 
-void SessionPool::closeAll(SessionList& sessionList)
+void SessionPool::close(PooledSessionHolderPtr pHolder)
 {
-	SessionList::iterator it = sessionList.begin();
-	for (; it != sessionList.end();)
+	try
 	{
-		try
-		{
-			(*it)->session()->close();
-		}
-		catch (...)
-		{
-		}
-		it = sessionList.erase(it);
-		if (_nSessions > 0) --_nSessions;
+		pHolder->session()->close();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+SessionPool::Histogram SessionPool::waitTimeHistogram() const
+{
+	return histogram(_waitTimes);
+}
+
+
+SessionPool::Histogram SessionPool::checkoutTimeHistogram() const
+{
+	return histogram(_checkoutTimes);
+}
+
+
+void SessionPool::resetStatistics()
+{
+	for (int i = 0; i < HISTOGRAM_BUCKETS; ++i)
+	{
+		_waitTimes[i].store(0, std::memory_order_relaxed);
+		_checkoutTimes[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+
+void SessionPool::record(HistogramBuckets& buckets, Poco::Timestamp::TimeDiff microseconds)
+{
+	int bucket = 0;
+	while (microseconds > 0 && bucket < HISTOGRAM_BUCKETS - 1)
+	{
+		microseconds >>= 1;
+		++bucket;
+	}
+	buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+SessionPool::Histogram SessionPool::histogram(const HistogramBuckets& buckets)
+{
+	Histogram result(HISTOGRAM_BUCKETS);
+	for (int i = 0; i < HISTOGRAM_BUCKETS; ++i)
+	{
+		result[i] = buckets[i].load(std::memory_order_relaxed);
 	}
+	return result;
 }
 
 
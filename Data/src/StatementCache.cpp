@@ -0,0 +1,176 @@
+//
+// StatementCache.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  StatementCache
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/StatementCache.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+StatementCache::Entry::Entry():
+	_generation(0)
+{
+}
+
+
+StatementCache::Entry::~Entry()
+{
+}
+
+
+StatementCache::StatementCache(std::size_t capacity):
+	_capacity(capacity),
+	_generation(1),
+	_hits(0),
+	_misses(0)
+{
+}
+
+
+StatementCache::~StatementCache()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+StatementCache::Entry::Ptr StatementCache::take(const std::string& sql)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	ItemIndex::iterator it = _index.find(sql);
+	if (it == _index.end())
+	{
+		++_misses;
+		return Entry::Ptr();
+	}
+
+	++_hits;
+	Entry::Ptr pEntry = it->second->second;
+	_items.erase(it->second);
+	_index.erase(it);
+	pEntry->_generation = _generation;
+	return pEntry;
+}
+
+
+void StatementCache::stamp(Entry& entry) const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	entry._generation = _generation;
+}
+
+
+void StatementCache::put(const std::string& sql, Entry::Ptr pEntry)
+{
+	// entries are released outside the lock, as releasing
+	// a prepared statement may require a server round trip
+	ItemList released;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (_capacity == 0 || pEntry->_generation != _generation || _index.find(sql) != _index.end()) return;
+
+		evict(_capacity - 1, released);
+		_items.push_front(Item(sql, pEntry));
+		_index[sql] = _items.begin();
+	}
+}
+
+
+void StatementCache::clear()
+{
+	ItemList released;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		++_generation;
+		evict(0, released);
+	}
+}
+
+
+void StatementCache::setCapacity(std::size_t capacity)
+{
+	ItemList released;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_capacity = capacity;
+		evict(capacity, released);
+	}
+}
+
+
+std::size_t StatementCache::getCapacity() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _capacity;
+}
+
+
+std::size_t StatementCache::size() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _items.size();
+}
+
+
+Poco::UInt64 StatementCache::hits() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _hits;
+}
+
+
+Poco::UInt64 StatementCache::misses() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _misses;
+}
+
+
+double StatementCache::hitRatio() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	Poco::UInt64 total = _hits + _misses;
+	return total ? static_cast<double>(_hits)/total : 0.0;
+}
+
+
+void StatementCache::resetStatistics()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_hits = 0;
+	_misses = 0;
+}
+
+
+void StatementCache::evict(std::size_t capacity, ItemList& released)
+{
+	while (_items.size() > capacity)
+	{
+		_index.erase(_items.back().first);
+		released.splice(released.begin(), _items, --_items.end());
+	}
+}
+
+
+} } // namespace Poco::Data
@@ -304,6 +304,16 @@ void DataTest::testProperties()
 	catch (NotSupportedException&)
 	{
 	}
+
+	// the statement cache is only available in connectors that use it
+	try
+	{
+		sess.setProperty("statementCacheSize", 16);
+		fail("statement cache not used by connector - must throw");
+	}
+	catch (NotSupportedException&)
+	{
+	}
 }
 
 
@@ -17,6 +17,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/Exception.h"
 #include "Connector.h"
+#include <numeric>
 
 
 using namespace Poco::Data::Keywords;
@@ -264,6 +265,54 @@ void SessionPoolTest::testSessionPoolContainer()
 }
 
 
+void SessionPoolTest::testSessionPoolStatistics()
+{
+	SessionPool pool("test", "cs", 1, 4, 60, 10);
+	{
+		Session s1(pool.get());
+		Session s2(pool.get());
+		s1.setFeature("f1", true);
+		s2.close();
+		s1.close();
+	}
+	assertTrue (pool.idle() == 2);
+
+	// the most recently returned session is recycled first
+	Session s3(pool.get());
+	assertTrue (s3.getFeature("f1"));
+	assertTrue (pool.idle() == 1);
+	s3.setFeature("f1", false);
+	s3.close();
+
+	// settings requested with get() are reverted
+	Session s4(pool.get("f1", true));
+	assertTrue (s4.getFeature("f1"));
+	s4.close();
+	Session s5(pool.get());
+	assertTrue (!s5.getFeature("f1"));
+	s5.close();
+
+	SessionPool::Histogram waitTimes = pool.waitTimeHistogram();
+	SessionPool::Histogram checkoutTimes = pool.checkoutTimeHistogram();
+	assertTrue (waitTimes.size() == SessionPool::HISTOGRAM_BUCKETS);
+	assertTrue (checkoutTimes.size() == SessionPool::HISTOGRAM_BUCKETS);
+	assertTrue (std::accumulate(waitTimes.begin(), waitTimes.end(), Poco::UInt64(0)) == 5);
+	assertTrue (std::accumulate(checkoutTimes.begin(), checkoutTimes.end(), Poco::UInt64(0)) == 5);
+
+	{
+		Session s6(pool.get());
+		Thread::sleep(20);
+	}
+	checkoutTimes = pool.checkoutTimeHistogram();
+	// 20 ms or more is counted in bucket 15 (16384 to 32768 us) or above
+	assertTrue (std::accumulate(checkoutTimes.begin() + 15, checkoutTimes.end(), Poco::UInt64(0)) == 1);
+
+	pool.resetStatistics();
+	waitTimes = pool.waitTimeHistogram();
+	assertTrue (std::accumulate(waitTimes.begin(), waitTimes.end(), Poco::UInt64(0)) == 0);
+}
+
+
 void SessionPoolTest::setUp()
 {
 }
@@ -280,6 +329,7 @@ CppUnit::Test* SessionPoolTest::suite()
 
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPool);
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolContainer);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolStatistics);
 
 	return pSuite;
 }
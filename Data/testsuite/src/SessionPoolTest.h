@@ -26,6 +26,7 @@ public:
 
 	void testSessionPool();
 	void testSessionPoolContainer();
+	void testSessionPoolStatistics();
 
 	void setUp();
 	void tearDown();
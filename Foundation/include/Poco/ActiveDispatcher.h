@@ -25,11 +25,15 @@
 #include "Poco/ActiveStarter.h"
 #include "Poco/ActiveRunnable.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/Mutex.h"
 
 
 namespace Poco {
 
 
+class ThreadPool;
+
+
 class Foundation_API ActiveDispatcher: protected Runnable
 	/// This class is used to implement an active object
 	/// with strictly serialized method execution.
@@ -79,6 +83,15 @@ public:
 		/// Creates the ActiveDispatcher and sets
 		/// the priority of its thread.
 
+	explicit ActiveDispatcher(ThreadPool& pool);
+		/// Creates the ActiveDispatcher. Instead of using
+		/// a thread of its own, the ActiveDispatcher executes
+		/// queued methods in threads taken from the given
+		/// ThreadPool (which may use a WorkStealingExecutor).
+		/// A pool thread is only used while methods are
+		/// queued, and methods are still executed strictly
+		/// one after another.
+
 	virtual ~ActiveDispatcher();
 		/// Destroys the ActiveDispatcher.
 
@@ -93,8 +106,14 @@ protected:
 	void stop();
 
 private:
+	void runQueued();
+
 	Thread            _thread;
 	NotificationQueue _queue;
+	ThreadPool*       _pPool;
+	bool              _scheduled;
+	FastMutex         _mutex;
+	Event             _idle;
 };
 
 
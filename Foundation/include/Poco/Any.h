@@ -101,8 +101,9 @@ public:
 
 	bool isEmpty() const
 	{
-		static char buf[SizeV+1] = {};
-		return 0 == std::memcmp(holder, buf, SizeV+1);
+		// A local holder has the local flag set, and a heap-allocated
+		// holder has a pointer; an empty Placeholder is all zeros.
+		return !isLocal() && pHolder == 0;
 	}
 
 	bool isLocal() const
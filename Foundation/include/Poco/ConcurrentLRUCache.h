@@ -0,0 +1,517 @@
+//
+// ConcurrentLRUCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ConcurrentLRUCache
+//
+// Definition of the ConcurrentLRUCache class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ConcurrentLRUCache_INCLUDED
+#define Foundation_ConcurrentLRUCache_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/RWLock.h"
+#include "Poco/Clock.h"
+#include "Poco/Timespan.h"
+#include "Poco/Exception.h"
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <set>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class AbstractConcurrentCache
+	/// The non-template base class of ConcurrentLRUCache.
+	///
+	/// Gives access to the statistics of a cache without
+	/// knowing its key and value types, e.g. for exporting
+	/// them as metrics.
+{
+public:
+	struct Statistics
+		/// Statistics collected by a concurrent cache.
+	{
+		Poco::UInt64 hits = 0;        /// Number of get() calls that found a valid entry.
+		Poco::UInt64 misses = 0;      /// Number of get() calls that found no valid entry.
+		Poco::UInt64 evictions = 0;   /// Number of entries removed to make room for new entries.
+		Poco::UInt64 expirations = 0; /// Number of entries removed because their time-to-live has passed.
+		std::size_t entries = 0;      /// Number of entries currently in the cache.
+		std::size_t bytes = 0;        /// Total size of all entries currently in the cache.
+	};
+
+	virtual ~AbstractConcurrentCache() = default;
+		/// Destroys the AbstractConcurrentCache.
+
+	virtual Statistics statistics() const = 0;
+		/// Returns a snapshot of the cache's statistics.
+};
+
+
+template <class TKey, class TValue, class THash = std::hash<TKey>>
+class ConcurrentLRUCache: public AbstractConcurrentCache
+	/// A ConcurrentLRUCache is a size-limited cache optimized
+	/// for being shared by many threads.
+	///
+	/// In contrast to LRUCache and the other caches based on
+	/// AbstractCache, which protect all entries with a single
+	/// mutex and notify their strategy of every access, the
+	/// entries of a ConcurrentLRUCache are distributed by the
+	/// hash of their key to a fixed number of shards, each
+	/// protected by its own RWLock. Threads accessing entries
+	/// in different shards do not contend for a lock, and threads
+	/// reading entries in the same shard only share a read lock.
+	///
+	/// Eviction approximates LRU with the CLOCK algorithm:
+	/// a get() only sets the referenced flag of the entry,
+	/// so no list of entries has to be reordered for a read.
+	/// If a shard is full, a clock hand sweeps over its entries,
+	/// clearing referenced flags, and evicts the first entry
+	/// not referenced since the hand passed it last.
+	///
+	/// The size of the cache can be limited by the number
+	/// of entries, and additionally by the total size of the
+	/// entries (in bytes). The size of an entry is determined by
+	/// a Weigher function given to the constructor, or is
+	/// sizeof(TValue) if no Weigher is given. Both limits are
+	/// split evenly among the shards.
+	///
+	/// Entries can be given an individual time-to-live. Expired
+	/// entries are no longer returned by get() and are removed
+	/// when a clock hand passes them or forceReplace() is called.
+	///
+	/// Values are held by SharedPtr, so a value obtained with
+	/// get() remains valid even if the entry is evicted.
+	///
+	/// The cache counts hits, misses, evictions and expirations.
+	/// See AbstractConcurrentCache::statistics(), and
+	/// Poco::Prometheus::CacheCollector for exporting them
+	/// as Prometheus metrics.
+{
+public:
+	using Weigher = std::function<std::size_t(const TKey&, const TValue&)>;
+
+	enum
+	{
+		DEFAULT_SHARDS = 16
+	};
+
+	explicit ConcurrentLRUCache(std::size_t capacity = 1024, std::size_t maxBytes = 0, int shards = DEFAULT_SHARDS, Weigher weigher = Weigher()):
+		_capacity(capacity),
+		_maxBytes(maxBytes),
+		_shardCount(1),
+		_shardShift(64),
+		_weigher(weigher)
+		/// Creates the ConcurrentLRUCache for up to capacity entries with a total
+		/// size of up to maxBytes (0 means unlimited), using the given number of shards
+		/// (rounded up to a power of two, and limited to capacity).
+	{
+		if (capacity < 1) throw InvalidArgumentException("size must be > 0");
+		poco_assert (shards > 0);
+
+		while (_shardCount < static_cast<std::size_t>(shards) && _shardCount*2 <= capacity)
+		{
+			_shardCount <<= 1;
+			--_shardShift;
+		}
+		std::size_t shardCapacity = (capacity + _shardCount - 1)/_shardCount;
+		std::size_t shardMaxBytes = maxBytes ? (maxBytes + _shardCount - 1)/_shardCount : 0;
+		_shards.reset(new Shard[_shardCount]);
+		for (std::size_t i = 0; i < _shardCount; ++i)
+		{
+			_shards[i].init(shardCapacity, shardMaxBytes);
+		}
+	}
+
+	~ConcurrentLRUCache()
+		/// Destroys the ConcurrentLRUCache.
+	{
+	}
+
+	void add(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		shardFor(key).add(key, SharedPtr<TValue>(new TValue(val)), weigh(key, val), 0);
+	}
+
+	void add(const TKey& key, const TValue& val, const Timespan& ttl)
+		/// Adds the key value pair to the cache, with the given time-to-live.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		shardFor(key).add(key, SharedPtr<TValue>(new TValue(val)), weigh(key, val), expiry(ttl));
+	}
+
+	void add(const TKey& key, SharedPtr<TValue> val)
+		/// Adds the key value pair to the cache. Note that adding a NULL SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		poco_check_ptr (val.get());
+
+		shardFor(key).add(key, val, weigh(key, *val), 0);
+	}
+
+	void add(const TKey& key, SharedPtr<TValue> val, const Timespan& ttl)
+		/// Adds the key value pair to the cache, with the given time-to-live.
+		/// Note that adding a NULL SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		poco_check_ptr (val.get());
+
+		shardFor(key).add(key, val, weigh(key, *val), expiry(ttl));
+	}
+
+	void remove(const TKey& key)
+		/// Removes an entry from the cache. If the entry is not found,
+		/// the remove is ignored.
+	{
+		shardFor(key).remove(key);
+	}
+
+	bool has(const TKey& key) const
+		/// Returns true if the cache contains a valid value for the key.
+		/// Does not count as an access of the entry.
+	{
+		return shardFor(key).has(key);
+	}
+
+	SharedPtr<TValue> get(const TKey& key)
+		/// Returns a SharedPtr of the value. The SharedPointer will remain valid
+		/// even when cache replacement removes the element.
+		/// If for the key no valid value exists, an empty SharedPtr is returned.
+	{
+		return shardFor(key).get(key);
+	}
+
+	void clear()
+		/// Removes all elements from the cache.
+	{
+		for (std::size_t i = 0; i < _shardCount; ++i) _shards[i].clear();
+	}
+
+	std::size_t size() const
+		/// Returns the number of cached elements, which may
+		/// include expired elements not removed yet.
+	{
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < _shardCount; ++i) n += _shards[i].size();
+		return n;
+	}
+
+	void forceReplace()
+		/// Removes all expired elements from the cache.
+	{
+		Clock::ClockVal now = Clock().raw();
+		for (std::size_t i = 0; i < _shardCount; ++i) _shards[i].purge(now);
+	}
+
+	std::set<TKey> getAllKeys() const
+		/// Returns a copy of all keys of valid elements stored in the cache.
+	{
+		std::set<TKey> result;
+		forEach([&result](const TKey& key, const TValue&)
+			{
+				result.insert(key);
+			});
+		return result;
+	}
+
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+		/// Iterates over all valid key-value pairs in the
+		/// cache, using a functor or lambda expression.
+		///
+		/// The given functor must take the key and value
+		/// as parameters. Only the shard containing the
+		/// current element is locked during the call.
+	{
+		Clock::ClockVal now = Clock().raw();
+		for (std::size_t i = 0; i < _shardCount; ++i)
+		{
+			RWLock::ScopedReadLock lock(_shards[i].lock);
+			for (const auto& p: _shards[i].map)
+			{
+				if (!p.second.expired(now)) fn(p.first, *p.second.pValue);
+			}
+		}
+	}
+
+	std::size_t capacity() const
+		/// Returns the maximum number of elements in the cache.
+	{
+		return _capacity;
+	}
+
+	std::size_t maxBytes() const
+		/// Returns the maximum total size of elements in the cache,
+		/// or 0 if the size is not limited.
+	{
+		return _maxBytes;
+	}
+
+	int shards() const
+		/// Returns the number of shards.
+	{
+		return static_cast<int>(_shardCount);
+	}
+
+	Statistics statistics() const
+	{
+		Statistics stats;
+		for (std::size_t i = 0; i < _shardCount; ++i)
+		{
+			const Shard& shard = _shards[i];
+			stats.hits        += shard.hits.load(std::memory_order_relaxed);
+			stats.misses      += shard.misses.load(std::memory_order_relaxed);
+			stats.evictions   += shard.evictions.load(std::memory_order_relaxed);
+			stats.expirations += shard.expirations.load(std::memory_order_relaxed);
+			stats.entries     += shard.entries.load(std::memory_order_relaxed);
+			stats.bytes       += shard.bytes.load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+private:
+	enum
+	{
+		CACHE_LINE_SIZE = 64
+	};
+
+	struct Entry
+	{
+		Entry(SharedPtr<TValue> val, std::size_t sz, Clock::ClockVal exp, std::size_t sl):
+			pValue(val),
+			size(sz),
+			expire(exp),
+			slot(sl),
+			referenced(false)
+		{
+		}
+
+		bool expired(Clock::ClockVal now) const
+		{
+			return expire != 0 && expire <= now;
+		}
+
+		SharedPtr<TValue> pValue;
+		std::size_t size;
+		Clock::ClockVal expire;
+		std::size_t slot;
+		mutable std::atomic<bool> referenced;
+	};
+
+	using Map = std::unordered_map<TKey, Entry, THash>;
+	using Slot = typename Map::value_type*;
+
+	struct alignas(CACHE_LINE_SIZE) Shard
+	{
+		Shard():
+			capacity(0),
+			maxBytes(0),
+			hand(0),
+			hits(0),
+			misses(0),
+			evictions(0),
+			expirations(0),
+			entries(0),
+			bytes(0)
+		{
+		}
+
+		void init(std::size_t cap, std::size_t maxb)
+		{
+			capacity = cap;
+			maxBytes = maxb;
+			map.reserve(cap);
+			slots.assign(cap, nullptr);
+			freeSlots.reserve(cap);
+			for (std::size_t i = cap; i > 0; --i) freeSlots.push_back(i - 1);
+		}
+
+		SharedPtr<TValue> get(const TKey& key)
+		{
+			RWLock::ScopedReadLock lock(this->lock);
+			typename Map::const_iterator it = map.find(key);
+			if (it != map.end() && !(it->second.expire != 0 && it->second.expired(Clock().raw())))
+			{
+				if (!it->second.referenced.load(std::memory_order_relaxed))
+					it->second.referenced.store(true, std::memory_order_relaxed);
+				hits.fetch_add(1, std::memory_order_relaxed);
+				return it->second.pValue;
+			}
+			misses.fetch_add(1, std::memory_order_relaxed);
+			return SharedPtr<TValue>();
+		}
+
+		bool has(const TKey& key) const
+		{
+			RWLock::ScopedReadLock lock(this->lock);
+			typename Map::const_iterator it = map.find(key);
+			return it != map.end() && !(it->second.expire != 0 && it->second.expired(Clock().raw()));
+		}
+
+		void add(const TKey& key, SharedPtr<TValue> val, std::size_t size, Clock::ClockVal expire)
+		{
+			RWLock::ScopedWriteLock lock(this->lock);
+			typename Map::iterator it = map.find(key);
+			if (it != map.end()) erase(it);
+			if (maxBytes && size > maxBytes) return;
+
+			while (freeSlots.empty() || (maxBytes && bytes + size > maxBytes))
+			{
+				evict();
+			}
+			std::size_t slot = freeSlots.back();
+			freeSlots.pop_back();
+			it = map.emplace(std::piecewise_construct,
+				std::forward_as_tuple(key),
+				std::forward_as_tuple(val, size, expire, slot)).first;
+			slots[slot] = &*it;
+			entries.store(map.size(), std::memory_order_relaxed);
+			bytes.store(bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+		}
+
+		void remove(const TKey& key)
+		{
+			RWLock::ScopedWriteLock lock(this->lock);
+			typename Map::iterator it = map.find(key);
+			if (it != map.end()) erase(it);
+		}
+
+		void clear()
+		{
+			RWLock::ScopedWriteLock lock(this->lock);
+			map.clear();
+			slots.assign(capacity, nullptr);
+			freeSlots.clear();
+			for (std::size_t i = capacity; i > 0; --i) freeSlots.push_back(i - 1);
+			hand = 0;
+			entries.store(0, std::memory_order_relaxed);
+			bytes.store(0, std::memory_order_relaxed);
+		}
+
+		std::size_t size() const
+		{
+			return entries.load(std::memory_order_relaxed);
+		}
+
+		void purge(Clock::ClockVal now)
+		{
+			RWLock::ScopedWriteLock lock(this->lock);
+			typename Map::iterator it = map.begin();
+			while (it != map.end())
+			{
+				typename Map::iterator cur = it++;
+				if (cur->second.expired(now))
+				{
+					erase(cur);
+					expirations.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		void evict()
+			/// Removes one entry, using the CLOCK algorithm.
+			/// Must be called with the write lock held and
+			/// at least one entry in the shard.
+		{
+			Clock::ClockVal now = Clock().raw();
+			for (;;)
+			{
+				Slot pSlot = slots[hand];
+				hand = hand + 1 < capacity ? hand + 1 : 0;
+				if (!pSlot) continue;
+
+				Entry& entry = pSlot->second;
+				if (entry.expired(now))
+				{
+					erase(map.find(pSlot->first));
+					expirations.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				else if (entry.referenced.load(std::memory_order_relaxed))
+				{
+					entry.referenced.store(false, std::memory_order_relaxed);
+				}
+				else
+				{
+					erase(map.find(pSlot->first));
+					evictions.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+			}
+		}
+
+		void erase(typename Map::iterator it)
+		{
+			slots[it->second.slot] = nullptr;
+			freeSlots.push_back(it->second.slot);
+			bytes.store(bytes.load(std::memory_order_relaxed) - it->second.size, std::memory_order_relaxed);
+			map.erase(it);
+			entries.store(map.size(), std::memory_order_relaxed);
+		}
+
+		mutable RWLock lock;
+		Map map;
+		std::vector<Slot> slots;
+		std::vector<std::size_t> freeSlots;
+		std::size_t capacity;
+		std::size_t maxBytes;
+		std::size_t hand;
+		std::atomic<Poco::UInt64> hits;
+		std::atomic<Poco::UInt64> misses;
+		std::atomic<Poco::UInt64> evictions;
+		std::atomic<Poco::UInt64> expirations;
+		std::atomic<std::size_t> entries;
+		std::atomic<std::size_t> bytes;
+	};
+
+	ConcurrentLRUCache(const ConcurrentLRUCache& aCache);
+	ConcurrentLRUCache& operator = (const ConcurrentLRUCache& aCache);
+
+	Shard& shardFor(const TKey& key) const
+	{
+		// Fibonacci hashing, so that the shard does not depend on the
+		// same (low) bits of the hash value as the bucket within the shard.
+		Poco::UInt64 h = static_cast<Poco::UInt64>(THash()(key))*0x9E3779B97F4A7C15ULL;
+		return _shards[_shardCount > 1 ? static_cast<std::size_t>(h >> _shardShift) : 0];
+	}
+
+	std::size_t weigh(const TKey& key, const TValue& val) const
+	{
+		return _weigher ? _weigher(key, val) : sizeof(TValue);
+	}
+
+	static Clock::ClockVal expiry(const Timespan& ttl)
+	{
+		return Clock().raw() + ttl.totalMicroseconds();
+	}
+
+	std::size_t _capacity;
+	std::size_t _maxBytes;
+	std::size_t _shardCount;
+	int _shardShift;
+	Weigher _weigher;
+	std::unique_ptr<Shard[]> _shards;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ConcurrentLRUCache_INCLUDED
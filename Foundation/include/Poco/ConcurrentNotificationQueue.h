@@ -0,0 +1,195 @@
+//
+// ConcurrentNotificationQueue.h
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  ConcurrentNotificationQueue
+//
+// Definition of the ConcurrentNotificationQueue class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ConcurrentNotificationQueue_INCLUDED
+#define Foundation_ConcurrentNotificationQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Notification.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class NotificationCenter;
+
+
+class Foundation_API ConcurrentNotificationQueue
+	/// A bounded, lock-free multi-producer/multi-consumer
+	/// variant of NotificationQueue.
+	///
+	/// The queue is a ring buffer of fixed capacity (rounded
+	/// up to a power of two). Each slot carries a sequence number
+	/// that tells producers and consumers whether the slot
+	/// is ready to be written or read, so that enqueueing and
+	/// dequeueing only take a single compare-and-swap on the
+	/// respective position counter in the common case. Neither
+	/// operation allocates memory.
+	///
+	/// Consumers only block if the queue is empty. Blocking
+	/// is done in the style of a futex: the number of waiting
+	/// consumers is kept in an atomic counter, and producers
+	/// only take the lock used for waking up consumers if the
+	/// counter is non-zero.
+	///
+	/// If the queue is full, enqueueNotification() yields
+	/// until a slot becomes available; tryEnqueueNotification()
+	/// returns false instead.
+	///
+	/// In contrast to NotificationQueue, notifications cannot
+	/// be enqueued at the front of the queue or removed from
+	/// the queue, and the order of notifications enqueued
+	/// concurrently by different threads is not defined.
+	///
+	/// The same shutdown sequence as for NotificationQueue
+	/// should be used.
+{
+public:
+	enum
+	{
+		DEFAULT_CAPACITY = 1024
+	};
+
+	explicit ConcurrentNotificationQueue(std::size_t capacity = DEFAULT_CAPACITY);
+		/// Creates the ConcurrentNotificationQueue with room for at least
+		/// capacity notifications.
+
+	~ConcurrentNotificationQueue();
+		/// Destroys the ConcurrentNotificationQueue.
+
+	void enqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO).
+		/// The queue takes ownership of the notification, thus
+		/// a call like
+		///     notificationQueue.enqueueNotification(new MyNotification);
+		/// does not result in a memory leak.
+		///
+		/// Waits until there is room in the queue if the queue is full.
+
+	bool tryEnqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO), if the queue is not full.
+		///
+		/// Returns true if the notification has been enqueued,
+		/// or false if the queue is full.
+
+	Notification* dequeueNotification();
+		/// Dequeues the next pending notification.
+		/// Returns 0 (null) if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+
+	Notification* waitDequeueNotification();
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		/// This method returns 0 (null) if wakeUpAll()
+		/// has been called by another thread.
+
+	Notification* waitDequeueNotification(long milliseconds);
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns 0 (null) if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+
+	void dispatch(NotificationCenter& notificationCenter);
+		/// Dispatches all queued notifications to the given
+		/// notification center.
+
+	void wakeUpAll();
+		/// Wakes up all threads that wait for a notification.
+
+	bool empty() const;
+		/// Returns true if the queue is empty.
+
+	int size() const;
+		/// Returns the number of notifications in the queue.
+		/// The returned value is only a snapshot if other
+		/// threads are accessing the queue concurrently.
+
+	std::size_t capacity() const;
+		/// Returns the maximum number of notifications in the queue.
+
+	void clear();
+		/// Removes all notifications from the queue.
+
+	bool hasIdleThreads() const;
+		/// Returns true if the queue has at least one thread waiting
+		/// for a notification.
+
+private:
+	struct Cell
+	{
+		std::atomic<std::size_t> sequence;
+		Notification* pNf;
+	};
+
+	enum
+	{
+		CACHE_LINE_SIZE = 64,
+		SPIN_COUNT = 64
+	};
+
+	ConcurrentNotificationQueue(const ConcurrentNotificationQueue&);
+	ConcurrentNotificationQueue& operator = (const ConcurrentNotificationQueue&);
+
+	bool push(Notification* pNf);
+	Notification* pop();
+	Notification* wait(long milliseconds);
+	void notifyOne();
+
+	std::size_t              _capacity;
+	std::size_t              _mask;
+	std::unique_ptr<Cell[]>  _cells;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _enqueuePos;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _dequeuePos;
+	alignas(CACHE_LINE_SIZE) std::atomic<int> _waiters;
+	std::atomic<unsigned> _wakeUpCount;
+	FastMutex                _mutex;
+	Condition                _nfAvailable;
+};
+
+
+//
+// inlines
+//
+inline std::size_t ConcurrentNotificationQueue::capacity() const
+{
+	return _capacity;
+}
+
+
+inline bool ConcurrentNotificationQueue::hasIdleThreads() const
+{
+	return _waiters > 0;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ConcurrentNotificationQueue_INCLUDED
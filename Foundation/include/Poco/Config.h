@@ -156,6 +156,13 @@
 // #define POCO_NET_NO_UNIX_SOCKET
 
 
+// No io_uring support
+// Define to disable the io_uring backend of
+// Poco::Net::SocketProactor on Linux.
+// See Net/Net.h
+// #define POCO_NET_NO_IO_URING
+
+
 // Define to nonzero to enable move semantics
 // on classes where it introduces a new state.
 // For explanation, see:
@@ -26,6 +26,7 @@
 #include "Poco/Dynamic/VarHolder.h"
 #include "Poco/Dynamic/VarIterator.h"
 #include <typeinfo>
+#include <type_traits>
 #include <map>
 #include <set>
 
@@ -139,6 +140,14 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (typeOf<T>() != TYPE_OTHER)
+		{
+			if (_type != TYPE_OTHER)
+			{
+				convertValue(pHolder, val);
+				return;
+			}
+		}
 		pHolder->convert(val);
 	}
 
@@ -161,6 +170,18 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (typeOf<T>() != TYPE_OTHER)
+		{
+			if (_type == typeOf<T>())
+				return static_cast<VarHolderImpl<T>*>(pHolder)->value();
+
+			if (_type != TYPE_OTHER)
+			{
+				T result;
+				convertValue(pHolder, result);
+				return result;
+			}
+		}
 		if (typeid(T) == pHolder->type()) return extract<T>();
 
 		T result;
@@ -182,19 +203,7 @@ public:
 		/// not available for the given type.
 		/// Throws InvalidAccessException if Var is empty.
 	{
-		VarHolder* pHolder = content();
-
-		if (!pHolder)
-				throw InvalidAccessException("Can not convert empty value.");
-
-		if (typeid(T) == pHolder->type())
-			return extract<T>();
-		else
-		{
-			T result;
-			pHolder->convert(result);
-			return result;
-		}
+		return convert<T>();
 	}
 
 	template <typename T>
@@ -208,6 +217,11 @@ public:
 	{
 		VarHolder* pHolder = content();
 
+		if constexpr (typeOf<T>() != TYPE_OTHER)
+		{
+			if (_type == typeOf<T>())
+				return static_cast<VarHolderImpl<T>*>(pHolder)->value();
+		}
 		if (pHolder && pHolder->type() == typeid(T))
 		{
 			VarHolderImpl<T>* pHolderImpl = static_cast<VarHolderImpl<T>*>(pHolder);
@@ -537,6 +551,77 @@ public:
 		/// a different result than Var::convert<std::string>() and Var::toString()!
 
 private:
+	enum ValueType
+		/// The types of values that are converted without
+		/// virtual function calls.
+	{
+		TYPE_OTHER = 0,
+		TYPE_INT8,
+		TYPE_INT16,
+		TYPE_INT32,
+		TYPE_INT64,
+		TYPE_UINT8,
+		TYPE_UINT16,
+		TYPE_UINT32,
+		TYPE_UINT64,
+		TYPE_BOOL,
+		TYPE_FLOAT,
+		TYPE_DOUBLE,
+		TYPE_CHAR,
+		TYPE_STRING
+	};
+
+	template <typename T>
+	static constexpr ValueType typeOf()
+	{
+		if constexpr (std::is_same<T, Int8>::value) return TYPE_INT8;
+		else if constexpr (std::is_same<T, Int16>::value) return TYPE_INT16;
+		else if constexpr (std::is_same<T, Int32>::value) return TYPE_INT32;
+		else if constexpr (std::is_same<T, Int64>::value) return TYPE_INT64;
+		else if constexpr (std::is_same<T, UInt8>::value) return TYPE_UINT8;
+		else if constexpr (std::is_same<T, UInt16>::value) return TYPE_UINT16;
+		else if constexpr (std::is_same<T, UInt32>::value) return TYPE_UINT32;
+		else if constexpr (std::is_same<T, UInt64>::value) return TYPE_UINT64;
+		else if constexpr (std::is_same<T, bool>::value) return TYPE_BOOL;
+		else if constexpr (std::is_same<T, float>::value) return TYPE_FLOAT;
+		else if constexpr (std::is_same<T, double>::value) return TYPE_DOUBLE;
+		else if constexpr (std::is_same<T, char>::value) return TYPE_CHAR;
+		else if constexpr (std::is_same<T, std::string>::value) return TYPE_STRING;
+		else return TYPE_OTHER;
+	}
+
+	template <typename H, typename T>
+	static void convertHolder(VarHolder* pHolder, T& val)
+		/// Calls VarHolderImpl<H>::convert() without a virtual function call.
+	{
+		static_cast<VarHolderImpl<H>*>(pHolder)->VarHolderImpl<H>::convert(val);
+	}
+
+	template <typename T>
+	void convertValue(VarHolder* pHolder, T& val) const
+		/// Converts the value held by pHolder, which must be of
+		/// the type given by _type, which must not be TYPE_OTHER.
+		/// T must be one of the types in ValueType.
+	{
+		switch (_type)
+		{
+		case TYPE_INT8:   convertHolder<Int8>(pHolder, val); break;
+		case TYPE_INT16:  convertHolder<Int16>(pHolder, val); break;
+		case TYPE_INT32:  convertHolder<Int32>(pHolder, val); break;
+		case TYPE_INT64:  convertHolder<Int64>(pHolder, val); break;
+		case TYPE_UINT8:  convertHolder<UInt8>(pHolder, val); break;
+		case TYPE_UINT16: convertHolder<UInt16>(pHolder, val); break;
+		case TYPE_UINT32: convertHolder<UInt32>(pHolder, val); break;
+		case TYPE_UINT64: convertHolder<UInt64>(pHolder, val); break;
+		case TYPE_BOOL:   convertHolder<bool>(pHolder, val); break;
+		case TYPE_FLOAT:  convertHolder<float>(pHolder, val); break;
+		case TYPE_DOUBLE: convertHolder<double>(pHolder, val); break;
+		case TYPE_CHAR:   convertHolder<char>(pHolder, val); break;
+		case TYPE_STRING: convertHolder<std::string>(pHolder, val); break;
+		default:          pHolder->convert(val); break;
+		}
+	}
+
 	Var& getAt(std::size_t n);
 	Var& getAt(const std::string& n);
 
@@ -601,16 +686,20 @@ private:
 	{
 	}
 
-	template<typename ValueType>
-	void construct(const ValueType& value)
+	template<typename T>
+	void construct(const T& value)
 	{
-		_placeholder.assign<VarHolderImpl<ValueType>, ValueType>(value);
+		_placeholder.assign<VarHolderImpl<T>, T>(value);
+		_type = typeOf<T>();
 	}
 
 	void construct(const char* value);
 	void construct(const Var& other);
 
 	Placeholder<VarHolder> _placeholder;
+	ValueType              _type;
+		/// The type of the value, if it is one of the types in
+		/// ValueType, otherwise, or if the Var is empty, TYPE_OTHER.
 };
 
 
@@ -627,13 +716,17 @@ inline void Var::construct(const char* value)
 {
 	std::string val(value);
 	_placeholder.assign<VarHolderImpl<std::string>, std::string>(val);
+	_type = TYPE_STRING;
 }
 
 
 inline void Var::construct(const Var& other)
 {
 	if (!other.isEmpty())
+	{
 		other.content()->clone(&_placeholder);
+		_type = other._type;
+	}
 }
 
 
@@ -644,6 +737,7 @@ inline void Var::swap(Var& other)
 	if (!_placeholder.isLocal() && !other._placeholder.isLocal())
 	{
 		_placeholder.swap(other._placeholder);
+		std::swap(_type, other._type);
 	}
 	else
 	{
@@ -23,6 +23,8 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Timespan.h"
 #include "Poco/Mutex.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
 
 
 namespace Poco {
@@ -162,6 +164,39 @@ class Foundation_API FileChannel: public Channel
 	///            if it exists (unless other conditions for a rotation are met).
 	///            This is the default.
 	///
+	/// For high message rates, the channel can coalesce log messages in
+	/// a write buffer and synchronize the log file with the storage device
+	/// only periodically ("group sync"), instead of issuing a system call
+	/// for every message. This is controlled by the following properties.
+	///
+	/// The bufferSize property specifies the size of the write buffer in
+	/// bytes (a "K" or "M" suffix can be used for kilobytes or megabytes).
+	/// Messages are written to the buffer and the buffer is written
+	/// to the file with a single system call when it is full, when a
+	/// sync is due, when the log file is rotated, or when the channel is
+	/// closed. The default is 0, which disables buffering. Note that
+	/// buffered messages not yet written to the file are lost if the
+	/// process terminates abnormally.
+	///
+	/// The syncInterval property specifies the maximum time in milliseconds
+	/// that written messages can remain unsynchronized. If set to a value
+	/// greater than zero, a background thread periodically writes the buffer
+	/// to the file and synchronizes the file with the storage device.
+	/// The default is 0 (no periodic sync).
+	///
+	/// The syncSize property specifies the maximum number of bytes
+	/// (again with optional "K" or "M" suffix) that can be written
+	/// before the log file is synchronized with the storage device.
+	/// The default is 0 (no size-based sync).
+	///
+	/// The preallocate property specifies the number of bytes to allocate
+	/// on disk ahead of the end of the log file, which reduces fragmentation
+	/// and file system metadata updates. This is only supported on Linux.
+	/// The default is 0 (no preallocation).
+	///
+	/// With buffering or group sync enabled, the flush property should
+	/// be false, as flushing every message defeats their purpose.
+	///
 	/// For a more lightweight file channel class, see SimpleFileChannel.
 {
 public:
@@ -205,6 +240,16 @@ public:
 		///                   for details.
 		///   * rotateOnOpen: Specifies whether an existing log file should be
 		///                   rotated and archived when the channel is opened.
+		///   * bufferSize:   The size of the write buffer in bytes.
+		///                   See the FileChannel class for details.
+		///   * syncInterval: The interval in milliseconds for periodically
+		///                   synchronizing the log file with the storage device.
+		///                   See the FileChannel class for details.
+		///   * syncSize:     The number of bytes after which the log file is
+		///                   synchronized with the storage device.
+		///                   See the FileChannel class for details.
+		///   * preallocate:  The number of bytes to preallocate on disk.
+		///                   See the FileChannel class for details.
 
 	std::string getProperty(const std::string& name) const;
 		/// Returns the value of the property with the given name.
@@ -241,6 +286,10 @@ public:
 	static const std::string PROP_PURGECOUNT;
 	static const std::string PROP_FLUSH;
 	static const std::string PROP_ROTATEONOPEN;
+	static const std::string PROP_BUFFERSIZE;
+	static const std::string PROP_SYNCINTERVAL;
+	static const std::string PROP_SYNCSIZE;
+	static const std::string PROP_PREALLOCATE;
 
 protected:
 	~FileChannel();
@@ -252,12 +301,21 @@ protected:
 	void setPurgeCount(const std::string& count);
 	void setFlush(const std::string& flush);
 	void setRotateOnOpen(const std::string& rotateOnOpen);
+	void setBufferSize(const std::string& size);
+	void setSyncInterval(const std::string& interval);
+	void setSyncSize(const std::string& size);
+	void setPreallocate(const std::string& size);
 	void purge();
 
 private:
+	void setupFile();
+	void startSync();
+	void stopSync();
+	void runSync();
 	bool setNoPurge(const std::string& value);
 	int extractDigit(const std::string& value, std::string::const_iterator* nextToDigit = NULL) const;
 	Timespan::TimeDiff extractFactor(const std::string& value, std::string::const_iterator start) const;
+	UInt64 extractSize(const std::string& name, const std::string& value) const;
 
 	RotateStrategy* createRotationStrategy(const std::string& rotation, const std::string& times) const;
 	ArchiveStrategy* createArchiveStrategy(const std::string& archive, const std::string& times) const;
@@ -271,11 +329,17 @@ private:
 	std::string      _purgeCount;
 	bool             _flush;
 	bool             _rotateOnOpen;
+	std::size_t      _bufferSize;
+	long             _syncInterval;
+	UInt64           _syncSize;
+	UInt64           _preallocate;
 	LogFile*         _pFile;
 	RotateStrategy*  _pRotateStrategy;
 	ArchiveStrategy* _pArchiveStrategy;
 	PurgeStrategy*   _pPurgeStrategy;
 	FastMutex        _mutex;
+	Thread           _syncThread;
+	Event            _syncStop;
 };
 
 
@@ -0,0 +1,75 @@
+//
+// JSONFormatter.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  JSONFormatter
+//
+// Definition of the JSONFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_JSONFormatter_INCLUDED
+#define Foundation_JSONFormatter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/StructuredFormatter.h"
+#include "Poco/Message.h"
+
+
+namespace Poco {
+
+
+class Foundation_API JSONFormatter: public StructuredFormatter
+	/// This Formatter formats a log message as a single-line
+	/// JSON object, suitable for log shippers and log processing
+	/// pipelines that ingest JSON.
+	///
+	/// The object contains the following members, in this order:
+	///
+	///   * timestamp - the message date/time in ISO 8601 format,
+	///     with fractional seconds (e.g., "2005-01-01T14:30:15.500000Z")
+	///   * priority - the message priority (Fatal, Critical, Error,
+	///     Warning, Notice, Information, Debug, Trace)
+	///   * source - the message source
+	///   * text - the message text
+	///   * thread - the message thread name (only if not empty)
+	///   * tid - the message thread identifier
+	///   * pid - the message process identifier
+	///   * file - the source file path (only if set and sourceLocation is true)
+	///   * line - the source line number (only if file is written)
+	///
+	/// These are followed by one member for every message parameter
+	/// (see Message::set()), with the parameter name as key.
+	///
+	/// Strings are escaped with Poco::toJSON() and written directly
+	/// into the output string; no intermediate JSON object is created.
+	///
+	/// The "times" and "sourceLocation" properties are supported
+	/// (see StructuredFormatter::setProperty()).
+{
+public:
+	using Ptr = AutoPtr<JSONFormatter>;
+
+	JSONFormatter();
+		/// Creates a JSONFormatter.
+
+	~JSONFormatter();
+		/// Destroys the JSONFormatter.
+
+	void format(const Message& msg, std::string& text);
+		/// Formats the message as JSON object and appends
+		/// the result to text.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_JSONFormatter_INCLUDED
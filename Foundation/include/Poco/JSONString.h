@@ -67,6 +67,21 @@ std::string Foundation_API toJSON(const std::string& value, int options = Poco::
 	/// If escapeAllUnicode is true, all unicode characters will be escaped, otherwise only the compulsory ones.
 
 
+void Foundation_API toJSON(const std::string& value, std::string& out, int options = Poco::JSON_WRAP_STRINGS);
+	/// Formats string value by escaping control characters and
+	/// appends the result to out, without creating temporary
+	/// strings for the unescaped parts.
+	/// See toJSON(const std::string&, std::ostream&, int) for
+	/// a description of the options.
+
+
+void Foundation_API toJSON(const char* value, std::size_t length, std::string& out, int options = Poco::JSON_WRAP_STRINGS);
+	/// Formats the string value given by value and length by
+	/// escaping control characters and appends the result to out.
+	/// See toJSON(const std::string&, std::ostream&, int) for
+	/// a description of the options.
+
+
 
 } // namespace Poco
 
@@ -20,6 +20,8 @@
 #include "Poco/Foundation.h"
 #include "Poco/Timestamp.h"
 #include "Poco/FileStream.h"
+#include <vector>
+#include <memory>
 
 namespace Poco {
 
@@ -39,6 +41,58 @@ public:
 		/// Writes the given text to the log file.
 		/// If flush is true, the text will be immediately
 		/// flushed to the file.
+		///
+		/// If a write buffer has been set up with setBufferSize(),
+		/// the text is appended to the buffer and only written to
+		/// the file once the buffer is full or flush() is called.
+		/// In this case, a true flush argument is equivalent
+		/// to calling sync() after appending the text.
+
+	void setBufferSize(std::size_t size);
+		/// Sets the size of the write buffer in bytes.
+		///
+		/// The size is rounded up to a multiple of BUFFER_CHUNK_SIZE.
+		/// The buffer consists of page-aligned chunks, which are
+		/// written to the file with a single system call (writev()
+		/// on POSIX platforms) when the buffer is full or when
+		/// flush() is called.
+		///
+		/// A size of 0 (the default) disables buffering.
+		/// Any buffered data is flushed before the buffer is resized.
+
+	std::size_t getBufferSize() const;
+		/// Returns the size of the write buffer in bytes.
+
+	void setPreallocation(UInt64 size);
+		/// Sets the number of bytes to preallocate on disk ahead
+		/// of the current end of the file.
+		///
+		/// Preallocating space reduces fragmentation and metadata
+		/// updates for files that grow by many small appends.
+		/// Preallocated space is allocated with fallocate() and
+		/// does not change the visible file size. Any unused space
+		/// is released when the LogFile is destroyed.
+		///
+		/// Preallocation is only supported on Linux and is silently
+		/// ignored on other platforms or if the file system does
+		/// not support it.
+
+	UInt64 getPreallocation() const;
+		/// Returns the number of bytes to preallocate.
+
+	void flush();
+		/// Writes any buffered data to the file.
+		///
+		/// Throws a WriteFileException if the data cannot be written.
+
+	void sync();
+		/// Writes any buffered data to the file and makes sure
+		/// that all data written so far has been transferred to
+		/// the storage device (using fdatasync() on Linux).
+
+	UInt64 unsyncedBytes() const;
+		/// Returns the number of bytes written (or buffered)
+		/// since the last call to sync().
 
 	UInt64 size() const;
 		/// Returns the current size in bytes of the log file.
@@ -49,11 +103,34 @@ public:
 	const std::string& path() const;
 		/// Returns the path given in the constructor.
 
+	enum
+	{
+		BUFFER_CHUNK_SIZE = 65536
+	};
+
+protected:
+	void append(const char* data, std::size_t length);
+	void preallocate(UInt64 offset, UInt64 end);
+
 private:
+	struct Chunk;
+	using ChunkPtr = std::unique_ptr<Chunk>;
+	using ChunkVec = std::vector<ChunkPtr>;
+
+	void discard(std::size_t length);
+		/// Removes the first length bytes from the buffer
+		/// and moves the remaining data to the front.
+
 	std::string _path;
 	mutable Poco::FileOutputStream _str;
 	Timestamp _creationDate;
 	UInt64 _size;
+	UInt64 _syncedSize;
+	UInt64 _preallocation;
+	UInt64 _allocatedSize;
+	ChunkVec _chunks;
+	std::size_t _chunkIndex;
+	std::size_t _chunkOffset;
 };
 
 
@@ -0,0 +1,79 @@
+//
+// LogfmtFormatter.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  LogfmtFormatter
+//
+// Definition of the LogfmtFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_LogfmtFormatter_INCLUDED
+#define Foundation_LogfmtFormatter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/StructuredFormatter.h"
+#include "Poco/Message.h"
+
+
+namespace Poco {
+
+
+class Foundation_API LogfmtFormatter: public StructuredFormatter
+	/// This Formatter formats a log message in logfmt format,
+	/// a sequence of space-separated key=value pairs, e.g.:
+	///
+	///     timestamp=2005-01-01T14:30:15.500000Z priority=Error source=TestSource text="Test message text" tid=1 pid=1234
+	///
+	/// The following keys are written, in this order:
+	///
+	///   * timestamp - the message date/time in ISO 8601 format,
+	///     with fractional seconds
+	///   * priority - the message priority (Fatal, Critical, Error,
+	///     Warning, Notice, Information, Debug, Trace)
+	///   * source - the message source
+	///   * text - the message text
+	///   * thread - the message thread name (only if not empty)
+	///   * tid - the message thread identifier
+	///   * pid - the message process identifier
+	///   * file - the source file path (only if set and sourceLocation is true)
+	///   * line - the source line number (only if file is written)
+	///
+	/// These are followed by one pair for every message parameter
+	/// (see Message::set()), with the parameter name as key.
+	/// Characters not allowed in a key (space, '=', '"' and
+	/// control characters) are replaced with an underscore.
+	///
+	/// Values that are empty or contain space, '=', '"' or control
+	/// characters are enclosed in double quotes and escaped
+	/// with Poco::toJSON(). All other values are written as they are.
+	///
+	/// The "times" and "sourceLocation" properties are supported
+	/// (see StructuredFormatter::setProperty()).
+{
+public:
+	using Ptr = AutoPtr<LogfmtFormatter>;
+
+	LogfmtFormatter();
+		/// Creates a LogfmtFormatter.
+
+	~LogfmtFormatter();
+		/// Destroys the LogfmtFormatter.
+
+	void format(const Message& msg, std::string& text);
+		/// Formats the message as logfmt line and appends
+		/// the result to text.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_LogfmtFormatter_INCLUDED
@@ -22,6 +22,7 @@
 #include "Poco/Channel.h"
 #include "Poco/Message.h"
 #include "Poco/Format.h"
+#include "Poco/RingBufferRecord.h"
 #include "Poco/AutoPtr.h"
 #include <map>
 #include <vector>
@@ -33,6 +34,7 @@ namespace Poco {
 
 
 class Exception;
+class RingBufferChannel;
 
 
 class Foundation_API Logger: public Channel
@@ -75,6 +77,11 @@ class Foundation_API Logger: public Channel
 	/// Variants of these macros that allow message formatting with Poco::format()
 	/// are also available.
 	///
+	/// If a logger is connected to a RingBufferChannel, messages are passed
+	/// to it without creating a Message object, and the formatting of
+	/// messages logged with the format-string variants of fatal(), critical(),
+	/// etc. is deferred to the channel's background thread.
+	///
 	/// Examples:
 	///     poco_warning(logger, "This is a warning");
 	///     poco_information_f(logger, "An informational message with args: %d, %d", 1, 2);
@@ -157,7 +164,7 @@ public:
 	void fatal(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (fatal())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_FATAL);
+			logFormatted(Message::PRIO_FATAL, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void critical(const std::string& msg);
@@ -180,7 +187,7 @@ public:
 	void critical(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (critical())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_CRITICAL);
+			logFormatted(Message::PRIO_CRITICAL, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void error(const std::string& msg);
@@ -203,7 +210,7 @@ public:
 	void error(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (error())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_ERROR);
+			logFormatted(Message::PRIO_ERROR, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void warning(const std::string& msg);
@@ -226,7 +233,7 @@ public:
 	void warning(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (warning())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_WARNING);
+			logFormatted(Message::PRIO_WARNING, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void notice(const std::string& msg);
@@ -249,7 +256,7 @@ public:
 	void notice(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (notice())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_NOTICE);
+			logFormatted(Message::PRIO_NOTICE, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void information(const std::string& msg);
@@ -272,7 +279,7 @@ public:
 	void information(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (information())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_INFORMATION);
+			logFormatted(Message::PRIO_INFORMATION, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void debug(const std::string& msg);
@@ -295,7 +302,7 @@ public:
 	void debug(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (debug())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_DEBUG);
+			logFormatted(Message::PRIO_DEBUG, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void trace(const std::string& msg);
@@ -318,7 +325,7 @@ public:
 	void trace(const std::string& fmt, T arg1, Args&&... args)
 	{
 		if (trace())
-			logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), Message::PRIO_TRACE);
+			logFormatted(Message::PRIO_TRACE, fmt, arg1, std::forward<Args>(args)...);
 	}
 
 	void dump(const std::string& msg, const void* buffer, std::size_t length, Message::Priority prio = Message::PRIO_DEBUG);
@@ -479,8 +486,43 @@ private:
 
 	void logAlways(const std::string& text, Message::Priority prio);
 
+	void logToRing(const std::string& text, Message::Priority prio, const char* file = 0, LineNumber line = 0);
+		/// Writes the message into the attached RingBufferChannel.
+
+	char* beginFormat(Message::Priority prio, const std::string& fmt, int argc, std::size_t argsSize);
+		/// Starts a deferred-format record in the attached RingBufferChannel.
+		/// Returns a pointer to the location of the first argument, or null
+		/// if the message must be discarded.
+
+	void endFormat();
+		/// Publishes the record started with beginFormat().
+
+	template <typename T, typename... Args>
+	void logFormatted(Message::Priority prio, const std::string& fmt, T arg1, Args&&... args)
+		/// Passes the format string and arguments to a RingBufferChannel,
+		/// which defers formatting to its background thread, or formats
+		/// the message and sends it to the attached channel.
+	{
+		if constexpr (RingBufferRecord::isDeferrable<T>() && (RingBufferRecord::isDeferrable<Args>() && ...))
+		{
+			if (_pRingChannel)
+			{
+				char* p = beginFormat(prio, fmt, 1 + sizeof...(Args), RingBufferRecord::argSize(arg1) + (RingBufferRecord::argSize(args) + ... + 0));
+				if (p)
+				{
+					p = RingBufferRecord::writeArg(p, arg1);
+					((p = RingBufferRecord::writeArg(p, args)), ...);
+					endFormat();
+				}
+				return;
+			}
+		}
+		logAlways(Poco::format(fmt, arg1, std::forward<Args>(args)...), prio);
+	}
+
 	std::string _name;
 	Channel::Ptr _pChannel;
+	RingBufferChannel* _pRingChannel;
 	int         _level;
 
 	// definitions in Foundation.cpp
@@ -785,7 +827,10 @@ inline void Logger::log(const std::string& text, Message::Priority prio)
 {
 	if (_level >= prio && _pChannel)
 	{
-		_pChannel->log(Message(_name, text, prio));
+		if (_pRingChannel)
+			logToRing(text, prio);
+		else
+			_pChannel->log(Message(_name, text, prio));
 	}
 }
 
@@ -794,7 +839,10 @@ inline void Logger::logNPC(const std::string& text, Message::Priority prio)
 {
 	if (_pChannel)
 	{
-		_pChannel->log(Message(_name, text, prio));
+		if (_pRingChannel)
+			logToRing(text, prio);
+		else
+			_pChannel->log(Message(_name, text, prio));
 	}
 }
 
@@ -803,7 +851,10 @@ inline void Logger::log(const std::string& text, Message::Priority prio, const c
 {
 	if (_level >= prio && _pChannel)
 	{
-		_pChannel->log(Message(_name, text, prio, file, line));
+		if (_pRingChannel)
+			logToRing(text, prio, file, line);
+		else
+			_pChannel->log(Message(_name, text, prio, file, line));
 	}
 }
 
@@ -812,7 +863,10 @@ inline void Logger::logAlways(const std::string& text, Message::Priority prio)
 {
 	if (_pChannel)
 	{
-		_pChannel->log(Message(_name, text, prio));
+		if (_pRingChannel)
+			logToRing(text, prio);
+		else
+			_pChannel->log(Message(_name, text, prio));
 	}
 }
 
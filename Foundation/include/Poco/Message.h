@@ -134,6 +134,10 @@ public:
 	long getTid() const;
 		/// Returns the numeric thread identifier for the message.
 
+	void setOsTid(long tid);
+		/// Sets the numeric operating system thread identifier
+		/// for the message.
+
 	long getOsTid() const;
 		/// Returns the numeric thread identifier for the message.
 
@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/Formatter.h"
 #include "Poco/Message.h"
+#include "Poco/Mutex.h"
 #include <vector>
 
 
@@ -76,7 +77,13 @@ class Foundation_API PatternFormatter: public Formatter
 	///   * %v[width] - the message source (%s) but text length is padded/cropped to 'width'
 	///   * %[name] - the value of the message parameter with the given name
 	///   * %% - percent sign
-
+	///
+	/// The pattern is compiled into a sequence of operations when it is set.
+	/// Literal text and constant fields (like the node name) are pre-rendered
+	/// at that time. Adjacent date/time fields with a resolution of one second
+	/// (together with any literal text between them) are rendered only once
+	/// per second and cached; only sub-second fields (%i, %c, %F) are computed
+	/// for every message.
 {
 public:
 	using Ptr = AutoPtr<PatternFormatter>;
@@ -138,16 +145,74 @@ private:
 		std::string prepend;
 	};
 
+	enum OpCode
+	{
+		OP_LITERAL,
+		OP_SOURCE,
+		OP_SOURCE_WIDTH,
+		OP_TEXT,
+		OP_PRIO_LEVEL,
+		OP_PRIO_NAME,
+		OP_PRIO_ABBR,
+		OP_PID,
+		OP_THREAD,
+		OP_TID,
+		OP_OSTID,
+		OP_FILE_PATH,
+		OP_FILE_NAME,
+		OP_LINE,
+		OP_DATETIME,
+		OP_MILLISECOND,
+		OP_CENTISECOND,
+		OP_MICROSECOND,
+		OP_PARAMETER
+	};
+
+	struct PatternOp
+		/// A compiled pattern operation.
+		/// For OP_LITERAL, text contains the literal text,
+		/// for OP_PARAMETER the parameter name.
+		/// For OP_DATETIME, index refers to an entry
+		/// in _timeGroups.
+	{
+		OpCode code;
+		int length;
+		std::size_t index;
+		std::string text;
+	};
+
+	struct TimeGroup
+		/// A run of date/time fields with a resolution of one
+		/// second, together with the cached rendering for the
+		/// most recent second.
+	{
+		std::vector<PatternAction> actions;
+		bool localTime;
+		Int64 second;
+		std::string text;
+	};
+
 	void parsePattern();
 		/// Will parse the _pattern string into the vector of PatternActions,
 		/// which contains the message key, any text that needs to be written first
 		/// a property in case of %[] and required length.
 
+	void compilePattern();
+		/// Compiles the PatternActions into the vector of PatternOps.
+
+	void addLiteral(const std::string& text);
+	void addOp(OpCode code, int length = 0, const std::string& text = std::string());
+	void renderTime(TimeGroup& group, Int64 second);
 	void parsePriorityNames();
 
 	static const std::string DEFAULT_PRIORITY_NAMES;
 
 	std::vector<PatternAction> _patternActions;
+	std::vector<PatternOp> _ops;
+	std::vector<TimeGroup> _timeGroups;
+	SpinlockMutex _timeMutex;
+	long _pid;
+	std::string _pidText;
 	bool _localTime;
 	std::string _pattern;
 	std::string _priorityNames;
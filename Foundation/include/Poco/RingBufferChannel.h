@@ -0,0 +1,303 @@
+//
+// RingBufferChannel.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  RingBufferChannel
+//
+// Definition of the RingBufferChannel class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_RingBufferChannel_INCLUDED
+#define Foundation_RingBufferChannel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Channel.h"
+#include "Poco/Message.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/RingBufferRecord.h"
+#include "Poco/Mutex.h"
+#include "Poco/Event.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Format.h"
+#include "Poco/Timestamp.h"
+#include <atomic>
+#include <vector>
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API RingBufferChannel: public Channel, public Runnable, private RingBufferRecord
+	/// A low-latency alternative to AsyncChannel.
+	///
+	/// Like AsyncChannel, this channel forwards log messages
+	/// to a target channel in a separate thread. However, instead
+	/// of copying every message into a Notification and passing it
+	/// through a NotificationQueue, each logging thread writes a
+	/// compact binary record into its own lock-free, single-producer
+	/// ring buffer. Writing a record does not allocate memory and
+	/// does not take a lock.
+	///
+	/// Records written by log(const std::string&, const std::string&, Message::Priority, ...)
+	/// and logFormat() contain only the source, text or format string
+	/// and arguments, priority, timestamp and source location. Thread
+	/// and process identifiers are stored once per ring buffer.
+	/// Logger uses these functions if its channel is a RingBufferChannel,
+	/// so no Message object is created in the logging thread, and
+	/// Poco::format() expansion of the format-string variants of
+	/// Logger::information(), etc. is deferred to the background
+	/// thread. Arguments of types not supported for deferred formatting
+	/// (see logFormat()) are formatted in the logging thread.
+	///
+	/// The background thread merges the records of all ring
+	/// buffers in timestamp order, re-creates the Message objects
+	/// and passes them to the target channel. Formatting (e.g.,
+	/// by a FormattingChannel with a PatternFormatter) and I/O are
+	/// thus done by the background thread.
+	///
+	/// If a ring buffer is full, the behavior depends on the
+	/// overflow policy:
+	///   - OVERFLOW_BLOCK: the logging thread waits until the background
+	///     thread has made room in the buffer.
+	///   - OVERFLOW_DROP: the message is discarded.
+	///   - OVERFLOW_COUNT: the message is discarded, and a message
+	///     giving the number of discarded messages is logged by
+	///     the background thread once the buffer has room again
+	///     (as with the "queueSize" property of AsyncChannel).
+	///
+	/// The number of discarded messages is available via droppedMessages().
+	///
+	/// Messages that do not fit into half of a ring buffer are
+	/// always discarded.
+{
+public:
+	using Ptr = AutoPtr<RingBufferChannel>;
+
+	enum OverflowPolicy
+	{
+		OVERFLOW_BLOCK, /// Wait until the buffer has room.
+		OVERFLOW_DROP,  /// Discard the message.
+		OVERFLOW_COUNT  /// Discard the message and report the number of discarded messages.
+	};
+
+	enum
+	{
+		DEFAULT_BUFFER_SIZE = 256*1024,
+		MIN_BUFFER_SIZE = 4096
+	};
+
+	RingBufferChannel(Channel::Ptr pChannel = 0, Thread::Priority prio = Thread::PRIO_NORMAL);
+		/// Creates the RingBufferChannel and connects it to
+		/// the given channel.
+
+	void setChannel(Channel::Ptr pChannel);
+		/// Connects the RingBufferChannel to the given target channel.
+		/// All messages will be forwarded to this channel.
+
+	Channel::Ptr getChannel() const;
+		/// Returns the target channel.
+
+	void setBufferSize(std::size_t size);
+		/// Sets the size in bytes of the per-thread ring buffers.
+		/// The size is rounded up to the next power of two.
+		///
+		/// Only affects ring buffers created after the call,
+		/// i.e. by threads that have not logged to this
+		/// channel before.
+
+	std::size_t getBufferSize() const;
+		/// Returns the size in bytes of the per-thread ring buffers.
+
+	void setOverflowPolicy(OverflowPolicy policy);
+		/// Sets the policy for handling full ring buffers.
+
+	OverflowPolicy getOverflowPolicy() const;
+		/// Returns the policy for handling full ring buffers.
+
+	void open();
+		/// Opens the channel and creates the
+		/// background logging thread.
+
+	void close();
+		/// Processes all pending messages, then stops the
+		/// background logging thread.
+		///
+		/// Messages logged after the channel has been
+		/// closed are discarded.
+
+	void log(const Message& msg);
+		/// Writes the message, including all its parameters,
+		/// into the calling thread's ring buffer.
+
+	void log(const std::string& source, const std::string& text, Message::Priority prio, const char* file = 0, LineNumber line = 0);
+		/// Writes a message with the given source, text, priority
+		/// and source location into the calling thread's ring buffer.
+		/// The thread and process identifiers of the message are those
+		/// of the calling thread.
+		///
+		/// File must be a static string, such as the value of
+		/// the __FILE__ macro. The string is not copied.
+
+	template <typename T, typename... Args>
+	void logFormat(const std::string& source, Message::Priority prio, const std::string& fmt, const T& arg1, const Args&... args)
+		/// Writes a message with the given source and priority
+		/// into the calling thread's ring buffer. The text of the message
+		/// is created from fmt and the arguments by Poco::format() in the
+		/// background thread.
+		///
+		/// Deferred formatting is supported for arguments of type bool,
+		/// char, all integer and floating-point types, std::string and
+		/// std::string_view. If any argument has a different type, the
+		/// text is formatted immediately.
+	{
+		if constexpr (isDeferrable<T>() && (isDeferrable<Args>() && ...))
+		{
+			char* p = beginFormat(source, prio, fmt, 1 + sizeof...(Args), argSize(arg1) + (argSize(args) + ... + 0));
+			if (p)
+			{
+				p = writeArg(p, arg1);
+				((p = writeArg(p, args)), ...);
+				commit();
+			}
+		}
+		else
+		{
+			log(source, Poco::format(fmt, arg1, args...), prio);
+		}
+	}
+
+	Poco::UInt64 droppedMessages() const;
+		/// Returns the total number of messages that have been
+		/// discarded because a ring buffer was full.
+
+	void setProperty(const std::string& name, const std::string& value);
+		/// Sets or changes a configuration property.
+		///
+		/// The "channel" property allows setting the target
+		/// channel via the LoggingRegistry.
+		/// The "channel" property is set-only.
+		///
+		/// The "priority" property allows setting the thread
+		/// priority. The following values are supported:
+		///    * lowest
+		///    * low
+		///    * normal (default)
+		///    * high
+		///    * highest
+		///
+		/// The "priority" property is set-only.
+		///
+		/// The "bufferSize" property sets the size of the per-thread
+		/// ring buffers in bytes (see setBufferSize()).
+		///
+		/// The "overflow" property sets the overflow policy.
+		/// Supported values are "block" (default), "drop" and "count".
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the "bufferSize" or "overflow" property.
+
+protected:
+	~RingBufferChannel();
+	void run();
+	void setPriority(const std::string& value);
+
+private:
+	class Buffer;
+	struct ThreadBuffers;
+
+	enum
+	{
+		IDLE_WAIT = 100
+	};
+
+	static char* writeHeader(char* pRecord, std::size_t size, RecordType type, Message::Priority prio, int argc, const char* file, LineNumber line);
+
+	char* beginFormat(const std::string& source, Message::Priority prio, const std::string& fmt, int argc, std::size_t argsSize);
+		/// Reserves a RECORD_FORMAT record with room for argc arguments
+		/// taking argsSize bytes and writes the header, source and format
+		/// string. Returns a pointer to the location of the first argument,
+		/// or null if the message must be discarded. The record must be
+		/// published with commit() after the arguments have been written.
+
+	char* reserve(std::size_t& size);
+		/// Reserves room for a record of the given size in the calling
+		/// thread's ring buffer. Rounds size up to the record alignment.
+		/// Returns a pointer to the record, or null if the message must
+		/// be discarded.
+
+	void commit();
+		/// Publishes the record previously reserved by the calling thread.
+
+	static ThreadBuffers& threadBuffers();
+	Buffer* threadBuffer(ThreadBuffers& buffers);
+	AutoPtr<Buffer> createBuffer();
+	void wakeUp();
+	bool drain();
+	bool pending();
+	void process(Buffer& buffer, const RecordHeader& header);
+	void removeAbandonedBuffers();
+
+	RingBufferChannel(const RingBufferChannel&);
+	RingBufferChannel& operator = (const RingBufferChannel&);
+
+	const Poco::UInt64 _id;
+	Channel::Ptr _pChannel;
+	Thread _thread;
+	FastMutex _threadMutex;
+	FastMutex _channelMutex;
+	mutable FastMutex _buffersMutex;
+	std::vector<AutoPtr<Buffer>> _buffers;
+	std::vector<AutoPtr<Buffer>> _consumerBuffers;
+	std::atomic<bool> _buffersChanged;
+	std::atomic<std::size_t> _bufferSize;
+	std::atomic<OverflowPolicy> _overflowPolicy;
+	std::atomic<bool> _running;
+	std::atomic<bool> _closed;
+	std::atomic<bool> _stop;
+	std::atomic<bool> _waiting;
+	std::atomic<Poco::UInt64> _dropped;
+	Event _wakeUp;
+	std::vector<Any> _args;
+	std::string _text;
+
+	static std::atomic<Poco::UInt64> _nextId;
+
+	friend class Logger;
+};
+
+
+//
+// inlines
+//
+inline std::size_t RingBufferChannel::getBufferSize() const
+{
+	return _bufferSize.load(std::memory_order_relaxed);
+}
+
+
+inline RingBufferChannel::OverflowPolicy RingBufferChannel::getOverflowPolicy() const
+{
+	return _overflowPolicy.load(std::memory_order_relaxed);
+}
+
+
+inline Poco::UInt64 RingBufferChannel::droppedMessages() const
+{
+	return _dropped.load(std::memory_order_relaxed);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_RingBufferChannel_INCLUDED
@@ -0,0 +1,166 @@
+//
+// RingBufferRecord.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  RingBufferChannel
+//
+// Definition of the RingBufferRecord class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_RingBufferRecord_INCLUDED
+#define Foundation_RingBufferRecord_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Message.h"
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <type_traits>
+
+
+namespace Poco {
+
+
+class Foundation_API RingBufferRecord
+	/// The layout of the records written into the ring buffers
+	/// of a RingBufferChannel.
+	///
+	/// This class is an implementation detail of RingBufferChannel
+	/// and Logger. It is kept separate from RingBufferChannel so
+	/// that Logger.h can encode deferred format arguments without
+	/// including RingBufferChannel.h.
+{
+public:
+	enum RecordType
+	{
+		RECORD_PADDING,
+		RECORD_TEXT,
+		RECORD_FORMAT,
+		RECORD_MESSAGE
+	};
+
+	enum ArgType
+	{
+		ARG_NONE,
+		ARG_BOOL,
+		ARG_CHAR,
+		ARG_SCHAR,
+		ARG_UCHAR,
+		ARG_SHORT,
+		ARG_USHORT,
+		ARG_INT,
+		ARG_UINT,
+		ARG_LONG,
+		ARG_ULONG,
+		ARG_LLONG,
+		ARG_ULLONG,
+		ARG_FLOAT,
+		ARG_DOUBLE,
+		ARG_LDOUBLE,
+		ARG_STRING,
+		ARG_STRING_VIEW
+	};
+
+	struct RecordHeader
+		/// Header of a record in a ring buffer. Records are
+		/// padded to a multiple of 8 bytes.
+	{
+		Poco::UInt32 size;
+		Poco::UInt8  type;
+		Poco::UInt8  prio;
+		Poco::UInt16 argc;
+		Poco::Int64  time;
+		const char*  file;
+		Poco::Int64  line;
+	};
+
+	enum
+	{
+		HEADER_SIZE = sizeof(RecordHeader)
+	};
+
+	template <typename T>
+	static constexpr ArgType argType()
+		/// Returns the type tag for a deferred format argument
+		/// of type T, or ARG_NONE if T is not supported.
+	{
+		using U = std::decay_t<T>;
+		if constexpr (std::is_same_v<U, bool>) return ARG_BOOL;
+		else if constexpr (std::is_same_v<U, char>) return ARG_CHAR;
+		else if constexpr (std::is_same_v<U, signed char>) return ARG_SCHAR;
+		else if constexpr (std::is_same_v<U, unsigned char>) return ARG_UCHAR;
+		else if constexpr (std::is_same_v<U, short>) return ARG_SHORT;
+		else if constexpr (std::is_same_v<U, unsigned short>) return ARG_USHORT;
+		else if constexpr (std::is_same_v<U, int>) return ARG_INT;
+		else if constexpr (std::is_same_v<U, unsigned>) return ARG_UINT;
+		else if constexpr (std::is_same_v<U, long>) return ARG_LONG;
+		else if constexpr (std::is_same_v<U, unsigned long>) return ARG_ULONG;
+		else if constexpr (std::is_same_v<U, long long>) return ARG_LLONG;
+		else if constexpr (std::is_same_v<U, unsigned long long>) return ARG_ULLONG;
+		else if constexpr (std::is_same_v<U, float>) return ARG_FLOAT;
+		else if constexpr (std::is_same_v<U, double>) return ARG_DOUBLE;
+		else if constexpr (std::is_same_v<U, long double>) return ARG_LDOUBLE;
+		else if constexpr (std::is_same_v<U, std::string>) return ARG_STRING;
+		else if constexpr (std::is_same_v<U, std::string_view>) return ARG_STRING_VIEW;
+		else return ARG_NONE;
+	}
+
+	template <typename T>
+	static constexpr bool isDeferrable()
+		/// Returns true if arguments of type T can be stored
+		/// in a record for deferred formatting.
+	{
+		return argType<T>() != ARG_NONE;
+	}
+
+	static std::size_t stringSize(std::string_view str)
+	{
+		return sizeof(Poco::UInt32) + str.size();
+	}
+
+	template <typename T>
+	static std::size_t argSize(const T& arg)
+	{
+		if constexpr (argType<T>() == ARG_STRING || argType<T>() == ARG_STRING_VIEW)
+			return 1 + stringSize(arg);
+		else
+			return 1 + sizeof(T);
+	}
+
+	static char* writeString(char* p, std::string_view str)
+	{
+		Poco::UInt32 n = static_cast<Poco::UInt32>(str.size());
+		std::memcpy(p, &n, sizeof(n));
+		std::memcpy(p + sizeof(n), str.data(), n);
+		return p + sizeof(n) + n;
+	}
+
+	template <typename T>
+	static char* writeArg(char* p, const T& arg)
+	{
+		*p++ = static_cast<char>(argType<T>());
+		if constexpr (argType<T>() == ARG_STRING || argType<T>() == ARG_STRING_VIEW)
+		{
+			return writeString(p, arg);
+		}
+		else
+		{
+			std::memcpy(p, &arg, sizeof(T));
+			return p + sizeof(T);
+		}
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_RingBufferRecord_INCLUDED
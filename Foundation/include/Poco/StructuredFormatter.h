@@ -0,0 +1,101 @@
+//
+// StructuredFormatter.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  StructuredFormatter
+//
+// Definition of the StructuredFormatter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_StructuredFormatter_INCLUDED
+#define Foundation_StructuredFormatter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Formatter.h"
+#include "Poco/Message.h"
+
+
+namespace Poco {
+
+
+class Foundation_API StructuredFormatter: public Formatter
+	/// The base class for formatters that write a log message
+	/// as a record of named fields, like JSONFormatter and
+	/// LogfmtFormatter.
+	///
+	/// StructuredFormatter implements the properties common
+	/// to these formatters, and the formatting of the message
+	/// timestamp and priority.
+{
+public:
+	using Ptr = AutoPtr<StructuredFormatter>;
+
+	void setProperty(const std::string& name, const std::string& value);
+		/// Sets the property with the given name to the given value.
+		///
+		/// The following properties are supported:
+		///
+		///     * times: Specifies whether times are adjusted for local time
+		///       or taken as they are in UTC. Supported values are "local" and "UTC".
+		///     * sourceLocation: Specifies whether the source file path
+		///       and line number are written, if available ("true", the default)
+		///       or not ("false").
+		///
+		/// If any other property name is given, a PropertyNotSupported
+		/// exception is thrown.
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the property with the given name or
+		/// throws a PropertyNotSupported exception if the given
+		/// name is not recognized.
+
+	static const std::string PROP_TIMES;
+	static const std::string PROP_SOURCE_LOCATION;
+
+protected:
+	StructuredFormatter();
+		/// Creates a StructuredFormatter.
+
+	~StructuredFormatter();
+		/// Destroys the StructuredFormatter.
+
+	void appendTimestamp(const Message& msg, std::string& text) const;
+		/// Appends the message date/time in ISO 8601 format, with
+		/// fractional seconds, in local time or UTC, to text.
+
+	static void appendPriority(const Message& msg, std::string& text);
+		/// Appends the name of the message priority (Fatal, Critical,
+		/// Error, Warning, Notice, Information, Debug, Trace) to text.
+		/// A priority outside the valid range is written as number.
+
+	bool sourceLocation() const;
+		/// Returns true if the source file path and line number
+		/// are written.
+
+private:
+	bool _localTime;
+	bool _sourceLocation;
+};
+
+
+//
+// inlines
+//
+inline bool StructuredFormatter::sourceLocation() const
+{
+	return _sourceLocation;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_StructuredFormatter_INCLUDED
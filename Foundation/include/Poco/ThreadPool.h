@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/Thread.h"
 #include "Poco/Mutex.h"
+#include "Poco/WorkStealingExecutor.h"
 #include <vector>
 
 
@@ -45,6 +46,12 @@ class Foundation_API ThreadPool
 	/// threads are created. Once the demand for threads sinks
 	/// again, no-longer used threads are stopped and removed
 	/// from the pool.
+	///
+	/// Alternatively, a thread pool can schedule all runnables
+	/// on a WorkStealingExecutor, which keeps a fixed number
+	/// of worker threads, each with its own queue of runnables.
+	/// This is more efficient if many short-lived runnables
+	/// are started.
 {
 public:
 	ThreadPool(int minCapacity = 2,
@@ -70,6 +77,16 @@ public:
 		/// and more than minCapacity threads are running, the thread
 		/// is killed. Threads are created with given stack size.
 
+	explicit ThreadPool(WorkStealingExecutor::Ptr pExecutor);
+		/// Creates a thread pool that schedules all runnables on
+		/// the given WorkStealingExecutor, instead of handing them
+		/// to individual threads.
+		///
+		/// The capacity of the thread pool is the number of workers
+		/// of the executor, and start() only throws a
+		/// NoThreadAvailableException if the executor's queues are full.
+		/// The capacity cannot be changed with addCapacity().
+
 	~ThreadPool();
 		/// Currently running threads will remain active
 		/// until they complete.
@@ -153,6 +170,11 @@ public:
 		/// or an empty string if no name has been
 		/// specified in the constructor.
 
+	WorkStealingExecutor::Ptr executor() const;
+		/// Returns the WorkStealingExecutor used by the
+		/// thread pool, or a null pointer if the thread pool
+		/// manages its own threads.
+
 	static ThreadPool& defaultPool();
 		/// Returns a reference to the default
 		/// thread pool.
@@ -177,6 +199,7 @@ private:
 	int _age;
 	int _stackSize;
 	ThreadVec _threads;
+	WorkStealingExecutor::Ptr _pExecutor;
 	mutable FastMutex _mutex;
 };
 
@@ -202,6 +225,12 @@ inline const std::string& ThreadPool::name() const
 }
 
 
+inline WorkStealingExecutor::Ptr ThreadPool::executor() const
+{
+	return _pExecutor;
+}
+
+
 } // namespace Poco
 
 
@@ -0,0 +1,252 @@
+//
+// WorkStealingExecutor.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingExecutor
+//
+// Definition of the WorkStealingExecutor class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingExecutor_INCLUDED
+#define Foundation_WorkStealingExecutor_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Thread.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Environment.h"
+#include <vector>
+#include <atomic>
+
+
+namespace Poco {
+
+
+class Runnable;
+
+
+class Foundation_API WorkStealingExecutor
+	/// An executor running Runnable objects on a fixed
+	/// number of worker threads, each of which has its own
+	/// bounded queue of pending runnables.
+	///
+	/// Runnables started from outside the executor are
+	/// distributed to the worker queues in round-robin fashion.
+	/// Runnables started from within a worker thread (e.g., by
+	/// a task splitting its work into smaller tasks) are put
+	/// into the queue of that worker, to benefit from data
+	/// already present in the worker's CPU cache.
+	///
+	/// A worker takes runnables from the back of its own queue.
+	/// If its queue is empty, it tries to steal a runnable from
+	/// the front of the queue of another worker. Only if there's
+	/// no work at all, the worker is parked until new runnables
+	/// are started. Each queue is protected by its own spin lock,
+	/// so there is no lock shared by all workers and submitters
+	/// on the fast path.
+	///
+	/// Runnables are not guaranteed to be executed in the order
+	/// they have been started.
+	///
+	/// A WorkStealingExecutor can be plugged into a ThreadPool
+	/// (see ThreadPool::ThreadPool(WorkStealingExecutor::Ptr)),
+	/// so that classes like TaskManager or Net::TCPServer can
+	/// use it. Note that a long-running runnable (like the
+	/// connection loop of Net::TCPServer) occupies its worker
+	/// until it completes, so the number of workers must be
+	/// large enough for all long-running runnables.
+{
+public:
+	using Ptr = SharedPtr<WorkStealingExecutor>;
+
+	struct Statistics
+		/// Statistics collected by the WorkStealingExecutor.
+	{
+		Poco::UInt64 submitted = 0;    /// Number of runnables accepted by start().
+		Poco::UInt64 rejected = 0;     /// Number of runnables rejected because all queues were full.
+		Poco::UInt64 executed = 0;     /// Number of runnables executed.
+		Poco::UInt64 localSubmits = 0; /// Number of runnables started from a worker thread into its own queue.
+		Poco::UInt64 steals = 0;       /// Number of runnables stolen from another worker's queue.
+		Poco::UInt64 parks = 0;        /// Number of times a worker was parked because there was no work.
+		Poco::UInt64 unparks = 0;      /// Number of times a parked worker was woken up for new work.
+		int queueDepth = 0;            /// Number of runnables currently waiting in all queues.
+		int maxQueueDepth = 0;         /// Number of runnables waiting in the longest queue.
+	};
+
+	enum
+	{
+		DEFAULT_QUEUE_CAPACITY = 1024
+	};
+
+	WorkStealingExecutor(int workers = static_cast<int>(Environment::processorCount()),
+		int queueCapacity = DEFAULT_QUEUE_CAPACITY,
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates the WorkStealingExecutor with the given number of
+		/// worker threads, each having a queue for up to queueCapacity
+		/// runnables. Threads are created with given stack size.
+
+	WorkStealingExecutor(const std::string& name,
+		int workers = static_cast<int>(Environment::processorCount()),
+		int queueCapacity = DEFAULT_QUEUE_CAPACITY,
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates the WorkStealingExecutor with the given name and
+		/// number of worker threads, each having a queue for up to
+		/// queueCapacity runnables. Threads are created with given
+		/// stack size.
+
+	~WorkStealingExecutor();
+		/// Stops all workers and destroys the WorkStealingExecutor.
+
+	int capacity() const;
+		/// Returns the number of worker threads.
+
+	int queueCapacity() const;
+		/// Returns the capacity of each worker's queue.
+
+	int getStackSize() const;
+		/// Returns the stack size used to create the worker threads.
+
+	int used() const;
+		/// Returns the number of runnables that have been
+		/// started, but not yet completed.
+
+	void start(Runnable& target);
+		/// Queues the target for execution by a worker.
+		/// Throws a NoThreadAvailableException if the
+		/// target cannot be queued because the queues
+		/// are full or the executor has been stopped.
+
+	void start(Runnable& target, const std::string& name);
+		/// Queues the target for execution by a worker.
+		/// The worker thread will have the given name
+		/// while it executes the target.
+		/// Throws a NoThreadAvailableException if the
+		/// target cannot be queued because the queues
+		/// are full or the executor has been stopped.
+
+	void startWithPriority(Thread::Priority priority, Runnable& target);
+		/// Queues the target for execution by a worker,
+		/// which adjusts its priority while executing the target.
+		/// Throws a NoThreadAvailableException if the
+		/// target cannot be queued because the queues
+		/// are full or the executor has been stopped.
+
+	void startWithPriority(Thread::Priority priority, Runnable& target, const std::string& name);
+		/// Queues the target for execution by a worker,
+		/// which adjusts its priority and name while executing
+		/// the target.
+		/// Throws a NoThreadAvailableException if the
+		/// target cannot be queued because the queues
+		/// are full or the executor has been stopped.
+
+	void joinAll();
+		/// Waits until all started runnables have completed.
+		///
+		/// Must not be called from a worker thread.
+
+	void stopAll();
+		/// Stops all worker threads and waits for their completion.
+		/// Runnables currently executing are allowed to complete,
+		/// runnables still waiting in a queue are discarded.
+		///
+		/// No more runnables can be started afterwards.
+
+	Statistics statistics() const;
+		/// Returns a snapshot of the executor's statistics.
+
+	const std::string& name() const;
+		/// Returns the name of the executor, or an empty
+		/// string if no name has been specified in the constructor.
+
+private:
+	class Worker;
+
+	struct Task
+	{
+		Runnable*        pTarget = nullptr;
+		Thread::Priority priority = Thread::PRIO_NORMAL;
+		std::string      name;
+	};
+
+	WorkStealingExecutor(const WorkStealingExecutor&);
+	WorkStealingExecutor& operator = (const WorkStealingExecutor&);
+
+	void init();
+	void submit(Thread::Priority priority, Runnable& target, const std::string& name);
+	bool next(Worker& worker, Task& task);
+	bool steal(Worker& worker, Task& task);
+	bool hasWork() const;
+	void park(Worker& worker);
+	bool unregisterParked(Worker& worker);
+	void unparkOne();
+	void completed();
+
+	using WorkerVec = std::vector<Worker*>;
+
+	std::string       _name;
+	int               _capacity;
+	int               _queueCapacity;
+	int               _stackSize;
+	WorkerVec         _workers;
+	std::atomic<unsigned> _nextWorker;
+	std::atomic<bool> _stopped;
+	std::atomic<int>  _pending;
+	std::atomic<Poco::UInt64> _submitted;
+	std::atomic<Poco::UInt64> _rejected;
+	WorkerVec         _parked;
+	std::atomic<int>  _parkedCount;
+	FastMutex         _parkMutex;
+	FastMutex         _joinMutex;
+	Condition         _allDone;
+	FastMutex         _stopMutex;
+
+	friend class Worker;
+};
+
+
+//
+// inlines
+//
+inline int WorkStealingExecutor::capacity() const
+{
+	return _capacity;
+}
+
+
+inline int WorkStealingExecutor::queueCapacity() const
+{
+	return _queueCapacity;
+}
+
+
+inline int WorkStealingExecutor::getStackSize() const
+{
+	return _stackSize;
+}
+
+
+inline int WorkStealingExecutor::used() const
+{
+	return _pending;
+}
+
+
+inline const std::string& WorkStealingExecutor::name() const
+{
+	return _name;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingExecutor_INCLUDED
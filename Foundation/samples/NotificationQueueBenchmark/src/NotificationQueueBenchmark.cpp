@@ -0,0 +1,188 @@
+//
+// NotificationQueueBenchmark.cpp
+//
+// This sample compares the throughput of NotificationQueue and
+// ConcurrentNotificationQueue with 1 to 64 producer and
+// consumer threads.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Notification.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/ConcurrentNotificationQueue.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberParser.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+
+using Poco::Notification;
+using Poco::NotificationQueue;
+using Poco::ConcurrentNotificationQueue;
+using Poco::Thread;
+using Poco::Runnable;
+using Poco::Stopwatch;
+
+
+class WorkNotification: public Notification
+	// The notification passed from producers to consumers.
+	// A negative value tells a consumer to stop.
+{
+public:
+	WorkNotification(int value):
+		_value(value)
+	{
+	}
+
+	int value() const
+	{
+		return _value;
+	}
+
+private:
+	int _value;
+};
+
+
+template <class Q>
+class Producer: public Runnable
+{
+public:
+	Producer(Q& queue, int count):
+		_queue(queue),
+		_count(count)
+	{
+	}
+
+	void run()
+	{
+		for (int i = 0; i < _count; ++i)
+		{
+			_queue.enqueueNotification(new WorkNotification(i));
+		}
+	}
+
+private:
+	Q& _queue;
+	int _count;
+};
+
+
+template <class Q>
+class Consumer: public Runnable
+{
+public:
+	Consumer(Q& queue, std::atomic<Poco::Int64>& sum):
+		_queue(queue),
+		_sum(sum)
+	{
+	}
+
+	void run()
+	{
+		Poco::Int64 sum = 0;
+		for (;;)
+		{
+			Notification::Ptr pNf(_queue.waitDequeueNotification());
+			if (!pNf) continue;
+			int value = static_cast<WorkNotification*>(pNf.get())->value();
+			if (value < 0) break;
+			sum += value;
+		}
+		_sum += sum;
+	}
+
+private:
+	Q& _queue;
+	std::atomic<Poco::Int64>& _sum;
+};
+
+
+template <class Q>
+double benchmark(Q& queue, int threads, int notifications)
+	// Runs the given number of producer and consumer threads,
+	// and returns the number of notifications per second.
+{
+	const int perProducer = notifications/threads;
+	std::atomic<Poco::Int64> sum(0);
+	std::vector<std::unique_ptr<Producer<Q>>> producers;
+	std::vector<std::unique_ptr<Consumer<Q>>> consumers;
+	std::vector<std::unique_ptr<Thread>> producerThreads;
+	std::vector<std::unique_ptr<Thread>> consumerThreads;
+	for (int i = 0; i < threads; ++i)
+	{
+		producers.emplace_back(new Producer<Q>(queue, perProducer));
+		consumers.emplace_back(new Consumer<Q>(queue, sum));
+		producerThreads.emplace_back(new Thread);
+		consumerThreads.emplace_back(new Thread);
+	}
+
+	Stopwatch sw;
+	sw.start();
+	for (int i = 0; i < threads; ++i)
+	{
+		consumerThreads[i]->start(*consumers[i]);
+	}
+	for (int i = 0; i < threads; ++i)
+	{
+		producerThreads[i]->start(*producers[i]);
+	}
+	for (auto& pThread: producerThreads)
+	{
+		pThread->join();
+	}
+	for (int i = 0; i < threads; ++i)
+	{
+		queue.enqueueNotification(new WorkNotification(-1));
+	}
+	for (auto& pThread: consumerThreads)
+	{
+		pThread->join();
+	}
+	sw.stop();
+
+	const Poco::Int64 expected = static_cast<Poco::Int64>(threads)*perProducer*(perProducer - 1)/2;
+	if (sum != expected)
+	{
+		std::cerr << "Checksum mismatch: " << sum << " != " << expected << std::endl;
+	}
+	return static_cast<double>(perProducer)*threads/(static_cast<double>(sw.elapsed())/Stopwatch::resolution());
+}
+
+
+int main(int argc, char** argv)
+{
+	int notifications = 1000000;
+	if (argc > 1) notifications = Poco::NumberParser::parse(argv[1]);
+
+	std::cout << "NotificationQueue Benchmark" << std::endl;
+	std::cout << "===========================" << std::endl;
+	std::cout << notifications << " notifications per run, N producers and N consumers." << std::endl << std::endl;
+	std::cout << std::setw(4) << "N"
+	          << std::setw(22) << "NotificationQueue"
+	          << std::setw(30) << "ConcurrentNotificationQueue"
+	          << std::setw(10) << "ratio" << std::endl;
+
+	for (int threads = 1; threads <= 64; threads *= 2)
+	{
+		NotificationQueue queue;
+		double nq = benchmark(queue, threads, notifications);
+		ConcurrentNotificationQueue cqueue;
+		double cnq = benchmark(cqueue, threads, notifications);
+		std::cout << std::setw(4) << threads
+		          << std::setw(16) << static_cast<Poco::Int64>(nq) << " nf/s"
+		          << std::setw(24) << static_cast<Poco::Int64>(cnq) << " nf/s"
+		          << std::setw(10) << std::fixed << std::setprecision(2) << cnq/nq << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,173 @@
+//
+// PatternFormatterBenchmark.cpp
+//
+// This sample measures the per-message cost of PatternFormatter
+// with a few typical patterns. For comparison, it also runs an
+// interpreting formatter that, like the PatternFormatter of earlier
+// releases, walks the pattern and computes all date/time fields
+// for every message.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/PatternFormatter.h"
+#include "Poco/Message.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timezone.h"
+#include "Poco/DateTime.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Environment.h"
+#include "Poco/Path.h"
+#include "Poco/Stopwatch.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+
+using Poco::PatternFormatter;
+using Poco::Message;
+using Poco::Timestamp;
+using Poco::Timezone;
+using Poco::DateTime;
+using Poco::DateTimeFormat;
+using Poco::NumberFormatter;
+using Poco::Environment;
+using Poco::Path;
+using Poco::Stopwatch;
+
+
+class InterpretingFormatter
+	// Formats messages by interpreting the pattern for every
+	// message, computing the date/time fields from scratch.
+	// Only the pattern characters used by this benchmark are
+	// supported.
+{
+public:
+	InterpretingFormatter(const std::string& pattern):
+		_pattern(pattern)
+	{
+	}
+
+	void format(const Message& msg, std::string& text)
+	{
+		Timestamp timestamp = msg.getTime();
+		DateTime dateTime = timestamp;
+		std::string::const_iterator it  = _pattern.begin();
+		std::string::const_iterator end = _pattern.end();
+		while (it != end)
+		{
+			if (*it == '%' && ++it != end)
+			{
+				switch (*it)
+				{
+				case 's': text.append(msg.getSource()); break;
+				case 't': text.append(msg.getText()); break;
+				case 'p': text.append(priorityName(msg.getPriority())); break;
+				case 'q': text += priorityName(msg.getPriority())[0]; break;
+				case 'P': NumberFormatter::append(text, msg.getPid()); break;
+				case 'I': NumberFormatter::append(text, msg.getTid()); break;
+				case 'N': text.append(Environment::nodeName()); break;
+				case 'O': text.append(msg.getSourceFile() ? Path(msg.getSourceFile()).getFileName() : ""); break;
+				case 'u': NumberFormatter::append(text, msg.getSourceLine()); break;
+				case 'w': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
+				case 'b': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
+				case 'd': NumberFormatter::append0(text, dateTime.day(), 2); break;
+				case 'e': NumberFormatter::append(text, dateTime.day()); break;
+				case 'm': NumberFormatter::append0(text, dateTime.month(), 2); break;
+				case 'y': NumberFormatter::append0(text, dateTime.year() % 100, 2); break;
+				case 'Y': NumberFormatter::append0(text, dateTime.year(), 4); break;
+				case 'H': NumberFormatter::append0(text, dateTime.hour(), 2); break;
+				case 'M': NumberFormatter::append0(text, dateTime.minute(), 2); break;
+				case 'S': NumberFormatter::append0(text, dateTime.second(), 2); break;
+				case 'i': NumberFormatter::append0(text, dateTime.millisecond(), 3); break;
+				case 'F': NumberFormatter::append0(text, dateTime.millisecond()*1000 + dateTime.microsecond(), 6); break;
+				case '%': text += '%'; break;
+				}
+				++it;
+			}
+			else text += *it++;
+		}
+	}
+
+private:
+	static const char* priorityName(Message::Priority prio)
+	{
+		static const char* names[] = {"", "Fatal", "Critical", "Error", "Warning", "Notice", "Information", "Debug", "Trace"};
+		return names[prio];
+	}
+
+	std::string _pattern;
+};
+
+
+template <class F>
+double benchmark(F& formatter, std::vector<Message>& messages, int count)
+	// Formats count messages and returns the
+	// average time per message in nanoseconds.
+{
+	std::string text;
+	std::size_t total = 0;
+	Stopwatch sw;
+	sw.start();
+	for (int i = 0; i < count; ++i)
+	{
+		text.clear();
+		formatter.format(messages[i % messages.size()], text);
+		total += text.size();
+	}
+	sw.stop();
+	if (total == 0) std::cerr << "No output." << std::endl;
+	return static_cast<double>(sw.elapsed())*1000/count;
+}
+
+
+int main(int argc, char** argv)
+{
+	int count = 1000000;
+	if (argc > 1) count = Poco::NumberParser::parse(argv[1]);
+
+	// Messages spread over ten seconds, 1000 messages per second,
+	// which is what a busy application's log looks like.
+	std::vector<Message> messages;
+	Timestamp base;
+	for (int i = 0; i < 10000; ++i)
+	{
+		Message msg("Benchmark.Source", "This is a log message of moderate length", Message::PRIO_INFORMATION, __FILE__, __LINE__);
+		msg.setTime(base + static_cast<Timestamp::TimeDiff>(i)*1000);
+		messages.push_back(msg);
+	}
+
+	const char* patterns[] =
+	{
+		"%Y-%m-%d %H:%M:%S.%i [%p] %s: %t",
+		"%w, %e %b %y %H:%M:%S.%F %N[%P]:%I %q %t",
+		"%Y-%m-%dT%H:%M:%S.%FZ %O:%u %t"
+	};
+
+	std::cout << "PatternFormatter Benchmark" << std::endl;
+	std::cout << "==========================" << std::endl;
+	std::cout << count << " messages per run, average time per message." << std::endl << std::endl;
+	std::cout << std::setw(46) << std::left << "pattern" << std::right
+	          << std::setw(14) << "interpreted"
+	          << std::setw(14) << "compiled"
+	          << std::setw(10) << "ratio" << std::endl;
+
+	for (const char* pattern: patterns)
+	{
+		InterpretingFormatter interpreter(pattern);
+		double before = benchmark(interpreter, messages, count);
+		PatternFormatter formatter(pattern);
+		double after = benchmark(formatter, messages, count);
+		std::cout << std::setw(46) << std::left << pattern << std::right
+		          << std::setw(11) << std::fixed << std::setprecision(1) << before << " ns"
+		          << std::setw(11) << after << " ns"
+		          << std::setw(10) << std::setprecision(2) << before/after << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,114 @@
+//
+// VarBenchmark.cpp
+//
+// This sample measures the cost of constructing, copying and
+// converting Poco::Dynamic::Var values holding common types.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Dynamic/Var.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Stopwatch.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+
+using Poco::Dynamic::Var;
+using Poco::Stopwatch;
+
+
+template <class F>
+double benchmark(F f, int count)
+	// Calls f count times and returns the average
+	// time per call in nanoseconds.
+{
+	Stopwatch sw;
+	sw.start();
+	std::size_t total = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		total += f(i);
+	}
+	sw.stop();
+	if (total == 42) std::cerr << "Unexpected result." << std::endl;
+	return static_cast<double>(sw.elapsed())*1000/count;
+}
+
+
+template <class T>
+void run(const std::string& name, const T& value, int count)
+{
+	Var var(value);
+
+	double construct = benchmark([&value](int) -> std::size_t
+	{
+		Var v(value);
+		return v.isEmpty() ? 0 : 1;
+	}, count);
+
+	double copy = benchmark([&var](int) -> std::size_t
+	{
+		Var v(var);
+		return v.isEmpty() ? 0 : 1;
+	}, count);
+
+	double extract = benchmark([&var](int) -> std::size_t
+	{
+		return var.convert<T>() == T() ? 0 : 1;
+	}, count);
+
+	double toInt = benchmark([&var](int) -> std::size_t
+	{
+		return static_cast<std::size_t>(var.convert<Poco::Int64>());
+	}, count);
+
+	double toDouble = benchmark([&var](int) -> std::size_t
+	{
+		return static_cast<std::size_t>(var.convert<double>());
+	}, count);
+
+	double toString = benchmark([&var](int) -> std::size_t
+	{
+		return var.convert<std::string>().size();
+	}, count);
+
+	std::cout << std::setw(12) << std::left << name << std::right << std::fixed << std::setprecision(1)
+	          << std::setw(12) << construct
+	          << std::setw(12) << copy
+	          << std::setw(12) << extract
+	          << std::setw(12) << toInt
+	          << std::setw(12) << toDouble
+	          << std::setw(12) << toString << std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+	int count = 10000000;
+	if (argc > 1) count = Poco::NumberParser::parse(argv[1]);
+
+	std::cout << "Var Benchmark" << std::endl;
+	std::cout << "=============" << std::endl;
+	std::cout << count << " operations per run, average time per operation in ns." << std::endl << std::endl;
+	std::cout << std::setw(12) << std::left << "type" << std::right
+	          << std::setw(12) << "construct"
+	          << std::setw(12) << "copy"
+	          << std::setw(12) << "same type"
+	          << std::setw(12) << "to Int64"
+	          << std::setw(12) << "to double"
+	          << std::setw(12) << "to string" << std::endl;
+
+	run("Int32", Poco::Int32(123456), count);
+	run("Int64", Poco::Int64(1234567890123), count);
+	run("UInt64", Poco::UInt64(1234567890123), count);
+	run("double", 12345.678, count);
+	run("bool", true, count);
+	run("string", std::string("1234567"), count);
+	return 0;
+}
@@ -13,6 +13,7 @@
 
 
 #include "Poco/ActiveDispatcher.h"
+#include "Poco/ThreadPool.h"
 #include "Poco/Notification.h"
 #include "Poco/AutoPtr.h"
 
@@ -45,19 +46,34 @@ namespace
 }
 
 
-ActiveDispatcher::ActiveDispatcher()
+ActiveDispatcher::ActiveDispatcher():
+	_pPool(0),
+	_scheduled(false),
+	_idle(Event::EVENT_MANUALRESET)
 {
 	_thread.start(*this);
 }
 
 
-ActiveDispatcher::ActiveDispatcher(Thread::Priority prio)
+ActiveDispatcher::ActiveDispatcher(Thread::Priority prio):
+	_pPool(0),
+	_scheduled(false),
+	_idle(Event::EVENT_MANUALRESET)
 {
 	_thread.setPriority(prio);
 	_thread.start(*this);
 }
 
 
+ActiveDispatcher::ActiveDispatcher(ThreadPool& pool):
+	_pPool(&pool),
+	_scheduled(false),
+	_idle(Event::EVENT_MANUALRESET)
+{
+	_idle.set();
+}
+
+
 ActiveDispatcher::~ActiveDispatcher()
 {
 	try
@@ -75,6 +91,25 @@ void ActiveDispatcher::start(ActiveRunnableBase::Ptr pRunnable)
 	poco_check_ptr (pRunnable);
 
 	_queue.enqueueNotification(new MethodNotification(pRunnable));
+	if (_pPool)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		if (!_scheduled)
+		{
+			_scheduled = true;
+			_idle.reset();
+			try
+			{
+				_pPool->start(*this);
+			}
+			catch (...)
+			{
+				_scheduled = false;
+				_idle.set();
+				throw;
+			}
+		}
+	}
 }
 
 
@@ -86,6 +121,12 @@ void ActiveDispatcher::cancel()
 
 void ActiveDispatcher::run()
 {
+	if (_pPool)
+	{
+		runQueued();
+		return;
+	}
+
 	AutoPtr<Notification> pNf = _queue.waitDequeueNotification();
 	while (pNf && !dynamic_cast<StopNotification*>(pNf.get()))
 	{
@@ -101,8 +142,42 @@ void ActiveDispatcher::run()
 }
 
 
+void ActiveDispatcher::runQueued()
+{
+	for (;;)
+	{
+		AutoPtr<Notification> pNf = _queue.dequeueNotification();
+		if (pNf)
+		{
+			MethodNotification* pMethodNf = dynamic_cast<MethodNotification*>(pNf.get());
+			poco_check_ptr (pMethodNf);
+			ActiveRunnableBase::Ptr pRunnable = pMethodNf->runnable();
+			pRunnable->duplicate(); // run will release
+			pRunnable->run();
+		}
+		else
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			if (_queue.empty())
+			{
+				_scheduled = false;
+				_idle.set();
+				return;
+			}
+		}
+	}
+}
+
+
 void ActiveDispatcher::stop()
 {
+	if (_pPool)
+	{
+		_queue.clear();
+		_idle.wait();
+		return;
+	}
+
 	_queue.clear();
 	_queue.wakeUpAll();
 	_queue.enqueueNotification(new StopNotification);
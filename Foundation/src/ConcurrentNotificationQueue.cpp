@@ -0,0 +1,260 @@
+//
+// ConcurrentNotificationQueue.cpp
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  ConcurrentNotificationQueue
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ConcurrentNotificationQueue.h"
+#include "Poco/NotificationCenter.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
+
+
+namespace Poco {
+
+
+ConcurrentNotificationQueue::ConcurrentNotificationQueue(std::size_t capacity):
+	_capacity(2),
+	_enqueuePos(0),
+	_dequeuePos(0),
+	_waiters(0),
+	_wakeUpCount(0)
+{
+	while (_capacity < capacity) _capacity <<= 1;
+	_mask = _capacity - 1;
+	_cells.reset(new Cell[_capacity]);
+	for (std::size_t i = 0; i < _capacity; ++i)
+	{
+		_cells[i].sequence.store(i, std::memory_order_relaxed);
+		_cells[i].pNf = 0;
+	}
+}
+
+
+ConcurrentNotificationQueue::~ConcurrentNotificationQueue()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ConcurrentNotificationQueue::enqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+
+	Notification* pNf = pNotification.duplicate();
+	while (!push(pNf))
+	{
+		Thread::yield();
+	}
+	notifyOne();
+}
+
+
+bool ConcurrentNotificationQueue::tryEnqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+
+	Notification* pNf = pNotification.duplicate();
+	if (push(pNf))
+	{
+		notifyOne();
+		return true;
+	}
+	pNf->release();
+	return false;
+}
+
+
+Notification* ConcurrentNotificationQueue::dequeueNotification()
+{
+	return pop();
+}
+
+
+Notification* ConcurrentNotificationQueue::waitDequeueNotification()
+{
+	return wait(-1);
+}
+
+
+Notification* ConcurrentNotificationQueue::waitDequeueNotification(long milliseconds)
+{
+	return wait(milliseconds);
+}
+
+
+void ConcurrentNotificationQueue::dispatch(NotificationCenter& notificationCenter)
+{
+	Notification* pNf = pop();
+	while (pNf)
+	{
+		notificationCenter.postNotification(Notification::Ptr(pNf));
+		pNf = pop();
+	}
+}
+
+
+void ConcurrentNotificationQueue::wakeUpAll()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	++_wakeUpCount;
+	_nfAvailable.broadcast();
+}
+
+
+bool ConcurrentNotificationQueue::empty() const
+{
+	return size() == 0;
+}
+
+
+int ConcurrentNotificationQueue::size() const
+{
+	std::size_t dequeuePos = _dequeuePos.load(std::memory_order_acquire);
+	std::size_t enqueuePos = _enqueuePos.load(std::memory_order_acquire);
+	if (enqueuePos <= dequeuePos) return 0;
+	std::size_t n = enqueuePos - dequeuePos;
+	return static_cast<int>(n > _capacity ? _capacity : n);
+}
+
+
+void ConcurrentNotificationQueue::clear()
+{
+	Notification* pNf = pop();
+	while (pNf)
+	{
+		pNf->release();
+		pNf = pop();
+	}
+}
+
+
+bool ConcurrentNotificationQueue::push(Notification* pNf)
+{
+	Cell* pCell;
+	std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		pCell = &_cells[pos & _mask];
+		std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+		if (diff == 0)
+		{
+			if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+		{
+			return false; // full
+		}
+		else
+		{
+			pos = _enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+	pCell->pNf = pNf;
+	pCell->sequence.store(pos + 1, std::memory_order_release);
+	return true;
+}
+
+
+Notification* ConcurrentNotificationQueue::pop()
+{
+	Cell* pCell;
+	std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		pCell = &_cells[pos & _mask];
+		std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+		if (diff == 0)
+		{
+			if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+		{
+			return 0; // empty
+		}
+		else
+		{
+			pos = _dequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+	Notification* pNf = pCell->pNf;
+	pCell->pNf = 0;
+	pCell->sequence.store(pos + _mask + 1, std::memory_order_release);
+	return pNf;
+}
+
+
+Notification* ConcurrentNotificationQueue::wait(long milliseconds)
+{
+	Notification* pNf = pop();
+	for (int i = 0; !pNf && i < SPIN_COUNT; ++i)
+	{
+		pNf = pop();
+	}
+	if (pNf) return pNf;
+
+	Timestamp start;
+	const Timestamp::TimeDiff timeout = static_cast<Timestamp::TimeDiff>(milliseconds)*1000;
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	unsigned wakeUpCount = _wakeUpCount;
+	++_waiters;
+	// Pairs with the fence in notifyOne(): either the producer
+	// sees this waiter, or this waiter sees the new notification.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	for (;;)
+	{
+		pNf = pop();
+		if (pNf || _wakeUpCount != wakeUpCount) break;
+		if (milliseconds < 0)
+		{
+			_nfAvailable.wait(_mutex);
+		}
+		else
+		{
+			Timestamp::TimeDiff remaining = timeout - start.elapsed();
+			if (remaining <= 0 || !_nfAvailable.tryWait(_mutex, static_cast<long>((remaining + 999)/1000)))
+			{
+				pNf = pop();
+				break;
+			}
+		}
+	}
+	--_waiters;
+	return pNf;
+}
+
+
+void ConcurrentNotificationQueue::notifyOne()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waiters.load(std::memory_order_relaxed) > 0)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_nfAvailable.signal();
+	}
+}
+
+
+} // namespace Poco
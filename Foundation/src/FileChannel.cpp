@@ -18,12 +18,14 @@
 #include "Poco/PurgeStrategy.h"
 #include "Poco/Message.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTime.h"
 #include "Poco/LocalDateTime.h"
 #include "Poco/String.h"
 #include "Poco/Exception.h"
 #include "Poco/Ascii.h"
+#include "Poco/ErrorHandler.h"
 
 
 namespace Poco {
@@ -38,12 +40,20 @@ const std::string FileChannel::PROP_PURGEAGE     = "purgeAge";
 const std::string FileChannel::PROP_PURGECOUNT   = "purgeCount";
 const std::string FileChannel::PROP_FLUSH        = "flush";
 const std::string FileChannel::PROP_ROTATEONOPEN = "rotateOnOpen";
+const std::string FileChannel::PROP_BUFFERSIZE   = "bufferSize";
+const std::string FileChannel::PROP_SYNCINTERVAL = "syncInterval";
+const std::string FileChannel::PROP_SYNCSIZE     = "syncSize";
+const std::string FileChannel::PROP_PREALLOCATE  = "preallocate";
 
 FileChannel::FileChannel():
 	_times("utc"),
 	_compress(false),
 	_flush(false),
 	_rotateOnOpen(false),
+	_bufferSize(0),
+	_syncInterval(0),
+	_syncSize(0),
+	_preallocate(0),
 	_pFile(nullptr),
 	_pRotateStrategy(new NullRotateStrategy()),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
@@ -58,6 +68,10 @@ FileChannel::FileChannel(const std::string& path):
 	_compress(false),
 	_flush(false),
 	_rotateOnOpen(false),
+	_bufferSize(0),
+	_syncInterval(0),
+	_syncSize(0),
+	_preallocate(0),
 	_pFile(nullptr),
 	_pRotateStrategy(new NullRotateStrategy()),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
@@ -103,12 +117,18 @@ void FileChannel::open()
 		}
 
 		_pFile = _pArchiveStrategy->open(_pFile);
+		setupFile();
+		if (_syncInterval > 0) startSync();
 	}
 }
 
 
 void FileChannel::close()
 {
+	// must be done before locking the mutex,
+	// as the sync thread acquires it
+	stopSync();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	if (_pFile != nullptr)
@@ -136,12 +156,15 @@ void FileChannel::log(const Message& msg)
 		{
 			_pFile = new LogFile(_path);
 		}
+		setupFile();
 		// we must call mustRotate() again to give the
 		// RotateByIntervalStrategy a chance to write its timestamp
 		// to the new file.
 		_pRotateStrategy->mustRotate(_pFile);
 	}
 	_pFile->write(msg.getText(), _flush);
+	if (_syncSize > 0 && _pFile->unsyncedBytes() >= _syncSize)
+		_pFile->sync();
 }
 
 
@@ -175,6 +198,14 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 		setFlush(value);
 	else if (name == PROP_ROTATEONOPEN)
 		setRotateOnOpen(value);
+	else if (name == PROP_BUFFERSIZE)
+		setBufferSize(value);
+	else if (name == PROP_SYNCINTERVAL)
+		setSyncInterval(value);
+	else if (name == PROP_SYNCSIZE)
+		setSyncSize(value);
+	else if (name == PROP_PREALLOCATE)
+		setPreallocate(value);
 	else
 		Channel::setProperty(name, value);
 }
@@ -200,6 +231,14 @@ std::string FileChannel::getProperty(const std::string& name) const
 		return std::string(_flush ? "true" : "false");
 	else if (name == PROP_ROTATEONOPEN)
 		return std::string(_rotateOnOpen ? "true" : "false");
+	else if (name == PROP_BUFFERSIZE)
+		return NumberFormatter::format(static_cast<UInt64>(_bufferSize));
+	else if (name == PROP_SYNCINTERVAL)
+		return NumberFormatter::format(_syncInterval);
+	else if (name == PROP_SYNCSIZE)
+		return NumberFormatter::format(_syncSize);
+	else if (name == PROP_PREALLOCATE)
+		return NumberFormatter::format(_preallocate);
 	else
 		return Channel::getProperty(name);
 }
@@ -395,6 +434,87 @@ void FileChannel::setRotateOnOpen(const std::string& rotateOnOpen)
 }
 
 
+void FileChannel::setBufferSize(const std::string& size)
+{
+	_bufferSize = static_cast<std::size_t>(extractSize(PROP_BUFFERSIZE, size));
+	if (_pFile) _pFile->setBufferSize(_bufferSize);
+}
+
+
+void FileChannel::setSyncInterval(const std::string& interval)
+{
+	int n = 0;
+	if (!NumberParser::tryParse(interval, n) || n < 0)
+		throw InvalidArgumentException(PROP_SYNCINTERVAL, interval);
+
+	_syncInterval = n;
+	if (_pFile && _syncInterval > 0) startSync();
+}
+
+
+void FileChannel::setSyncSize(const std::string& size)
+{
+	_syncSize = extractSize(PROP_SYNCSIZE, size);
+}
+
+
+void FileChannel::setPreallocate(const std::string& size)
+{
+	_preallocate = extractSize(PROP_PREALLOCATE, size);
+	if (_pFile) _pFile->setPreallocation(_preallocate);
+}
+
+
+void FileChannel::setupFile()
+{
+	if (_bufferSize > 0) _pFile->setBufferSize(_bufferSize);
+	if (_preallocate > 0) _pFile->setPreallocation(_preallocate);
+}
+
+
+void FileChannel::startSync()
+{
+	if (!_syncThread.isRunning())
+	{
+		_syncThread.join();
+		_syncThread.startFunc([this]() { runSync(); });
+	}
+}
+
+
+void FileChannel::stopSync()
+{
+	if (_syncThread.isRunning())
+		_syncStop.set();
+	_syncThread.join();
+	_syncStop.reset();
+}
+
+
+void FileChannel::runSync()
+{
+	for (;;)
+	{
+		long interval;
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			interval = _syncInterval;
+		}
+		if (interval <= 0 || _syncStop.tryWait(interval)) break;
+
+		FastMutex::ScopedLock lock(_mutex);
+		try
+		{
+			if (_pFile) _pFile->sync();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+	}
+}
+
+
 void FileChannel::purge()
 {
 	if (_pPurgeStrategy)
@@ -453,6 +573,30 @@ void FileChannel::setPurgeStrategy(PurgeStrategy* strategy)
 }
 
 
+UInt64 FileChannel::extractSize(const std::string& name, const std::string& value) const
+{
+	std::string::const_iterator it  = value.begin();
+	std::string::const_iterator end = value.end();
+	UInt64 n = 0;
+	bool digits = false;
+	while (it != end && Ascii::isSpace(*it)) ++it;
+	while (it != end && Ascii::isDigit(*it)) { n *= 10; n += *it++ - '0'; digits = true; }
+	while (it != end && Ascii::isSpace(*it)) ++it;
+	std::string unit;
+	while (it != end && Ascii::isAlpha(*it)) unit += *it++;
+
+	if (!digits || it != end)
+		throw InvalidArgumentException(name, value);
+	if (unit == "K")
+		n *= 1024;
+	else if (unit == "M")
+		n *= 1024*1024;
+	else if (!unit.empty())
+		throw InvalidArgumentException(name, value);
+	return n;
+}
+
+
 Timespan::TimeDiff FileChannel::extractFactor(const std::string& value, std::string::const_iterator start) const
 {
 	while (start != value.end() && Ascii::isSpace(*start)) ++start;
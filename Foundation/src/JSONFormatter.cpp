@@ -0,0 +1,90 @@
+//
+// JSONFormatter.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  JSONFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSONFormatter.h"
+#include "Poco/JSONString.h"
+#include "Poco/NumberFormatter.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	inline void appendKey(std::string& text, const char* key, std::size_t length)
+	{
+		text += ',';
+		text += '"';
+		text.append(key, length);
+		text += '"';
+		text += ':';
+	}
+
+	inline void appendString(std::string& text, const char* key, std::size_t length, const std::string& value)
+	{
+		appendKey(text, key, length);
+		toJSON(value, text, JSON_WRAP_STRINGS);
+	}
+
+	inline void appendNumber(std::string& text, const char* key, std::size_t length, long value)
+	{
+		appendKey(text, key, length);
+		NumberFormatter::append(text, value);
+	}
+}
+
+
+JSONFormatter::JSONFormatter()
+{
+}
+
+
+JSONFormatter::~JSONFormatter()
+{
+}
+
+
+void JSONFormatter::format(const Message& msg, std::string& text)
+{
+	text.append("{\"timestamp\":\"");
+	appendTimestamp(msg, text);
+	text.append("\",\"priority\":\"");
+	appendPriority(msg, text);
+	text += '"';
+	appendString(text, "source", 6, msg.getSource());
+	appendString(text, "text", 4, msg.getText());
+	if (!msg.getThread().empty())
+		appendString(text, "thread", 6, msg.getThread());
+	appendNumber(text, "tid", 3, msg.getTid());
+	appendNumber(text, "pid", 3, msg.getPid());
+	if (sourceLocation() && msg.getSourceFile())
+	{
+		const char* file = msg.getSourceFile();
+		appendKey(text, "file", 4);
+		toJSON(file, std::strlen(file), text, JSON_WRAP_STRINGS);
+		appendNumber(text, "line", 4, msg.getSourceLine());
+	}
+	for (const auto& p: msg.getAll())
+	{
+		text += ',';
+		toJSON(p.first, text, JSON_WRAP_STRINGS);
+		text += ':';
+		toJSON(p.second, text, JSON_WRAP_STRINGS);
+	}
+	text += '}';
+}
+
+
+} // namespace Poco
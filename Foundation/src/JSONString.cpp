@@ -27,14 +27,46 @@ struct WriteFunc
 
 
 
+std::size_t escapeChar(char c, char* buffer, bool lowerCaseHex)
+	/// Escapes a control character, double quote or backslash
+	/// the same way as Poco::UTF8::escape() in strict JSON mode.
+	/// Returns the number of characters written to buffer.
+{
+	static const char upperHex[] = "0123456789ABCDEF";
+	static const char lowerHex[] = "0123456789abcdef";
+
+	buffer[0] = '\\';
+	switch (c)
+	{
+	case '\n': buffer[1] = 'n'; return 2;
+	case '\t': buffer[1] = 't'; return 2;
+	case '\r': buffer[1] = 'r'; return 2;
+	case '\b': buffer[1] = 'b'; return 2;
+	case '\f': buffer[1] = 'f'; return 2;
+	case '\\': buffer[1] = '\\'; return 2;
+	case '"': buffer[1] = '"'; return 2;
+	default:
+		{
+			const char* hex = lowerCaseHex ? lowerHex : upperHex;
+			buffer[1] = 'u';
+			buffer[2] = '0';
+			buffer[3] = '0';
+			buffer[4] = hex[(c >> 4) & 0x0F];
+			buffer[5] = hex[c & 0x0F];
+			return 6;
+		}
+	}
+}
+
+
 template<typename T, typename S>
-void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Type write, int options)
+void writeString(const char* begin, const char* end, T& obj, typename WriteFunc<T, S>::Type write, int options)
 {
 	bool wrap = ((options & Poco::JSON_WRAP_STRINGS) != 0);
 	bool escapeAllUnicode = ((options & Poco::JSON_ESCAPE_UNICODE) != 0);
 	bool lowerCaseHex = ((options & Poco::JSON_LOWERCASE_HEX) != 0);
 
-	if (value.size() == 0)
+	if (begin == end)
 	{
 		if(wrap) (obj.*write)("\"\"", 2);
 		return;
@@ -43,20 +75,26 @@ void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Typ
 	if(wrap) (obj.*write)("\"", 1);
 	if(escapeAllUnicode)
 	{
+		std::string value(begin, end);
 		std::string str = Poco::UTF8::escape(value.begin(), value.end(), true, lowerCaseHex);
 		(obj.*write)(str.c_str(), str.size());
 	}
 	else
 	{
-		for(std::string::const_iterator it = value.begin(), end = value.end(); it != end; ++it)
+		// write runs of characters not requiring escaping in one go
+		const char* run = begin;
+		for (const char* it = begin; it != end; ++it)
 		{
 			if ((*it >= 0 && *it <= 31) || (*it == '"') || (*it == '\\'))
 			{
-				std::string str = Poco::UTF8::escape(it, it + 1, true, lowerCaseHex);
-				(obj.*write)(str.c_str(), str.size());
+				if (it != run) (obj.*write)(run, static_cast<S>(it - run));
+				char buffer[8];
+				std::size_t n = escapeChar(*it, buffer, lowerCaseHex);
+				(obj.*write)(buffer, static_cast<S>(n));
+				run = it + 1;
 			}
-			else (obj.*write)(&(*it), 1);
 		}
+		if (end != run) (obj.*write)(run, static_cast<S>(end - run));
 	}
 	if(wrap) (obj.*write)("\"", 1);
 };
@@ -70,16 +108,28 @@ namespace Poco {
 
 void toJSON(const std::string& value, std::ostream& out, int options)
 {
-	writeString<std::ostream, std::streamsize>(value, out, &std::ostream::write, options);
+	writeString<std::ostream, std::streamsize>(value.data(), value.data() + value.size(), out, &std::ostream::write, options);
 }
 
 
 std::string toJSON(const std::string& value, int options)
 {
 	std::string ret;
-	writeString<std::string, std::string::size_type>(value, ret, &std::string::append, options);
+	toJSON(value.data(), value.size(), ret, options);
 	return ret;
 }
 
 
+void toJSON(const std::string& value, std::string& out, int options)
+{
+	toJSON(value.data(), value.size(), out, options);
+}
+
+
+void toJSON(const char* value, std::size_t length, std::string& out, int options)
+{
+	writeString<std::string, std::string::size_type>(value, value + length, out, &std::string::append, options);
+}
+
+
 } // namespace Poco
@@ -15,14 +15,61 @@
 #include "Poco/LogFile.h"
 #include "Poco/File.h"
 #include "Poco/Exception.h"
+#include <algorithm>
+#include <cstring>
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/uio.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#endif
+#if defined(POCO_OS_LINUX)
+#include <fcntl.h>
+#endif
+
 
 namespace Poco {
 
 
+namespace
+{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	std::string convertNewlines(const std::string& text)
+		/// Replaces \n with \r\n.
+	{
+		std::string logText;
+		logText.reserve(text.size() + 16); // keep some reserve for \n -> \r\n
+		char prevChar = 0;
+		for (char c: text)
+		{
+			if (c == '\n' && prevChar != '\r')
+				logText += POCO_DEFAULT_NEWLINE_CHARS;
+			else
+				logText += c;
+
+			prevChar = c;
+		}
+		return logText;
+	}
+#endif
+}
+
+
+struct alignas(4096) LogFile::Chunk
+{
+	char data[BUFFER_CHUNK_SIZE];
+};
+
+
 LogFile::LogFile(const std::string& path):
 	_path(path),
 	_str(_path, std::ios::app),
-	_size(static_cast<UInt64>(_str.tellp()))
+	_size(static_cast<UInt64>(_str.tellp())),
+	_syncedSize(_size),
+	_preallocation(0),
+	_allocatedSize(0),
+	_chunkIndex(0),
+	_chunkOffset(0)
 {
 	// There seems to be a strange "optimization" in the Windows NTFS
 	// filesystem that causes it to reuse directory entries of deleted
@@ -46,28 +93,46 @@ LogFile::LogFile(const std::string& path):
 
 LogFile::~LogFile()
 {
+	try
+	{
+		if (!_chunks.empty()) sync();
+#if defined(POCO_OS_LINUX)
+		if (_allocatedSize > _size)
+		{
+			// release preallocated space beyond the end of the file
+			int rc = ftruncate(_str.nativeHandle(), static_cast<off_t>(_size));
+			(void) rc;
+		}
+#endif
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
 }
 
 
 void LogFile::write(const std::string& text, bool flush)
 {
+	if (!_chunks.empty())
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		std::string logText = convertNewlines(text);
+		append(logText.data(), logText.size());
+#else
+		append(text.data(), text.size());
+#endif
+		append(POCO_DEFAULT_NEWLINE_CHARS, sizeof(POCO_DEFAULT_NEWLINE_CHARS) - 1);
+		if (flush) sync();
+		return;
+	}
+
 	std::streampos pos = _str.tellp();
 
-#if defined(POCO_OS_FAMILY_WINDOWS)
-	// Replace \n with \r\n
-	std::string logText;
-	logText.reserve(text.size() + 16); // keep some reserve for \n -> \r\n
-	char prevChar = 0;
-	for (char c: text)
-	{
-		if (c == '\n' && prevChar != '\r')
-			logText += POCO_DEFAULT_NEWLINE_CHARS;
-		else
-			logText += c;
+	if (_preallocation > 0) preallocate(_size, _size + text.size() + sizeof(POCO_DEFAULT_NEWLINE_CHARS));
 
-		prevChar = c;
-	}
-	_str << logText;
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	_str << convertNewlines(text);
 #else
 	_str << text;
 #endif
@@ -87,6 +152,215 @@ void LogFile::write(const std::string& text, bool flush)
 	}
 
 	_size = static_cast<UInt64>(_str.tellp());
+	if (flush) _syncedSize = _size;
+}
+
+
+void LogFile::append(const char* data, std::size_t length)
+{
+	while (length > 0)
+	{
+		if (_chunkIndex == _chunks.size()) flush();
+
+		std::size_t n = BUFFER_CHUNK_SIZE - _chunkOffset;
+		if (n > length) n = length;
+		std::memcpy(_chunks[_chunkIndex]->data + _chunkOffset, data, n);
+		_chunkOffset += n;
+		_size += n;
+		data += n;
+		length -= n;
+		if (_chunkOffset == BUFFER_CHUNK_SIZE)
+		{
+			++_chunkIndex;
+			_chunkOffset = 0;
+		}
+	}
+}
+
+
+void LogFile::flush()
+{
+	if (_chunkIndex == 0 && _chunkOffset == 0) return;
+
+	if (_preallocation > 0)
+	{
+		UInt64 buffered = static_cast<UInt64>(_chunkIndex)*BUFFER_CHUNK_SIZE + _chunkOffset;
+		preallocate(_size - buffered, _size);
+	}
+
+#if defined(POCO_OS_FAMILY_UNIX)
+	std::vector<struct iovec> iov;
+	iov.reserve(_chunkIndex + 1);
+	for (std::size_t i = 0; i < _chunkIndex; ++i)
+	{
+		struct iovec v;
+		v.iov_base = _chunks[i]->data;
+		v.iov_len  = BUFFER_CHUNK_SIZE;
+		iov.push_back(v);
+	}
+	if (_chunkOffset > 0)
+	{
+		struct iovec v;
+		v.iov_base = _chunks[_chunkIndex]->data;
+		v.iov_len  = _chunkOffset;
+		iov.push_back(v);
+	}
+
+	int fd = _str.nativeHandle();
+	std::size_t first = 0;
+	std::size_t total = 0;
+	while (first < iov.size())
+	{
+		std::size_t count = iov.size() - first;
+		if (count > IOV_MAX) count = IOV_MAX;
+		ssize_t rc = ::writev(fd, &iov[first], static_cast<int>(count));
+		if (rc < 0)
+		{
+			if (errno == EINTR) continue;
+			// keep only the data that has not been written yet,
+			// so that it is not written twice by the next flush()
+			discard(total);
+			throw WriteFileException(_path);
+		}
+		// handle partial writes
+		std::size_t written = static_cast<std::size_t>(rc);
+		total += written;
+		while (first < iov.size() && written >= iov[first].iov_len)
+		{
+			written -= iov[first].iov_len;
+			++first;
+		}
+		if (written > 0)
+		{
+			iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + written;
+			iov[first].iov_len -= written;
+		}
+	}
+#else
+	for (std::size_t i = 0; i < _chunkIndex; ++i)
+	{
+		_str.write(_chunks[i]->data, BUFFER_CHUNK_SIZE);
+	}
+	if (_chunkOffset > 0)
+	{
+		_str.write(_chunks[_chunkIndex]->data, _chunkOffset);
+	}
+	_str.flush();
+	if (!_str.good())
+	{
+		_str.clear();
+		throw WriteFileException(_path);
+	}
+#endif
+
+	_chunkIndex = 0;
+	_chunkOffset = 0;
+}
+
+
+void LogFile::discard(std::size_t length)
+{
+	std::size_t remaining = _chunkIndex*BUFFER_CHUNK_SIZE + _chunkOffset - length;
+	std::size_t src = length;
+	std::size_t dst = 0;
+	while (dst < remaining)
+	{
+		std::size_t srcOffset = src % BUFFER_CHUNK_SIZE;
+		std::size_t dstOffset = dst % BUFFER_CHUNK_SIZE;
+		std::size_t n = std::min(BUFFER_CHUNK_SIZE - srcOffset, BUFFER_CHUNK_SIZE - dstOffset);
+		if (n > remaining - dst) n = remaining - dst;
+		std::memmove(_chunks[dst/BUFFER_CHUNK_SIZE]->data + dstOffset, _chunks[src/BUFFER_CHUNK_SIZE]->data + srcOffset, n);
+		src += n;
+		dst += n;
+	}
+	_chunkIndex = remaining/BUFFER_CHUNK_SIZE;
+	_chunkOffset = remaining % BUFFER_CHUNK_SIZE;
+}
+
+
+void LogFile::sync()
+{
+	flush();
+	if (_syncedSize != _size)
+	{
+#if defined(POCO_OS_LINUX)
+		int rc;
+		do
+		{
+			rc = ::fdatasync(_str.nativeHandle());
+		}
+		while (rc != 0 && errno == EINTR);
+		if (rc != 0) throw WriteFileException(_path);
+#else
+		_str.flushToDisk();
+#endif
+		_syncedSize = _size;
+	}
+}
+
+
+UInt64 LogFile::unsyncedBytes() const
+{
+	return _size - _syncedSize;
+}
+
+
+void LogFile::setBufferSize(std::size_t size)
+{
+	flush();
+	// Buffered data is written with writev() on the file descriptor,
+	// bypassing the stream, so anything still held in the stream
+	// buffer must reach the file first.
+	_str.flush();
+	if (!_str.good())
+	{
+		_str.clear();
+		throw WriteFileException(_path);
+	}
+
+	std::size_t nChunks = (size + BUFFER_CHUNK_SIZE - 1)/BUFFER_CHUNK_SIZE;
+	_chunks.resize(nChunks);
+	for (auto& pChunk: _chunks)
+	{
+		if (!pChunk) pChunk.reset(new Chunk);
+	}
+}
+
+
+std::size_t LogFile::getBufferSize() const
+{
+	return _chunks.size()*BUFFER_CHUNK_SIZE;
+}
+
+
+void LogFile::setPreallocation(UInt64 size)
+{
+	_preallocation = size;
+}
+
+
+UInt64 LogFile::getPreallocation() const
+{
+	return _preallocation;
+}
+
+
+void LogFile::preallocate(UInt64 offset, UInt64 end)
+{
+#if defined(POCO_OS_LINUX)
+	if (end > _allocatedSize)
+	{
+		// Failure is not an error here; the file simply grows
+		// on demand, as it does without preallocation.
+		UInt64 length = end - offset + _preallocation;
+		if (::fallocate(_str.nativeHandle(), FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset), static_cast<off_t>(length)) == 0)
+			_allocatedSize = offset + length;
+		else
+			_preallocation = 0;
+	}
+#else
+	_preallocation = 0;
+#endif
 }
 
 
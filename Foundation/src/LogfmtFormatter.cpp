@@ -0,0 +1,107 @@
+//
+// LogfmtFormatter.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  LogfmtFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/LogfmtFormatter.h"
+#include "Poco/JSONString.h"
+#include "Poco/NumberFormatter.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	inline bool mustQuote(char c)
+	{
+		return (c >= 0 && c <= ' ') || c == '=' || c == '"' || c == 0x7F;
+	}
+
+	void appendValue(std::string& text, const char* value, std::size_t length)
+	{
+		const char* end = value + length;
+		const char* it = value;
+		while (it != end && !mustQuote(*it)) ++it;
+		if (it == end && length > 0)
+			text.append(value, length);
+		else
+			toJSON(value, length, text, JSON_WRAP_STRINGS);
+	}
+
+	void appendKey(std::string& text, const std::string& key)
+	{
+		text += ' ';
+		for (char c: key)
+		{
+			text += mustQuote(c) ? '_' : c;
+		}
+		text += '=';
+	}
+
+	inline void appendString(std::string& text, const char* key, const std::string& value)
+	{
+		text += ' ';
+		text.append(key);
+		text += '=';
+		appendValue(text, value.data(), value.size());
+	}
+
+	inline void appendNumber(std::string& text, const char* key, long value)
+	{
+		text += ' ';
+		text.append(key);
+		text += '=';
+		NumberFormatter::append(text, value);
+	}
+}
+
+
+LogfmtFormatter::LogfmtFormatter()
+{
+}
+
+
+LogfmtFormatter::~LogfmtFormatter()
+{
+}
+
+
+void LogfmtFormatter::format(const Message& msg, std::string& text)
+{
+	text.append("timestamp=");
+	appendTimestamp(msg, text);
+	text.append(" priority=");
+	appendPriority(msg, text);
+	appendString(text, "source", msg.getSource());
+	appendString(text, "text", msg.getText());
+	if (!msg.getThread().empty())
+		appendString(text, "thread", msg.getThread());
+	appendNumber(text, "tid", msg.getTid());
+	appendNumber(text, "pid", msg.getPid());
+	if (sourceLocation() && msg.getSourceFile())
+	{
+		const char* file = msg.getSourceFile();
+		text.append(" file=");
+		appendValue(text, file, std::strlen(file));
+		appendNumber(text, "line", msg.getSourceLine());
+	}
+	for (const auto& p: msg.getAll())
+	{
+		appendKey(text, p.first);
+		appendValue(text, p.second.data(), p.second.size());
+	}
+}
+
+
+} // namespace Poco
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Logger.h"
+#include "Poco/RingBufferChannel.h"
 #include "Poco/Formatter.h"
 #include "Poco/LoggingRegistry.h"
 #include "Poco/Exception.h"
@@ -29,7 +30,7 @@ Mutex                Logger::_mapMtx;
 const std::string    Logger::ROOT;
 
 
-Logger::Logger(const std::string& name, Channel::Ptr pChannel, int level): _name(name), _pChannel(pChannel), _level(level)
+Logger::Logger(const std::string& name, Channel::Ptr pChannel, int level): _name(name), _pChannel(pChannel), _pRingChannel(dynamic_cast<RingBufferChannel*>(pChannel.get())), _level(level)
 {
 }
 
@@ -42,6 +43,7 @@ Logger::~Logger()
 void Logger::setChannel(Channel::Ptr pChannel)
 {
 	_pChannel = pChannel;
+	_pRingChannel = dynamic_cast<RingBufferChannel*>(pChannel.get());
 }
 
 
@@ -95,6 +97,24 @@ void Logger::log(const Exception& exc, const char* file, LineNumber line)
 }
 
 
+void Logger::logToRing(const std::string& text, Message::Priority prio, const char* file, LineNumber line)
+{
+	_pRingChannel->log(_name, text, prio, file, line);
+}
+
+
+char* Logger::beginFormat(Message::Priority prio, const std::string& fmt, int argc, std::size_t argsSize)
+{
+	return _pRingChannel->beginFormat(_name, prio, fmt, argc, argsSize);
+}
+
+
+void Logger::endFormat()
+{
+	_pRingChannel->commit();
+}
+
+
 void Logger::dump(const std::string& msg, const void* buffer, std::size_t length, Message::Priority prio)
 {
 	if (_level >= prio && _pChannel)
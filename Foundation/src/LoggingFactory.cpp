@@ -21,6 +21,7 @@
 #include "Poco/SplitterChannel.h"
 #include "Poco/NullChannel.h"
 #include "Poco/EventChannel.h"
+#include "Poco/RingBufferChannel.h"
 #if defined(POCO_OS_FAMILY_UNIX) && !defined(POCO_NO_SYSLOGCHANNEL)
 #include "Poco/SyslogChannel.h"
 #endif
@@ -29,6 +30,8 @@
 #include "Poco/WindowsConsoleChannel.h"
 #endif
 #include "Poco/PatternFormatter.h"
+#include "Poco/JSONFormatter.h"
+#include "Poco/LogfmtFormatter.h"
 
 
 using namespace std::string_literals;
@@ -100,6 +103,7 @@ void LoggingFactory::registerBuiltins()
 #endif
 	_channelFactory.registerClass("NullChannel"s, new Instantiator<NullChannel, Channel>);
 	_channelFactory.registerClass("EventChannel"s, new Instantiator<EventChannel, Channel>);
+	_channelFactory.registerClass("RingBufferChannel"s, new Instantiator<RingBufferChannel, Channel>);
 
 #if defined(POCO_OS_FAMILY_UNIX)
 #ifndef POCO_NO_SYSLOGCHANNEL
@@ -112,6 +116,8 @@ void LoggingFactory::registerBuiltins()
 #endif
 
 	_formatterFactory.registerClass("PatternFormatter"s, new Instantiator<PatternFormatter, Formatter>);
+	_formatterFactory.registerClass("JSONFormatter"s, new Instantiator<JSONFormatter, Formatter>);
+	_formatterFactory.registerClass("LogfmtFormatter"s, new Instantiator<LogfmtFormatter, Formatter>);
 }
 
 
@@ -226,6 +226,12 @@ void Message::setTid(long tid)
 }
 
 
+void Message::setOsTid(long tid)
+{
+	_ostid = tid;
+}
+
+
 void Message::setPid(long pid)
 {
 	_pid = pid;
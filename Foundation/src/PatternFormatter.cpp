@@ -23,7 +23,9 @@
 #include "Poco/Environment.h"
 #include "Poco/NumberParser.h"
 #include "Poco/StringTokenizer.h"
-#include "Poco/Path.h"
+#include "Poco/Process.h"
+#include <cstring>
+#include <limits>
 
 
 namespace Poco {
@@ -35,18 +37,22 @@ const std::string PatternFormatter::PROP_PRIORITY_NAMES = "priorityNames";
 const std::string PatternFormatter::DEFAULT_PRIORITY_NAMES = "Fatal,Critical,Error,Warning,Notice,Information,Debug,Trace";
 
 PatternFormatter::PatternFormatter():
+	_pid(static_cast<long>(Process::id())),
 	_localTime(false),
 	_priorityNames(DEFAULT_PRIORITY_NAMES)
 {
+	NumberFormatter::append(_pidText, _pid);
 	parsePriorityNames();
 }
 
 
 PatternFormatter::PatternFormatter(const std::string& format):
+	_pid(static_cast<long>(Process::id())),
 	_localTime(false),
 	_pattern(format),
 	_priorityNames(DEFAULT_PRIORITY_NAMES)
 {
+	NumberFormatter::append(_pidText, _pid);
 	parsePriorityNames();
 	parsePattern();
 }
@@ -57,82 +63,92 @@ PatternFormatter::~PatternFormatter()
 }
 
 
+namespace
+{
+	inline bool isTimeKey(char key)
+		/// Returns true if the given key denotes a date/time
+		/// field with a resolution of one second.
+	{
+		return key != 0 && std::strchr("wWbBdefmnoyYHhaAMSzZE", key) != nullptr;
+	}
+
+	inline const char* fileName(const char* path)
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		const char* p = std::strrchr(path, '\\');
+		const char* q = std::strrchr(path, '/');
+		if (q > p) p = q;
+		if (!p)	p = std::strrchr(path, ':');
+#else
+		const char* p = std::strrchr(path, '/');
+#endif
+		return p ? p + 1 : path;
+	}
+}
+
+
 void PatternFormatter::format(const Message& msg, std::string& text)
 {
-	Timestamp timestamp = msg.getTime();
-	bool localTime = _localTime;
-	if (localTime)
+	Int64 micros = msg.getTime().epochMicroseconds();
+	Int64 second = micros/Timestamp::resolution();
+	int fraction = static_cast<int>(micros % Timestamp::resolution());
+	if (fraction < 0)
 	{
-		timestamp += Timezone::utcOffset()*Timestamp::resolution();
-		timestamp += Timezone::dst()*Timestamp::resolution();
+		fraction += static_cast<int>(Timestamp::resolution());
+		--second;
 	}
-	DateTime dateTime = timestamp;
-	for (auto& pa:_patternActions)
+
+	for (const auto& op: _ops)
 	{
-		text.append(pa.prepend);
-		switch (pa.key)
+		switch (op.code)
 		{
-		case 's': text.append(msg.getSource()); break;
-		case 't': text.append(msg.getText()); break;
-		case 'l': NumberFormatter::append(text, (int) msg.getPriority()); break;
-		case 'p': text.append(getPriorityName((int) msg.getPriority())); break;
-		case 'q': text += getPriorityName((int) msg.getPriority()).at(0); break;
-		case 'P': NumberFormatter::append(text, msg.getPid()); break;
-		case 'T': text.append(msg.getThread()); break;
-		case 'I': NumberFormatter::append(text, msg.getTid()); break;
-		case 'J': NumberFormatter::append(text, msg.getOsTid()); break;
-		case 'N': text.append(Environment::nodeName()); break;
-		case 'U': text.append(msg.getSourceFile() ? msg.getSourceFile() : ""); break;
-		case 'O': text.append(msg.getSourceFile() ? Path(msg.getSourceFile()).getFileName() : ""); break;
-		case 'u': NumberFormatter::append(text, msg.getSourceLine()); break;
-		case 'w': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
-		case 'W': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()]); break;
-		case 'b': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
-		case 'B': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1]); break;
-		case 'd': NumberFormatter::append0(text, dateTime.day(), 2); break;
-		case 'e': NumberFormatter::append(text, dateTime.day()); break;
-		case 'f': NumberFormatter::append(text, dateTime.day(), 2); break;
-		case 'm': NumberFormatter::append0(text, dateTime.month(), 2); break;
-		case 'n': NumberFormatter::append(text, dateTime.month()); break;
-		case 'o': NumberFormatter::append(text, dateTime.month(), 2); break;
-		case 'y': NumberFormatter::append0(text, dateTime.year() % 100, 2); break;
-		case 'Y': NumberFormatter::append0(text, dateTime.year(), 4); break;
-		case 'H': NumberFormatter::append0(text, dateTime.hour(), 2); break;
-		case 'h': NumberFormatter::append0(text, dateTime.hourAMPM(), 2); break;
-		case 'a': text.append(dateTime.isAM() ? "am" : "pm"); break;
-		case 'A': text.append(dateTime.isAM() ? "AM" : "PM"); break;
-		case 'M': NumberFormatter::append0(text, dateTime.minute(), 2); break;
-		case 'S': NumberFormatter::append0(text, dateTime.second(), 2); break;
-		case 'i': NumberFormatter::append0(text, dateTime.millisecond(), 3); break;
-		case 'c': NumberFormatter::append(text, dateTime.millisecond()/100); break;
-		case 'F': NumberFormatter::append0(text, dateTime.millisecond()*1000 + dateTime.microsecond(), 6); break;
-		case 'z': text.append(DateTimeFormatter::tzdISO(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
-		case 'Z': text.append(DateTimeFormatter::tzdRFC(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
-		case 'E': NumberFormatter::append(text, msg.getTime().epochTime()); break;
-		case 'v':
-			if (pa.length > msg.getSource().length())	//append spaces
-				text.append(msg.getSource()).append(pa.length - msg.getSource().length(), ' ');
-			else if (pa.length && pa.length < msg.getSource().length()) // crop
-				text.append(msg.getSource(), msg.getSource().length()-pa.length, pa.length);
+		case OP_LITERAL: text.append(op.text); break;
+		case OP_SOURCE: text.append(msg.getSource()); break;
+		case OP_SOURCE_WIDTH:
+			{
+				const std::string& source = msg.getSource();
+				if (op.length > source.length())	//append spaces
+					text.append(source).append(op.length - source.length(), ' ');
+				else if (op.length && op.length < source.length()) // crop
+					text.append(source, source.length() - op.length, op.length);
+				else
+					text.append(source);
+			}
+			break;
+		case OP_TEXT: text.append(msg.getText()); break;
+		case OP_PRIO_LEVEL: NumberFormatter::append(text, (int) msg.getPriority()); break;
+		case OP_PRIO_NAME: text.append(getPriorityName((int) msg.getPriority())); break;
+		case OP_PRIO_ABBR: text += getPriorityName((int) msg.getPriority()).at(0); break;
+		case OP_PID:
+			if (msg.getPid() == _pid)
+				text.append(_pidText);
 			else
-				text.append(msg.getSource());
+				NumberFormatter::append(text, msg.getPid());
 			break;
-		case 'x':
-			try
+		case OP_THREAD: text.append(msg.getThread()); break;
+		case OP_TID: NumberFormatter::append(text, msg.getTid()); break;
+		case OP_OSTID: NumberFormatter::append(text, msg.getOsTid()); break;
+		case OP_FILE_PATH: if (msg.getSourceFile()) text.append(msg.getSourceFile()); break;
+		case OP_FILE_NAME: if (msg.getSourceFile()) text.append(fileName(msg.getSourceFile())); break;
+		case OP_LINE: NumberFormatter::append(text, msg.getSourceLine()); break;
+		case OP_DATETIME:
 			{
-				text.append(msg[pa.property]);
+				TimeGroup& group = _timeGroups[op.index];
+				SpinlockMutex::ScopedLock lock(_timeMutex);
+				if (group.second != second) renderTime(group, second);
+				text.append(group.text);
 			}
-			catch (...)
+			break;
+		case OP_MILLISECOND: NumberFormatter::append0(text, fraction/1000, 3); break;
+		case OP_CENTISECOND: NumberFormatter::append(text, fraction/100000); break;
+		case OP_MICROSECOND: NumberFormatter::append0(text, fraction, 6); break;
+		case OP_PARAMETER:
+			try
 			{
+				text.append(msg[op.text]);
 			}
-			break;
-		case 'L':
-			if (!localTime)
+			catch (...)
 			{
-				localTime = true;
-				timestamp += Timezone::utcOffset()*Timestamp::resolution();
-				timestamp += Timezone::dst()*Timestamp::resolution();
-				dateTime = timestamp;
 			}
 			break;
 		}
@@ -140,6 +156,48 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 }
 
 
+void PatternFormatter::renderTime(TimeGroup& group, Int64 second)
+{
+	Timestamp timestamp(second*Timestamp::resolution());
+	if (group.localTime)
+	{
+		timestamp += Timezone::utcOffset()*Timestamp::resolution();
+		timestamp += Timezone::dst()*Timestamp::resolution();
+	}
+	DateTime dateTime = timestamp;
+	group.text.clear();
+	for (const auto& pa: group.actions)
+	{
+		group.text.append(pa.prepend);
+		switch (pa.key)
+		{
+		case 'w': group.text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
+		case 'W': group.text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()]); break;
+		case 'b': group.text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
+		case 'B': group.text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1]); break;
+		case 'd': NumberFormatter::append0(group.text, dateTime.day(), 2); break;
+		case 'e': NumberFormatter::append(group.text, dateTime.day()); break;
+		case 'f': NumberFormatter::append(group.text, dateTime.day(), 2); break;
+		case 'm': NumberFormatter::append0(group.text, dateTime.month(), 2); break;
+		case 'n': NumberFormatter::append(group.text, dateTime.month()); break;
+		case 'o': NumberFormatter::append(group.text, dateTime.month(), 2); break;
+		case 'y': NumberFormatter::append0(group.text, dateTime.year() % 100, 2); break;
+		case 'Y': NumberFormatter::append0(group.text, dateTime.year(), 4); break;
+		case 'H': NumberFormatter::append0(group.text, dateTime.hour(), 2); break;
+		case 'h': NumberFormatter::append0(group.text, dateTime.hourAMPM(), 2); break;
+		case 'a': group.text.append(dateTime.isAM() ? "am" : "pm"); break;
+		case 'A': group.text.append(dateTime.isAM() ? "AM" : "PM"); break;
+		case 'M': NumberFormatter::append0(group.text, dateTime.minute(), 2); break;
+		case 'S': NumberFormatter::append0(group.text, dateTime.second(), 2); break;
+		case 'z': group.text.append(DateTimeFormatter::tzdISO(group.localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
+		case 'Z': group.text.append(DateTimeFormatter::tzdRFC(group.localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
+		case 'E': NumberFormatter::append(group.text, second); break;
+		}
+	}
+	group.second = second;
+}
+
+
 void PatternFormatter::parsePattern()
 {
 	_patternActions.clear();
@@ -196,6 +254,78 @@ void PatternFormatter::parsePattern()
 	{
 		_patternActions.push_back(endAct);
 	}
+	compilePattern();
+}
+
+
+void PatternFormatter::compilePattern()
+{
+	_ops.clear();
+	_timeGroups.clear();
+	bool localTime = _localTime;
+	for (const auto& pa: _patternActions)
+	{
+		if (isTimeKey(pa.key))
+		{
+			if (_ops.empty() || _ops.back().code != OP_DATETIME || _timeGroups.back().localTime != localTime)
+			{
+				TimeGroup group;
+				group.localTime = localTime;
+				group.second = std::numeric_limits<Int64>::min();
+				_timeGroups.push_back(group);
+				addOp(OP_DATETIME);
+				_ops.back().index = _timeGroups.size() - 1;
+			}
+			_timeGroups.back().actions.push_back(pa);
+			continue;
+		}
+
+		addLiteral(pa.prepend);
+		switch (pa.key)
+		{
+		case 's': addOp(OP_SOURCE); break;
+		case 't': addOp(OP_TEXT); break;
+		case 'l': addOp(OP_PRIO_LEVEL); break;
+		case 'p': addOp(OP_PRIO_NAME); break;
+		case 'q': addOp(OP_PRIO_ABBR); break;
+		case 'P': addOp(OP_PID); break;
+		case 'T': addOp(OP_THREAD); break;
+		case 'I': addOp(OP_TID); break;
+		case 'J': addOp(OP_OSTID); break;
+		case 'N': addLiteral(Environment::nodeName()); break;
+		case 'U': addOp(OP_FILE_PATH); break;
+		case 'O': addOp(OP_FILE_NAME); break;
+		case 'u': addOp(OP_LINE); break;
+		case 'i': addOp(OP_MILLISECOND); break;
+		case 'c': addOp(OP_CENTISECOND); break;
+		case 'F': addOp(OP_MICROSECOND); break;
+		case 'v': addOp(OP_SOURCE_WIDTH, pa.length); break;
+		case 'x': addOp(OP_PARAMETER, 0, pa.property); break;
+		case 'L': localTime = true; break;
+		}
+	}
+}
+
+
+void PatternFormatter::addLiteral(const std::string& text)
+{
+	if (text.empty()) return;
+
+	if (!_ops.empty() && _ops.back().code == OP_LITERAL)
+		_ops.back().text.append(text);
+	else
+		addOp(OP_LITERAL, 0, text);
+}
+
+
+void PatternFormatter::addOp(OpCode code, int length, const std::string& text)
+{
+	PatternOp op;
+	op.code = code;
+	op.length = length;
+	op.index = 0;
+	op.text = text;
+	_ops.push_back(op);
 }
 
 
@@ -209,6 +339,7 @@ void PatternFormatter::setProperty(const std::string& name, const std::string& v
 	else if (name == PROP_TIMES)
 	{
 		_localTime = (value == "local");
+		compilePattern();
 	}
 	else if (name == PROP_PRIORITY_NAMES)
 	{
@@ -0,0 +1,754 @@
+//
+// RingBufferChannel.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  RingBufferChannel
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/RingBufferChannel.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/LoggingRegistry.h"
+#include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/String.h"
+#include <algorithm>
+#include <memory>
+
+
+namespace Poco {
+
+
+namespace
+{
+	template <typename T>
+	T readValue(const char*& p)
+	{
+		T value;
+		std::memcpy(&value, p, sizeof(T));
+		p += sizeof(T);
+		return value;
+	}
+
+	std::string_view readString(const char*& p)
+	{
+		Poco::UInt32 n = readValue<Poco::UInt32>(p);
+		std::string_view str(p, n);
+		p += n;
+		return str;
+	}
+
+	char* writeInt(char* p, Poco::Int64 value)
+	{
+		std::memcpy(p, &value, sizeof(value));
+		return p + sizeof(value);
+	}
+}
+
+
+class RingBufferChannel::Buffer: public RefCountedObject
+	/// A single-producer, single-consumer ring buffer holding
+	/// variable-size records. The write position is only
+	/// advanced by the owning thread, the read position only
+	/// by the background thread.
+{
+public:
+	enum
+	{
+		CACHE_LINE_SIZE = 64
+	};
+
+	Buffer(std::size_t size):
+		data(new char[size]),
+		capacity(size),
+		mask(size - 1),
+		writePos(0),
+		cachedReadPos(0),
+		readPos(0),
+		dropped(0),
+		reported(0),
+		tid(0),
+		ostid(0),
+		abandoned(false),
+		detached(false)
+	{
+	}
+
+	const RecordHeader* peek()
+		/// Returns the next record, or null if the buffer is empty.
+		/// Skips padding records.
+	{
+		Poco::UInt64 pos = readPos.load(std::memory_order_relaxed);
+		const Poco::UInt64 end = writePos.load(std::memory_order_acquire);
+		while (pos != end)
+		{
+			const RecordHeader* pHeader = reinterpret_cast<const RecordHeader*>(data.get() + (pos & mask));
+			if (pHeader->type != RECORD_PADDING) return pHeader;
+			pos += pHeader->size;
+			readPos.store(pos, std::memory_order_release);
+		}
+		return nullptr;
+	}
+
+	void consume(std::size_t size)
+	{
+		readPos.store(readPos.load(std::memory_order_relaxed) + size, std::memory_order_release);
+	}
+
+	bool empty() const
+	{
+		return readPos.load(std::memory_order_acquire) == writePos.load(std::memory_order_acquire);
+	}
+
+	std::unique_ptr<char[]> data;
+	const std::size_t capacity;
+	const std::size_t mask;
+	alignas(CACHE_LINE_SIZE) std::atomic<Poco::UInt64> writePos;
+	Poco::UInt64 cachedReadPos;
+	alignas(CACHE_LINE_SIZE) std::atomic<Poco::UInt64> readPos;
+	std::atomic<Poco::UInt64> dropped;
+	Poco::UInt64 reported;
+	long tid;
+	long ostid;
+	std::string thread;
+	std::atomic<bool> abandoned;
+	std::atomic<bool> detached;
+};
+
+
+struct RingBufferChannel::ThreadBuffers
+	/// The ring buffers of a thread, one for every
+	/// RingBufferChannel the thread has logged to.
+{
+	struct Entry
+	{
+		Poco::UInt64 channelId;
+		AutoPtr<Buffer> pBuffer;
+	};
+
+	~ThreadBuffers()
+	{
+		for (auto& entry: entries)
+		{
+			entry.pBuffer->abandoned.store(true, std::memory_order_release);
+		}
+	}
+
+	std::vector<Entry> entries;
+	Buffer* pReserved = nullptr;
+	Poco::UInt64 commitPos = 0;
+};
+
+
+std::atomic<Poco::UInt64> RingBufferChannel::_nextId(1);
+
+
+RingBufferChannel::RingBufferChannel(Channel::Ptr pChannel, Thread::Priority prio):
+	_id(_nextId++),
+	_pChannel(pChannel),
+	_thread("RingBufferChannel"),
+	_buffersChanged(false),
+	_bufferSize(DEFAULT_BUFFER_SIZE),
+	_overflowPolicy(OVERFLOW_BLOCK),
+	_running(false),
+	_closed(false),
+	_stop(false),
+	_waiting(false),
+	_dropped(0),
+	_wakeUp(Event::EVENT_AUTORESET)
+{
+	_thread.setPriority(prio);
+}
+
+
+RingBufferChannel::~RingBufferChannel()
+{
+	try
+	{
+		close();
+
+		FastMutex::ScopedLock lock(_buffersMutex);
+		for (auto& pBuffer: _buffers)
+		{
+			pBuffer->detached.store(true, std::memory_order_release);
+		}
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void RingBufferChannel::setChannel(Channel::Ptr pChannel)
+{
+	FastMutex::ScopedLock lock(_channelMutex);
+
+	_pChannel = pChannel;
+}
+
+
+Channel::Ptr RingBufferChannel::getChannel() const
+{
+	return _pChannel;
+}
+
+
+void RingBufferChannel::setBufferSize(std::size_t size)
+{
+	std::size_t bufferSize = MIN_BUFFER_SIZE;
+	while (bufferSize < size) bufferSize <<= 1;
+	_bufferSize.store(bufferSize, std::memory_order_relaxed);
+}
+
+
+void RingBufferChannel::setOverflowPolicy(OverflowPolicy policy)
+{
+	_overflowPolicy.store(policy, std::memory_order_relaxed);
+}
+
+
+void RingBufferChannel::open()
+{
+	FastMutex::ScopedLock lock(_threadMutex);
+
+	if (!_closed && !_thread.isRunning())
+	{
+		_thread.start(*this);
+	}
+	_running.store(true, std::memory_order_release);
+}
+
+
+void RingBufferChannel::close()
+{
+	if (!_closed.exchange(true))
+	{
+		FastMutex::ScopedLock lock(_threadMutex);
+
+		if (_thread.isRunning())
+		{
+			_stop.store(true, std::memory_order_release);
+			_wakeUp.set();
+			_thread.join();
+		}
+	}
+}
+
+
+void RingBufferChannel::log(const Message& msg)
+{
+	const Message::StringMap& params = msg.getAll();
+	std::size_t size = HEADER_SIZE
+		+ stringSize(msg.getSource())
+		+ stringSize(msg.getText())
+		+ stringSize(msg.getThread())
+		+ 3*sizeof(Poco::Int64)
+		+ sizeof(Poco::UInt32);
+	for (const auto& p: params)
+	{
+		size += stringSize(p.first) + stringSize(p.second);
+	}
+
+	char* pRecord = reserve(size);
+	if (pRecord)
+	{
+		char* p = writeHeader(pRecord, size, RECORD_MESSAGE, msg.getPriority(), 0, msg.getSourceFile(), msg.getSourceLine());
+		reinterpret_cast<RecordHeader*>(pRecord)->time = msg.getTime().epochMicroseconds();
+		p = writeString(p, msg.getSource());
+		p = writeString(p, msg.getText());
+		p = writeString(p, msg.getThread());
+		p = writeInt(p, msg.getTid());
+		p = writeInt(p, msg.getOsTid());
+		p = writeInt(p, msg.getPid());
+		Poco::UInt32 n = static_cast<Poco::UInt32>(params.size());
+		std::memcpy(p, &n, sizeof(n));
+		p += sizeof(n);
+		for (const auto& param: params)
+		{
+			p = writeString(p, param.first);
+			p = writeString(p, param.second);
+		}
+		commit();
+	}
+}
+
+
+void RingBufferChannel::log(const std::string& source, const std::string& text, Message::Priority prio, const char* file, LineNumber line)
+{
+	std::size_t size = HEADER_SIZE + stringSize(source) + stringSize(text);
+	char* pRecord = reserve(size);
+	if (pRecord)
+	{
+		char* p = writeHeader(pRecord, size, RECORD_TEXT, prio, 0, file, line);
+		p = writeString(p, source);
+		writeString(p, text);
+		commit();
+	}
+}
+
+
+char* RingBufferChannel::beginFormat(const std::string& source, Message::Priority prio, const std::string& fmt, int argc, std::size_t argsSize)
+{
+	std::size_t size = HEADER_SIZE + stringSize(source) + stringSize(fmt) + argsSize;
+	char* pRecord = reserve(size);
+	if (pRecord)
+	{
+		char* p = writeHeader(pRecord, size, RECORD_FORMAT, prio, argc, 0, 0);
+		p = writeString(p, source);
+		return writeString(p, fmt);
+	}
+	return nullptr;
+}
+
+
+void RingBufferChannel::setProperty(const std::string& name, const std::string& value)
+{
+	if (name == "channel")
+	{
+		setChannel(LoggingRegistry::defaultRegistry().channelForName(value));
+	}
+	else if (name == "priority")
+	{
+		setPriority(value);
+	}
+	else if (name == "bufferSize")
+	{
+		setBufferSize(Poco::NumberParser::parseUnsigned(value));
+	}
+	else if (name == "overflow")
+	{
+		if (Poco::icompare(value, "block") == 0)
+			setOverflowPolicy(OVERFLOW_BLOCK);
+		else if (Poco::icompare(value, "drop") == 0)
+			setOverflowPolicy(OVERFLOW_DROP);
+		else if (Poco::icompare(value, "count") == 0)
+			setOverflowPolicy(OVERFLOW_COUNT);
+		else
+			throw InvalidArgumentException("overflow policy", value);
+	}
+	else
+	{
+		Channel::setProperty(name, value);
+	}
+}
+
+
+std::string RingBufferChannel::getProperty(const std::string& name) const
+{
+	if (name == "bufferSize")
+	{
+		return NumberFormatter::format(getBufferSize());
+	}
+	else if (name == "overflow")
+	{
+		switch (getOverflowPolicy())
+		{
+		case OVERFLOW_DROP:
+			return "drop";
+		case OVERFLOW_COUNT:
+			return "count";
+		default:
+			return "block";
+		}
+	}
+	else
+	{
+		return Channel::getProperty(name);
+	}
+}
+
+
+void RingBufferChannel::run()
+{
+	for (;;)
+	{
+		const bool stop = _stop.load(std::memory_order_acquire);
+		if (!drain())
+		{
+			if (stop) break;
+
+			removeAbandonedBuffers();
+
+			_waiting.store(true, std::memory_order_relaxed);
+			// Pairs with the fence in commit(): either the producer
+			// sees the waiting flag, or we see the new record.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!pending() && !_stop.load(std::memory_order_acquire))
+			{
+				_wakeUp.tryWait(IDLE_WAIT);
+			}
+			_waiting.store(false, std::memory_order_relaxed);
+		}
+	}
+}
+
+
+void RingBufferChannel::setPriority(const std::string& value)
+{
+	Thread::Priority prio = Thread::PRIO_NORMAL;
+
+	if (value == "lowest")
+		prio = Thread::PRIO_LOWEST;
+	else if (value == "low")
+		prio = Thread::PRIO_LOW;
+	else if (value == "normal")
+		prio = Thread::PRIO_NORMAL;
+	else if (value == "high")
+		prio = Thread::PRIO_HIGH;
+	else if (value == "highest")
+		prio = Thread::PRIO_HIGHEST;
+	else
+		throw InvalidArgumentException("thread priority", value);
+
+	_thread.setPriority(prio);
+}
+
+
+char* RingBufferChannel::writeHeader(char* pRecord, std::size_t size, RecordType type, Message::Priority prio, int argc, const char* file, LineNumber line)
+{
+	RecordHeader* pHeader = reinterpret_cast<RecordHeader*>(pRecord);
+	pHeader->size = static_cast<Poco::UInt32>(size);
+	pHeader->type = static_cast<Poco::UInt8>(type);
+	pHeader->prio = static_cast<Poco::UInt8>(prio);
+	pHeader->argc = static_cast<Poco::UInt16>(argc);
+	pHeader->time = Timestamp().epochMicroseconds();
+	pHeader->file = file;
+	pHeader->line = line;
+	return pRecord + HEADER_SIZE;
+}
+
+
+char* RingBufferChannel::reserve(std::size_t& size)
+{
+	if (_closed.load(std::memory_order_relaxed)) return nullptr;
+	if (!_running.load(std::memory_order_acquire)) open();
+
+	ThreadBuffers& buffers = threadBuffers();
+	Buffer* pBuffer = threadBuffer(buffers);
+
+	size = (size + sizeof(Poco::Int64) - 1) & ~(sizeof(Poco::Int64) - 1);
+	const Poco::UInt64 pos = pBuffer->writePos.load(std::memory_order_relaxed);
+	const std::size_t offset = static_cast<std::size_t>(pos & pBuffer->mask);
+	const std::size_t contiguous = pBuffer->capacity - offset;
+	const std::size_t needed = size <= contiguous ? size : contiguous + size;
+
+	bool fits = size <= pBuffer->capacity/2;
+	int spins = 0;
+	while (fits && pos + needed - pBuffer->cachedReadPos > pBuffer->capacity)
+	{
+		pBuffer->cachedReadPos = pBuffer->readPos.load(std::memory_order_acquire);
+		if (pos + needed - pBuffer->cachedReadPos <= pBuffer->capacity) break;
+
+		// Never block the background thread (e.g., if the target
+		// channel logs to this channel), or after close().
+		if (getOverflowPolicy() != OVERFLOW_BLOCK || _closed.load(std::memory_order_relaxed) || Thread::current() == &_thread)
+		{
+			fits = false;
+		}
+		else
+		{
+			_wakeUp.set();
+			if (++spins < 64)
+				Thread::yield();
+			else
+				Thread::sleep(1);
+		}
+	}
+	if (!fits)
+	{
+		pBuffer->dropped.fetch_add(1, std::memory_order_relaxed);
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	char* pRecord = pBuffer->data.get() + offset;
+	if (size > contiguous)
+	{
+		RecordHeader* pPadding = reinterpret_cast<RecordHeader*>(pRecord);
+		pPadding->size = static_cast<Poco::UInt32>(contiguous);
+		pPadding->type = RECORD_PADDING;
+		pRecord = pBuffer->data.get();
+	}
+	buffers.pReserved = pBuffer;
+	buffers.commitPos = pos + needed;
+	return pRecord;
+}
+
+
+void RingBufferChannel::commit()
+{
+	ThreadBuffers& buffers = threadBuffers();
+	buffers.pReserved->writePos.store(buffers.commitPos, std::memory_order_release);
+	buffers.pReserved = nullptr;
+	wakeUp();
+}
+
+
+RingBufferChannel::ThreadBuffers& RingBufferChannel::threadBuffers()
+{
+	static thread_local ThreadBuffers buffers;
+	return buffers;
+}
+
+
+RingBufferChannel::Buffer* RingBufferChannel::threadBuffer(ThreadBuffers& buffers)
+{
+	for (auto& entry: buffers.entries)
+	{
+		if (entry.channelId == _id) return entry.pBuffer.get();
+	}
+
+	// Release the buffers of channels that no longer exist.
+	buffers.entries.erase(
+		std::remove_if(buffers.entries.begin(), buffers.entries.end(),
+			[](const ThreadBuffers::Entry& entry)
+			{
+				return entry.pBuffer->detached.load(std::memory_order_acquire);
+			}),
+		buffers.entries.end());
+
+	AutoPtr<Buffer> pBuffer = createBuffer();
+	buffers.entries.push_back({_id, pBuffer});
+	return pBuffer.get();
+}
+
+
+AutoPtr<RingBufferChannel::Buffer> RingBufferChannel::createBuffer()
+{
+	AutoPtr<Buffer> pBuffer = new Buffer(getBufferSize());
+	Thread* pThread = Thread::current();
+	if (pThread)
+	{
+		pBuffer->tid = pThread->id();
+		pBuffer->thread = pThread->name();
+	}
+	pBuffer->ostid = static_cast<long>(Thread::currentOsTid());
+
+	FastMutex::ScopedLock lock(_buffersMutex);
+	_buffers.push_back(pBuffer);
+	_buffersChanged.store(true, std::memory_order_release);
+	return pBuffer;
+}
+
+
+void RingBufferChannel::wakeUp()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waiting.load(std::memory_order_relaxed))
+	{
+		_wakeUp.set();
+	}
+}
+
+
+bool RingBufferChannel::drain()
+{
+	if (_buffersChanged.exchange(false, std::memory_order_acquire))
+	{
+		FastMutex::ScopedLock lock(_buffersMutex);
+		_consumerBuffers = _buffers;
+	}
+
+	bool processed = false;
+	for (;;)
+	{
+		// Merge the buffers by picking the oldest record.
+		Buffer* pNext = nullptr;
+		const RecordHeader* pNextHeader = nullptr;
+		for (auto& pBuffer: _consumerBuffers)
+		{
+			const RecordHeader* pHeader = pBuffer->peek();
+			if (pHeader && (!pNextHeader || pHeader->time < pNextHeader->time))
+			{
+				pNext = pBuffer;
+				pNextHeader = pHeader;
+			}
+		}
+		if (!pNext) break;
+
+		const std::size_t size = pNextHeader->size;
+		process(*pNext, *pNextHeader);
+		pNext->consume(size);
+		processed = true;
+	}
+	return processed;
+}
+
+
+bool RingBufferChannel::pending()
+{
+	if (_buffersChanged.load(std::memory_order_acquire)) return true;
+
+	for (const auto& pBuffer: _consumerBuffers)
+	{
+		if (!pBuffer->empty()) return true;
+	}
+	return false;
+}
+
+
+void RingBufferChannel::process(Buffer& buffer, const RecordHeader& header)
+{
+	const char* p = reinterpret_cast<const char*>(&header) + HEADER_SIZE;
+	const Message::Priority prio = static_cast<Message::Priority>(header.prio);
+	const std::string_view source = readString(p);
+
+	Message msg(std::string(source), std::string(), prio, header.file, static_cast<LineNumber>(header.line));
+	msg.setTime(Timestamp(header.time));
+	switch (header.type)
+	{
+	case RECORD_TEXT:
+		msg.setText(std::string(readString(p)));
+		break;
+
+	case RECORD_FORMAT:
+		{
+			const std::string fmt(readString(p));
+			_args.clear();
+			for (int i = 0; i < header.argc; i++)
+			{
+				switch (static_cast<ArgType>(*p++))
+				{
+				case ARG_BOOL:        _args.emplace_back(readValue<bool>(p)); break;
+				case ARG_CHAR:        _args.emplace_back(readValue<char>(p)); break;
+				case ARG_SCHAR:       _args.emplace_back(readValue<signed char>(p)); break;
+				case ARG_UCHAR:       _args.emplace_back(readValue<unsigned char>(p)); break;
+				case ARG_SHORT:       _args.emplace_back(readValue<short>(p)); break;
+				case ARG_USHORT:      _args.emplace_back(readValue<unsigned short>(p)); break;
+				case ARG_INT:         _args.emplace_back(readValue<int>(p)); break;
+				case ARG_UINT:        _args.emplace_back(readValue<unsigned>(p)); break;
+				case ARG_LONG:        _args.emplace_back(readValue<long>(p)); break;
+				case ARG_ULONG:       _args.emplace_back(readValue<unsigned long>(p)); break;
+				case ARG_LLONG:       _args.emplace_back(readValue<long long>(p)); break;
+				case ARG_ULLONG:      _args.emplace_back(readValue<unsigned long long>(p)); break;
+				case ARG_FLOAT:       _args.emplace_back(readValue<float>(p)); break;
+				case ARG_DOUBLE:      _args.emplace_back(readValue<double>(p)); break;
+				case ARG_LDOUBLE:     _args.emplace_back(readValue<long double>(p)); break;
+				case ARG_STRING:      _args.emplace_back(std::string(readString(p))); break;
+				case ARG_STRING_VIEW: _args.emplace_back(readString(p)); break;
+				default:
+					poco_bugcheck_msg("invalid argument type in log record");
+				}
+			}
+			_text.clear();
+			Poco::format(_text, fmt, _args);
+			msg.setText(_text);
+		}
+		break;
+
+	case RECORD_MESSAGE:
+		{
+			msg.setText(std::string(readString(p)));
+			msg.setThread(std::string(readString(p)));
+			msg.setTid(static_cast<long>(readValue<Poco::Int64>(p)));
+			msg.setOsTid(static_cast<long>(readValue<Poco::Int64>(p)));
+			msg.setPid(static_cast<long>(readValue<Poco::Int64>(p)));
+			Poco::UInt32 n = readValue<Poco::UInt32>(p);
+			for (Poco::UInt32 i = 0; i < n; i++)
+			{
+				std::string name(readString(p));
+				msg.set(name, std::string(readString(p)));
+			}
+		}
+		break;
+
+	default:
+		poco_bugcheck_msg("invalid log record type");
+	}
+
+	if (header.type != RECORD_MESSAGE)
+	{
+		msg.setTid(buffer.tid);
+		msg.setOsTid(buffer.ostid);
+		msg.setThread(buffer.thread);
+	}
+
+	FastMutex::ScopedLock lock(_channelMutex);
+
+	if (_pChannel)
+	{
+		// An exception thrown by the target channel must neither
+		// terminate the background thread nor prevent the remaining
+		// records from being processed.
+		try
+		{
+			_pChannel->log(msg);
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+
+		if (getOverflowPolicy() == OVERFLOW_COUNT)
+		{
+			const Poco::UInt64 dropped = buffer.dropped.load(std::memory_order_relaxed);
+			if (dropped != buffer.reported)
+			{
+				const std::size_t count = static_cast<std::size_t>(dropped - buffer.reported);
+				buffer.reported = dropped;
+				try
+				{
+					_pChannel->log(Message(msg, Poco::format("Dropped %z messages.", count)));
+				}
+				catch (Exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (std::exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (...)
+				{
+					ErrorHandler::handle();
+				}
+			}
+		}
+	}
+}
+
+
+void RingBufferChannel::removeAbandonedBuffers()
+{
+	bool removed = false;
+	for (const auto& pBuffer: _consumerBuffers)
+	{
+		if (pBuffer->abandoned.load(std::memory_order_acquire) && pBuffer->empty())
+		{
+			removed = true;
+			break;
+		}
+	}
+	if (removed)
+	{
+		FastMutex::ScopedLock lock(_buffersMutex);
+		_buffers.erase(
+			std::remove_if(_buffers.begin(), _buffers.end(),
+				[](const AutoPtr<Buffer>& pBuffer)
+				{
+					return pBuffer->abandoned.load(std::memory_order_acquire) && pBuffer->empty();
+				}),
+			_buffers.end());
+		_consumerBuffers = _buffers;
+	}
+}
+
+
+} // namespace Poco
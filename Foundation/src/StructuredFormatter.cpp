@@ -0,0 +1,106 @@
+//
+// StructuredFormatter.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  StructuredFormatter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/StructuredFormatter.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timezone.h"
+#include "Poco/String.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	const char* PRIORITY_NAMES[] =
+	{
+		"Fatal",
+		"Critical",
+		"Error",
+		"Warning",
+		"Notice",
+		"Information",
+		"Debug",
+		"Trace"
+	};
+}
+
+
+const std::string StructuredFormatter::PROP_TIMES           = "times";
+const std::string StructuredFormatter::PROP_SOURCE_LOCATION = "sourceLocation";
+
+
+StructuredFormatter::StructuredFormatter():
+	_localTime(false),
+	_sourceLocation(true)
+{
+}
+
+
+StructuredFormatter::~StructuredFormatter()
+{
+}
+
+
+void StructuredFormatter::appendTimestamp(const Message& msg, std::string& text) const
+{
+	if (_localTime)
+	{
+		int tzd = Timezone::tzd();
+		Timestamp timestamp = msg.getTime() + static_cast<Timestamp::TimeDiff>(tzd)*Timestamp::resolution();
+		DateTimeFormatter::append(text, timestamp, DateTimeFormat::ISO8601_FRAC_FORMAT, tzd);
+	}
+	else
+	{
+		DateTimeFormatter::append(text, msg.getTime(), DateTimeFormat::ISO8601_FRAC_FORMAT);
+	}
+}
+
+
+void StructuredFormatter::appendPriority(const Message& msg, std::string& text)
+{
+	int prio = msg.getPriority();
+	if (prio >= Message::PRIO_FATAL && prio <= Message::PRIO_TRACE)
+		text.append(PRIORITY_NAMES[prio - Message::PRIO_FATAL]);
+	else
+		NumberFormatter::append(text, prio);
+}
+
+
+void StructuredFormatter::setProperty(const std::string& name, const std::string& value)
+{
+	if (name == PROP_TIMES)
+		_localTime = (icompare(value, "local") == 0);
+	else if (name == PROP_SOURCE_LOCATION)
+		_sourceLocation = (icompare(value, "true") == 0);
+	else
+		Formatter::setProperty(name, value);
+}
+
+
+std::string StructuredFormatter::getProperty(const std::string& name) const
+{
+	if (name == PROP_TIMES)
+		return _localTime ? "local" : "UTC";
+	else if (name == PROP_SOURCE_LOCATION)
+		return _sourceLocation ? "true" : "false";
+	else
+		return Formatter::getProperty(name);
+}
+
+
+} // namespace Poco
@@ -18,6 +18,8 @@
 #include "Poco/Event.h"
 #include "Poco/ThreadLocal.h"
 #include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <algorithm>
 #include <sstream>
 #include <ctime>
 
@@ -263,8 +265,25 @@ ThreadPool::ThreadPool(const std::string& name,
 }
 
 
+ThreadPool::ThreadPool(WorkStealingExecutor::Ptr pExecutor):
+	_serial(0),
+	_age(0),
+	_pExecutor(pExecutor)
+{
+	poco_check_ptr (_pExecutor);
+
+	_name = _pExecutor->name();
+	_minCapacity = _maxCapacity = _pExecutor->capacity();
+	_idleTime = 60;
+	_stackSize = _pExecutor->getStackSize();
+}
+
+
 ThreadPool::~ThreadPool()
 {
+	// a WorkStealingExecutor stops its workers when it is destroyed
+	if (_pExecutor) return;
+
 	try
 	{
 		stopAll();
@@ -278,6 +297,8 @@ ThreadPool::~ThreadPool()
 
 void ThreadPool::addCapacity(int n)
 {
+	if (_pExecutor) throw InvalidAccessException("Cannot change the capacity of a thread pool using a WorkStealingExecutor");
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	poco_assert (_maxCapacity + n >= _minCapacity);
@@ -288,6 +309,8 @@ void ThreadPool::addCapacity(int n)
 
 int ThreadPool::capacity() const
 {
+	if (_pExecutor) return _pExecutor->capacity();
+
 	FastMutex::ScopedLock lock(_mutex);
 	return _maxCapacity;
 }
@@ -295,6 +318,8 @@ int ThreadPool::capacity() const
 
 int ThreadPool::available() const
 {
+	if (_pExecutor) return std::max(_pExecutor->capacity() - _pExecutor->used(), 0);
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	int count = 0;
@@ -308,6 +333,8 @@ int ThreadPool::available() const
 
 int ThreadPool::used() const
 {
+	if (_pExecutor) return _pExecutor->used();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	int count = 0;
@@ -321,6 +348,8 @@ int ThreadPool::used() const
 
 int ThreadPool::allocated() const
 {
+	if (_pExecutor) return _pExecutor->capacity();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	return int(_threads.size());
@@ -329,30 +358,60 @@ int ThreadPool::allocated() const
 
 void ThreadPool::start(Runnable& target)
 {
+	if (_pExecutor)
+	{
+		_pExecutor->start(target);
+		return;
+	}
+
 	getThread()->start(Thread::PRIO_NORMAL, target);
 }
 
 
 void ThreadPool::start(Runnable& target, const std::string& name)
 {
+	if (_pExecutor)
+	{
+		_pExecutor->start(target, name);
+		return;
+	}
+
 	getThread()->start(Thread::PRIO_NORMAL, target, name);
 }
 
 
 void ThreadPool::startWithPriority(Thread::Priority priority, Runnable& target)
 {
+	if (_pExecutor)
+	{
+		_pExecutor->startWithPriority(priority, target);
+		return;
+	}
+
 	getThread()->start(priority, target);
 }
 
 
 void ThreadPool::startWithPriority(Thread::Priority priority, Runnable& target, const std::string& name)
 {
+	if (_pExecutor)
+	{
+		_pExecutor->startWithPriority(priority, target, name);
+		return;
+	}
+
 	getThread()->start(priority, target, name);
 }
 
 
 void ThreadPool::stopAll()
 {
+	if (_pExecutor)
+	{
+		_pExecutor->stopAll();
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	for (auto pThread: _threads)
@@ -365,6 +424,12 @@ void ThreadPool::stopAll()
 
 void ThreadPool::joinAll()
 {
+	if (_pExecutor)
+	{
+		_pExecutor->joinAll();
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	for (auto pThread: _threads)
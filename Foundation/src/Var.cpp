@@ -25,18 +25,21 @@ namespace Poco {
 namespace Dynamic {
 
 
-Var::Var()
+Var::Var():
+	_type(TYPE_OTHER)
 {
 }
 
 
-Var::Var(const char* pVal)
+Var::Var(const char* pVal):
+	_type(TYPE_OTHER)
 {
 	construct(std::string(pVal));
 }
 
 
-Var::Var(const Var& other)
+Var::Var(const Var& other):
+	_type(TYPE_OTHER)
 {
 	if ((this != &other) && !other.isEmpty())
 			construct(other);
@@ -306,12 +309,14 @@ bool Var::operator && (const Var& other) const
 void Var::empty()
 {
 	_placeholder.erase();
+	_type = TYPE_OTHER;
 }
 
 
 void Var::clear()
 {
 	_placeholder.erase();
+	_type = TYPE_OTHER;
 }
 
 
@@ -370,19 +375,7 @@ Var& Var::getAt(const std::string& name)
 
 std::string Var::toString() const
 {
-	VarHolder* pHolder = content();
-
-	if (!pHolder)
-		throw InvalidAccessException("Can not convert empty value.");
-
-	if (typeid(std::string) == pHolder->type())
-		return extract<std::string>();
-	else
-	{
-		std::string result;
-		pHolder->convert(result);
-		return result;
-	}
+	return convert<std::string>();
 }
 
 
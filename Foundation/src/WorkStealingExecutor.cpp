@@ -0,0 +1,520 @@
+//
+// WorkStealingExecutor.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingExecutor
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/WorkStealingExecutor.h"
+#include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/ThreadLocal.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <sstream>
+
+
+namespace Poco {
+
+
+namespace
+{
+	// Identifies the executor and worker (if any) the current thread belongs to.
+	thread_local const WorkStealingExecutor* pCurrentExecutor = nullptr;
+	thread_local int currentWorker = -1;
+}
+
+
+class WorkStealingExecutor::Worker: public Runnable
+{
+public:
+	Worker(WorkStealingExecutor& executor, int index, const std::string& name, int queueCapacity, int stackSize):
+		_executor(executor),
+		_index(index),
+		_name(name),
+		_tasks(queueCapacity),
+		_head(0),
+		_size(0),
+		_thread(name),
+		_executed(0),
+		_localSubmits(0),
+		_steals(0),
+		_parks(0),
+		_unparks(0)
+	{
+		poco_assert_dbg (stackSize >= 0);
+		_thread.setStackSize(stackSize);
+	}
+
+	~Worker() override = default;
+
+	bool push(Thread::Priority priority, Runnable& target, const std::string& name)
+		/// Appends a task to the back of the queue.
+	{
+		SpinlockMutex::ScopedLock lock(_mutex);
+
+		std::size_t size = _size.load(std::memory_order_relaxed);
+		if (size == _tasks.size()) return false;
+		Task& task = _tasks[(_head + size) % _tasks.size()];
+		task.pTarget = &target;
+		task.priority = priority;
+		task.name = name;
+		_size.store(size + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool pop(Task& task)
+		/// Removes the task at the back of the queue.
+	{
+		SpinlockMutex::ScopedLock lock(_mutex);
+
+		std::size_t size = _size.load(std::memory_order_relaxed);
+		if (size == 0) return false;
+		take(_tasks[(_head + size - 1) % _tasks.size()], task);
+		_size.store(size - 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool stealInto(Task& task)
+		/// Removes the task at the front of the queue.
+	{
+		if (_size.load(std::memory_order_relaxed) == 0) return false;
+
+		SpinlockMutex::ScopedLock lock(_mutex);
+
+		std::size_t size = _size.load(std::memory_order_relaxed);
+		if (size == 0) return false;
+		take(_tasks[_head], task);
+		_head = (_head + 1) % _tasks.size();
+		_size.store(size - 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	int clear()
+		/// Discards all queued tasks and returns their number.
+	{
+		SpinlockMutex::ScopedLock lock(_mutex);
+
+		int n = static_cast<int>(_size.load(std::memory_order_relaxed));
+		for (auto& task: _tasks) task = Task();
+		_head = 0;
+		_size.store(0, std::memory_order_relaxed);
+		return n;
+	}
+
+	int size() const
+	{
+		return static_cast<int>(_size.load(std::memory_order_relaxed));
+	}
+
+	void start()
+	{
+		_thread.start(*this);
+	}
+
+	void wakeUp()
+	{
+		_wakeUp.set();
+	}
+
+	void wait()
+	{
+		_wakeUp.wait();
+	}
+
+	void join()
+	{
+		_thread.join();
+	}
+
+	void run() override
+	{
+		pCurrentExecutor = &_executor;
+		currentWorker = _index;
+
+		Task task;
+		while (_executor.next(*this, task))
+		{
+			execute(task);
+			task = Task();
+			_executor.completed();
+		}
+	}
+
+	int index() const
+	{
+		return _index;
+	}
+
+	std::atomic<Poco::UInt64>& executed()
+	{
+		return _executed;
+	}
+
+	std::atomic<Poco::UInt64>& localSubmits()
+	{
+		return _localSubmits;
+	}
+
+	std::atomic<Poco::UInt64>& steals()
+	{
+		return _steals;
+	}
+
+	std::atomic<Poco::UInt64>& parks()
+	{
+		return _parks;
+	}
+
+	std::atomic<Poco::UInt64>& unparks()
+	{
+		return _unparks;
+	}
+
+private:
+	static void take(Task& from, Task& to)
+	{
+		to.pTarget = from.pTarget;
+		to.priority = from.priority;
+		to.name.swap(from.name);
+		from.pTarget = nullptr;
+	}
+
+	void execute(Task& task)
+	{
+		if (task.priority != Thread::PRIO_NORMAL)
+			_thread.setPriority(task.priority);
+		if (!task.name.empty())
+			_thread.setName(task.name);
+		try
+		{
+			task.pTarget->run();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+		if (!task.name.empty())
+			_thread.setName(_name);
+		if (task.priority != Thread::PRIO_NORMAL)
+			_thread.setPriority(Thread::PRIO_NORMAL);
+		ThreadLocalStorage::clear();
+		_executed.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	WorkStealingExecutor&      _executor;
+	int                        _index;
+	std::string                _name;
+	std::vector<Task>          _tasks;
+	std::size_t                _head;
+	std::atomic<std::size_t>   _size;
+	mutable SpinlockMutex      _mutex;
+	Thread                     _thread;
+	Event                      _wakeUp;
+	std::atomic<Poco::UInt64>  _executed;
+	std::atomic<Poco::UInt64>  _localSubmits;
+	std::atomic<Poco::UInt64>  _steals;
+	std::atomic<Poco::UInt64>  _parks;
+	std::atomic<Poco::UInt64>  _unparks;
+};
+
+
+WorkStealingExecutor::WorkStealingExecutor(int workers, int queueCapacity, int stackSize):
+	_capacity(workers),
+	_queueCapacity(queueCapacity),
+	_stackSize(stackSize),
+	_nextWorker(0),
+	_stopped(false),
+	_pending(0),
+	_submitted(0),
+	_rejected(0),
+	_parkedCount(0)
+{
+	init();
+}
+
+
+WorkStealingExecutor::WorkStealingExecutor(const std::string& name, int workers, int queueCapacity, int stackSize):
+	_name(name),
+	_capacity(workers),
+	_queueCapacity(queueCapacity),
+	_stackSize(stackSize),
+	_nextWorker(0),
+	_stopped(false),
+	_pending(0),
+	_submitted(0),
+	_rejected(0),
+	_parkedCount(0)
+{
+	init();
+}
+
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+	try
+	{
+		stopAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+	for (auto pWorker: _workers)
+	{
+		delete pWorker;
+	}
+}
+
+
+void WorkStealingExecutor::init()
+{
+	poco_assert (_capacity >= 1 && _queueCapacity >= 1);
+
+	_workers.reserve(_capacity);
+	_parked.reserve(_capacity);
+	for (int i = 0; i < _capacity; i++)
+	{
+		std::ostringstream name;
+		name << _name << "[#ws-" << i + 1 << "]";
+		_workers.push_back(new Worker(*this, i, name.str(), _queueCapacity, _stackSize));
+	}
+	for (auto pWorker: _workers)
+	{
+		pWorker->start();
+	}
+}
+
+
+void WorkStealingExecutor::start(Runnable& target)
+{
+	submit(Thread::PRIO_NORMAL, target, std::string());
+}
+
+
+void WorkStealingExecutor::start(Runnable& target, const std::string& name)
+{
+	submit(Thread::PRIO_NORMAL, target, name);
+}
+
+
+void WorkStealingExecutor::startWithPriority(Thread::Priority priority, Runnable& target)
+{
+	submit(priority, target, std::string());
+}
+
+
+void WorkStealingExecutor::startWithPriority(Thread::Priority priority, Runnable& target, const std::string& name)
+{
+	submit(priority, target, name);
+}
+
+
+void WorkStealingExecutor::submit(Thread::Priority priority, Runnable& target, const std::string& name)
+{
+	if (_stopped)
+	{
+		_rejected.fetch_add(1, std::memory_order_relaxed);
+		throw NoThreadAvailableException("Executor has been stopped");
+	}
+
+	bool local = pCurrentExecutor == this;
+	int first = local ? currentWorker : static_cast<int>(_nextWorker.fetch_add(1, std::memory_order_relaxed) % _capacity);
+	++_pending;
+	int i = first;
+	do
+	{
+		if (_workers[i]->push(priority, target, name))
+		{
+			if (local && i == first) _workers[i]->localSubmits().fetch_add(1, std::memory_order_relaxed);
+			_submitted.fetch_add(1, std::memory_order_relaxed);
+			unparkOne();
+			return;
+		}
+		if (++i == _capacity) i = 0;
+	}
+	while (i != first);
+
+	completed();
+	_rejected.fetch_add(1, std::memory_order_relaxed);
+	throw NoThreadAvailableException("All executor queues are full");
+}
+
+
+bool WorkStealingExecutor::next(Worker& worker, Task& task)
+{
+	for (;;)
+	{
+		if (_stopped) return false;
+		if (worker.pop(task)) return true;
+		if (steal(worker, task)) return true;
+		park(worker);
+	}
+}
+
+
+bool WorkStealingExecutor::steal(Worker& worker, Task& task)
+{
+	for (int n = 1; n < _capacity; ++n)
+	{
+		Worker* pVictim = _workers[(worker.index() + n) % _capacity];
+		if (pVictim->stealInto(task))
+		{
+			worker.steals().fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+
+bool WorkStealingExecutor::hasWork() const
+{
+	for (auto pWorker: _workers)
+	{
+		if (pWorker->size() > 0) return true;
+	}
+	return false;
+}
+
+
+void WorkStealingExecutor::park(Worker& worker)
+{
+	{
+		FastMutex::ScopedLock lock(_parkMutex);
+		_parked.push_back(&worker);
+		_parkedCount.fetch_add(1);
+	}
+	// Pairs with the fence in unparkOne(): either the submitter
+	// sees this worker as parked, or this worker sees the new task.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_stopped || hasWork())
+	{
+		unregisterParked(worker);
+		return;
+	}
+	worker.parks().fetch_add(1, std::memory_order_relaxed);
+	worker.wait();
+	unregisterParked(worker);
+}
+
+
+bool WorkStealingExecutor::unregisterParked(Worker& worker)
+{
+	FastMutex::ScopedLock lock(_parkMutex);
+
+	auto it = std::find(_parked.begin(), _parked.end(), &worker);
+	if (it != _parked.end())
+	{
+		_parked.erase(it);
+		_parkedCount.fetch_sub(1);
+		return true;
+	}
+	return false;
+}
+
+
+void WorkStealingExecutor::unparkOne()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_parkedCount.load() == 0) return;
+
+	Worker* pWorker = nullptr;
+	{
+		FastMutex::ScopedLock lock(_parkMutex);
+		if (!_parked.empty())
+		{
+			pWorker = _parked.back();
+			_parked.pop_back();
+			_parkedCount.fetch_sub(1);
+		}
+	}
+	if (pWorker)
+	{
+		pWorker->unparks().fetch_add(1, std::memory_order_relaxed);
+		pWorker->wakeUp();
+	}
+}
+
+
+void WorkStealingExecutor::completed()
+{
+	if (--_pending == 0)
+	{
+		FastMutex::ScopedLock lock(_joinMutex);
+		_allDone.broadcast();
+	}
+}
+
+
+void WorkStealingExecutor::joinAll()
+{
+	poco_assert_dbg (pCurrentExecutor != this);
+
+	FastMutex::ScopedLock lock(_joinMutex);
+	while (_pending > 0)
+	{
+		_allDone.wait(_joinMutex);
+	}
+}
+
+
+void WorkStealingExecutor::stopAll()
+{
+	FastMutex::ScopedLock lock(_stopMutex);
+
+	if (_stopped.exchange(true)) return;
+
+	for (auto pWorker: _workers)
+	{
+		pWorker->wakeUp();
+	}
+	for (auto pWorker: _workers)
+	{
+		pWorker->join();
+	}
+	for (auto pWorker: _workers)
+	{
+		int n = pWorker->clear();
+		while (n-- > 0) completed();
+	}
+}
+
+
+WorkStealingExecutor::Statistics WorkStealingExecutor::statistics() const
+{
+	Statistics stats;
+	stats.submitted = _submitted.load(std::memory_order_relaxed);
+	stats.rejected = _rejected.load(std::memory_order_relaxed);
+	for (auto pWorker: _workers)
+	{
+		stats.executed += pWorker->executed().load(std::memory_order_relaxed);
+		stats.localSubmits += pWorker->localSubmits().load(std::memory_order_relaxed);
+		stats.steals += pWorker->steals().load(std::memory_order_relaxed);
+		stats.parks += pWorker->parks().load(std::memory_order_relaxed);
+		stats.unparks += pWorker->unparks().load(std::memory_order_relaxed);
+		int size = pWorker->size();
+		stats.queueDepth += size;
+		stats.maxQueueDepth = std::max(stats.maxQueueDepth, size);
+	}
+	return stats;
+}
+
+
+} // namespace Poco
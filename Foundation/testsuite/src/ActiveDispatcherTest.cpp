@@ -17,6 +17,8 @@
 #include "Poco/Event.h"
 #include "Poco/Exception.h"
 #include "Poco/Environment.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/WorkStealingExecutor.h"
 #include <iostream>
 
 
@@ -28,6 +30,8 @@ using Poco::Thread;
 using Poco::Event;
 using Poco::Exception;
 using Poco::Environment;
+using Poco::ThreadPool;
+using Poco::WorkStealingExecutor;
 
 
 namespace
@@ -43,6 +47,15 @@ namespace
 		{
 		}
 
+		ActiveObject(ThreadPool& pool):
+			ActiveDispatcher(pool),
+			testMethod(this, &ActiveObject::testMethodImpl),
+			testVoid(this, &ActiveObject::testVoidImpl),
+			testVoidInOut(this, &ActiveObject::testVoidInOutImpl),
+			testVoidIn(this, &ActiveObject::testVoidInImpl)
+		{
+		}
+
 		~ActiveObject()
 		{
 		}
@@ -198,6 +211,31 @@ void ActiveDispatcherTest::testVoidIn()
 }
 
 
+void ActiveDispatcherTest::testThreadPool()
+{
+	ThreadPool pool(new WorkStealingExecutor(2));
+	ActiveObject activeObj(pool);
+	ActiveResult<int> result1 = activeObj.testMethod(123);
+	ActiveResult<int> result2 = activeObj.testMethod(456);
+	assertTrue (!result1.available());
+	assertTrue (!result1.tryWait(100));
+	assertTrue (!result2.available());
+	activeObj.cont();
+	assertTrue (result1.tryWait(10000));
+	assertTrue (result1.data() == 123);
+	// methods are serialized, so the second one is still waiting
+	assertTrue (!result2.tryWait(100));
+	activeObj.cont();
+	assertTrue (result2.tryWait(10000));
+	assertTrue (result2.data() == 456);
+
+	ActiveResult<int> result3 = activeObj.testMethod(100);
+	result3.wait();
+	assertTrue (result3.failed());
+	assertTrue (result3.error() == "n == 100");
+}
+
+
 void ActiveDispatcherTest::testActiveDispatcher()
 {
 	std::cout << "(disabled on TSAN runs)";
@@ -228,6 +266,7 @@ CppUnit::Test* ActiveDispatcherTest::suite()
 		CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoid);
 		CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoidIn);
 		CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoidInOut);
+		CppUnit_addTest(pSuite, ActiveDispatcherTest, testThreadPool);
 	}
 	else
 		CppUnit_addTest(pSuite, ActiveDispatcherTest, testActiveDispatcher);
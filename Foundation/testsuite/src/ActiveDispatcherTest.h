@@ -28,6 +28,7 @@ public:
 	void testVoid();
 	void testVoidIn();
 	void testVoidInOut();
+	void testThreadPool();
 	void testActiveDispatcher();
 
 	void setUp();
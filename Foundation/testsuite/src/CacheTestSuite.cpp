@@ -14,6 +14,7 @@
 #include "ExpireLRUCacheTest.h"
 #include "UniqueExpireCacheTest.h"
 #include "UniqueExpireLRUCacheTest.h"
+#include "ConcurrentLRUCacheTest.h"
 
 CppUnit::Test* CacheTestSuite::suite()
 {
@@ -24,6 +25,7 @@ CppUnit::Test* CacheTestSuite::suite()
 	pSuite->addTest(UniqueExpireCacheTest::suite());
 	pSuite->addTest(ExpireLRUCacheTest::suite());
 	pSuite->addTest(UniqueExpireLRUCacheTest::suite());
+	pSuite->addTest(ConcurrentLRUCacheTest::suite());
 
 	return pSuite;
 }
@@ -0,0 +1,375 @@
+//
+// ConcurrentLRUCacheTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ConcurrentLRUCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Exception.h"
+#include "Poco/ConcurrentLRUCache.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+#include <map>
+
+
+using namespace Poco;
+
+
+namespace
+{
+	class CacheRunnable: public Runnable
+	{
+	public:
+		CacheRunnable(ConcurrentLRUCache<int, int>& cache, int base):
+			_cache(cache),
+			_base(base),
+			_errors(0)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < 10000; ++i)
+			{
+				int key = _base + i % 500;
+				SharedPtr<int> pVal = _cache.get(key);
+				if (pVal)
+				{
+					if (*pVal != key*2) ++_errors;
+				}
+				else
+				{
+					_cache.add(key, key*2);
+				}
+			}
+		}
+
+		int errors() const
+		{
+			return _errors;
+		}
+
+	private:
+		ConcurrentLRUCache<int, int>& _cache;
+		int _base;
+		int _errors;
+	};
+}
+
+
+ConcurrentLRUCacheTest::ConcurrentLRUCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ConcurrentLRUCacheTest::~ConcurrentLRUCacheTest()
+{
+}
+
+
+void ConcurrentLRUCacheTest::testClear()
+{
+	ConcurrentLRUCache<int, int> aCache(3);
+	assertTrue (aCache.size() == 0);
+	assertTrue (aCache.getAllKeys().size() == 0);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.getAllKeys().size() == 3);
+	assertTrue (aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (*aCache.get(1) == 2);
+	assertTrue (*aCache.get(3) == 4);
+	assertTrue (*aCache.get(5) == 6);
+	aCache.clear();
+	assertTrue (aCache.size() == 0);
+	assertTrue (!aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (!aCache.has(5));
+}
+
+
+void ConcurrentLRUCacheTest::testCacheSize0()
+{
+	// cache size 0 is illegal
+	try
+	{
+		ConcurrentLRUCache<int, int> aCache(0);
+		failmsg ("cache size of 0 is illegal, test should fail");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void ConcurrentLRUCacheTest::testCacheSize1()
+{
+	ConcurrentLRUCache<int, int> aCache(1);
+	assertTrue (aCache.shards() == 1);
+	aCache.add(1, 2);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+
+	aCache.add(3, 4); // replaces 1
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (*aCache.get(3) == 4);
+
+	aCache.remove(3);
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.get(3).isNull());
+	assertTrue (aCache.size() == 0);
+}
+
+
+void ConcurrentLRUCacheTest::testCacheSizeN()
+{
+	// use a single shard for predictable eviction order
+	ConcurrentLRUCache<int, int> aCache(3, 0, 1);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.size() == 3);
+
+	// 1 has been referenced, so the clock hand
+	// passes it and evicts 3 instead
+	assertTrue (*aCache.get(1) == 2);
+	aCache.add(7, 8);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (aCache.has(7));
+
+	// the referenced flag of 1 has been cleared
+	// in the previous sweep, 5 is next
+	aCache.add(9, 10);
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(5));
+	assertTrue (aCache.has(7));
+	assertTrue (aCache.has(9));
+
+	aCache.add(11, 12);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.statistics().evictions == 3);
+}
+
+
+void ConcurrentLRUCacheTest::testDuplicateAdd()
+{
+	ConcurrentLRUCache<int, int> aCache(3);
+	aCache.add(1, 2);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+	aCache.add(1, 3);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 3);
+	assertTrue (aCache.size() == 1);
+
+	SharedPtr<int> pVal(new int(4));
+	aCache.add(1, pVal);
+	assertTrue (aCache.get(1) == pVal);
+	assertTrue (aCache.size() == 1);
+}
+
+
+void ConcurrentLRUCacheTest::testShards()
+{
+	ConcurrentLRUCache<int, int> aCache(1000, 0, 10);
+	assertTrue (aCache.shards() == 16);
+	assertTrue (aCache.capacity() == 1000);
+
+	for (int i = 0; i < 500; ++i)
+	{
+		aCache.add(i, i*2);
+	}
+	assertTrue (aCache.size() == 500);
+	for (int i = 0; i < 500; ++i)
+	{
+		assertTrue (*aCache.get(i) == i*2);
+	}
+
+	for (int i = 500; i < 5000; ++i)
+	{
+		aCache.add(i, i*2);
+	}
+	assertTrue (aCache.size() <= 1008);
+	assertTrue (aCache.size() >= 900);
+
+	ConcurrentLRUCache<int, int> smallCache(4, 0, 16);
+	assertTrue (smallCache.shards() == 4);
+}
+
+
+void ConcurrentLRUCacheTest::testExpire()
+{
+	ConcurrentLRUCache<int, int> aCache(10);
+	aCache.add(1, 2, Timespan(200*Timespan::MILLISECONDS));
+	aCache.add(3, 4, Timespan(10*Timespan::SECONDS));
+	aCache.add(5, 6);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+	Thread::sleep(300);
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.get(1).isNull());
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (aCache.getAllKeys().size() == 2);
+
+	// not removed yet
+	assertTrue (aCache.size() == 3);
+	aCache.forceReplace();
+	assertTrue (aCache.size() == 2);
+	assertTrue (aCache.statistics().expirations == 1);
+	assertTrue (aCache.statistics().evictions == 0);
+}
+
+
+void ConcurrentLRUCacheTest::testMaxBytes()
+{
+	ConcurrentLRUCache<int, std::string> aCache(100, 10, 1,
+		[](const int&, const std::string& s)
+		{
+			return s.size();
+		});
+
+	aCache.add(1, "abcd");
+	aCache.add(2, "efgh");
+	assertTrue (aCache.statistics().bytes == 8);
+	aCache.add(3, "ijkl"); // evicts 1
+	assertTrue (aCache.size() == 2);
+	assertTrue (aCache.statistics().bytes == 8);
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.has(2));
+	assertTrue (aCache.has(3));
+
+	aCache.add(4, "0123456789"); // evicts 2 and 3
+	assertTrue (aCache.size() == 1);
+	assertTrue (aCache.statistics().bytes == 10);
+	assertTrue (*aCache.get(4) == "0123456789");
+
+	aCache.add(4, "too large for the cache"); // not cached
+	assertTrue (!aCache.has(4));
+	assertTrue (aCache.size() == 0);
+	assertTrue (aCache.statistics().bytes == 0);
+
+	ConcurrentLRUCache<int, int> intCache(100, 2*sizeof(int), 1);
+	intCache.add(1, 1);
+	intCache.add(2, 2);
+	intCache.add(3, 3);
+	assertTrue (intCache.size() == 2);
+}
+
+
+void ConcurrentLRUCacheTest::testStatistics()
+{
+	ConcurrentLRUCache<int, int> aCache(2, 0, 1);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.get(1);
+	aCache.get(1);
+	aCache.get(3);
+	aCache.get(5);
+	aCache.add(5, 6);
+
+	AbstractConcurrentCache& cache = aCache;
+	AbstractConcurrentCache::Statistics stats = cache.statistics();
+	assertTrue (stats.hits == 3);
+	assertTrue (stats.misses == 1);
+	assertTrue (stats.evictions == 1);
+	assertTrue (stats.expirations == 0);
+	assertTrue (stats.entries == 2);
+	assertTrue (stats.bytes == 2*sizeof(int));
+}
+
+
+void ConcurrentLRUCacheTest::testForEach()
+{
+	ConcurrentLRUCache<int, int> aCache(10);
+	std::map<int, int> values;
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+
+	aCache.forEach([&values](const int& key, const int& value)
+		{
+			values[key] = value;
+		});
+
+	assertTrue (values.size() == 3);
+	assertTrue (values[1] == 2);
+	assertTrue (values[3] == 4);
+	assertTrue (values[5] == 6);
+}
+
+
+void ConcurrentLRUCacheTest::testConcurrency()
+{
+	ConcurrentLRUCache<int, int> aCache(1024, 0, 8);
+	CacheRunnable r1(aCache, 0);
+	CacheRunnable r2(aCache, 250);
+	CacheRunnable r3(aCache, 500);
+	CacheRunnable r4(aCache, 750);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	Thread t4;
+	t1.start(r1);
+	t2.start(r2);
+	t3.start(r3);
+	t4.start(r4);
+	t1.join();
+	t2.join();
+	t3.join();
+	t4.join();
+
+	assertTrue (r1.errors() == 0);
+	assertTrue (r2.errors() == 0);
+	assertTrue (r3.errors() == 0);
+	assertTrue (r4.errors() == 0);
+
+	AbstractConcurrentCache::Statistics stats = aCache.statistics();
+	assertTrue (stats.hits + stats.misses == 40000);
+	assertTrue (stats.entries == aCache.size());
+	assertTrue (aCache.size() <= 1024);
+}
+
+
+void ConcurrentLRUCacheTest::setUp()
+{
+}
+
+
+void ConcurrentLRUCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ConcurrentLRUCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ConcurrentLRUCacheTest");
+
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testClear);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testCacheSize0);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testCacheSize1);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testCacheSizeN);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testDuplicateAdd);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testShards);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testExpire);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testMaxBytes);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testStatistics);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testForEach);
+	CppUnit_addTest(pSuite, ConcurrentLRUCacheTest, testConcurrency);
+
+	return pSuite;
+}
@@ -0,0 +1,44 @@
+//
+// ConcurrentLRUCacheTest.h
+//
+// Tests for ConcurrentLRUCache
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+#ifndef ConcurrentLRUCacheTest_INCLUDED
+#define ConcurrentLRUCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ConcurrentLRUCacheTest: public CppUnit::TestCase
+{
+public:
+	ConcurrentLRUCacheTest(const std::string& name);
+	~ConcurrentLRUCacheTest();
+
+	void testClear();
+	void testCacheSize0();
+	void testCacheSize1();
+	void testCacheSizeN();
+	void testDuplicateAdd();
+	void testShards();
+	void testExpire();
+	void testMaxBytes();
+	void testStatistics();
+	void testForEach();
+	void testConcurrency();
+
+	void setUp();
+	void tearDown();
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ConcurrentLRUCacheTest_INCLUDED
@@ -0,0 +1,302 @@
+//
+// ConcurrentNotificationQueueTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ConcurrentNotificationQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ConcurrentNotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/Random.h"
+
+
+using Poco::ConcurrentNotificationQueue;
+using Poco::Notification;
+using Poco::Thread;
+using Poco::RunnableAdapter;
+using Poco::Stopwatch;
+
+
+namespace
+{
+	class QTestNotification: public Notification
+	{
+	public:
+		QTestNotification(const std::string& data): _data(data)
+		{
+		}
+		~QTestNotification()
+		{
+		}
+		const std::string& data() const
+		{
+			return _data;
+		}
+
+	private:
+		std::string _data;
+	};
+
+	const int PRODUCER_COUNT = 4;
+	const int NOTIFICATIONS_PER_PRODUCER = 10000;
+}
+
+
+ConcurrentNotificationQueueTest::ConcurrentNotificationQueueTest(const std::string& name):
+	CppUnit::TestCase(name),
+	_queue(64),
+	_consumed(0)
+{
+}
+
+
+ConcurrentNotificationQueueTest::~ConcurrentNotificationQueueTest()
+{
+}
+
+
+void ConcurrentNotificationQueueTest::testQueueDequeue()
+{
+	ConcurrentNotificationQueue queue;
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+	Notification* pNf = queue.dequeueNotification();
+	assertNullPtr(pNf);
+	queue.enqueueNotification(new Notification);
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 1);
+	pNf = queue.dequeueNotification();
+	assertNotNullPtr(pNf);
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+	pNf->release();
+
+	queue.enqueueNotification(new QTestNotification("first"));
+	queue.enqueueNotification(new QTestNotification("second"));
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 2);
+	QTestNotification* pTNf = dynamic_cast<QTestNotification*>(queue.dequeueNotification());
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "first");
+	pTNf->release();
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 1);
+	pTNf = dynamic_cast<QTestNotification*>(queue.dequeueNotification());
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "second");
+	pTNf->release();
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+
+	pNf = queue.dequeueNotification();
+	assertNullPtr(pNf);
+}
+
+
+void ConcurrentNotificationQueueTest::testCapacity()
+{
+	ConcurrentNotificationQueue queue(3);
+	assertTrue (queue.capacity() == 4);
+	for (int i = 0; i < 4; ++i)
+	{
+		assertTrue (queue.tryEnqueueNotification(new QTestNotification(std::to_string(i))));
+	}
+	assertTrue (queue.size() == 4);
+	Notification::Ptr pNf = new Notification;
+	assertTrue (!queue.tryEnqueueNotification(pNf));
+	assertTrue (pNf->referenceCount() == 1);
+
+	for (int round = 0; round < 3; ++round)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			Notification::Ptr pTNf(queue.dequeueNotification());
+			assertTrue (pTNf.cast<QTestNotification>()->data() == std::to_string(i));
+			assertTrue (queue.tryEnqueueNotification(pTNf));
+		}
+	}
+	queue.clear();
+	assertTrue (queue.empty());
+}
+
+
+void ConcurrentNotificationQueueTest::testWaitDequeue()
+{
+	ConcurrentNotificationQueue queue;
+	queue.enqueueNotification(new QTestNotification("third"));
+	queue.enqueueNotification(new QTestNotification("fourth"));
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 2);
+	QTestNotification* pTNf = dynamic_cast<QTestNotification*>(queue.waitDequeueNotification(10));
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "third");
+	pTNf->release();
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 1);
+	pTNf = dynamic_cast<QTestNotification*>(queue.waitDequeueNotification(10));
+	assertNotNullPtr(pTNf);
+	assertTrue (pTNf->data() == "fourth");
+	pTNf->release();
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+
+	Stopwatch sw;
+	sw.start();
+	Notification* pNf = queue.waitDequeueNotification(100);
+	sw.stop();
+	assertNullPtr(pNf);
+	assertTrue (sw.elapsed() >= 90000);
+}
+
+
+void ConcurrentNotificationQueueTest::testWakeUpAll()
+{
+	Thread t1("thread1");
+	Thread t2("thread2");
+
+	RunnableAdapter<ConcurrentNotificationQueueTest> ra(*this, &ConcurrentNotificationQueueTest::work);
+	t1.start(ra);
+	t2.start(ra);
+	while (!_queue.hasIdleThreads()) Thread::sleep(10);
+	_queue.enqueueNotification(new Notification);
+	while (!_queue.empty()) Thread::sleep(10);
+	Thread::sleep(20);
+	_queue.wakeUpAll();
+	t1.join();
+	t2.join();
+	assertTrue (_handled.size() == 1);
+	assertTrue (!_queue.hasIdleThreads());
+}
+
+
+void ConcurrentNotificationQueueTest::testThreads()
+{
+	const int NOTIFICATION_COUNT = 5000;
+
+	Thread t1("thread1");
+	Thread t2("thread2");
+	Thread t3("thread3");
+
+	RunnableAdapter<ConcurrentNotificationQueueTest> ra(*this, &ConcurrentNotificationQueueTest::work);
+	t1.start(ra);
+	t2.start(ra);
+	t3.start(ra);
+	for (int i = 0; i < NOTIFICATION_COUNT; ++i)
+	{
+		_queue.enqueueNotification(new Notification);
+	}
+	while (!_queue.empty()) Thread::sleep(50);
+	Thread::sleep(20);
+	_queue.wakeUpAll();
+	t1.join();
+	t2.join();
+	t3.join();
+	assertTrue (_handled.size() == NOTIFICATION_COUNT);
+	assertTrue (_handled.count("thread1") > 0);
+	assertTrue (_handled.count("thread2") > 0);
+	assertTrue (_handled.count("thread3") > 0);
+}
+
+
+void ConcurrentNotificationQueueTest::testProducersConsumers()
+{
+	RunnableAdapter<ConcurrentNotificationQueueTest> producer(*this, &ConcurrentNotificationQueueTest::produce);
+	RunnableAdapter<ConcurrentNotificationQueueTest> consumer(*this, &ConcurrentNotificationQueueTest::consume);
+	Thread producers[PRODUCER_COUNT];
+	Thread consumers[PRODUCER_COUNT];
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+	{
+		consumers[i].start(consumer);
+	}
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+	{
+		producers[i].start(producer);
+	}
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+	{
+		producers[i].join();
+	}
+	while (_consumed < PRODUCER_COUNT*NOTIFICATIONS_PER_PRODUCER) Thread::sleep(10);
+	_queue.wakeUpAll();
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+	{
+		consumers[i].join();
+	}
+	assertTrue (_consumed == PRODUCER_COUNT*NOTIFICATIONS_PER_PRODUCER);
+	assertTrue (_queue.empty());
+}
+
+
+void ConcurrentNotificationQueueTest::setUp()
+{
+	_handled.clear();
+	_consumed = 0;
+}
+
+
+void ConcurrentNotificationQueueTest::tearDown()
+{
+	_queue.clear();
+}
+
+
+void ConcurrentNotificationQueueTest::work()
+{
+	Poco::Random rnd;
+	Notification* pNf = _queue.waitDequeueNotification();
+	while (pNf)
+	{
+		pNf->release();
+		_mutex.lock();
+		_handled.insert(Thread::current()->name());
+		_mutex.unlock();
+		Thread::sleep(rnd.next(5));
+		pNf = _queue.waitDequeueNotification();
+	}
+}
+
+
+void ConcurrentNotificationQueueTest::produce()
+{
+	for (int i = 0; i < NOTIFICATIONS_PER_PRODUCER; ++i)
+	{
+		_queue.enqueueNotification(new Notification);
+	}
+}
+
+
+void ConcurrentNotificationQueueTest::consume()
+{
+	Notification* pNf = _queue.waitDequeueNotification();
+	while (pNf)
+	{
+		pNf->release();
+		++_consumed;
+		pNf = _queue.waitDequeueNotification();
+	}
+}
+
+
+CppUnit::Test* ConcurrentNotificationQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ConcurrentNotificationQueueTest");
+
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testQueueDequeue);
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testCapacity);
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testWaitDequeue);
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testWakeUpAll);
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testThreads);
+	CppUnit_addTest(pSuite, ConcurrentNotificationQueueTest, testProducersConsumers);
+
+	return pSuite;
+}
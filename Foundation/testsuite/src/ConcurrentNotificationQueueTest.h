@@ -0,0 +1,56 @@
+//
+// ConcurrentNotificationQueueTest.h
+//
+// Definition of the ConcurrentNotificationQueueTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ConcurrentNotificationQueueTest_INCLUDED
+#define ConcurrentNotificationQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+#include "Poco/ConcurrentNotificationQueue.h"
+#include "Poco/Mutex.h"
+#include <set>
+#include <atomic>
+
+
+class ConcurrentNotificationQueueTest: public CppUnit::TestCase
+{
+public:
+	ConcurrentNotificationQueueTest(const std::string& name);
+	~ConcurrentNotificationQueueTest();
+
+	void testQueueDequeue();
+	void testCapacity();
+	void testWaitDequeue();
+	void testWakeUpAll();
+	void testThreads();
+	void testProducersConsumers();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+protected:
+	void work();
+	void produce();
+	void consume();
+
+private:
+	Poco::ConcurrentNotificationQueue _queue;
+	std::multiset<std::string> _handled;
+	Poco::FastMutex            _mutex;
+	std::atomic<int>           _consumed;
+};
+
+
+#endif // ConcurrentNotificationQueueTest_INCLUDED
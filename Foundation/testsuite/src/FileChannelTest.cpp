@@ -856,6 +856,134 @@ void FileChannelTest::testPurgeByStrategy()
 }
 
 
+void FileChannelTest::testBuffered()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "128K");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_BUFFERSIZE) == "131072");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 100; ++i)
+		{
+			pChannel->log(msg);
+		}
+		// messages are still in the buffer
+		File f(name);
+		assertTrue (f.exists());
+		assertTrue (f.getSize() == 0);
+		assertTrue (pChannel->size() == 100*(msg.getText().size() + sizeof(POCO_DEFAULT_NEWLINE_CHARS) - 1));
+
+		// filling the buffer writes it to the file
+		for (int i = 0; i < 10000; ++i)
+		{
+			pChannel->log(msg);
+		}
+		assertTrue (f.getSize() > 0);
+		assertTrue (f.getSize() < pChannel->size());
+
+		Poco::UInt64 size = pChannel->size();
+		pChannel->close();
+		assertTrue (f.getSize() == size);
+
+		try
+		{
+			pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "64X");
+			fail("bad size - must throw");
+		}
+		catch (InvalidArgumentException&)
+		{
+		}
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testBufferedRotation()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_ROTATION, "2 K");
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "64K");
+		pChannel->setProperty(FileChannel::PROP_PREALLOCATE, "16K");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 200; ++i)
+		{
+			pChannel->log(msg);
+		}
+		pChannel->close();
+		File f(name);
+		assertTrue (f.exists());
+		f = name + ".0";
+		assertTrue (f.exists());
+		assertTrue (f.getSize() >= 2048 && f.getSize() < 2048 + 64);
+		f = name + ".1";
+		assertTrue (f.exists());
+		assertTrue (f.getSize() >= 2048 && f.getSize() < 2048 + 64);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testGroupSync()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "64K");
+		pChannel->setProperty(FileChannel::PROP_SYNCINTERVAL, "100");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_SYNCINTERVAL) == "100");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 10; ++i)
+		{
+			pChannel->log(msg);
+		}
+		File f(name);
+		assertTrue (f.getSize() == 0);
+
+		// the sync thread writes the buffer
+		Thread::sleep(500);
+		assertTrue (f.getSize() == pChannel->size());
+
+		pChannel->setProperty(FileChannel::PROP_SYNCINTERVAL, "0");
+		pChannel->setProperty(FileChannel::PROP_SYNCSIZE, "1K");
+		for (int i = 0; i < 100; ++i)
+		{
+			pChannel->log(msg);
+		}
+		// the buffer is synced as soon as 1K has been written
+		assertTrue (f.getSize() > 0);
+		assertTrue (pChannel->size() - f.getSize() < 1024);
+		Poco::UInt64 size = pChannel->size();
+		pChannel->close();
+		assertTrue (f.getSize() == size);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
 void FileChannelTest::setUp()
 {
 }
@@ -965,6 +1093,9 @@ CppUnit::Test* FileChannelTest::suite()
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeCount);
 	CppUnit_addTest(pSuite, FileChannelTest, testWrongPurgeOption);
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeByStrategy);
+	CppUnit_addTest(pSuite, FileChannelTest, testBuffered);
+	CppUnit_addTest(pSuite, FileChannelTest, testBufferedRotation);
+	CppUnit_addTest(pSuite, FileChannelTest, testGroupSync);
 
 	return pSuite;
 }
@@ -50,6 +50,9 @@ public:
 	void testPurgeCount();
 	void testWrongPurgeOption();
 	void testPurgeByStrategy();
+	void testBuffered();
+	void testBufferedRotation();
+	void testGroupSync();
 
 	void setUp();
 	void tearDown();
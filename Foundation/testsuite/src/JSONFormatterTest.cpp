@@ -0,0 +1,148 @@
+//
+// JSONFormatterTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "JSONFormatterTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/JSONFormatter.h"
+#include "Poco/Message.h"
+#include "Poco/DateTime.h"
+#include "Poco/Exception.h"
+
+
+using Poco::JSONFormatter;
+using Poco::Message;
+using Poco::DateTime;
+
+
+JSONFormatterTest::JSONFormatterTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+JSONFormatterTest::~JSONFormatterTest()
+{
+}
+
+
+void JSONFormatterTest::testFormat()
+{
+	Message msg;
+	JSONFormatter fmt;
+	msg.setSource("TestSource");
+	msg.setText("Test message text");
+	msg.setPid(1234);
+	msg.setTid(1);
+	msg.setThread("TestThread");
+	msg.setPriority(Message::PRIO_ERROR);
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15, 500).timestamp());
+
+	std::string result;
+	fmt.format(msg, result);
+	assertEqual ("{\"timestamp\":\"2005-01-01T14:30:15.500000Z\",\"priority\":\"Error\",\"source\":\"TestSource\","
+		"\"text\":\"Test message text\",\"thread\":\"TestThread\",\"tid\":1,\"pid\":1234}", result);
+
+	msg.setSourceFile("src/Test.cpp");
+	msg.setSourceLine(42);
+	msg.setThread("");
+	msg["testParam"] = "Test Parameter";
+	msg["count"] = "7";
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual ("{\"timestamp\":\"2005-01-01T14:30:15.500000Z\",\"priority\":\"Error\",\"source\":\"TestSource\","
+		"\"text\":\"Test message text\",\"tid\":1,\"pid\":1234,\"file\":\"src/Test.cpp\",\"line\":42,"
+		"\"count\":\"7\",\"testParam\":\"Test Parameter\"}", result);
+
+	// appends to existing text
+	result = "> ";
+	msg.setPriority(Message::PRIO_TRACE);
+	fmt.format(msg, result);
+	assertTrue (result.find("> {\"timestamp\":") == 0);
+	assertTrue (result.find("\"priority\":\"Trace\"") != std::string::npos);
+
+	// invalid priority
+	result.clear();
+	msg.setPriority(static_cast<Message::Priority>(42));
+	fmt.format(msg, result);
+	assertTrue (result.find("\"priority\":\"42\"") != std::string::npos);
+}
+
+
+void JSONFormatterTest::testEscaping()
+{
+	Message msg;
+	JSONFormatter fmt;
+	msg.setSource("Test\"Source\"");
+	msg.setPid(1);
+	msg.setText("line 1\nline 2\ttab \\ backslash \x01");
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15).timestamp());
+	msg.setSourceFile("C:\\src\\Test.cpp");
+	msg.setSourceLine(1);
+	msg["key \"quoted\""] = "\r\n";
+
+	std::string result;
+	fmt.format(msg, result);
+	assertEqual ("{\"timestamp\":\"2005-01-01T14:30:15.000000Z\",\"priority\":\"Fatal\",\"source\":\"Test\\\"Source\\\"\","
+		"\"text\":\"line 1\\nline 2\\ttab \\\\ backslash \\u0001\",\"tid\":0,\"pid\":1,"
+		"\"file\":\"C:\\\\src\\\\Test.cpp\",\"line\":1,\"key \\\"quoted\\\"\":\"\\r\\n\"}", result);
+}
+
+
+void JSONFormatterTest::testProperties()
+{
+	Message msg("TestSource", "text", Message::PRIO_INFORMATION, "Test.cpp", 10);
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15).timestamp());
+	JSONFormatter fmt;
+	assertTrue (fmt.getProperty(JSONFormatter::PROP_TIMES) == "UTC");
+	assertTrue (fmt.getProperty(JSONFormatter::PROP_SOURCE_LOCATION) == "true");
+
+	fmt.setProperty(JSONFormatter::PROP_SOURCE_LOCATION, "false");
+	std::string result;
+	fmt.format(msg, result);
+	assertTrue (result.find("\"file\"") == std::string::npos);
+	assertTrue (result.find("\"line\"") == std::string::npos);
+
+	fmt.setProperty(JSONFormatter::PROP_TIMES, "local");
+	assertTrue (fmt.getProperty(JSONFormatter::PROP_TIMES) == "local");
+	result.clear();
+	fmt.format(msg, result);
+	assertTrue (result.find("{\"timestamp\":\"2005-01-0") == 0);
+
+	try
+	{
+		fmt.setProperty("unknown", "value");
+		fail("unknown property - must throw");
+	}
+	catch (Poco::PropertyNotSupportedException&)
+	{
+	}
+}
+
+
+void JSONFormatterTest::setUp()
+{
+}
+
+
+void JSONFormatterTest::tearDown()
+{
+}
+
+
+CppUnit::Test* JSONFormatterTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("JSONFormatterTest");
+
+	CppUnit_addTest(pSuite, JSONFormatterTest, testFormat);
+	CppUnit_addTest(pSuite, JSONFormatterTest, testEscaping);
+	CppUnit_addTest(pSuite, JSONFormatterTest, testProperties);
+
+	return pSuite;
+}
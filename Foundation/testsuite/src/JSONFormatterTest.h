@@ -0,0 +1,40 @@
+//
+// JSONFormatterTest.h
+//
+// Definition of the JSONFormatterTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSONFormatterTest_INCLUDED
+#define JSONFormatterTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class JSONFormatterTest: public CppUnit::TestCase
+{
+public:
+	JSONFormatterTest(const std::string& name);
+	~JSONFormatterTest();
+
+	void testFormat();
+	void testEscaping();
+	void testProperties();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // JSONFormatterTest_INCLUDED
@@ -0,0 +1,125 @@
+//
+// LogfmtFormatterTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "LogfmtFormatterTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/LogfmtFormatter.h"
+#include "Poco/Message.h"
+#include "Poco/DateTime.h"
+
+
+using Poco::LogfmtFormatter;
+using Poco::Message;
+using Poco::DateTime;
+
+
+LogfmtFormatterTest::LogfmtFormatterTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+LogfmtFormatterTest::~LogfmtFormatterTest()
+{
+}
+
+
+void LogfmtFormatterTest::testFormat()
+{
+	Message msg;
+	LogfmtFormatter fmt;
+	msg.setSource("TestSource");
+	msg.setText("Test message text");
+	msg.setPid(1234);
+	msg.setTid(1);
+	msg.setThread("TestThread");
+	msg.setPriority(Message::PRIO_ERROR);
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15, 500).timestamp());
+
+	std::string result;
+	fmt.format(msg, result);
+	assertEqual ("timestamp=2005-01-01T14:30:15.500000Z priority=Error source=TestSource "
+		"text=\"Test message text\" thread=TestThread tid=1 pid=1234", result);
+
+	msg.setSourceFile("src/Test.cpp");
+	msg.setSourceLine(42);
+	msg.setThread("");
+	msg["testParam"] = "Test Parameter";
+	msg["count"] = "7";
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual ("timestamp=2005-01-01T14:30:15.500000Z priority=Error source=TestSource "
+		"text=\"Test message text\" tid=1 pid=1234 file=src/Test.cpp line=42 count=7 testParam=\"Test Parameter\"", result);
+
+	// invalid priority
+	result.clear();
+	msg.setPriority(static_cast<Message::Priority>(0));
+	fmt.format(msg, result);
+	assertTrue (result.find(" priority=0 ") != std::string::npos);
+}
+
+
+void LogfmtFormatterTest::testEscaping()
+{
+	Message msg;
+	LogfmtFormatter fmt;
+	msg.setSource("");
+	msg.setPid(1);
+	msg.setText("a=b \"quoted\"\nnext line");
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15).timestamp());
+	msg["bad key=x"] = "C:\\path";
+
+	std::string result;
+	fmt.format(msg, result);
+	assertEqual ("timestamp=2005-01-01T14:30:15.000000Z priority=Fatal source=\"\" "
+		"text=\"a=b \\\"quoted\\\"\\nnext line\" tid=0 pid=1 bad_key_x=C:\\path", result);
+}
+
+
+void LogfmtFormatterTest::testProperties()
+{
+	Message msg("TestSource", "text", Message::PRIO_INFORMATION, "Test.cpp", 10);
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15).timestamp());
+	LogfmtFormatter fmt;
+	std::string result;
+	fmt.format(msg, result);
+	assertTrue (result.find(" file=Test.cpp line=10") != std::string::npos);
+
+	fmt.setProperty(LogfmtFormatter::PROP_SOURCE_LOCATION, "false");
+	assertTrue (fmt.getProperty(LogfmtFormatter::PROP_SOURCE_LOCATION) == "false");
+	result.clear();
+	fmt.format(msg, result);
+	assertTrue (result.find("file=") == std::string::npos);
+
+	fmt.setProperty(LogfmtFormatter::PROP_TIMES, "local");
+	assertTrue (fmt.getProperty(LogfmtFormatter::PROP_TIMES) == "local");
+}
+
+
+void LogfmtFormatterTest::setUp()
+{
+}
+
+
+void LogfmtFormatterTest::tearDown()
+{
+}
+
+
+CppUnit::Test* LogfmtFormatterTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("LogfmtFormatterTest");
+
+	CppUnit_addTest(pSuite, LogfmtFormatterTest, testFormat);
+	CppUnit_addTest(pSuite, LogfmtFormatterTest, testEscaping);
+	CppUnit_addTest(pSuite, LogfmtFormatterTest, testProperties);
+
+	return pSuite;
+}
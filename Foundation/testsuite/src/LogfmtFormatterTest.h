@@ -0,0 +1,40 @@
+//
+// LogfmtFormatterTest.h
+//
+// Definition of the LogfmtFormatterTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef LogfmtFormatterTest_INCLUDED
+#define LogfmtFormatterTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class LogfmtFormatterTest: public CppUnit::TestCase
+{
+public:
+	LogfmtFormatterTest(const std::string& name);
+	~LogfmtFormatterTest();
+
+	void testFormat();
+	void testEscaping();
+	void testProperties();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // LogfmtFormatterTest_INCLUDED
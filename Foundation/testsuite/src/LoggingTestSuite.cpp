@@ -11,7 +11,10 @@
 #include "LoggingTestSuite.h"
 #include "LoggerTest.h"
 #include "ChannelTest.h"
+#include "RingBufferChannelTest.h"
 #include "PatternFormatterTest.h"
+#include "JSONFormatterTest.h"
+#include "LogfmtFormatterTest.h"
 #include "FileChannelTest.h"
 #include "SimpleFileChannelTest.h"
 #include "LoggingFactoryTest.h"
@@ -25,7 +28,10 @@ CppUnit::Test* LoggingTestSuite::suite()
 
 	pSuite->addTest(LoggerTest::suite());
 	pSuite->addTest(ChannelTest::suite());
+	pSuite->addTest(RingBufferChannelTest::suite());
 	pSuite->addTest(PatternFormatterTest::suite());
+	pSuite->addTest(JSONFormatterTest::suite());
+	pSuite->addTest(LogfmtFormatterTest::suite());
 	pSuite->addTest(FileChannelTest::suite());
 	pSuite->addTest(SimpleFileChannelTest::suite());
 	pSuite->addTest(LoggingFactoryTest::suite());
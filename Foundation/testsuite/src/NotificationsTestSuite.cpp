@@ -11,6 +11,7 @@
 #include "NotificationsTestSuite.h"
 #include "NotificationCenterTest.h"
 #include "NotificationQueueTest.h"
+#include "ConcurrentNotificationQueueTest.h"
 #include "PriorityNotificationQueueTest.h"
 #include "TimedNotificationQueueTest.h"
 
@@ -21,6 +22,7 @@ CppUnit::Test* NotificationsTestSuite::suite()
 
 	pSuite->addTest(NotificationCenterTest::suite());
 	pSuite->addTest(NotificationQueueTest::suite());
+	pSuite->addTest(ConcurrentNotificationQueueTest::suite());
 	pSuite->addTest(PriorityNotificationQueueTest::suite());
 	pSuite->addTest(TimedNotificationQueueTest::suite());
 
@@ -106,6 +106,86 @@ void PatternFormatterTest::testPatternFormatter()
 }
 
 
+void PatternFormatterTest::testTimeCache()
+{
+	Message msg;
+	msg.setText("text");
+	msg.setPid(1234);
+	PatternFormatter fmt("%Y-%m-%d %H:%M:%S.%i %F %c [%P] %t %E");
+
+	std::string result;
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15, 500, 250).timestamp());
+	fmt.format(msg, result);
+	assertTrue (result == "2005-01-01 14:30:15.500 500250 5 [1234] text 1104589815");
+
+	// same second, cached date/time rendering
+	result.clear();
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15, 999, 1).timestamp());
+	fmt.format(msg, result);
+	assertTrue (result == "2005-01-01 14:30:15.999 999001 9 [1234] text 1104589815");
+
+	// next second
+	result.clear();
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 16, 0, 0).timestamp());
+	fmt.format(msg, result);
+	assertTrue (result == "2005-01-01 14:30:16.000 000000 0 [1234] text 1104589816");
+
+	// earlier second
+	result.clear();
+	msg.setTime(DateTime(2004, 12, 31, 23, 59, 59, 1, 0).timestamp());
+	fmt.format(msg, result);
+	assertTrue (result == "2004-12-31 23:59:59.001 001000 0 [1234] text 1104537599");
+
+	// %L switches to local time for the following fields only
+	result.clear();
+	fmt.setProperty("pattern", "%H:%M:%S%L");
+	fmt.format(msg, result);
+	assertTrue (result == "23:59:59");
+
+	result.clear();
+	fmt.setProperty("pattern", "%H%L%H");
+	fmt.format(msg, result);
+	std::string local;
+	fmt.setProperty("pattern", "%L%H");
+	fmt.format(msg, local);
+	assertTrue (result == "23" + local);
+
+	// a pattern change resets the cache
+	result.clear();
+	fmt.setProperty("pattern", "%Y %b %d");
+	fmt.format(msg, result);
+	assertTrue (result == "2004 Dec 31");
+}
+
+
+void PatternFormatterTest::testNoTimeFields()
+{
+	Message msg;
+	msg.setSource("TestSource");
+	msg.setText("text");
+	msg.setPriority(Message::PRIO_ERROR);
+	PatternFormatter fmt("[%p] %s: %t!");
+
+	std::string result;
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15).timestamp());
+	fmt.format(msg, result);
+	assertTrue (result == "[Error] TestSource: text!");
+
+	// the trailing literal does not depend on the time
+	result.clear();
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 16).timestamp());
+	msg.setText("other text");
+	fmt.format(msg, result);
+	assertTrue (result == "[Error] TestSource: other text!");
+
+	// literal text only
+	result.clear();
+	fmt.setProperty("pattern", "no fields");
+	fmt.format(msg, result);
+	assertTrue (result == "no fields");
+}
+
+
 void PatternFormatterTest::setUp()
 {
 }
@@ -121,6 +201,8 @@ CppUnit::Test* PatternFormatterTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("PatternFormatterTest");
 
 	CppUnit_addTest(pSuite, PatternFormatterTest, testPatternFormatter);
+	CppUnit_addTest(pSuite, PatternFormatterTest, testTimeCache);
+	CppUnit_addTest(pSuite, PatternFormatterTest, testNoTimeFields);
 
 	return pSuite;
 }
@@ -25,6 +25,8 @@ public:
 	~PatternFormatterTest();
 
 	void testPatternFormatter();
+	void testTimeCache();
+	void testNoTimeFields();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,484 @@
+//
+// RingBufferChannelTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "RingBufferChannelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/RingBufferChannel.h"
+#include "Poco/Logger.h"
+#include "Poco/Message.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/NumberParser.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include "TestChannel.h"
+#include <atomic>
+#include <map>
+
+
+using Poco::RingBufferChannel;
+using Poco::Logger;
+using Poco::Message;
+using Poco::AutoPtr;
+using Poco::Thread;
+using Poco::Runnable;
+using Poco::Event;
+using Poco::FastMutex;
+using Poco::ErrorHandler;
+
+
+namespace
+{
+	class BlockingChannel: public Poco::Channel
+		/// Collects messages. The first message blocks
+		/// until release() is called.
+	{
+	public:
+		BlockingChannel():
+			_blocked(false)
+		{
+		}
+
+		void log(const Message& msg)
+		{
+			bool first;
+			{
+				FastMutex::ScopedLock lock(_mutex);
+				_messages.push_back(msg);
+				first = _messages.size() == 1;
+			}
+			if (first)
+			{
+				_blocked = true;
+				_release.wait();
+			}
+		}
+
+		void waitUntilBlocked()
+		{
+			while (!_blocked) Thread::sleep(1);
+		}
+
+		void release()
+		{
+			_release.set();
+		}
+
+		std::vector<Message> messages()
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			return _messages;
+		}
+
+	private:
+		FastMutex _mutex;
+		std::vector<Message> _messages;
+		std::atomic<bool> _blocked;
+		Event _release;
+	};
+
+	class ThrowingChannel: public Poco::Channel
+		/// Forwards messages to a TestChannel, but throws
+		/// for messages with the text "throw".
+	{
+	public:
+		ThrowingChannel(TestChannel* pChannel):
+			_pChannel(pChannel, true)
+		{
+		}
+
+		void log(const Message& msg)
+		{
+			if (msg.getText() == "throw") throw Poco::IOException("cannot write message");
+			_pChannel->log(msg);
+		}
+
+	private:
+		AutoPtr<TestChannel> _pChannel;
+	};
+
+	class CountingErrorHandler: public ErrorHandler
+	{
+	public:
+		CountingErrorHandler():
+			_count(0)
+		{
+		}
+
+		void exception(const Poco::Exception&)
+		{
+			++_count;
+		}
+
+		void exception(const std::exception&)
+		{
+			++_count;
+		}
+
+		void exception()
+		{
+			++_count;
+		}
+
+		int count() const
+		{
+			return _count;
+		}
+
+	private:
+		std::atomic<int> _count;
+	};
+
+	class LogRunnable: public Runnable
+	{
+	public:
+		LogRunnable(Logger& logger, int count):
+			_logger(logger),
+			_count(count)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _count; ++i)
+			{
+				_logger.information("message %d", i);
+			}
+		}
+
+	private:
+		Logger& _logger;
+		int _count;
+	};
+}
+
+
+RingBufferChannelTest::RingBufferChannelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+RingBufferChannelTest::~RingBufferChannelTest()
+{
+}
+
+
+void RingBufferChannelTest::testLogMessage()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+
+	Message msg("Source", "Text", Message::PRIO_WARNING, __FILE__, 42);
+	msg.set("key1", "value1");
+	msg.set("key2", "value2");
+	msg.setTid(1234);
+	msg.setThread("Thread");
+	pRing->log(msg);
+	pRing->close();
+
+	assertTrue (pChannel->list().size() == 1);
+	const Message& received = pChannel->list().front();
+	assertTrue (received.getSource() == "Source");
+	assertTrue (received.getText() == "Text");
+	assertTrue (received.getPriority() == Message::PRIO_WARNING);
+	assertTrue (received.getTime() == msg.getTime());
+	assertTrue (received.getTid() == 1234);
+	assertTrue (received.getOsTid() == msg.getOsTid());
+	assertTrue (received.getThread() == "Thread");
+	assertTrue (received.getPid() == msg.getPid());
+	assertTrue (received.getSourceFile() == msg.getSourceFile());
+	assertTrue (received.getSourceLine() == 42);
+	assertTrue (received.getAll().size() == 2);
+	assertTrue (received.get("key1") == "value1");
+	assertTrue (received.get("key2") == "value2");
+}
+
+
+void RingBufferChannelTest::testLogText()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+
+	Logger& logger = Logger::get("RingBufferChannelTest");
+	logger.setChannel(pRing);
+	logger.setLevel(Message::PRIO_INFORMATION);
+
+	logger.information("information");
+	logger.debug("debug");
+	poco_warning(logger, "warning");
+	pRing->close();
+
+	assertTrue (pChannel->list().size() == 2);
+	const Message& msg1 = pChannel->list().front();
+	assertTrue (msg1.getSource() == "RingBufferChannelTest");
+	assertTrue (msg1.getText() == "information");
+	assertTrue (msg1.getPriority() == Message::PRIO_INFORMATION);
+	assertTrue (msg1.getOsTid() == Thread::currentOsTid());
+	assertTrue (msg1.getSourceFile() == 0);
+
+	const Message& msg2 = pChannel->list().back();
+	assertTrue (msg2.getText() == "warning");
+	assertTrue (msg2.getPriority() == Message::PRIO_WARNING);
+	assertTrue (msg2.getSourceFile() != 0);
+	assertTrue (msg2.getSourceLine() != 0);
+	assertTrue (msg2.getTime() >= msg1.getTime());
+}
+
+
+void RingBufferChannelTest::testDeferredFormat()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+
+	Logger& logger = Logger::get("RingBufferChannelTest");
+	logger.setChannel(pRing);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	std::string str("string");
+	std::string_view view("view");
+	logger.information("%d %u %ld %lu %hd %c %b", -1, 2u, -3l, 4ul, static_cast<short>(5), 'x', true);
+	logger.warning("%s %v %.1f %.1hf %z", str, view, 1.5, 2.5f, static_cast<std::size_t>(7));
+	logger.debug("%[1]s %[0]d", 1, str);
+	// not deferred
+	logger.error("%s", Poco::Any(str));
+	pRing->close();
+
+	assertTrue (pChannel->list().size() == 4);
+	auto it = pChannel->list().begin();
+	assertTrue (it->getText() == "-1 2 -3 4 5 x 1");
+	assertTrue (it->getPriority() == Message::PRIO_INFORMATION);
+	++it;
+	assertTrue (it->getText() == "string view 1.5 2.5 7");
+	assertTrue (it->getPriority() == Message::PRIO_WARNING);
+	++it;
+	assertTrue (it->getText() == "string 1");
+	++it;
+	assertTrue (it->getText() == "string");
+	assertTrue (it->getPriority() == Message::PRIO_ERROR);
+}
+
+
+void RingBufferChannelTest::testMultipleThreads()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+	pRing->setBufferSize(8192);
+
+	Logger& logger = Logger::get("RingBufferChannelTest");
+	logger.setChannel(pRing);
+	logger.setLevel(Message::PRIO_INFORMATION);
+
+	const int count = 2000;
+	LogRunnable r1(logger, count);
+	LogRunnable r2(logger, count);
+	LogRunnable r3(logger, count);
+	LogRunnable r4(logger, count);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	Thread t4;
+	t1.start(r1);
+	t2.start(r2);
+	t3.start(r3);
+	t4.start(r4);
+	t1.join();
+	t2.join();
+	t3.join();
+	t4.join();
+	pRing->close();
+
+	assertTrue (pRing->droppedMessages() == 0);
+	assertTrue (pChannel->list().size() == 4*count);
+
+	// messages of each thread must arrive in order
+	std::map<long, int> next;
+	for (const auto& msg: pChannel->list())
+	{
+		int n = Poco::NumberParser::parse(msg.getText().substr(8));
+		assertTrue (next[msg.getTid()] == n);
+		next[msg.getTid()] = n + 1;
+	}
+	assertTrue (next.size() == 4);
+	assertTrue (next[t1.id()] == count);
+	assertTrue (next[t4.id()] == count);
+}
+
+
+void RingBufferChannelTest::testOverflowDrop()
+{
+	AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+	pRing->setBufferSize(RingBufferChannel::MIN_BUFFER_SIZE);
+	pRing->setOverflowPolicy(RingBufferChannel::OVERFLOW_DROP);
+
+	pRing->log("Source", "first", Message::PRIO_INFORMATION);
+	pChannel->waitUntilBlocked();
+
+	const int count = 1000;
+	for (int i = 0; i < count; ++i)
+	{
+		pRing->log("Source", "message", Message::PRIO_INFORMATION);
+	}
+	assertTrue (pRing->droppedMessages() > 0);
+
+	pChannel->release();
+	pRing->close();
+
+	std::vector<Message> messages = pChannel->messages();
+	assertTrue (messages.size() + pRing->droppedMessages() == count + 1);
+	for (const auto& msg: messages)
+	{
+		assertTrue (msg.getText() == "first" || msg.getText() == "message");
+	}
+}
+
+
+void RingBufferChannelTest::testOverflowCount()
+{
+	AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+	pRing->setBufferSize(RingBufferChannel::MIN_BUFFER_SIZE);
+	pRing->setOverflowPolicy(RingBufferChannel::OVERFLOW_COUNT);
+
+	pRing->log("Source", "first", Message::PRIO_INFORMATION);
+	pChannel->waitUntilBlocked();
+
+	const int count = 1000;
+	for (int i = 0; i < count; ++i)
+	{
+		pRing->log("Source", "message", Message::PRIO_INFORMATION);
+	}
+	const Poco::UInt64 dropped = pRing->droppedMessages();
+	assertTrue (dropped > 0);
+
+	pChannel->release();
+	pRing->close();
+
+	std::vector<Message> messages = pChannel->messages();
+	assertTrue (messages.size() == count + 1 - dropped + 1);
+	int reports = 0;
+	for (const auto& msg: messages)
+	{
+		if (msg.getText() == Poco::format("Dropped %z messages.", static_cast<std::size_t>(dropped))) ++reports;
+	}
+	assertTrue (reports == 1);
+}
+
+
+void RingBufferChannelTest::testOverflowBlock()
+{
+	AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(pChannel);
+	pRing->setBufferSize(RingBufferChannel::MIN_BUFFER_SIZE);
+	pRing->setOverflowPolicy(RingBufferChannel::OVERFLOW_BLOCK);
+
+	Logger& logger = Logger::get("RingBufferChannelTest");
+	logger.setChannel(pRing);
+	logger.setLevel(Message::PRIO_INFORMATION);
+
+	const int count = 1000;
+	LogRunnable r(logger, count);
+	Thread t;
+	t.start(r);
+	pChannel->waitUntilBlocked();
+	Thread::sleep(100);
+	// the producer waits for room in the buffer
+	assertTrue (t.isRunning());
+	pChannel->release();
+	t.join();
+	pRing->close();
+
+	assertTrue (pRing->droppedMessages() == 0);
+	assertTrue (pChannel->messages().size() == count);
+}
+
+
+void RingBufferChannelTest::testProperties()
+{
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel;
+	assertTrue (pRing->getProperty("bufferSize") == "262144");
+	assertTrue (pRing->getProperty("overflow") == "block");
+
+	pRing->setProperty("bufferSize", "10000");
+	assertTrue (pRing->getBufferSize() == 16384);
+	pRing->setProperty("bufferSize", "100");
+	assertTrue (pRing->getBufferSize() == RingBufferChannel::MIN_BUFFER_SIZE);
+
+	pRing->setProperty("overflow", "drop");
+	assertTrue (pRing->getOverflowPolicy() == RingBufferChannel::OVERFLOW_DROP);
+	pRing->setProperty("overflow", "count");
+	assertTrue (pRing->getProperty("overflow") == "count");
+
+	try
+	{
+		pRing->setProperty("overflow", "invalid");
+		fail("invalid overflow policy - must throw");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void RingBufferChannelTest::testChannelException()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<RingBufferChannel> pRing = new RingBufferChannel(new ThrowingChannel(pChannel));
+	CountingErrorHandler eh;
+	ErrorHandler* pOldEH = ErrorHandler::set(&eh);
+
+	Logger& logger = Logger::get("RingBufferChannelTest");
+	logger.setChannel(pRing);
+	logger.setLevel(Message::PRIO_INFORMATION);
+
+	logger.information("first");
+	logger.information("throw");
+	logger.information("second %d", 2);
+	pRing->close();
+	ErrorHandler::set(pOldEH);
+
+	assertTrue (eh.count() == 1);
+	assertTrue (pChannel->list().size() == 2);
+	assertTrue (pChannel->list().front().getText() == "first");
+	assertTrue (pChannel->list().back().getText() == "second 2");
+}
+
+
+void RingBufferChannelTest::setUp()
+{
+}
+
+
+void RingBufferChannelTest::tearDown()
+{
+	Logger::get("RingBufferChannelTest").setChannel(nullptr);
+}
+
+
+CppUnit::Test* RingBufferChannelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("RingBufferChannelTest");
+
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testLogMessage);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testLogText);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testDeferredFormat);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testMultipleThreads);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testOverflowDrop);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testOverflowCount);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testOverflowBlock);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testProperties);
+	CppUnit_addTest(pSuite, RingBufferChannelTest, testChannelException);
+
+	return pSuite;
+}
@@ -0,0 +1,46 @@
+//
+// RingBufferChannelTest.h
+//
+// Definition of the RingBufferChannelTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef RingBufferChannelTest_INCLUDED
+#define RingBufferChannelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class RingBufferChannelTest: public CppUnit::TestCase
+{
+public:
+	RingBufferChannelTest(const std::string& name);
+	~RingBufferChannelTest();
+
+	void testLogMessage();
+	void testLogText();
+	void testDeferredFormat();
+	void testMultipleThreads();
+	void testOverflowDrop();
+	void testOverflowCount();
+	void testOverflowBlock();
+	void testProperties();
+	void testChannelException();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // RingBufferChannelTest_INCLUDED
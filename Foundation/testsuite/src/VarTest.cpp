@@ -2978,6 +2978,67 @@ void VarTest::testGetIdxMustThrow(Var& a1, std::vector<Var>::size_type n)
 }
 
 
+void VarTest::testChangeType()
+{
+	Var a(42);
+	Var b(std::string("hello"));
+	a.swap(b);
+	assertTrue (a.type() == typeid(std::string));
+	assertTrue (a.extract<std::string>() == "hello");
+	assertTrue (b.type() == typeid(int));
+	assertTrue (b.extract<int>() == 42);
+	assertTrue (b.convert<std::string>() == "42");
+	assertTrue (b.convert<Poco::UInt8>() == 42);
+
+	try
+	{
+		Poco::Int64 POCO_UNUSED i = b.extract<Poco::Int64>();
+		fail ("must fail");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+
+	a = 1.5;
+	assertTrue (a.extract<double>() == 1.5);
+	assertTrue (a.convert<std::string>() == "1.5");
+	assertTrue (a.convert<int>() == 1);
+
+	Var c(a);
+	assertTrue (c.extract<double>() == 1.5);
+	c = 'x';
+	assertTrue (c.convert<int>() == 'x');
+	assertTrue (c.toString() == "x");
+	assertTrue (a.extract<double>() == 1.5);
+
+	c = Poco::Timestamp(0);
+	assertTrue (c.convert<Poco::Int64>() == 0);
+	c = true;
+	assertTrue (c.convert<std::string>() == "true");
+
+	a.clear();
+	try
+	{
+		int POCO_UNUSED i = a.convert<int>();
+		fail ("must fail");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+	a = "abc";
+	assertTrue (a.extract<std::string>() == "abc");
+
+	try
+	{
+		Poco::UInt8 POCO_UNUSED i = Var(-1).convert<Poco::UInt8>();
+		fail ("must fail");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+}
+
+
 void VarTest::testEmpty()
 {
 	Var da;
@@ -3372,6 +3433,7 @@ CppUnit::Test* VarTest::suite()
 	CppUnit_addTest(pSuite, VarTest, testJSONRoundtripStruct);
 	CppUnit_addTest(pSuite, VarTest, testDate);
 	CppUnit_addTest(pSuite, VarTest, testUUID);
+	CppUnit_addTest(pSuite, VarTest, testChangeType);
 	CppUnit_addTest(pSuite, VarTest, testEmpty);
 	CppUnit_addTest(pSuite, VarTest, testIterator);
 	CppUnit_addTest(pSuite, VarTest, testVarVisitor);
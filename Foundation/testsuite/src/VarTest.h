@@ -77,6 +77,7 @@ public:
 	void testJSONDeserializeComplex();
 	void testDate();
 	void testUUID();
+	void testChangeType();
 	void testEmpty();
 	void testIterator();
 	void testSharedPtr();
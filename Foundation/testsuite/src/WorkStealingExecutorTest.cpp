@@ -0,0 +1,351 @@
+//
+// WorkStealingExecutorTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "WorkStealingExecutorTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/WorkStealingExecutor.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/TaskManager.h"
+#include "Poco/Task.h"
+#include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/Thread.h"
+#include "Poco/Exception.h"
+#include <atomic>
+#include <vector>
+
+
+using Poco::WorkStealingExecutor;
+using Poco::ThreadPool;
+using Poco::TaskManager;
+using Poco::Task;
+using Poco::Runnable;
+using Poco::Event;
+using Poco::Thread;
+using Poco::NoThreadAvailableException;
+
+
+namespace
+{
+	class CountingRunnable: public Runnable
+	{
+	public:
+		CountingRunnable(): _count(0)
+		{
+		}
+
+		void run()
+		{
+			++_count;
+		}
+
+		int count() const
+		{
+			return _count;
+		}
+
+	private:
+		std::atomic<int> _count;
+	};
+
+	class SplittingRunnable: public Runnable
+		/// Starts a number of child runnables from within a worker.
+	{
+	public:
+		SplittingRunnable(WorkStealingExecutor& executor, Runnable& child, int children):
+			_executor(executor),
+			_child(child),
+			_children(children)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _children; ++i)
+			{
+				_executor.start(_child);
+			}
+		}
+
+	private:
+		WorkStealingExecutor& _executor;
+		Runnable& _child;
+		int _children;
+	};
+
+	class SleepingRunnable: public Runnable
+	{
+	public:
+		SleepingRunnable(): _count(0)
+		{
+		}
+
+		void run()
+		{
+			Thread::sleep(20);
+			++_count;
+		}
+
+		int count() const
+		{
+			return _count;
+		}
+
+	private:
+		std::atomic<int> _count;
+	};
+
+	class BlockingRunnable: public Runnable
+	{
+	public:
+		BlockingRunnable(): _started(Event::EVENT_MANUALRESET), _continue(Event::EVENT_MANUALRESET)
+		{
+		}
+
+		void run()
+		{
+			_started.set();
+			_continue.wait();
+		}
+
+		void waitStarted()
+		{
+			_started.wait();
+		}
+
+		void cont()
+		{
+			_continue.set();
+		}
+
+	private:
+		Event _started;
+		Event _continue;
+	};
+
+	class CountingTask: public Task
+	{
+	public:
+		CountingTask(std::atomic<int>& count): Task("CountingTask"), _count(count)
+		{
+		}
+
+		void runTask()
+		{
+			++_count;
+		}
+
+	private:
+		std::atomic<int>& _count;
+	};
+}
+
+
+WorkStealingExecutorTest::WorkStealingExecutorTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+WorkStealingExecutorTest::~WorkStealingExecutorTest()
+{
+}
+
+
+void WorkStealingExecutorTest::testStart()
+{
+	WorkStealingExecutor executor("test", 4, 1024);
+	assertTrue (executor.capacity() == 4);
+	assertTrue (executor.queueCapacity() == 1024);
+	assertTrue (executor.name() == "test");
+
+	CountingRunnable r;
+	for (int i = 0; i < 1000; ++i)
+	{
+		if (i % 2)
+			executor.start(r);
+		else
+			executor.start(r, "counter");
+	}
+	executor.joinAll();
+	assertTrue (r.count() == 1000);
+	assertTrue (executor.used() == 0);
+
+	WorkStealingExecutor::Statistics stats = executor.statistics();
+	assertTrue (stats.submitted == 1000);
+	assertTrue (stats.executed == 1000);
+	assertTrue (stats.rejected == 0);
+	assertTrue (stats.queueDepth == 0);
+}
+
+
+void WorkStealingExecutorTest::testLocalSubmit()
+{
+	WorkStealingExecutor executor(2, 1024);
+	CountingRunnable child;
+	SplittingRunnable parent(executor, child, 100);
+	for (int i = 0; i < 5; ++i)
+	{
+		executor.start(parent);
+	}
+	executor.joinAll();
+	assertTrue (child.count() == 500);
+
+	WorkStealingExecutor::Statistics stats = executor.statistics();
+	assertTrue (stats.submitted == 505);
+	assertTrue (stats.executed == 505);
+	assertTrue (stats.localSubmits == 500);
+}
+
+
+void WorkStealingExecutorTest::testSteal()
+{
+	WorkStealingExecutor executor(4, 64);
+	SleepingRunnable child;
+	SplittingRunnable parent(executor, child, 16);
+	executor.start(parent);
+	executor.joinAll();
+	assertTrue (child.count() == 16);
+
+	WorkStealingExecutor::Statistics stats = executor.statistics();
+	assertTrue (stats.localSubmits == 16);
+	assertTrue (stats.steals > 0);
+}
+
+
+void WorkStealingExecutorTest::testQueueFull()
+{
+	WorkStealingExecutor executor(1, 2);
+	BlockingRunnable blocker;
+	executor.start(blocker);
+	blocker.waitStarted();
+
+	CountingRunnable r;
+	executor.start(r);
+	executor.start(r);
+	assertTrue (executor.used() == 3);
+	assertTrue (executor.statistics().queueDepth == 2);
+	try
+	{
+		executor.start(r);
+		failmsg("queue full - must throw exception");
+	}
+	catch (NoThreadAvailableException&)
+	{
+	}
+	assertTrue (executor.statistics().rejected == 1);
+
+	blocker.cont();
+	executor.joinAll();
+	assertTrue (r.count() == 2);
+	assertTrue (executor.used() == 0);
+}
+
+
+void WorkStealingExecutorTest::testStopAll()
+{
+	WorkStealingExecutor executor(1, 16);
+	BlockingRunnable blocker;
+	executor.start(blocker);
+	blocker.waitStarted();
+
+	CountingRunnable r;
+	executor.start(r);
+	blocker.cont();
+	executor.stopAll();
+	assertTrue (executor.used() == 0);
+	try
+	{
+		executor.start(r);
+		failmsg("executor stopped - must throw exception");
+	}
+	catch (NoThreadAvailableException&)
+	{
+	}
+}
+
+
+void WorkStealingExecutorTest::testThreadPool()
+{
+	ThreadPool pool(new WorkStealingExecutor("pool", 3, 8));
+	assertTrue (pool.name() == "pool");
+	assertTrue (pool.capacity() == 3);
+	assertTrue (pool.allocated() == 3);
+	assertTrue (pool.used() == 0);
+	assertTrue (pool.available() == 3);
+	assertTrue (!pool.executor().isNull());
+
+	BlockingRunnable blocker;
+	pool.start(blocker, "blocker");
+	blocker.waitStarted();
+	assertTrue (pool.used() == 1);
+	assertTrue (pool.available() == 2);
+
+	CountingRunnable r;
+	for (int i = 0; i < 10; ++i)
+	{
+		pool.startWithPriority(Thread::PRIO_NORMAL, r);
+	}
+	blocker.cont();
+	pool.joinAll();
+	assertTrue (r.count() == 10);
+	assertTrue (pool.used() == 0);
+
+	try
+	{
+		pool.addCapacity(1);
+		failmsg("capacity is fixed - must throw exception");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+}
+
+
+void WorkStealingExecutorTest::testTaskManager()
+{
+	ThreadPool pool(new WorkStealingExecutor(2, 64));
+	std::atomic<int> count(0);
+	{
+		TaskManager tm(pool);
+		for (int i = 0; i < 20; ++i)
+		{
+			tm.start(new CountingTask(count));
+		}
+		tm.joinAll();
+	}
+	assertTrue (count == 20);
+}
+
+
+void WorkStealingExecutorTest::setUp()
+{
+}
+
+
+void WorkStealingExecutorTest::tearDown()
+{
+}
+
+
+CppUnit::Test* WorkStealingExecutorTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WorkStealingExecutorTest");
+
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testStart);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testLocalSubmit);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testSteal);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testQueueFull);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testStopAll);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testThreadPool);
+	CppUnit_addTest(pSuite, WorkStealingExecutorTest, testTaskManager);
+
+	return pSuite;
+}
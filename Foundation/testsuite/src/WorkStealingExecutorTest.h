@@ -0,0 +1,42 @@
+//
+// WorkStealingExecutorTest.h
+//
+// Definition of the WorkStealingExecutorTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef WorkStealingExecutorTest_INCLUDED
+#define WorkStealingExecutorTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class WorkStealingExecutorTest: public CppUnit::TestCase
+{
+public:
+	WorkStealingExecutorTest(const std::string& name);
+	~WorkStealingExecutorTest();
+
+	void testStart();
+	void testLocalSubmit();
+	void testSteal();
+	void testQueueFull();
+	void testStopAll();
+	void testThreadPool();
+	void testTaskManager();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // WorkStealingExecutorTest_INCLUDED
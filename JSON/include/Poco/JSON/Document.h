@@ -0,0 +1,185 @@
+//
+// Document.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Definition of the Document class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Document_INCLUDED
+#define JSON_Document_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Node.h"
+#include <istream>
+#include <string_view>
+#include <vector>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class Reader;
+
+
+class JSON_API Document
+	/// Document is an immutable, compact representation of a
+	/// parsed JSON document.
+	///
+	/// Unlike Parser, which creates an Object or Array instance for
+	/// every object or array and a Dynamic::Var for every value, the
+	/// Document stores all values, keys and strings in a single memory
+	/// arena it owns. The arena is allocated in a few large blocks and
+	/// released as a whole, so parsing a document takes a small number
+	/// of memory allocations, independent of the number of values, and
+	/// the values are stored close together in memory.
+	///
+	/// The values are accessed through Node instances:
+	///
+	///     Document doc(json);
+	///     Node root = doc.root();
+	///     for (std::size_t i = 0; i < root["items"].size(); ++i)
+	///     {
+	///         Node item = root["items"][i];
+	///         total += item["price"].getDouble();
+	///     }
+	///
+	/// A Document cannot be modified after it has been parsed. Use
+	/// Node::toVar() to obtain a modifiable copy of any part of
+	/// the document as Object and Array instances.
+	///
+	/// Query and Stringifier accept a Node in a Dynamic::Var.
+	///
+	/// The text passed to parse() is not referenced after parse()
+	/// returns. Nodes obtained from the Document become invalid when
+	/// the Document is destroyed, cleared or parses another text.
+{
+public:
+	Document();
+		/// Creates an empty Document. The root Node of an
+		/// empty Document is invalid.
+
+	explicit Document(std::string_view json);
+		/// Creates the Document and parses the given JSON text.
+
+	Document(Document&& other) noexcept;
+		/// Creates the Document by taking over the contents of another
+		/// Document, which is left empty. Nodes obtained from the other
+		/// Document remain valid.
+
+	~Document();
+		/// Destroys the Document and releases its memory.
+
+	Document& operator = (Document&& other) noexcept;
+		/// Takes over the contents of another Document, which
+		/// is left empty.
+
+	void parse(std::string_view json);
+		/// Parses the given JSON text, replacing the current contents
+		/// of the Document.
+		///
+		/// Throws a JSONException if the text is not valid JSON, in
+		/// which case the Document is left empty.
+
+	void parse(std::istream& in);
+		/// Reads the given stream to its end and parses the text.
+
+	Node root() const;
+		/// Returns the root value of the Document.
+
+	bool empty() const;
+		/// Returns true if the Document has no contents.
+
+	void clear();
+		/// Releases the contents of the Document.
+
+	std::size_t arenaSize() const;
+		/// Returns the total size of the memory blocks
+		/// allocated for the contents of the Document.
+
+	void setMaxDepth(std::size_t depth);
+		/// Sets the maximum nesting depth of objects and arrays.
+		/// Defaults to Reader::DEFAULT_MAX_DEPTH.
+
+	std::size_t getMaxDepth() const;
+		/// Returns the maximum nesting depth of objects and arrays.
+
+	static const std::size_t MIN_BLOCK_SIZE = 4096;
+
+private:
+	Document(const Document&);
+	Document& operator = (const Document&);
+
+	struct Frame
+	{
+		bool        isObject;
+		std::size_t start;
+	};
+
+	void build(Reader& reader);
+	void addValue(const Node::Value& value);
+	void endContainer();
+	const char* copyString(std::string_view str);
+	void* allocate(std::size_t size);
+	void reserve(std::size_t size);
+
+	std::vector<char*>        _blocks;
+	char*                     _pCur;
+	char*                     _pEnd;
+	std::size_t               _arenaSize;
+	std::size_t               _nextBlockSize;
+	Node::Value*              _pRoot;
+	std::size_t               _maxDepth;
+	std::vector<Node::Value>  _values;  // elements of the open arrays
+	std::vector<Node::Member> _members; // members of the open objects
+	std::vector<Frame>        _frames;
+};
+
+
+//
+// inlines
+//
+inline Node Document::root() const
+{
+	return Node(_pRoot);
+}
+
+
+inline bool Document::empty() const
+{
+	return _pRoot == 0;
+}
+
+
+inline std::size_t Document::arenaSize() const
+{
+	return _arenaSize;
+}
+
+
+inline void Document::setMaxDepth(std::size_t depth)
+{
+	_maxDepth = depth;
+}
+
+
+inline std::size_t Document::getMaxDepth() const
+{
+	return _maxDepth;
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_Document_INCLUDED
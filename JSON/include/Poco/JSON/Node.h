@@ -0,0 +1,424 @@
+//
+// Node.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Definition of the Node class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Node_INCLUDED
+#define JSON_Node_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/Dynamic/Var.h"
+#include "Poco/JSONString.h"
+#include <ostream>
+#include <sstream>
+#include <string_view>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class Document;
+
+
+class JSON_API Node
+	/// Node is a read-only reference to a value in a Document.
+	///
+	/// A Node is a single pointer and is meant to be passed by value.
+	/// It remains valid as long as the Document it has been obtained
+	/// from exists and has not been cleared or reparsed.
+	///
+	/// Looking up a member or element that does not exist returns an
+	/// invalid Node, so lookups can be chained without checking every
+	/// step:
+	///
+	///     Document doc(json);
+	///     std::string_view name = doc.root()["person"]["children"][0]["name"].getString();
+	///     if (!doc.root()["person"]["age"].isValid()) ...
+	///
+	/// Object members are kept in document order. Members are looked up
+	/// with a binary search in a sorted index for objects with more
+	/// than LINEAR_LOOKUP_LIMIT members, and with a linear search for
+	/// smaller objects. If an object contains the same key more than
+	/// once, the lookup returns the last member with that key, like
+	/// Object does.
+{
+public:
+	enum Type
+	{
+		NODE_NULL,     /// null, or an invalid Node
+		NODE_BOOLEAN,  /// true or false
+		NODE_INTEGER,  /// an integer number that fits into Int64
+		NODE_UNSIGNED, /// an integer number that only fits into UInt64
+		NODE_DOUBLE,   /// any other number
+		NODE_STRING,   /// a string
+		NODE_ARRAY,    /// an array
+		NODE_OBJECT    /// an object
+	};
+
+	static const std::size_t LINEAR_LOOKUP_LIMIT = 8;
+
+	Node();
+		/// Creates an invalid Node.
+
+	bool isValid() const;
+		/// Returns true if the Node refers to a value.
+
+	Type type() const;
+		/// Returns the type of the value. Returns NODE_NULL
+		/// for an invalid Node.
+
+	bool isNull() const;
+		/// Returns true if the value is null, or the Node is invalid.
+
+	bool isBoolean() const;
+		/// Returns true if the value is true or false.
+
+	bool isNumber() const;
+		/// Returns true if the value is a number.
+
+	bool isInteger() const;
+		/// Returns true if the value is an integer number.
+
+	bool isString() const;
+		/// Returns true if the value is a string.
+
+	bool isArray() const;
+		/// Returns true if the value is an array.
+
+	bool isObject() const;
+		/// Returns true if the value is an object.
+
+	bool getBool() const;
+		/// Returns the value of a boolean.
+		///
+		/// Throws a BadCastException if the value is not a boolean.
+
+	Poco::Int64 getInt64() const;
+		/// Returns the value of an integer number.
+		///
+		/// Throws a BadCastException if the value is not an integer
+		/// number, and a RangeException if it does not fit.
+
+	Poco::UInt64 getUInt64() const;
+		/// Returns the value of an integer number.
+		///
+		/// Throws a BadCastException if the value is not an integer
+		/// number, and a RangeException if it is negative.
+
+	double getDouble() const;
+		/// Returns the value of a number.
+		///
+		/// Throws a BadCastException if the value is not a number.
+
+	std::string_view getString() const;
+		/// Returns the value of a string. The string is stored in
+		/// the Document, with escape sequences decoded.
+		///
+		/// Throws a BadCastException if the value is not a string.
+
+	std::size_t size() const;
+		/// Returns the number of elements of an array, or members
+		/// of an object. Returns zero for other values.
+
+	Node get(std::size_t index) const;
+		/// Returns the element of an array with the given index, or
+		/// an invalid Node if the value is not an array or the index
+		/// is out of range.
+
+	Node get(std::string_view key) const;
+		/// Returns the value of the member of an object with the given
+		/// key, or an invalid Node if the value is not an object or has
+		/// no such member.
+
+	Node operator [] (std::size_t index) const;
+		/// Same as get(index).
+
+	Node operator [] (std::string_view key) const;
+		/// Same as get(key).
+
+	bool has(std::string_view key) const;
+		/// Returns true if the value is an object with a member
+		/// with the given key.
+
+	std::string_view key(std::size_t index) const;
+		/// Returns the key of the member of an object with the given
+		/// index, in document order.
+		///
+		/// Throws a RangeException if the value is not an object
+		/// or the index is out of range.
+
+	Node at(std::size_t index) const;
+		/// Returns the element of an array, or the value of the member
+		/// of an object, with the given index, in document order.
+		///
+		/// Throws a RangeException if the value is not an array or
+		/// object, or the index is out of range.
+
+	Poco::Dynamic::Var toVar() const;
+		/// Returns a copy of the value, as an Object::Ptr, an Array::Ptr,
+		/// a scalar value, or an empty Var for null.
+
+	void stringify(std::ostream& out, unsigned int indent = 0, int step = -1, int options = Poco::JSON_WRAP_STRINGS) const;
+		/// Writes the value to the output stream in the same format
+		/// as Stringifier. Members of objects are written in document
+		/// order.
+
+	bool operator == (const Node& other) const;
+		/// Returns true if both Nodes refer to the same value.
+
+	bool operator != (const Node& other) const;
+		/// Returns true if the Nodes refer to different values.
+
+private:
+	struct Member;
+
+	struct Value
+	{
+		Type          type;
+		Poco::UInt32  size;    // length of a string, count of elements or members
+		union
+		{
+			bool          boolean;
+			Poco::Int64   integer;
+			Poco::UInt64  unsignedInteger;
+			double        number;
+			const char*   string;
+			const Value*  elements;
+			const Member* members; // followed by the sorted index for large objects
+		};
+	};
+
+	struct Member
+	{
+		const char*   key;
+		Poco::UInt32  keyLength;
+		Value         value;
+	};
+
+	explicit Node(const Value* pValue);
+
+	const Member* find(std::string_view key) const;
+	void stringify(std::ostream& out, std::string& buffer, unsigned int indent, unsigned int step, int options) const;
+
+	const Value* _pValue;
+
+	friend class Document;
+};
+
+
+//
+// inlines
+//
+inline Node::Node():
+	_pValue(0)
+{
+}
+
+
+inline Node::Node(const Value* pValue):
+	_pValue(pValue)
+{
+}
+
+
+inline bool Node::isValid() const
+{
+	return _pValue != 0;
+}
+
+
+inline Node::Type Node::type() const
+{
+	return _pValue ? _pValue->type : NODE_NULL;
+}
+
+
+inline bool Node::isNull() const
+{
+	return type() == NODE_NULL;
+}
+
+
+inline bool Node::isBoolean() const
+{
+	return type() == NODE_BOOLEAN;
+}
+
+
+inline bool Node::isNumber() const
+{
+	Type t = type();
+	return t == NODE_INTEGER || t == NODE_UNSIGNED || t == NODE_DOUBLE;
+}
+
+
+inline bool Node::isInteger() const
+{
+	Type t = type();
+	return t == NODE_INTEGER || t == NODE_UNSIGNED;
+}
+
+
+inline bool Node::isString() const
+{
+	return type() == NODE_STRING;
+}
+
+
+inline bool Node::isArray() const
+{
+	return type() == NODE_ARRAY;
+}
+
+
+inline bool Node::isObject() const
+{
+	return type() == NODE_OBJECT;
+}
+
+
+inline std::size_t Node::size() const
+{
+	Type t = type();
+	return (t == NODE_ARRAY || t == NODE_OBJECT) ? _pValue->size : 0;
+}
+
+
+inline Node Node::get(std::size_t index) const
+{
+	if (type() == NODE_ARRAY && index < _pValue->size)
+		return Node(&_pValue->elements[index]);
+	else
+		return Node();
+}
+
+
+inline Node Node::get(std::string_view key) const
+{
+	const Member* pMember = find(key);
+	return pMember ? Node(&pMember->value) : Node();
+}
+
+
+inline Node Node::operator [] (std::size_t index) const
+{
+	return get(index);
+}
+
+
+inline Node Node::operator [] (std::string_view key) const
+{
+	return get(key);
+}
+
+
+inline bool Node::has(std::string_view key) const
+{
+	return find(key) != 0;
+}
+
+
+inline bool Node::operator == (const Node& other) const
+{
+	return _pValue == other._pValue;
+}
+
+
+inline bool Node::operator != (const Node& other) const
+{
+	return _pValue != other._pValue;
+}
+
+
+} // namespace JSON
+
+
+namespace Dynamic {
+
+
+template <>
+class VarHolderImpl<JSON::Node>: public VarHolder
+{
+public:
+	VarHolderImpl(const JSON::Node& val): _val(val)
+	{
+	}
+
+	~VarHolderImpl()
+	{
+	}
+
+	const std::type_info& type() const
+	{
+		return typeid(JSON::Node);
+	}
+
+	void convert(bool& value) const
+	{
+		value = _val.size() > 0;
+	}
+
+	void convert(std::string& s) const
+	{
+		std::ostringstream oss;
+		_val.stringify(oss);
+		s = oss.str();
+	}
+
+	VarHolder* clone(Placeholder<VarHolder>* pVarHolder = 0) const
+	{
+		return cloneHolder(pVarHolder, _val);
+	}
+
+	const JSON::Node& value() const
+	{
+		return _val;
+	}
+
+	bool isArray() const
+	{
+		return false;
+	}
+
+	bool isInteger() const
+	{
+		return false;
+	}
+
+	bool isSigned() const
+	{
+		return false;
+	}
+
+	bool isNumeric() const
+	{
+		return false;
+	}
+
+	bool isString() const
+	{
+		return false;
+	}
+
+private:
+	JSON::Node _val;
+};
+
+
+} } // namespace Poco::Dynamic
+
+
+#endif // JSON_Node_INCLUDED
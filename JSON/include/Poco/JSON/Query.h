@@ -21,6 +21,7 @@
 #include "Poco/JSON/JSON.h"
 #include "Poco/JSON/Object.h"
 #include "Poco/JSON/Array.h"
+#include "Poco/JSON/Node.h"
 
 
 namespace Poco {
@@ -35,11 +36,16 @@ public:
 		/// Creates a Query.
 		///
 		/// Source must be JSON Object, Array, Object::Ptr,
-		/// Array::Ptr or empty Var. Any other type will trigger throwing of
+		/// Array::Ptr, Node or empty Var. Any other type will trigger throwing of
 		/// InvalidArgumentException.
 		///
 		/// Creating Query holding Ptr will typically result in faster
 		/// performance.
+		///
+		/// When searching a Node, objects and arrays are returned as
+		/// Node, and other values as their scalar value. findObject()
+		/// and findArray() return copies of the Node, created with
+		/// Node::toVar().
 
 	virtual ~Query();
 		/// Destroys the Query.
@@ -115,6 +121,8 @@ public:
 	}
 
 private:
+	static Dynamic::Var fromNode(const Node& node);
+
 	Dynamic::Var _source;
 };
 
@@ -0,0 +1,296 @@
+//
+// Reader.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Reader
+//
+// Definition of the Reader class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Reader_INCLUDED
+#define JSON_Reader_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Handler.h"
+#include "Poco/Dynamic/Var.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class JSON_API Reader
+	/// Reader is a pull parser for RFC 8259 compliant JSON in
+	/// a contiguous buffer.
+	///
+	/// Unlike Parser, which reports every value to a Handler and
+	/// builds a tree of Object and Array instances holding
+	/// Dynamic::Var values, the Reader returns one token at a time
+	/// and leaves it to the application what to do with it. Keys,
+	/// strings and numbers are returned as std::string_view pointing
+	/// into the buffer, so reading a document does not allocate memory.
+	/// Escape sequences in strings are only decoded if the application
+	/// asks for the string() value.
+	///
+	/// The buffer must remain valid, and unchanged, while the Reader
+	/// and the views it returns are in use.
+	///
+	/// Example:
+	///
+	///     Reader reader(json);
+	///     while (reader.next() != Reader::TOKEN_END)
+	///     {
+	///         if (reader.token() == Reader::TOKEN_KEY && reader.string() == "price")
+	///         {
+	///             reader.next();
+	///             total += reader.asDouble();
+	///         }
+	///     }
+	///
+	/// With read(), the next value is reported to a Handler, which
+	/// makes the Reader a drop-in replacement for Parser with
+	/// existing handlers:
+	///
+	///     Reader reader(json);
+	///     Dynamic::Var result = reader.parse(); // same as Parser().parse(json)
+	///
+	/// In in-situ mode, which requires a writable buffer, string()
+	/// decodes escape sequences in place, overwriting the buffer,
+	/// instead of copying the string.
+	///
+	/// The Reader only accepts a single JSON value (with any whitespace
+	/// around it) and throws a JSONException with the offset of the
+	/// error for syntax errors, including invalid UTF-8 sequences
+	/// in strings.
+{
+public:
+	enum Token
+	{
+		TOKEN_NONE,         /// next() has not been called yet
+		TOKEN_BEGIN_OBJECT, /// {
+		TOKEN_END_OBJECT,   /// }
+		TOKEN_BEGIN_ARRAY,  /// [
+		TOKEN_END_ARRAY,    /// ]
+		TOKEN_KEY,          /// the key of an object member
+		TOKEN_STRING,       /// a string value
+		TOKEN_NUMBER,       /// a number value
+		TOKEN_TRUE,         /// true
+		TOKEN_FALSE,        /// false
+		TOKEN_NULL,         /// null
+		TOKEN_END           /// the end of the document has been reached
+	};
+
+	static const std::size_t DEFAULT_MAX_DEPTH = 128;
+
+	Reader(const char* pData, std::size_t size);
+		/// Creates the Reader for the given buffer.
+
+	explicit Reader(std::string_view json);
+		/// Creates the Reader for the given JSON text.
+
+	Reader(char* pData, std::size_t size, bool inSitu);
+		/// Creates the Reader for the given buffer. If inSitu is true,
+		/// string() decodes escape sequences in place, modifying
+		/// the buffer.
+
+	~Reader();
+		/// Destroys the Reader.
+
+	Token next();
+		/// Reads the next token and returns it.
+		///
+		/// Returns TOKEN_END after the last token of the document,
+		/// and throws a JSONException if the document is not valid.
+
+	Token token() const;
+		/// Returns the current token.
+
+	std::string_view raw() const;
+		/// Returns the text of the current token, as it appears in
+		/// the document. For keys and strings, this is the content
+		/// between the quotes, with escape sequences not decoded
+		/// (unless they have been decoded in place by string()).
+
+	bool hasEscapes() const;
+		/// Returns true if the current key or string contains escape
+		/// sequences that have not been decoded yet, i.e. if raw()
+		/// and string() are different.
+
+	std::string_view string();
+		/// Returns the value of the current key or string, with escape
+		/// sequences decoded. The view points into the buffer if the
+		/// string contains no escape sequences or the Reader is in
+		/// in-situ mode, and into an internal buffer otherwise. Either
+		/// way, it is valid until next() is called.
+		///
+		/// For other tokens, returns raw().
+
+	bool isInteger() const;
+		/// Returns true if the current token is a number without
+		/// fraction and exponent.
+
+	Poco::Int64 asInt64() const;
+		/// Returns the value of the current number.
+		///
+		/// Throws a JSONException if the current token is not an
+		/// integer number, or if the value does not fit.
+
+	Poco::UInt64 asUInt64() const;
+		/// Returns the value of the current number.
+		///
+		/// Throws a JSONException if the current token is not a
+		/// non-negative integer number, or if the value does not fit.
+
+	double asDouble() const;
+		/// Returns the value of the current number.
+		///
+		/// Throws a JSONException if the current token is not a number,
+		/// or if the value is too large for a double.
+
+	bool asBool() const;
+		/// Returns the value of the current true or false token.
+		///
+		/// Throws a JSONException for other tokens.
+
+	void skip();
+		/// Skips the current value. If the current token begins an
+		/// object or array, the tokens up to the end of the object or
+		/// array are skipped. If the current token is a key, its value
+		/// is skipped.
+
+	void read(Handler& handler);
+		/// Reads the next value, including all nested values,
+		/// and reports it to the handler, like Parser does.
+		///
+		/// When called before the first call to next(), reads
+		/// the whole document.
+
+	Poco::Dynamic::Var parse();
+		/// Reads the next value with a ParseHandler and returns
+		/// the result, an Object, Array or scalar value.
+
+	std::size_t depth() const;
+		/// Returns the number of objects and arrays enclosing
+		/// the current position.
+
+	std::size_t offset() const;
+		/// Returns the offset of the current token in the buffer.
+
+	void setMaxDepth(std::size_t depth);
+		/// Sets the maximum nesting depth of objects and arrays.
+		/// Defaults to DEFAULT_MAX_DEPTH.
+
+	std::size_t getMaxDepth() const;
+		/// Returns the maximum nesting depth of objects and arrays.
+
+private:
+	Reader(const Reader&);
+	Reader& operator = (const Reader&);
+
+	enum State
+	{
+		ST_START,        // expecting the value of the document
+		ST_DONE,         // the value of the document has been read
+		ST_ARRAY_FIRST,  // after [, expecting a value or ]
+		ST_ARRAY_NEXT,   // after a value in an array, expecting , or ]
+		ST_OBJECT_FIRST, // after {, expecting a key or }
+		ST_OBJECT_VALUE, // after a key, expecting : and a value
+		ST_OBJECT_NEXT   // after a value in an object, expecting , or }
+	};
+
+	Token readValue();
+	Token readKey();
+	Token beginContainer(char c, Token token, State state);
+	Token endContainer(char c);
+	Token readLiteral(const char* literal, std::size_t length, Token token);
+	void scanString();
+	void scanNumber();
+	void skipWhitespace();
+	void checkValueEnd();
+	void afterValue();
+	void reportNumber(Handler& handler) const;
+	[[noreturn]] void error(const std::string& message) const;
+	[[noreturn]] void error(const std::string& message, const char* pPos) const;
+
+	const char*       _pBegin;
+	const char*       _pEnd;
+	const char*       _pCur;
+	char*             _pInSitu;
+	const char*       _pToken;
+	std::string_view  _raw;
+	Token             _token;
+	State             _state;
+	bool              _hasEscapes;
+	bool              _isInteger;
+	std::vector<char> _stack;
+	std::size_t       _maxDepth;
+	std::string       _buffer;
+};
+
+
+//
+// inlines
+//
+inline Reader::Token Reader::token() const
+{
+	return _token;
+}
+
+
+inline std::string_view Reader::raw() const
+{
+	return _raw;
+}
+
+
+inline bool Reader::hasEscapes() const
+{
+	return _hasEscapes;
+}
+
+
+inline bool Reader::isInteger() const
+{
+	return _token == TOKEN_NUMBER && _isInteger;
+}
+
+
+inline std::size_t Reader::depth() const
+{
+	return _stack.size();
+}
+
+
+inline std::size_t Reader::offset() const
+{
+	return _pToken - _pBegin;
+}
+
+
+inline void Reader::setMaxDepth(std::size_t depth)
+{
+	_maxDepth = depth;
+}
+
+
+inline std::size_t Reader::getMaxDepth() const
+{
+	return _maxDepth;
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_Reader_INCLUDED
@@ -23,17 +23,15 @@
 #include "Poco/SharedPtr.h"
 #include "Poco/Path.h"
 #include "Poco/Timestamp.h"
+#include "Poco/Buffer.h"
 #include <sstream>
-#include <stack>
+#include <vector>
 
 
 namespace Poco {
 namespace JSON {
 
 
-class MultiPart;
-
-
 POCO_DECLARE_EXCEPTION(JSON_API, JSONTemplateException, Poco::Exception)
 
 
@@ -84,7 +82,14 @@ class JSON_API Template
 	/// file doesn't exist, it can still be found when the JSONTemplateCache
 	/// is used.
 	///
-	///  A query is passed to Poco::JSON::Query to get the value.
+	///  A query has the same syntax as for Poco::JSON::Query.
+	///
+	/// The template is compiled into a flat list of instructions when
+	/// it is parsed, with every query split into its names and array
+	/// indexes, so rendering does not need to parse queries. Rendering
+	/// does not modify the template or the data (loop variables are
+	/// kept by the renderer), so a parsed template can be rendered by
+	/// multiple threads at the same time.
 {
 public:
 	using Ptr = SharedPtr<Template>;
@@ -113,7 +118,49 @@ public:
 	void render(const Dynamic::Var& data, std::ostream& out) const;
 		/// Renders the template and send the output to the stream.
 
+	void render(const Dynamic::Var& data, Poco::Buffer<char>& out) const;
+		/// Renders the template and appends the output to the buffer.
+
 private:
+	struct Step
+		/// A name in a compiled query, with the array
+		/// indexes following it, e.g. children[0].
+	{
+		std::string      name;
+		std::vector<int> indexes;
+	};
+
+	using CompiledQuery = std::vector<Step>;
+
+	enum Opcode
+	{
+		OP_TEXT,    // writes _strings[operand]
+		OP_ECHO,    // writes the value of _queries[operand]
+		OP_IF,      // jumps to target if the value of _queries[operand] is false
+		OP_IFEXIST, // jumps to target if _queries[operand] has no value
+		OP_JUMP,    // jumps to target
+		OP_FOR,     // loops over the array _queries[operand], or jumps to target if it is empty
+		OP_ENDFOR,  // continues the loop started by the OP_FOR at target
+		OP_INCLUDE  // renders the template _includes[operand]
+	};
+
+	struct Instruction
+	{
+		Opcode      opcode;
+		std::size_t operand;
+		std::size_t variable; // OP_FOR: the loop variable in _strings
+		std::size_t target;
+	};
+
+	class Context;
+
+	void render(Context& context) const;
+	Dynamic::Var find(const CompiledQuery& query, const Context& context) const;
+	bool isTrue(const CompiledQuery& query, const Context& context) const;
+	std::size_t emit(Opcode opcode, std::size_t operand = 0);
+	std::size_t addString(const std::string& str);
+	std::size_t addQuery(const std::string& query);
+
 	std::string readText(std::istream& in);
 	std::string readWord(std::istream& in);
 	std::string readQuery(std::istream& in);
@@ -121,9 +168,10 @@ private:
 	std::string readString(std::istream& in);
 	void readWhiteSpace(std::istream& in);
 
-	MultiPart* _parts;
-	std::stack<MultiPart*> _partStack;
-	MultiPart* _currentPart;
+	std::vector<Instruction>   _program;
+	std::vector<std::string>   _strings;
+	std::vector<CompiledQuery> _queries;
+	std::vector<Path>          _includes;
 	Path _templatePath;
 	Timestamp _parseTime;
 };
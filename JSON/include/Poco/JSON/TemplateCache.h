@@ -23,6 +23,10 @@
 #include "Poco/Path.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/Logger.h"
+#include "Poco/Mutex.h"
+#ifndef POCO_NO_INOTIFY
+#include "Poco/DirectoryWatcher.h"
+#endif
 #include <vector>
 #include <map>
 
@@ -37,9 +41,20 @@ class JSON_API TemplateCache
 	/// When a template file has changed, the cache
 	/// will remove the old template from the cache
 	/// and load a new one.
+	///
+	/// Changes are detected with a DirectoryWatcher for every
+	/// directory containing a cached template and every include
+	/// path, so a lookup of a cached template does not access the
+	/// file system. Depending on the platform, the DirectoryWatcher
+	/// may report changes with a delay of a few seconds. If watching
+	/// is disabled, not supported (POCO_NO_INOTIFY), or fails for a
+	/// directory, the modification time of the template file is
+	/// checked on every lookup instead.
+	///
+	/// The cache can be used by multiple threads.
 {
 public:
-	TemplateCache();
+	explicit TemplateCache(bool watchChanges = true);
 		/// Creates an empty TemplateCache.
 		///
 		/// The cache must be created and not destroyed
@@ -67,26 +82,41 @@ public:
 	void setLogger(Logger& logger);
 		/// Sets the logger for the cache.
 
+	bool isWatchingChanges() const;
+		/// Returns true if changes are detected with a DirectoryWatcher.
+
 private:
+	struct Entry
+	{
+		Template::Ptr pTemplate;
+		bool          watched;
+	};
+
 	void setup();
 	Path resolvePath(const Path& path) const;
+	Template::Ptr loadTemplate(const Path& templatePath);
+	bool watch(const Path& directory);
+#ifndef POCO_NO_INOTIFY
+	void onItemChanged(const void* pSender, const DirectoryWatcher::DirectoryEvent& event);
+#endif
 
 	static TemplateCache*                _pInstance;
 	std::vector<Path>                    _includePaths;
-	std::map<std::string, Template::Ptr> _cache;
+	bool                                 _includePathsWatched;
+	std::map<std::string, Entry>         _cache;
+	std::map<std::string, std::string>   _resolvedPaths;
+#ifndef POCO_NO_INOTIFY
+	std::map<std::string, SharedPtr<DirectoryWatcher>> _watchers;
+#endif
+	bool                                 _watchChanges;
 	Logger*                              _pLogger;
+	FastMutex                            _mutex;
 };
 
 
 //
 // inlines
 //
-inline void TemplateCache::addPath(const Path& path)
-{
-	_includePaths.push_back(path);
-}
-
-
 inline TemplateCache* TemplateCache::instance()
 {
 	return _pInstance;
@@ -99,6 +129,12 @@ inline void TemplateCache::setLogger(Logger& logger)
 }
 
 
+inline bool TemplateCache::isWatchingChanges() const
+{
+	return _watchChanges;
+}
+
+
 } } // namespace Poco::JSON
 
 
@@ -0,0 +1,406 @@
+//
+// TypeMapping.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  TypeMapping
+//
+// Definition of the TypeMapping class template.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_TypeMapping_INCLUDED
+#define JSON_TypeMapping_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Writer.h"
+#include "Poco/JSON/Reader.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/Buffer.h"
+#include "Poco/Nullable.h"
+#include "Poco/Format.h"
+#include <limits>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace Poco {
+namespace JSON {
+
+
+template <class T, class Enable = void>
+class TypeMapping
+	/// TypeMapping converts values of a C++ type directly to and from
+	/// JSON text, without going through Object, Array and Dynamic::Var.
+	///
+	/// Every specialization provides the static functions
+	///
+	///     static void write(Writer& writer, const T& value);
+	///     static void read(Reader& reader, T& value);
+	///
+	/// write() writes the value with the Writer. read() is called with
+	/// the Reader positioned on the first token of the value, and must
+	/// consume the value up to its last token.
+	///
+	/// Specializations are provided for bool, integer and floating point
+	/// types, std::string, std::vector, std::map with std::string keys
+	/// and Poco::Nullable. Structs and classes with public members are
+	/// mapped to JSON objects with the POCO_JSON_MAPPING macros:
+	///
+	///     struct Person
+	///     {
+	///         std::string name;
+	///         int age = 0;
+	///         std::vector<std::string> children;
+	///     };
+	///
+	///     POCO_JSON_MAPPING_BEGIN(Person)
+	///         POCO_JSON_MAPPING_MEMBER(name)
+	///         POCO_JSON_MAPPING_MEMBER(age)
+	///         POCO_JSON_MAPPING_MEMBER_NAMED("kids", children)
+	///     POCO_JSON_MAPPING_END
+	///
+	/// The macros must be used in the global namespace. For other types,
+	/// specialize TypeMapping in the Poco::JSON namespace.
+	///
+	/// The mapped values are then written and read with serialize()
+	/// and deserialize():
+	///
+	///     Poco::Buffer<char> buffer(0);
+	///     Poco::JSON::serialize(person, buffer);
+	///     Poco::JSON::deserialize(std::string_view(buffer.begin(), buffer.size()), person);
+	///
+	/// When reading an object, members that are not mapped are skipped,
+	/// and mapped members missing from the object keep their value.
+	/// A JSONException is thrown if a value does not have the expected
+	/// type or is out of range.
+{
+public:
+	static_assert(sizeof(T) == 0, "No TypeMapping for this type; see POCO_JSON_MAPPING_BEGIN");
+};
+
+
+template <>
+class TypeMapping<bool>
+{
+public:
+	static void write(Writer& writer, bool value)
+	{
+		writer.value(value);
+	}
+
+	static void read(Reader& reader, bool& value)
+	{
+		value = reader.asBool();
+	}
+};
+
+
+template <class T>
+class TypeMapping<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+public:
+	static void write(Writer& writer, T value)
+	{
+		writer.value(value);
+	}
+
+	static void read(Reader& reader, T& value)
+	{
+		if constexpr (std::is_signed<T>::value)
+		{
+			Poco::Int64 v = reader.asInt64();
+			if (v < static_cast<Poco::Int64>(std::numeric_limits<T>::min()) || v > static_cast<Poco::Int64>(std::numeric_limits<T>::max()))
+				throw JSONException(Poco::format("Value out of range at offset %z", reader.offset()));
+			value = static_cast<T>(v);
+		}
+		else
+		{
+			Poco::UInt64 v = reader.asUInt64();
+			if (v > static_cast<Poco::UInt64>(std::numeric_limits<T>::max()))
+				throw JSONException(Poco::format("Value out of range at offset %z", reader.offset()));
+			value = static_cast<T>(v);
+		}
+	}
+};
+
+
+template <class T>
+class TypeMapping<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+public:
+	static void write(Writer& writer, T value)
+	{
+		if constexpr (std::is_same<T, float>::value)
+			writer.value(static_cast<float>(value));
+		else
+			writer.value(static_cast<double>(value));
+	}
+
+	static void read(Reader& reader, T& value)
+	{
+		value = static_cast<T>(reader.asDouble());
+	}
+};
+
+
+template <>
+class TypeMapping<std::string>
+{
+public:
+	static void write(Writer& writer, const std::string& value)
+	{
+		writer.value(std::string_view(value));
+	}
+
+	static void read(Reader& reader, std::string& value)
+	{
+		if (reader.token() != Reader::TOKEN_STRING)
+			throw JSONException(Poco::format("String expected at offset %z", reader.offset()));
+		std::string_view str = reader.string();
+		value.assign(str.data(), str.size());
+	}
+};
+
+
+template <class T>
+class TypeMapping<std::vector<T>>
+{
+public:
+	static void write(Writer& writer, const std::vector<T>& value)
+	{
+		writer.startArray();
+		for (typename std::vector<T>::const_iterator it = value.begin(); it != value.end(); ++it)
+		{
+			TypeMapping<T>::write(writer, *it);
+		}
+		writer.endArray();
+	}
+
+	static void read(Reader& reader, std::vector<T>& value)
+	{
+		if (reader.token() != Reader::TOKEN_BEGIN_ARRAY)
+			throw JSONException(Poco::format("Array expected at offset %z", reader.offset()));
+		value.clear();
+		while (reader.next() != Reader::TOKEN_END_ARRAY)
+		{
+			T element = T();
+			TypeMapping<T>::read(reader, element);
+			value.push_back(std::move(element));
+		}
+	}
+};
+
+
+template <class T>
+class TypeMapping<std::map<std::string, T>>
+{
+public:
+	static void write(Writer& writer, const std::map<std::string, T>& value)
+	{
+		writer.startObject();
+		for (typename std::map<std::string, T>::const_iterator it = value.begin(); it != value.end(); ++it)
+		{
+			writer.key(it->first);
+			TypeMapping<T>::write(writer, it->second);
+		}
+		writer.endObject();
+	}
+
+	static void read(Reader& reader, std::map<std::string, T>& value)
+	{
+		if (reader.token() != Reader::TOKEN_BEGIN_OBJECT)
+			throw JSONException(Poco::format("Object expected at offset %z", reader.offset()));
+		value.clear();
+		while (reader.next() == Reader::TOKEN_KEY)
+		{
+			std::string_view key = reader.string();
+			T& element = value[std::string(key.data(), key.size())];
+			reader.next();
+			TypeMapping<T>::read(reader, element);
+		}
+	}
+};
+
+
+template <class T>
+class TypeMapping<Poco::Nullable<T>>
+{
+public:
+	static void write(Writer& writer, const Poco::Nullable<T>& value)
+	{
+		if (value.isNull())
+			writer.null();
+		else
+			TypeMapping<T>::write(writer, value.value());
+	}
+
+	static void read(Reader& reader, Poco::Nullable<T>& value)
+	{
+		if (reader.token() == Reader::TOKEN_NULL)
+		{
+			value.clear();
+		}
+		else
+		{
+			T v = T();
+			TypeMapping<T>::read(reader, v);
+			value = std::move(v);
+		}
+	}
+};
+
+
+template <class M, class T>
+class StructMapping
+	/// The base class of the TypeMapping specializations created by
+	/// the POCO_JSON_MAPPING macros. M::visit() calls a visitor with
+	/// the name and a reference of every mapped member.
+{
+public:
+	static void write(Writer& writer, const T& value)
+	{
+		MemberWriter memberWriter(writer);
+		writer.startObject();
+		M::visit(memberWriter, value);
+		writer.endObject();
+	}
+
+	static void read(Reader& reader, T& value)
+	{
+		if (reader.token() != Reader::TOKEN_BEGIN_OBJECT)
+			throw JSONException(Poco::format("Object expected at offset %z", reader.offset()));
+		while (reader.next() == Reader::TOKEN_KEY)
+		{
+			MemberReader memberReader(reader, reader.string());
+			M::visit(memberReader, value);
+			if (!memberReader.found()) reader.skip();
+		}
+	}
+
+private:
+	class MemberWriter
+	{
+	public:
+		explicit MemberWriter(Writer& writer): _writer(writer)
+		{
+		}
+
+		template <class V>
+		void operator () (const char* name, const V& value)
+		{
+			_writer.key(name);
+			TypeMapping<V>::write(_writer, value);
+		}
+
+	private:
+		Writer& _writer;
+	};
+
+	class MemberReader
+	{
+	public:
+		MemberReader(Reader& reader, std::string_view key): _reader(reader), _key(key), _found(false)
+		{
+		}
+
+		template <class V>
+		void operator () (const char* name, V& value)
+		{
+			if (!_found && _key == name)
+			{
+				_found = true;
+				_reader.next();
+				TypeMapping<V>::read(_reader, value);
+			}
+		}
+
+		bool found() const
+		{
+			return _found;
+		}
+
+	private:
+		Reader&          _reader;
+		std::string_view _key;
+		bool             _found;
+	};
+};
+
+
+template <class T>
+void serialize(const T& value, Writer& writer)
+	/// Writes the value with the given Writer.
+{
+	TypeMapping<T>::write(writer, value);
+}
+
+
+template <class T>
+void serialize(const T& value, Poco::Buffer<char>& buffer, int options = 0)
+	/// Appends the value, as JSON text, to the given buffer.
+{
+	Writer writer(buffer, options);
+	TypeMapping<T>::write(writer, value);
+}
+
+
+template <class T>
+void deserialize(Reader& reader, T& value)
+	/// Reads the next value from the Reader into value.
+{
+	reader.next();
+	TypeMapping<T>::read(reader, value);
+}
+
+
+template <class T>
+void deserialize(std::string_view json, T& value)
+	/// Reads the JSON text, which must contain a single value, into value.
+{
+	Reader reader(json);
+	reader.next();
+	TypeMapping<T>::read(reader, value);
+	reader.next(); // throws if there is more than one value
+}
+
+
+} } // namespace Poco::JSON
+
+
+#define POCO_JSON_MAPPING_BEGIN(type) \
+	namespace Poco { \
+	namespace JSON { \
+	template <> \
+	class TypeMapping<type>: public StructMapping<TypeMapping<type>, type> \
+	{ \
+	public: \
+		template <class Visitor, class Struct> \
+		static void visit(Visitor& visitor, Struct& object) \
+		{
+
+
+#define POCO_JSON_MAPPING_MEMBER(member) \
+			visitor(#member, object.member);
+
+
+#define POCO_JSON_MAPPING_MEMBER_NAMED(name, member) \
+			visitor(name, object.member);
+
+
+#define POCO_JSON_MAPPING_END \
+		} \
+	}; \
+	} }
+
+
+#endif // JSON_TypeMapping_INCLUDED
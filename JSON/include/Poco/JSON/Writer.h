@@ -0,0 +1,269 @@
+//
+// Writer.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Writer
+//
+// Definition of the Writer class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Writer_INCLUDED
+#define JSON_Writer_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/Buffer.h"
+#include "Poco/NumericString.h"
+#include "Poco/JSONString.h"
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <cstring>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class JSON_API Writer
+	/// Writer appends JSON text directly to a Poco::Buffer<char>.
+	///
+	/// The Writer has the same events as Handler, but as non-virtual
+	/// functions, and formats values without going through
+	/// Dynamic::Var or std::ostream: numbers are formatted with the
+	/// functions in NumericString.h, and strings are only escaped if
+	/// they contain characters that must be escaped. The buffer grows
+	/// geometrically, so a buffer that is reused for many documents
+	/// quickly stops allocating memory.
+	///
+	/// Commas and colons are inserted automatically. The output is
+	/// always condensed. It is up to the caller to produce a well-formed
+	/// document, i.e. to balance startObject() and endObject() and
+	/// to call key() before every value in an object.
+	///
+	/// Example:
+	///
+	///     Poco::Buffer<char> buffer(0);
+	///     Writer writer(buffer);
+	///     writer.startObject();
+	///     writer.key("name");
+	///     writer.value("Franky");
+	///     writer.key("children");
+	///     writer.startArray();
+	///     writer.value("Jonas");
+	///     writer.value("Ellen");
+	///     writer.endArray();
+	///     writer.endObject();
+	///
+	/// See TypeMapping.h for writing C++ types with a single call.
+{
+public:
+	explicit Writer(Poco::Buffer<char>& buffer, int options = 0);
+		/// Creates the Writer, which appends to the given buffer.
+		///
+		/// The options are the same as for Stringifier;
+		/// JSON_WRAP_STRINGS is always set.
+
+	~Writer();
+		/// Destroys the Writer.
+
+	void startObject();
+		/// Writes a {.
+
+	void endObject();
+		/// Writes a }.
+
+	void startArray();
+		/// Writes a [.
+
+	void endArray();
+		/// Writes a ].
+
+	void key(std::string_view k);
+		/// Writes the key of an object member, followed by a colon.
+
+	void null();
+		/// Writes null.
+
+	void value(bool b);
+		/// Writes true or false.
+
+	template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+	void value(T v)
+		/// Writes an integer number.
+	{
+		char buffer[POCO_MAX_INT_STRING_LEN];
+		std::size_t size = sizeof(buffer);
+		intToStr(v, 10, buffer, size);
+		separate();
+		write(buffer, size);
+	}
+
+	void value(float f);
+		/// Writes a number, or null if the value is
+		/// infinite or not a number.
+
+	void value(double d);
+		/// Writes a number, or null if the value is
+		/// infinite or not a number.
+
+	void value(std::string_view s);
+		/// Writes a string.
+
+	void value(const char* s);
+		/// Writes a string.
+
+	void raw(std::string_view json);
+		/// Writes the given JSON text, which must be a single
+		/// valid JSON value, without changing it.
+
+	Poco::Buffer<char>& buffer();
+		/// Returns the buffer.
+
+	int options() const;
+		/// Returns the options.
+
+private:
+	Writer(const Writer&);
+	Writer& operator = (const Writer&);
+
+	void separate();
+	void put(char c);
+	void write(const char* pData, std::size_t size);
+	void writeString(std::string_view s);
+	void grow(std::size_t size);
+
+	Poco::Buffer<char>& _buffer;
+	int                 _options;
+	bool                _separate;
+	std::string         _escaped;
+};
+
+
+//
+// inlines
+//
+inline void Writer::separate()
+{
+	if (_separate) put(',');
+	_separate = true;
+}
+
+
+inline void Writer::put(char c)
+{
+	std::size_t size = _buffer.size();
+	if (size == _buffer.capacity()) grow(size + 1);
+	_buffer.resize(size + 1);
+	_buffer[size] = c;
+}
+
+
+inline void Writer::write(const char* pData, std::size_t size)
+{
+	std::size_t used = _buffer.size();
+	if (used + size > _buffer.capacity()) grow(used + size);
+	_buffer.resize(used + size);
+	std::memcpy(_buffer.begin() + used, pData, size);
+}
+
+
+inline void Writer::startObject()
+{
+	separate();
+	put('{');
+	_separate = false;
+}
+
+
+inline void Writer::endObject()
+{
+	put('}');
+	_separate = true;
+}
+
+
+inline void Writer::startArray()
+{
+	separate();
+	put('[');
+	_separate = false;
+}
+
+
+inline void Writer::endArray()
+{
+	put(']');
+	_separate = true;
+}
+
+
+inline void Writer::key(std::string_view k)
+{
+	separate();
+	writeString(k);
+	put(':');
+	_separate = false;
+}
+
+
+inline void Writer::null()
+{
+	separate();
+	write("null", 4);
+}
+
+
+inline void Writer::value(bool b)
+{
+	separate();
+	if (b)
+		write("true", 4);
+	else
+		write("false", 5);
+}
+
+
+inline void Writer::value(std::string_view s)
+{
+	separate();
+	writeString(s);
+}
+
+
+inline void Writer::value(const char* s)
+{
+	value(std::string_view(s));
+}
+
+
+inline void Writer::raw(std::string_view json)
+{
+	separate();
+	write(json.data(), json.size());
+}
+
+
+inline Poco::Buffer<char>& Writer::buffer()
+{
+	return _buffer;
+}
+
+
+inline int Writer::options() const
+{
+	return _options;
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_Writer_INCLUDED
@@ -0,0 +1,333 @@
+//
+// Document.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Document.h"
+#include "Poco/JSON/Reader.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/StreamCopier.h"
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+
+namespace
+{
+	const std::size_t ALIGNMENT = alignof(Poco::UInt64) > alignof(double) ? alignof(Poco::UInt64) : alignof(double);
+
+
+	inline std::size_t alignSize(std::size_t size)
+	{
+		return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+}
+
+
+namespace Poco {
+namespace JSON {
+
+
+Document::Document():
+	_pCur(0),
+	_pEnd(0),
+	_arenaSize(0),
+	_nextBlockSize(MIN_BLOCK_SIZE),
+	_pRoot(0),
+	_maxDepth(Reader::DEFAULT_MAX_DEPTH)
+{
+}
+
+
+Document::Document(std::string_view json):
+	_pCur(0),
+	_pEnd(0),
+	_arenaSize(0),
+	_nextBlockSize(MIN_BLOCK_SIZE),
+	_pRoot(0),
+	_maxDepth(Reader::DEFAULT_MAX_DEPTH)
+{
+	parse(json);
+}
+
+
+Document::Document(Document&& other) noexcept:
+	_blocks(std::move(other._blocks)),
+	_pCur(other._pCur),
+	_pEnd(other._pEnd),
+	_arenaSize(other._arenaSize),
+	_nextBlockSize(other._nextBlockSize),
+	_pRoot(other._pRoot),
+	_maxDepth(other._maxDepth)
+{
+	other._blocks.clear();
+	other._pCur = 0;
+	other._pEnd = 0;
+	other._arenaSize = 0;
+	other._nextBlockSize = MIN_BLOCK_SIZE;
+	other._pRoot = 0;
+}
+
+
+Document::~Document()
+{
+	clear();
+}
+
+
+Document& Document::operator = (Document&& other) noexcept
+{
+	if (&other != this)
+	{
+		clear();
+		_blocks.swap(other._blocks);
+		std::swap(_pCur, other._pCur);
+		std::swap(_pEnd, other._pEnd);
+		std::swap(_arenaSize, other._arenaSize);
+		std::swap(_nextBlockSize, other._nextBlockSize);
+		std::swap(_pRoot, other._pRoot);
+		_maxDepth = other._maxDepth;
+	}
+	return *this;
+}
+
+
+void Document::parse(std::string_view json)
+{
+	clear();
+
+	// Size the first block in proportion to the text; if it is too
+	// small, the following blocks double in size, so even documents
+	// with many small values only need a few blocks.
+	std::size_t blockSize = alignSize(json.size()*2);
+	reserve(blockSize > MIN_BLOCK_SIZE ? blockSize : MIN_BLOCK_SIZE);
+
+	try
+	{
+		Reader reader(json);
+		reader.setMaxDepth(_maxDepth);
+		build(reader);
+	}
+	catch (...)
+	{
+		_values.clear();
+		_members.clear();
+		_frames.clear();
+		clear();
+		throw;
+	}
+}
+
+
+void Document::parse(std::istream& in)
+{
+	std::string json;
+	Poco::StreamCopier::copyToString(in, json);
+	parse(json);
+}
+
+
+void Document::clear()
+{
+	for (std::vector<char*>::iterator it = _blocks.begin(); it != _blocks.end(); ++it)
+	{
+		delete [] *it;
+	}
+	_blocks.clear();
+	_pCur = 0;
+	_pEnd = 0;
+	_arenaSize = 0;
+	_nextBlockSize = MIN_BLOCK_SIZE;
+	_pRoot = 0;
+}
+
+
+void Document::build(Reader& reader)
+{
+	_pRoot = static_cast<Node::Value*>(allocate(sizeof(Node::Value)));
+	_pRoot->type = Node::NODE_NULL;
+	_pRoot->size = 0;
+	_pRoot->integer = 0;
+
+	Node::Value value;
+	Reader::Token token;
+	while ((token = reader.next()) != Reader::TOKEN_END)
+	{
+		value.size = 0;
+		switch (token)
+		{
+		case Reader::TOKEN_BEGIN_OBJECT:
+		case Reader::TOKEN_BEGIN_ARRAY:
+			{
+				Frame frame;
+				frame.isObject = (token == Reader::TOKEN_BEGIN_OBJECT);
+				frame.start = frame.isObject ? _members.size() : _values.size();
+				_frames.push_back(frame);
+			}
+			continue;
+		case Reader::TOKEN_END_OBJECT:
+		case Reader::TOKEN_END_ARRAY:
+			endContainer();
+			continue;
+		case Reader::TOKEN_KEY:
+			{
+				std::string_view key = reader.string();
+				Node::Member member;
+				member.key = copyString(key);
+				member.keyLength = static_cast<Poco::UInt32>(key.size());
+				member.value.type = Node::NODE_NULL;
+				member.value.size = 0;
+				member.value.integer = 0;
+				_members.push_back(member);
+			}
+			continue;
+		case Reader::TOKEN_STRING:
+			{
+				std::string_view str = reader.string();
+				value.type = Node::NODE_STRING;
+				value.size = static_cast<Poco::UInt32>(str.size());
+				value.string = copyString(str);
+			}
+			break;
+		case Reader::TOKEN_NUMBER:
+			if (!reader.isInteger())
+			{
+				value.type = Node::NODE_DOUBLE;
+				value.number = reader.asDouble();
+			}
+			else if (reader.raw()[0] == '-')
+			{
+				value.type = Node::NODE_INTEGER;
+				value.integer = reader.asInt64();
+			}
+			else
+			{
+				value.unsignedInteger = reader.asUInt64();
+				value.type = value.unsignedInteger <= static_cast<Poco::UInt64>(std::numeric_limits<Poco::Int64>::max()) ? Node::NODE_INTEGER : Node::NODE_UNSIGNED;
+			}
+			break;
+		case Reader::TOKEN_TRUE:
+		case Reader::TOKEN_FALSE:
+			value.type = Node::NODE_BOOLEAN;
+			value.boolean = (token == Reader::TOKEN_TRUE);
+			break;
+		default:
+			value.type = Node::NODE_NULL;
+			value.integer = 0;
+			break;
+		}
+		addValue(value);
+	}
+}
+
+
+void Document::addValue(const Node::Value& value)
+{
+	if (_frames.empty())
+		*_pRoot = value;
+	else if (_frames.back().isObject)
+		_members.back().value = value;
+	else
+		_values.push_back(value);
+}
+
+
+void Document::endContainer()
+{
+	Frame frame = _frames.back();
+	_frames.pop_back();
+
+	Node::Value value;
+	if (frame.isObject)
+	{
+		std::size_t count = _members.size() - frame.start;
+		if (count > std::numeric_limits<Poco::UInt32>::max()) throw JSONException("Object too large");
+
+		std::size_t size = count*sizeof(Node::Member);
+		if (count > Node::LINEAR_LOOKUP_LIMIT) size += count*sizeof(Poco::UInt32);
+		Node::Member* pMembers = count ? static_cast<Node::Member*>(allocate(size)) : 0;
+		if (count) std::memcpy(pMembers, &_members[frame.start], count*sizeof(Node::Member));
+		if (count > Node::LINEAR_LOOKUP_LIMIT)
+		{
+			// Sort the positions of the members by key, and equal keys
+			// by position, so the lookup can find the last member with
+			// a given key.
+			Poco::UInt32* pIndex = reinterpret_cast<Poco::UInt32*>(pMembers + count);
+			for (Poco::UInt32 i = 0; i < count; ++i) pIndex[i] = i;
+			std::sort(pIndex, pIndex + count, [pMembers](Poco::UInt32 a, Poco::UInt32 b)
+			{
+				std::string_view keyA(pMembers[a].key, pMembers[a].keyLength);
+				std::string_view keyB(pMembers[b].key, pMembers[b].keyLength);
+				int cmp = keyA.compare(keyB);
+				return cmp < 0 || (cmp == 0 && a < b);
+			});
+		}
+		_members.resize(frame.start);
+
+		value.type = Node::NODE_OBJECT;
+		value.size = static_cast<Poco::UInt32>(count);
+		value.members = pMembers;
+	}
+	else
+	{
+		std::size_t count = _values.size() - frame.start;
+		if (count > std::numeric_limits<Poco::UInt32>::max()) throw JSONException("Array too large");
+
+		Node::Value* pElements = count ? static_cast<Node::Value*>(allocate(count*sizeof(Node::Value))) : 0;
+		if (count) std::memcpy(pElements, &_values[frame.start], count*sizeof(Node::Value));
+		_values.resize(frame.start);
+
+		value.type = Node::NODE_ARRAY;
+		value.size = static_cast<Poco::UInt32>(count);
+		value.elements = pElements;
+	}
+	addValue(value);
+}
+
+
+const char* Document::copyString(std::string_view str)
+{
+	char* p = static_cast<char*>(allocate(str.size() + 1));
+	std::memcpy(p, str.data(), str.size());
+	p[str.size()] = 0;
+	return p;
+}
+
+
+void* Document::allocate(std::size_t size)
+{
+	size = alignSize(size);
+	if (static_cast<std::size_t>(_pEnd - _pCur) < size)
+	{
+		reserve(std::max(size, _nextBlockSize));
+	}
+	void* p = _pCur;
+	_pCur += size;
+	return p;
+}
+
+
+void Document::reserve(std::size_t size)
+{
+	// operator new[] returns memory suitably aligned for any
+	// fundamental type, and all allocations are multiples of
+	// ALIGNMENT, so every allocation in the block is aligned.
+	char* pBlock = new char[size];
+	_blocks.push_back(pBlock);
+	_pCur = pBlock;
+	_pEnd = pBlock + size;
+	_arenaSize += size;
+	_nextBlockSize = std::max(_nextBlockSize, size*2);
+}
+
+
+} } // namespace Poco::JSON
@@ -0,0 +1,267 @@
+//
+// Node.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Node.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+
+namespace Poco {
+namespace JSON {
+
+
+bool Node::getBool() const
+{
+	if (type() != NODE_BOOLEAN) throw BadCastException("Node is not a boolean");
+	return _pValue->boolean;
+}
+
+
+Poco::Int64 Node::getInt64() const
+{
+	switch (type())
+	{
+	case NODE_INTEGER:
+		return _pValue->integer;
+	case NODE_UNSIGNED:
+		throw RangeException("Value too large for Int64");
+	default:
+		throw BadCastException("Node is not an integer number");
+	}
+}
+
+
+Poco::UInt64 Node::getUInt64() const
+{
+	switch (type())
+	{
+	case NODE_INTEGER:
+		if (_pValue->integer < 0) throw RangeException("Negative value for UInt64");
+		return static_cast<Poco::UInt64>(_pValue->integer);
+	case NODE_UNSIGNED:
+		return _pValue->unsignedInteger;
+	default:
+		throw BadCastException("Node is not an integer number");
+	}
+}
+
+
+double Node::getDouble() const
+{
+	switch (type())
+	{
+	case NODE_INTEGER:
+		return static_cast<double>(_pValue->integer);
+	case NODE_UNSIGNED:
+		return static_cast<double>(_pValue->unsignedInteger);
+	case NODE_DOUBLE:
+		return _pValue->number;
+	default:
+		throw BadCastException("Node is not a number");
+	}
+}
+
+
+std::string_view Node::getString() const
+{
+	if (type() != NODE_STRING) throw BadCastException("Node is not a string");
+	return std::string_view(_pValue->string, _pValue->size);
+}
+
+
+std::string_view Node::key(std::size_t index) const
+{
+	if (type() != NODE_OBJECT || index >= _pValue->size) throw RangeException("Invalid member index");
+	const Member& member = _pValue->members[index];
+	return std::string_view(member.key, member.keyLength);
+}
+
+
+Node Node::at(std::size_t index) const
+{
+	Type t = type();
+	if (t == NODE_ARRAY && index < _pValue->size)
+		return Node(&_pValue->elements[index]);
+	else if (t == NODE_OBJECT && index < _pValue->size)
+		return Node(&_pValue->members[index].value);
+	else
+		throw RangeException("Invalid element index");
+}
+
+
+const Node::Member* Node::find(std::string_view key) const
+{
+	if (type() != NODE_OBJECT) return 0;
+
+	const Member* pMembers = _pValue->members;
+	std::size_t count = _pValue->size;
+	if (count <= LINEAR_LOOKUP_LIMIT)
+	{
+		// search backwards, so the last member with the key is found
+		for (std::size_t i = count; i > 0; --i)
+		{
+			const Member& member = pMembers[i - 1];
+			if (member.keyLength == key.size() && key.compare(0, key.size(), member.key, member.keyLength) == 0)
+				return &member;
+		}
+		return 0;
+	}
+
+	// The index is sorted by key, and members with equal keys by position.
+	// Find the first entry past the key; the entry before it is the last
+	// member with the key, if there is one.
+	const Poco::UInt32* pIndex = reinterpret_cast<const Poco::UInt32*>(pMembers + count);
+	const Poco::UInt32* pIt = std::upper_bound(pIndex, pIndex + count, key, [pMembers](std::string_view k, Poco::UInt32 i)
+	{
+		return k.compare(std::string_view(pMembers[i].key, pMembers[i].keyLength)) < 0;
+	});
+	if (pIt == pIndex) return 0;
+	const Member& member = pMembers[*(pIt - 1)];
+	if (key.compare(std::string_view(member.key, member.keyLength)) == 0)
+		return &member;
+	else
+		return 0;
+}
+
+
+Poco::Dynamic::Var Node::toVar() const
+{
+	switch (type())
+	{
+	case NODE_BOOLEAN:
+		return _pValue->boolean;
+	case NODE_INTEGER:
+		return _pValue->integer;
+	case NODE_UNSIGNED:
+		return _pValue->unsignedInteger;
+	case NODE_DOUBLE:
+		return _pValue->number;
+	case NODE_STRING:
+		return std::string(_pValue->string, _pValue->size);
+	case NODE_ARRAY:
+		{
+			Array::Ptr pArray = new Array;
+			for (std::size_t i = 0; i < _pValue->size; ++i)
+			{
+				pArray->add(Node(&_pValue->elements[i]).toVar());
+			}
+			return pArray;
+		}
+	case NODE_OBJECT:
+		{
+			Object::Ptr pObject = new Object;
+			for (std::size_t i = 0; i < _pValue->size; ++i)
+			{
+				const Member& member = _pValue->members[i];
+				pObject->set(std::string(member.key, member.keyLength), Node(&member.value).toVar());
+			}
+			return pObject;
+		}
+	default:
+		return Poco::Dynamic::Var();
+	}
+}
+
+
+void Node::stringify(std::ostream& out, unsigned int indent, int step, int options) const
+{
+	if (step < 0) step = indent;
+
+	std::string buffer;
+	stringify(out, buffer, indent, step, options);
+}
+
+
+void Node::stringify(std::ostream& out, std::string& buffer, unsigned int indent, unsigned int step, int options) const
+{
+	// The format is the same as the one of Object::stringify()
+	// and Array::stringify().
+	switch (type())
+	{
+	case NODE_BOOLEAN:
+		out << (_pValue->boolean ? "true" : "false");
+		break;
+	case NODE_INTEGER:
+		out << NumberFormatter::format(_pValue->integer);
+		break;
+	case NODE_UNSIGNED:
+		out << NumberFormatter::format(_pValue->unsignedInteger);
+		break;
+	case NODE_DOUBLE:
+		if (std::isfinite(_pValue->number))
+			out << NumberFormatter::format(_pValue->number);
+		else
+			out << "null";
+		break;
+	case NODE_STRING:
+		buffer.clear();
+		Poco::toJSON(_pValue->string, _pValue->size, buffer, options);
+		out.write(buffer.data(), buffer.size());
+		break;
+	case NODE_ARRAY:
+		{
+			options |= Poco::JSON_WRAP_STRINGS;
+			out << '[';
+			if (indent > 0) out << '\n';
+			for (std::size_t i = 0; i < _pValue->size; ++i)
+			{
+				for (unsigned int j = 0; j < indent; j++) out << ' ';
+				Node(&_pValue->elements[i]).stringify(out, buffer, indent + step, step, options);
+				if (i + 1 < _pValue->size)
+				{
+					out << ',';
+					if (step > 0) out << '\n';
+				}
+			}
+			if (step > 0) out << '\n';
+			if (indent >= step) indent -= step;
+			for (unsigned int j = 0; j < indent; j++) out << ' ';
+			out << ']';
+		}
+		break;
+	case NODE_OBJECT:
+		{
+			options |= Poco::JSON_WRAP_STRINGS;
+			out << '{';
+			if (indent > 0) out << '\n';
+			for (std::size_t i = 0; i < _pValue->size; ++i)
+			{
+				const Member& member = _pValue->members[i];
+				for (unsigned int j = 0; j < indent; j++) out << ' ';
+				buffer.clear();
+				Poco::toJSON(member.key, member.keyLength, buffer, options);
+				out.write(buffer.data(), buffer.size());
+				out << ((indent > 0) ? ": " : ":");
+				Node(&member.value).stringify(out, buffer, indent + step, step, options);
+				if (i + 1 < _pValue->size) out << ',';
+				if (step > 0) out << '\n';
+			}
+			if (indent >= step) indent -= step;
+			for (unsigned int j = 0; j < indent; j++) out << ' ';
+			out << '}';
+		}
+		break;
+	default:
+		out << "null";
+		break;
+	}
+}
+
+
+} } // namespace Poco::JSON
@@ -32,8 +32,9 @@ Query::Query(const Var& source): _source(source)
 		source.type() != typeid(Object) &&
 		source.type() != typeid(Object::Ptr) &&
 		source.type() != typeid(Array) &&
-		source.type() != typeid(Array::Ptr))
-		throw InvalidArgumentException("Only JSON Object, Array or pointers thereof allowed.");
+		source.type() != typeid(Array::Ptr) &&
+		source.type() != typeid(Node))
+		throw InvalidArgumentException("Only JSON Object, Array, Node or pointers thereof allowed.");
 }
 
 
@@ -50,6 +51,8 @@ Object::Ptr Query::findObject(const std::string& path) const
 		return result.extract<Object::Ptr>();
 	else if (result.type() == typeid(Object))
 		return new Object(result.extract<Object>());
+	else if (result.type() == typeid(Node) && result.extract<Node>().isObject())
+		return result.extract<Node>().toVar().extract<Object::Ptr>();
 
 	return 0;
 }
@@ -65,6 +68,8 @@ Object& Query::findObject(const std::string& path, Object& obj) const
 		obj = *result.extract<Object::Ptr>();
 	else if (result.type() == typeid(Object))
 		obj = result.extract<Object>();
+	else if (result.type() == typeid(Node) && result.extract<Node>().isObject())
+		obj = *result.extract<Node>().toVar().extract<Object::Ptr>();
 
 	return obj;
 }
@@ -78,6 +83,8 @@ Array::Ptr Query::findArray(const std::string& path) const
 		return result.extract<Array::Ptr>();
 	else if (result.type() == typeid(Array))
 		return new Array(result.extract<Array>());
+	else if (result.type() == typeid(Node) && result.extract<Node>().isArray())
+		return result.extract<Node>().toVar().extract<Array::Ptr>();
 
 	return 0;
 }
@@ -93,6 +100,8 @@ Array& Query::findArray(const std::string& path, Array& arr) const
 		arr = *result.extract<Array::Ptr>();
 	else if (result.type() == typeid(Array))
 		arr = result.extract<Array>();
+	else if (result.type() == typeid(Node) && result.extract<Node>().isArray())
+		arr = *result.extract<Node>().toVar().extract<Array::Ptr>();
 
 	return arr;
 }
@@ -144,6 +153,13 @@ Var Query::find(const std::string& path) const
 					result = o.get(name);
 					found = true;
 				}
+				else if (result.type() == typeid(Node))
+				{
+					Node node = result.extract<Node>().get(name);
+					if (node.isValid()) result = node;
+					else result.empty();
+					found = true;
+				}
 				else result.empty();
 
 			}
@@ -164,13 +180,33 @@ Var Query::find(const std::string& path) const
 						result = array.get(i);
 						if (result.isEmpty()) break;
 					}
+					else if (result.type() == typeid(Node))
+					{
+						Node node = result.extract<Node>().get(static_cast<std::size_t>(i));
+						if (node.isValid()) result = node;
+						else
+						{
+							result.empty();
+							break;
+						}
+					}
 				}
 			}
 		}
 	}
 	if (!found) result.empty();
+	else if (result.type() == typeid(Node)) result = fromNode(result.extract<Node>());
 	return result;
 }
 
 
+Var Query::fromNode(const Node& node)
+{
+	if (node.isObject() || node.isArray())
+		return node;
+	else
+		return node.toVar();
+}
+
+
 } } // namespace Poco::JSON
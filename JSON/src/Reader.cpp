@@ -0,0 +1,710 @@
+//
+// Reader.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Reader
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Reader.h"
+#include "Poco/JSON/ParseHandler.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/NumericString.h"
+#include "Poco/Format.h"
+#include <limits>
+#include <cstring>
+#include <cmath>
+
+
+namespace
+{
+	const Poco::UInt64 ONES  = 0x0101010101010101ULL;
+	const Poco::UInt64 HIGHS = 0x8080808080808080ULL;
+
+
+	inline bool hasStringSpecial(Poco::UInt64 word)
+		/// Returns true if any of the eight bytes in word is a quote,
+		/// a backslash, a control character or not ASCII, which end
+		/// a run of plain characters in a string.
+	{
+		Poco::UInt64 quote = word ^ (ONES*'"');
+		Poco::UInt64 backslash = word ^ (ONES*'\\');
+		return ((((quote - ONES) & ~quote) |
+			((backslash - ONES) & ~backslash) |
+			((word - ONES*0x20) & ~word) |
+			word) & HIGHS) != 0;
+	}
+
+
+	std::size_t utf8SequenceLength(const char* p, const char* pEnd)
+		/// Returns the length of the valid UTF-8 sequence starting
+		/// at p, or 0 if the sequence is invalid, overlong, truncated,
+		/// or encodes a surrogate or a character beyond U+10FFFF.
+	{
+		unsigned char c = static_cast<unsigned char>(*p);
+		std::size_t length;
+		int ch;
+		int min;
+		if (c < 0xC2) return 0;
+		else if (c < 0xE0)
+		{
+			length = 2;
+			ch = c & 0x1F;
+			min = 0x80;
+		}
+		else if (c < 0xF0)
+		{
+			length = 3;
+			ch = c & 0x0F;
+			min = 0x800;
+		}
+		else if (c < 0xF5)
+		{
+			length = 4;
+			ch = c & 0x07;
+			min = 0x10000;
+		}
+		else return 0;
+
+		if (static_cast<std::size_t>(pEnd - p) < length) return 0;
+		for (std::size_t i = 1; i < length; ++i)
+		{
+			unsigned char cc = static_cast<unsigned char>(p[i]);
+			if ((cc & 0xC0) != 0x80) return 0;
+			ch = (ch << 6) | (cc & 0x3F);
+		}
+		if (ch < min || ch > 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) return 0;
+		return length;
+	}
+
+
+	inline bool isDigit(char c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+
+	inline bool isWhitespace(char c)
+	{
+		return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+	}
+
+
+	inline int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	}
+
+
+	inline bool isHex4(const char* p)
+	{
+		return hexValue(p[0]) >= 0 && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0 && hexValue(p[3]) >= 0;
+	}
+
+
+	inline int hex4(const char* p)
+	{
+		return (hexValue(p[0]) << 12) | (hexValue(p[1]) << 8) | (hexValue(p[2]) << 4) | hexValue(p[3]);
+	}
+
+
+	std::size_t encodeUTF8(int ch, char* pOut)
+	{
+		if (ch <= 0x7F)
+		{
+			pOut[0] = static_cast<char>(ch);
+			return 1;
+		}
+		else if (ch <= 0x7FF)
+		{
+			pOut[0] = static_cast<char>(0xC0 | (ch >> 6));
+			pOut[1] = static_cast<char>(0x80 | (ch & 0x3F));
+			return 2;
+		}
+		else if (ch <= 0xFFFF)
+		{
+			pOut[0] = static_cast<char>(0xE0 | (ch >> 12));
+			pOut[1] = static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+			pOut[2] = static_cast<char>(0x80 | (ch & 0x3F));
+			return 3;
+		}
+		else
+		{
+			pOut[0] = static_cast<char>(0xF0 | (ch >> 18));
+			pOut[1] = static_cast<char>(0x80 | ((ch >> 12) & 0x3F));
+			pOut[2] = static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+			pOut[3] = static_cast<char>(0x80 | (ch & 0x3F));
+			return 4;
+		}
+	}
+
+
+	std::size_t unescape(std::string_view in, char* pOut)
+		/// Decodes the escape sequences in a string that has been
+		/// validated by the Reader. The decoded string is never longer
+		/// than the escaped one, so pOut may point to the same memory
+		/// as in.
+	{
+		const char* p = in.data();
+		const char* pEnd = p + in.size();
+		char* pStart = pOut;
+		while (p < pEnd)
+		{
+			const char* pEscape = static_cast<const char*>(std::memchr(p, '\\', pEnd - p));
+			if (!pEscape) pEscape = pEnd;
+			if (pOut != p) std::memmove(pOut, p, pEscape - p);
+			pOut += pEscape - p;
+			p = pEscape;
+			if (p == pEnd) break;
+
+			char c = p[1];
+			p += 2;
+			switch (c)
+			{
+			case 'b': *pOut++ = '\b'; break;
+			case 'f': *pOut++ = '\f'; break;
+			case 'n': *pOut++ = '\n'; break;
+			case 'r': *pOut++ = '\r'; break;
+			case 't': *pOut++ = '\t'; break;
+			case 'u':
+				{
+					int ch = hex4(p);
+					p += 4;
+					if (ch >= 0xD800 && ch <= 0xDBFF)
+					{
+						int low = (pEnd - p >= 6 && p[0] == '\\' && p[1] == 'u') ? hex4(p + 2) : 0;
+						if (low < 0xDC00 || low > 0xDFFF)
+							throw Poco::JSON::JSONException("Invalid surrogate pair in string");
+						ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+						p += 6;
+					}
+					else if (ch >= 0xDC00 && ch <= 0xDFFF)
+					{
+						throw Poco::JSON::JSONException("Invalid surrogate pair in string");
+					}
+					pOut += encodeUTF8(ch, pOut);
+				}
+				break;
+			default: // " \ /
+				*pOut++ = c;
+				break;
+			}
+		}
+		return pOut - pStart;
+	}
+
+
+	bool parseUnsigned(std::string_view digits, Poco::UInt64& value)
+	{
+		const Poco::UInt64 max = std::numeric_limits<Poco::UInt64>::max();
+		value = 0;
+		for (char c: digits)
+		{
+			unsigned d = static_cast<unsigned>(c - '0');
+			if (value > (max - d)/10) return false;
+			value = value*10 + d;
+		}
+		return true;
+	}
+
+
+	bool parseSigned(std::string_view text, Poco::Int64& value)
+	{
+		bool negative = text[0] == '-';
+		Poco::UInt64 magnitude;
+		if (!parseUnsigned(negative ? text.substr(1) : text, magnitude)) return false;
+		const Poco::UInt64 limit = static_cast<Poco::UInt64>(std::numeric_limits<Poco::Int64>::max());
+		if (negative)
+		{
+			if (magnitude > limit + 1) return false;
+			value = magnitude == limit + 1 ? std::numeric_limits<Poco::Int64>::min() : -static_cast<Poco::Int64>(magnitude);
+		}
+		else
+		{
+			if (magnitude > limit) return false;
+			value = static_cast<Poco::Int64>(magnitude);
+		}
+		return true;
+	}
+}
+
+
+namespace Poco {
+namespace JSON {
+
+
+Reader::Reader(const char* pData, std::size_t size):
+	_pBegin(pData),
+	_pEnd(pData + size),
+	_pCur(pData),
+	_pInSitu(0),
+	_pToken(pData),
+	_token(TOKEN_NONE),
+	_state(ST_START),
+	_hasEscapes(false),
+	_isInteger(false),
+	_maxDepth(DEFAULT_MAX_DEPTH)
+{
+}
+
+
+Reader::Reader(std::string_view json):
+	_pBegin(json.data()),
+	_pEnd(json.data() + json.size()),
+	_pCur(json.data()),
+	_pInSitu(0),
+	_pToken(json.data()),
+	_token(TOKEN_NONE),
+	_state(ST_START),
+	_hasEscapes(false),
+	_isInteger(false),
+	_maxDepth(DEFAULT_MAX_DEPTH)
+{
+}
+
+
+Reader::Reader(char* pData, std::size_t size, bool inSitu):
+	_pBegin(pData),
+	_pEnd(pData + size),
+	_pCur(pData),
+	_pInSitu(inSitu ? pData : 0),
+	_pToken(pData),
+	_token(TOKEN_NONE),
+	_state(ST_START),
+	_hasEscapes(false),
+	_isInteger(false),
+	_maxDepth(DEFAULT_MAX_DEPTH)
+{
+}
+
+
+Reader::~Reader()
+{
+}
+
+
+Reader::Token Reader::next()
+{
+	_raw = std::string_view();
+	_hasEscapes = false;
+
+	switch (_state)
+	{
+	case ST_START:
+		return readValue();
+	case ST_DONE:
+		skipWhitespace();
+		_pToken = _pCur;
+		if (_pCur != _pEnd) error("Excess characters found after JSON end");
+		return _token = TOKEN_END;
+	case ST_ARRAY_FIRST:
+		skipWhitespace();
+		if (_pCur < _pEnd && *_pCur == ']') return endContainer(']');
+		return readValue();
+	case ST_ARRAY_NEXT:
+		skipWhitespace();
+		if (_pCur < _pEnd && *_pCur == ',')
+		{
+			++_pCur;
+			return readValue();
+		}
+		if (_pCur < _pEnd && *_pCur == ']') return endContainer(']');
+		error("Expected , or ]", _pCur);
+	case ST_OBJECT_FIRST:
+		skipWhitespace();
+		if (_pCur < _pEnd && *_pCur == '}') return endContainer('}');
+		return readKey();
+	case ST_OBJECT_VALUE:
+		skipWhitespace();
+		if (_pCur == _pEnd || *_pCur != ':') error("Expected :", _pCur);
+		++_pCur;
+		return readValue();
+	case ST_OBJECT_NEXT:
+		skipWhitespace();
+		if (_pCur < _pEnd && *_pCur == ',')
+		{
+			++_pCur;
+			return readKey();
+		}
+		if (_pCur < _pEnd && *_pCur == '}') return endContainer('}');
+		error("Expected , or }", _pCur);
+	}
+	return _token;
+}
+
+
+std::string_view Reader::string()
+{
+	if (!_hasEscapes) return _raw;
+
+	if (_pInSitu)
+	{
+		char* pRaw = _pInSitu + (_raw.data() - _pBegin);
+		_raw = std::string_view(pRaw, unescape(_raw, pRaw));
+		_hasEscapes = false;
+		return _raw;
+	}
+
+	_buffer.resize(_raw.size());
+	return std::string_view(_buffer.data(), unescape(_raw, &_buffer[0]));
+}
+
+
+Poco::Int64 Reader::asInt64() const
+{
+	if (!isInteger()) error("Not an integer number");
+
+	Poco::Int64 value;
+	if (!parseSigned(_raw, value)) error("Integer number out of range");
+	return value;
+}
+
+
+Poco::UInt64 Reader::asUInt64() const
+{
+	if (!isInteger() || _raw[0] == '-') error("Not a non-negative integer number");
+
+	Poco::UInt64 value;
+	if (!parseUnsigned(_raw, value)) error("Integer number out of range");
+	return value;
+}
+
+
+double Reader::asDouble() const
+{
+	if (_token != TOKEN_NUMBER) error("Not a number");
+
+	// integers with up to 15 digits are exactly representable
+	if (_isInteger && _raw.size() <= 15) return static_cast<double>(asInt64());
+
+	double value;
+	char buffer[64];
+	if (_raw.size() < sizeof(buffer))
+	{
+		std::memcpy(buffer, _raw.data(), _raw.size());
+		buffer[_raw.size()] = 0;
+		value = Poco::strToDouble(buffer);
+	}
+	else value = Poco::strToDouble(std::string(_raw).c_str());
+
+	if (std::isinf(value)) error("Number out of range");
+	return value;
+}
+
+
+bool Reader::asBool() const
+{
+	if (_token == TOKEN_TRUE) return true;
+	if (_token == TOKEN_FALSE) return false;
+	error("Not a boolean");
+}
+
+
+void Reader::skip()
+{
+	if (_token == TOKEN_KEY) next();
+	if (_token == TOKEN_BEGIN_OBJECT || _token == TOKEN_BEGIN_ARRAY)
+	{
+		std::size_t depth = _stack.size() - 1;
+		while (_stack.size() > depth) next();
+	}
+}
+
+
+void Reader::read(Handler& handler)
+{
+	bool document = _state == ST_START;
+	std::size_t depth = _stack.size();
+
+	Token token = next();
+	if (token == TOKEN_KEY || token == TOKEN_END_OBJECT || token == TOKEN_END_ARRAY || token == TOKEN_END)
+		error("Expected a value");
+
+	for (;;)
+	{
+		switch (token)
+		{
+		case TOKEN_BEGIN_OBJECT:
+			handler.startObject();
+			break;
+		case TOKEN_END_OBJECT:
+			handler.endObject();
+			break;
+		case TOKEN_BEGIN_ARRAY:
+			handler.startArray();
+			break;
+		case TOKEN_END_ARRAY:
+			handler.endArray();
+			break;
+		case TOKEN_KEY:
+			handler.key(std::string(string()));
+			break;
+		case TOKEN_STRING:
+			handler.value(std::string(string()));
+			break;
+		case TOKEN_NUMBER:
+			reportNumber(handler);
+			break;
+		case TOKEN_TRUE:
+			handler.value(true);
+			break;
+		case TOKEN_FALSE:
+			handler.value(false);
+			break;
+		case TOKEN_NULL:
+			handler.null();
+			break;
+		default:
+			break;
+		}
+		if (_stack.size() == depth) break;
+		token = next();
+	}
+
+	if (document) next();
+}
+
+
+Poco::Dynamic::Var Reader::parse()
+{
+	ParseHandler handler;
+	read(handler);
+	return handler.asVar();
+}
+
+
+Reader::Token Reader::readValue()
+{
+	skipWhitespace();
+	_pToken = _pCur;
+	if (_pCur == _pEnd) error("Unexpected end of JSON");
+
+	switch (*_pCur)
+	{
+	case '{':
+		return beginContainer('{', TOKEN_BEGIN_OBJECT, ST_OBJECT_FIRST);
+	case '[':
+		return beginContainer('[', TOKEN_BEGIN_ARRAY, ST_ARRAY_FIRST);
+	case '"':
+		scanString();
+		afterValue();
+		return _token = TOKEN_STRING;
+	case 't':
+		return readLiteral("true", 4, TOKEN_TRUE);
+	case 'f':
+		return readLiteral("false", 5, TOKEN_FALSE);
+	case 'n':
+		return readLiteral("null", 4, TOKEN_NULL);
+	case '-': case '0': case '1': case '2': case '3': case '4':
+	case '5': case '6': case '7': case '8': case '9':
+		scanNumber();
+		afterValue();
+		return _token = TOKEN_NUMBER;
+	default:
+		error("Unexpected character");
+	}
+}
+
+
+Reader::Token Reader::readKey()
+{
+	skipWhitespace();
+	_pToken = _pCur;
+	if (_pCur == _pEnd || *_pCur != '"') error("Expected key");
+
+	scanString();
+	_state = ST_OBJECT_VALUE;
+	return _token = TOKEN_KEY;
+}
+
+
+Reader::Token Reader::beginContainer(char c, Token token, State state)
+{
+	if (_stack.size() >= _maxDepth) error("Maximum depth exceeded");
+
+	_stack.push_back(c);
+	_raw = std::string_view(_pCur, 1);
+	++_pCur;
+	_state = state;
+	return _token = token;
+}
+
+
+Reader::Token Reader::endContainer(char c)
+{
+	_pToken = _pCur;
+	_raw = std::string_view(_pCur, 1);
+	++_pCur;
+	_stack.pop_back();
+	afterValue();
+	return _token = (c == '}' ? TOKEN_END_OBJECT : TOKEN_END_ARRAY);
+}
+
+
+Reader::Token Reader::readLiteral(const char* literal, std::size_t length, Token token)
+{
+	if (static_cast<std::size_t>(_pEnd - _pCur) < length || std::memcmp(_pCur, literal, length) != 0)
+		error("Invalid literal");
+
+	_raw = std::string_view(_pCur, length);
+	_pCur += length;
+	checkValueEnd();
+	afterValue();
+	return _token = token;
+}
+
+
+void Reader::scanString()
+{
+	const char* p = _pCur + 1;
+	const char* pStart = p;
+	bool escapes = false;
+
+	for (;;)
+	{
+		// skip plain characters eight at a time
+		while (_pEnd - p >= 8)
+		{
+			Poco::UInt64 word;
+			std::memcpy(&word, p, sizeof(word));
+			if (hasStringSpecial(word)) break;
+			p += 8;
+		}
+
+		if (p == _pEnd) error("Unterminated string");
+
+		unsigned char c = static_cast<unsigned char>(*p);
+		if (c == '"')
+		{
+			break;
+		}
+		else if (c == '\\')
+		{
+			escapes = true;
+			if (_pEnd - p < 2) error("Unterminated string");
+			switch (p[1])
+			{
+			case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+				p += 2;
+				break;
+			case 'u':
+				if (_pEnd - p < 6 || !isHex4(p + 2)) error("Invalid escape sequence", p);
+				p += 6;
+				break;
+			default:
+				error("Invalid escape sequence", p);
+			}
+		}
+		else if (c < 0x20)
+		{
+			error("Control character in string", p);
+		}
+		else if (c >= 0x80)
+		{
+			std::size_t length = utf8SequenceLength(p, _pEnd);
+			if (length == 0) error("Invalid UTF-8 sequence in string", p);
+			p += length;
+		}
+		else ++p;
+	}
+
+	_raw = std::string_view(pStart, p - pStart);
+	_hasEscapes = escapes;
+	_pCur = p + 1;
+}
+
+
+void Reader::scanNumber()
+{
+	const char* p = _pCur;
+	bool integer = true;
+
+	if (*p == '-') ++p;
+	if (p == _pEnd || !isDigit(*p)) error("Invalid number");
+	if (*p == '0') ++p;
+	else while (p < _pEnd && isDigit(*p)) ++p;
+
+	if (p < _pEnd && *p == '.')
+	{
+		integer = false;
+		++p;
+		if (p == _pEnd || !isDigit(*p)) error("Invalid number");
+		while (p < _pEnd && isDigit(*p)) ++p;
+	}
+
+	if (p < _pEnd && (*p == 'e' || *p == 'E'))
+	{
+		integer = false;
+		++p;
+		if (p < _pEnd && (*p == '+' || *p == '-')) ++p;
+		if (p == _pEnd || !isDigit(*p)) error("Invalid number");
+		while (p < _pEnd && isDigit(*p)) ++p;
+	}
+
+	_raw = std::string_view(_pCur, p - _pCur);
+	_isInteger = integer;
+	_pCur = p;
+	checkValueEnd();
+}
+
+
+void Reader::skipWhitespace()
+{
+	while (_pCur < _pEnd && isWhitespace(*_pCur)) ++_pCur;
+}
+
+
+void Reader::checkValueEnd()
+{
+	if (_pCur < _pEnd && !isWhitespace(*_pCur) && *_pCur != ',' && *_pCur != ']' && *_pCur != '}')
+		error("Unexpected character", _pCur);
+}
+
+
+void Reader::afterValue()
+{
+	if (_stack.empty())
+		_state = ST_DONE;
+	else if (_stack.back() == '[')
+		_state = ST_ARRAY_NEXT;
+	else
+		_state = ST_OBJECT_NEXT;
+}
+
+
+void Reader::reportNumber(Handler& handler) const
+{
+	if (_isInteger)
+	{
+		Poco::Int64 value;
+		if (parseSigned(_raw, value))
+			handler.value(value);
+		else
+			handler.value(asUInt64());
+	}
+	else handler.value(asDouble());
+}
+
+
+void Reader::error(const std::string& message) const
+{
+	error(message, _pToken);
+}
+
+
+void Reader::error(const std::string& message, const char* pPos) const
+{
+	throw JSONException(Poco::format("%s at offset %z", message, static_cast<std::size_t>(pPos - _pBegin)));
+}
+
+
+} } // namespace Poco::JSON
@@ -15,6 +15,7 @@
 #include "Poco/JSON/Stringifier.h"
 #include "Poco/JSON/Array.h"
 #include "Poco/JSON/Object.h"
+#include "Poco/JSON/Node.h"
 #include <iomanip>
 
 
@@ -60,6 +61,10 @@ void Stringifier::stringify(const Var& any, std::ostream& out, unsigned int inde
 		a->setLowercaseHex(lowercaseHex);
 		a->stringify(out, indent == 0 ? 0 : indent, step);
 	}
+	else if (any.type() == typeid(Node))
+	{
+		any.extract<Node>().stringify(out, indent, step, options);
+	}
 	else if (any.isEmpty())
 	{
 		out << "null";
@@ -14,9 +14,15 @@
 
 #include "Poco/JSON/Template.h"
 #include "Poco/JSON/TemplateCache.h"
-#include "Poco/JSON/Query.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/JSON/Node.h"
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
+#include "Poco/RegularExpression.h"
+#include "Poco/StringTokenizer.h"
+#include "Poco/NumberParser.h"
+#include <cstring>
 
 
 using Poco::Dynamic::Var;
@@ -29,342 +35,171 @@ namespace JSON {
 POCO_IMPLEMENT_EXCEPTION(JSONTemplateException, Exception, "Template Exception")
 
 
-class Part
+namespace
 {
-public:
-	Part()
-	{
-	}
-
-	virtual ~Part()
-	{
-	}
-
-	virtual void render(const Var& data, std::ostream& out) const = 0;
-
-	typedef std::vector<SharedPtr<Part>> VectorParts;
-};
-
-
-class StringPart: public Part
-{
-public:
-	StringPart(): Part()
-	{
-	}
-
-	StringPart(const std::string& content): Part(), _content(content)
-	{
-	}
-
-	virtual ~StringPart()
-	{
-	}
-
-	void render(const Var& data, std::ostream& out) const
-	{
-		out << _content;
-	}
-
-	void setContent(const std::string& content)
-	{
-		_content = content;
-	}
-
-	inline std::string getContent() const
-	{
-		return _content;
-	}
-
-private:
-	std::string _content;
-};
-
-
-class MultiPart: public Part
-{
-public:
-	MultiPart()
-	{
-	}
-
-	virtual ~MultiPart()
-	{
+	Var fromNode(const Node& node)
+		/// Objects and arrays in a Document are passed on as Node,
+		/// like Query does, other values as their value.
+	{
+		if (!node.isValid())
+			return Var();
+		else if (node.isObject() || node.isArray())
+			return node;
+		else
+			return node.toVar();
 	}
 
-	virtual void addPart(Part* part)
-	{
-		_parts.push_back(part);
-	}
 
-	void render(const Var& data, std::ostream& out) const
+	Var getMember(const Var& value, const std::string& name, bool& found)
+		/// Returns the member of an object, like Query::find().
 	{
-		for (const auto& p: _parts)
+		if (value.type() == typeid(Object::Ptr))
 		{
-			p->render(data, out);
+			found = true;
+			return value.extract<Object::Ptr>()->get(name);
 		}
-	}
-
-protected:
-	VectorParts _parts;
-};
-
-
-class EchoPart: public Part
-{
-public:
-	EchoPart(const std::string& query): Part(), _query(query)
-	{
-	}
-
-	virtual ~EchoPart()
-	{
-	}
-
-	void render(const Var& data, std::ostream& out) const
-	{
-		Query query(data);
-		Var value = query.find(_query);
-
-		if (!value.isEmpty())
+		else if (value.type() == typeid(Object))
 		{
-			out << value.convert<std::string>();
+			found = true;
+			return value.extract<Object>().get(name);
 		}
-	}
-
-private:
-	std::string _query;
-};
-
-
-class LogicQuery
-{
-public:
-	LogicQuery(const std::string& query): _queryString(query)
-	{
-	}
-
-	virtual ~LogicQuery()
-	{
-	}
-
-	virtual bool apply(const Var& data) const
-	{
-		bool logic = false;
-
-		Query query(data);
-		Var value = query.find(_queryString);
-
-		if (!value.isEmpty()) // When empty, logic will be false
+		else if (value.type() == typeid(Node))
 		{
-			if (value.isString())
-				// An empty string must result in false, otherwise true
-				// Which is not the case when we convert to bool with Var
-			{
-				std::string s = value.convert<std::string>();
-				logic = !s.empty();
-			}
-			else
-			{
-				// All other values, try to convert to bool
-				// An empty object or array will turn into false
-				// all other values depend on the convert<> in Var
-				logic = value.convert<bool>();
-			}
+			found = true;
+			return fromNode(value.extract<Node>().get(name));
 		}
-
-		return logic;
+		return Var();
 	}
 
-protected:
-	std::string _queryString;
-};
-
 
-class LogicExistQuery: public LogicQuery
-{
-public:
-	LogicExistQuery(const std::string& query): LogicQuery(query)
-	{
-	}
-
-	virtual ~LogicExistQuery()
-	{
-	}
-
-	virtual bool apply(const Var& data) const
-	{
-		Query query(data);
-		Var value = query.find(_queryString);
-
-		return !value.isEmpty();
-	}
-};
-
-
-class LogicElseQuery: public LogicQuery
-{
-public:
-	LogicElseQuery(): LogicQuery("")
+	std::size_t getSize(const Var& value)
+		/// Returns the number of elements of an array,
+		/// or zero if the value is not an array.
 	{
+		if (value.type() == typeid(Array::Ptr))
+			return value.extract<Array::Ptr>()->size();
+		else if (value.type() == typeid(Array))
+			return value.extract<Array>().size();
+		else if (value.type() == typeid(Node) && value.extract<Node>().isArray())
+			return value.extract<Node>().size();
+		else
+			return 0;
 	}
 
-	virtual ~LogicElseQuery()
-	{
-	}
 
-	virtual bool apply(const Var& data) const
+	Var getElement(const Var& value, std::size_t index)
+		/// Returns the element of an array, or an empty value.
 	{
-		return true;
+		if (value.type() == typeid(Array::Ptr))
+			return value.extract<Array::Ptr>()->get(static_cast<unsigned int>(index));
+		else if (value.type() == typeid(Array))
+			return value.extract<Array>().get(static_cast<unsigned int>(index));
+		else if (value.type() == typeid(Node))
+			return fromNode(value.extract<Node>().get(index));
+		else
+			return Var();
 	}
-};
+}
 
 
-class LogicPart: public MultiPart
+namespace
 {
-public:
-	LogicPart(): MultiPart()
-	{
-	}
-
-	virtual ~LogicPart()
+	class Output
 	{
-	}
+	public:
+		virtual ~Output()
+		{
+		}
 
-	void addPart(LogicQuery* query, Part* part)
-	{
-		MultiPart::addPart(part);
-		_queries.push_back(query);
-	}
+		virtual void write(const char* data, std::size_t length) = 0;
+	};
 
-	void addPart(Part* part)
-	{
-		MultiPart::addPart(part);
-		_queries.push_back(new LogicElseQuery());
-	}
 
-	void render(const Var& data, std::ostream& out) const
+	class StreamOutput: public Output
 	{
-		int count = 0;
-		for (auto it = _queries.begin(); it != _queries.end(); ++it, ++count)
+	public:
+		StreamOutput(std::ostream& out): _out(out)
 		{
-			if ((*it)->apply(data) && _parts.size() > count)
-			{
-				_parts[count]->render(data, out);
-				break;
-			}
 		}
-	}
-
-private:
-	std::vector<SharedPtr<LogicQuery>> _queries;
-};
 
+		void write(const char* data, std::size_t length)
+		{
+			_out.write(data, static_cast<std::streamsize>(length));
+		}
 
-class LoopPart: public MultiPart
-{
-public:
-	LoopPart(const std::string& name, const std::string& query): MultiPart(), _name(name), _query(query)
-	{
-	}
+	private:
+		std::ostream& _out;
+	};
 
-	virtual ~LoopPart()
-	{
-	}
 
-	void render(const Var& data, std::ostream& out) const
+	class BufferOutput: public Output
 	{
-		Query query(data);
+	public:
+		BufferOutput(Poco::Buffer<char>& out): _out(out)
+		{
+		}
 
-		if (data.type() == typeid(Object::Ptr))
+		void write(const char* data, std::size_t length)
 		{
-			Object::Ptr dataObject = data.extract<Object::Ptr>();
-			Array::Ptr array = query.findArray(_query);
-			if (!array.isNull())
+			std::size_t size = _out.size();
+			if (size + length > _out.capacity())
 			{
-				for (int i = 0; i < array->size(); i++)
-				{
-					Var value = array->get(i);
-					dataObject->set(_name, value);
-					MultiPart::render(data, out);
-				}
-				dataObject->remove(_name);
+				// Buffer::append() grows the buffer to the exact size,
+				// so grow geometrically here.
+				std::size_t capacity = _out.capacity()*2;
+				if (capacity < size + length) capacity = size + length;
+				_out.setCapacity(capacity, true);
 			}
+			_out.resize(size + length);
+			std::memcpy(_out.begin() + size, data, length);
 		}
-	}
 
-private:
-	std::string _name;
-	std::string _query;
-};
+	private:
+		Poco::Buffer<char>& _out;
+	};
+}
 
 
-class IncludePart: public Part
+class Template::Context
+	/// The state of rendering a template. The loop variables
+	/// are kept here instead of in the data object, so the
+	/// data is not modified.
 {
 public:
-
-	IncludePart(const Path& parentPath, const Path& path):
-		Part(),
-		_path(path)
+	struct Loop
 	{
-		// When the path is relative, try to make it absolute based
-		// on the path of the parent template. When the file doesn't
-		// exist, we keep it relative and hope that the cache can
-		// resolve it.
-		if (_path.isRelative())
-		{
-			Path templatePath(parentPath, _path);
-			File templateFile(templatePath);
-			if (templateFile.exists())
-			{
-				_path = templatePath;
-			}
-		}
-	}
+		const std::string* pVariable;
+		Var                array;
+		std::size_t        size;
+		std::size_t        index;
+		Var                value;
+	};
 
-	virtual ~IncludePart()
+	Context(const Var& data, Output& output):
+		data(data),
+		output(output)
 	{
 	}
 
-	void render(const Var& data, std::ostream& out) const
-	{
-		TemplateCache* cache = TemplateCache::instance();
-		if (cache == 0)
-		{
-			Template tpl(_path);
-			tpl.parse();
-			tpl.render(data, out);
-		}
-		else
-		{
-			Template::Ptr tpl = cache->getTemplate(_path);
-			tpl->render(data, out);
-		}
-	}
-
-private:
-	Path _path;
+	const Var&         data;
+	Output&            output;
+	std::vector<Loop>  loops;
 };
 
 
 Template::Template(const Path& templatePath):
-	_parts(0),
-	_currentPart(0),
 	_templatePath(templatePath)
 {
 }
 
 
-Template::Template():
-	_parts(0),
-	_currentPart(0)
+Template::Template()
 {
 }
 
 
 Template::~Template()
 {
-	delete _parts;
 }
 
 
@@ -381,17 +216,31 @@ void Template::parse()
 
 void Template::parse(std::istream& in)
 {
+	struct Block
+	{
+		Opcode                   opcode; // OP_IF or OP_FOR
+		std::size_t              start;
+		std::size_t              pending; // the conditional jump to the next branch, or npos
+		std::vector<std::size_t> exits;   // the jumps to the end of the block
+	};
+
+	static const std::size_t NONE = static_cast<std::size_t>(-1);
+
 	_parseTime.update();
 
-	_parts = new MultiPart;
-	_currentPart = _parts;
+	_program.clear();
+	_strings.clear();
+	_queries.clear();
+	_includes.clear();
+
+	std::vector<Block> blocks;
 
 	while (in.good())
 	{
 		std::string text = readText(in); // Try to read text first
 		if (text.length() > 0)
 		{
-			_currentPart->addPart(new StringPart(text));
+			emit(OP_TEXT, addString(text));
 		}
 
 		if (in.bad())
@@ -412,7 +261,7 @@ void Template::parse(std::istream& in)
 			{
 				throw JSONTemplateException("Missing query in <? echo ?>");
 			}
-			_currentPart->addPart(new EchoPart(query));
+			emit(OP_ECHO, addQuery(query));
 		}
 		else if (command.compare("for") == 0)
 		{
@@ -429,27 +278,27 @@ void Template::parse(std::istream& in)
 				throw JSONTemplateException("Missing query in <? for ?> command");
 			}
 
-			_partStack.push(_currentPart);
-			LoopPart* part = new LoopPart(loopVariable, query);
-			_partStack.push(part);
-			_currentPart->addPart(part);
-			_currentPart = part;
+			Block block;
+			block.opcode = OP_FOR;
+			block.start = emit(OP_FOR, addQuery(query));
+			block.pending = NONE;
+			_program[block.start].variable = addString(loopVariable);
+			blocks.push_back(block);
 		}
 		else if (command.compare("else") == 0)
 		{
-			if (_partStack.size() == 0)
+			if (blocks.empty())
 			{
 				throw JSONTemplateException("Unexpected <? else ?> found");
 			}
-			_currentPart = _partStack.top();
-			LogicPart* lp = dynamic_cast<LogicPart*>(_currentPart);
-			if (lp == 0)
+			Block& block = blocks.back();
+			if (block.opcode != OP_IF)
 			{
 				throw JSONTemplateException("Missing <? if ?> or <? ifexist ?> for <? else ?>");
 			}
-			MultiPart* part = new MultiPart();
-			lp->addPart(part);
-			_currentPart = part;
+			block.exits.push_back(emit(OP_JUMP));
+			if (block.pending != NONE) _program[block.pending].target = _program.size();
+			block.pending = NONE;
 		}
 		else if (command.compare("elsif") == 0 || command.compare("elif") == 0)
 		{
@@ -459,54 +308,51 @@ void Template::parse(std::istream& in)
 				throw JSONTemplateException("Missing query in <? " + command + " ?>");
 			}
 
-			if (_partStack.size() == 0)
+			if (blocks.empty())
 			{
 				throw JSONTemplateException("Unexpected <? elsif / elif ?> found");
 			}
 
-			_currentPart = _partStack.top();
-			LogicPart* lp = dynamic_cast<LogicPart*>(_currentPart);
-			if (lp == 0)
+			Block& block = blocks.back();
+			if (block.opcode != OP_IF)
 			{
 				throw JSONTemplateException("Missing <? if ?> or <? ifexist ?> for <? elsif / elif ?>");
 			}
-			MultiPart* part = new MultiPart();
-			lp->addPart(new LogicQuery(query), part);
-			_currentPart = part;
+			block.exits.push_back(emit(OP_JUMP));
+			if (block.pending != NONE) _program[block.pending].target = _program.size();
+			block.pending = emit(OP_IF, addQuery(query));
 		}
 		else if (command.compare("endfor") == 0)
 		{
-			if (_partStack.size() < 2)
+			if (blocks.empty())
 			{
 				throw JSONTemplateException("Unexpected <? endfor ?> found");
 			}
-			MultiPart* loopPart = _partStack.top();
-			LoopPart* lp = dynamic_cast<LoopPart*>(loopPart);
-			if (lp == 0)
+			Block& block = blocks.back();
+			if (block.opcode != OP_FOR)
 			{
 				throw JSONTemplateException("Missing <? for ?> command");
 			}
-			_partStack.pop();
-			_currentPart = _partStack.top();
-			_partStack.pop();
+			std::size_t endFor = emit(OP_ENDFOR);
+			_program[endFor].target = block.start;
+			_program[block.start].target = _program.size();
+			blocks.pop_back();
 		}
 		else if (command.compare("endif") == 0)
 		{
-			if (_partStack.size() < 2)
+			if (blocks.empty())
 			{
 				throw JSONTemplateException("Unexpected <? endif ?> found");
 			}
 
-			_currentPart = _partStack.top();
-			LogicPart* lp = dynamic_cast<LogicPart*>(_currentPart);
-			if (lp == 0)
+			Block& block = blocks.back();
+			if (block.opcode != OP_IF)
 			{
 				throw JSONTemplateException("Missing <? if ?> or <? ifexist ?> for <? endif ?>");
 			}
-
-			_partStack.pop();
-			_currentPart = _partStack.top();
-			_partStack.pop();
+			if (block.pending != NONE) _program[block.pending].target = _program.size();
+			for (auto exit: block.exits) _program[exit].target = _program.size();
+			blocks.pop_back();
 		}
 		else if (command.compare("if") == 0 || command.compare("ifexist") == 0)
 		{
@@ -515,19 +361,11 @@ void Template::parse(std::istream& in)
 			{
 				throw JSONTemplateException("Missing query in <? " + command + " ?>");
 			}
-			_partStack.push(_currentPart);
-			LogicPart* lp = new LogicPart();
-			_partStack.push(lp);
-			_currentPart->addPart(lp);
-			_currentPart = new MultiPart();
-			if (command.compare("ifexist") == 0)
-			{
-				lp->addPart(new LogicExistQuery(query), _currentPart);
-			}
-			else
-			{
-				lp->addPart(new LogicQuery(query), _currentPart);
-			}
+			Block block;
+			block.opcode = OP_IF;
+			block.start = emit(command.compare("ifexist") == 0 ? OP_IFEXIST : OP_IF, addQuery(query));
+			block.pending = block.start;
+			blocks.push_back(block);
 		}
 		else if (command.compare("include") == 0)
 		{
@@ -539,9 +377,24 @@ void Template::parse(std::istream& in)
 			}
 			else
 			{
+				// When the path is relative, try to make it absolute based
+				// on the path of the parent template. When the file doesn't
+				// exist, we keep it relative and hope that the cache can
+				// resolve it.
 				Path resolvePath(_templatePath);
 				resolvePath.makeParent();
-				_currentPart->addPart(new IncludePart(resolvePath, filename));
+				Path path(filename);
+				if (path.isRelative())
+				{
+					Path templatePath(resolvePath, path);
+					File templateFile(templatePath);
+					if (templateFile.exists())
+					{
+						path = templatePath;
+					}
+				}
+				_includes.push_back(path);
+				emit(OP_INCLUDE, _includes.size() - 1);
 			}
 		}
 		else
@@ -573,6 +426,73 @@ void Template::parse(std::istream& in)
 			throw JSONTemplateException("Missing ?>");
 		}
 	}
+
+	// Blocks that are still open end with the template.
+	while (!blocks.empty())
+	{
+		Block& block = blocks.back();
+		if (block.opcode == OP_FOR)
+		{
+			std::size_t endFor = emit(OP_ENDFOR);
+			_program[endFor].target = block.start;
+			_program[block.start].target = _program.size();
+		}
+		else
+		{
+			if (block.pending != NONE) _program[block.pending].target = _program.size();
+			for (auto exit: block.exits) _program[exit].target = _program.size();
+		}
+		blocks.pop_back();
+	}
+}
+
+
+std::size_t Template::emit(Opcode opcode, std::size_t operand)
+{
+	Instruction instruction;
+	instruction.opcode = opcode;
+	instruction.operand = operand;
+	instruction.variable = 0;
+	instruction.target = 0;
+	_program.push_back(instruction);
+	return _program.size() - 1;
+}
+
+
+std::size_t Template::addString(const std::string& str)
+{
+	_strings.push_back(str);
+	return _strings.size() - 1;
+}
+
+
+std::size_t Template::addQuery(const std::string& query)
+{
+	// Split the query the same way as Query::find() does.
+	CompiledQuery compiled;
+	RegularExpression regex("\\[([0-9]+)\\]");
+	StringTokenizer tokenizer(query, ".");
+	for (const auto& token: tokenizer)
+	{
+		Step step;
+		RegularExpression::MatchVec matches;
+		int firstOffset = -1;
+		int offset = 0;
+		while (regex.match(token, offset, matches) > 0)
+		{
+			if (firstOffset == -1)
+			{
+				firstOffset = static_cast<int>(matches[0].offset);
+			}
+			std::string num(token, matches[1].offset, matches[1].length);
+			step.indexes.push_back(NumberParser::parse(num));
+			offset = static_cast<int>(matches[0].offset + matches[0].length);
+		}
+		step.name = (firstOffset != -1) ? token.substr(0, firstOffset) : token;
+		compiled.push_back(step);
+	}
+	_queries.push_back(compiled);
+	return _queries.size() - 1;
 }
 
 
@@ -692,9 +612,181 @@ std::string Template::readString(std::istream& in)
 }
 
 
+Var Template::find(const CompiledQuery& query, const Context& context) const
+{
+	Var result = context.data;
+	if (query.empty()) return result;
+	bool found = false;
+	for (CompiledQuery::const_iterator it = query.begin(); it != query.end() && !result.isEmpty(); ++it)
+	{
+		if (!it->name.empty())
+		{
+			bool isVariable = false;
+			if (it == query.begin())
+			{
+				for (std::vector<Context::Loop>::const_reverse_iterator loop = context.loops.rbegin(); loop != context.loops.rend(); ++loop)
+				{
+					if (*loop->pVariable == it->name)
+					{
+						result = loop->value;
+						found = isVariable = true;
+						break;
+					}
+				}
+			}
+			if (!isVariable) result = getMember(result, it->name, found);
+		}
+
+		for (auto index: it->indexes)
+		{
+			if (result.isEmpty()) break;
+			result = getElement(result, static_cast<std::size_t>(index));
+		}
+	}
+	if (!found) result.empty();
+	return result;
+}
+
+
+bool Template::isTrue(const CompiledQuery& query, const Context& context) const
+{
+	bool logic = false;
+
+	Var value = find(query, context);
+
+	if (!value.isEmpty()) // When empty, logic will be false
+	{
+		if (value.isString())
+			// An empty string must result in false, otherwise true
+			// Which is not the case when we convert to bool with Var
+		{
+			std::string s = value.convert<std::string>();
+			logic = !s.empty();
+		}
+		else
+		{
+			// All other values, try to convert to bool
+			// An empty object or array will turn into false
+			// all other values depend on the convert<> in Var
+			logic = value.convert<bool>();
+		}
+	}
+
+	return logic;
+}
+
+
 void Template::render(const Var& data, std::ostream& out) const
 {
-	_parts->render(data, out);
+	StreamOutput output(out);
+	Context context(data, output);
+	render(context);
+}
+
+
+void Template::render(const Var& data, Poco::Buffer<char>& out) const
+{
+	BufferOutput output(out);
+	Context context(data, output);
+	render(context);
+}
+
+
+void Template::render(Context& context) const
+{
+	std::size_t loopBase = context.loops.size();
+	std::size_t pc = 0;
+	while (pc < _program.size())
+	{
+		const Instruction& instruction = _program[pc];
+		switch (instruction.opcode)
+		{
+		case OP_TEXT:
+			{
+				const std::string& text = _strings[instruction.operand];
+				context.output.write(text.data(), text.size());
+				++pc;
+			}
+			break;
+		case OP_ECHO:
+			{
+				Var value = find(_queries[instruction.operand], context);
+				if (value.type() == typeid(std::string))
+				{
+					const std::string& str = value.extract<std::string>();
+					context.output.write(str.data(), str.size());
+				}
+				else if (!value.isEmpty())
+				{
+					std::string str = value.convert<std::string>();
+					context.output.write(str.data(), str.size());
+				}
+				++pc;
+			}
+			break;
+		case OP_IF:
+			pc = isTrue(_queries[instruction.operand], context) ? pc + 1 : instruction.target;
+			break;
+		case OP_IFEXIST:
+			pc = !find(_queries[instruction.operand], context).isEmpty() ? pc + 1 : instruction.target;
+			break;
+		case OP_JUMP:
+			pc = instruction.target;
+			break;
+		case OP_FOR:
+			{
+				Var array = find(_queries[instruction.operand], context);
+				std::size_t size = getSize(array);
+				if (size > 0)
+				{
+					Context::Loop loop;
+					loop.pVariable = &_strings[instruction.variable];
+					loop.array = array;
+					loop.size = size;
+					loop.index = 0;
+					loop.value = getElement(array, 0);
+					context.loops.push_back(loop);
+					++pc;
+				}
+				else pc = instruction.target;
+			}
+			break;
+		case OP_ENDFOR:
+			{
+				Context::Loop& loop = context.loops.back();
+				if (++loop.index < loop.size)
+				{
+					loop.value = getElement(loop.array, loop.index);
+					pc = instruction.target + 1;
+				}
+				else
+				{
+					context.loops.pop_back();
+					++pc;
+				}
+			}
+			break;
+		case OP_INCLUDE:
+			{
+				const Path& path = _includes[instruction.operand];
+				TemplateCache* cache = TemplateCache::instance();
+				if (cache == 0)
+				{
+					Template tpl(path);
+					tpl.parse();
+					tpl.render(context);
+				}
+				else
+				{
+					Template::Ptr tpl = cache->getTemplate(path);
+					if (!tpl.isNull()) tpl->render(context);
+				}
+				++pc;
+			}
+			break;
+		}
+	}
+	poco_assert_dbg (context.loops.size() == loopBase);
 }
 
 
@@ -14,6 +14,7 @@
 
 #include "Poco/File.h"
 #include "Poco/JSON/TemplateCache.h"
+#include "Poco/Delegate.h"
 
 
 namespace Poco {
@@ -23,7 +24,14 @@ namespace JSON {
 TemplateCache* TemplateCache::_pInstance = 0;
 
 
-TemplateCache::TemplateCache(): _pLogger(0)
+TemplateCache::TemplateCache(bool watchChanges):
+	_includePathsWatched(true),
+#ifndef POCO_NO_INOTIFY
+	_watchChanges(watchChanges),
+#else
+	_watchChanges(false),
+#endif
+	_pLogger(0)
 {
 	setup();
 }
@@ -31,6 +39,16 @@ TemplateCache::TemplateCache(): _pLogger(0)
 
 TemplateCache::~TemplateCache()
 {
+#ifndef POCO_NO_INOTIFY
+	// Stop the watchers without holding the mutex,
+	// which their event handlers need.
+	std::map<std::string, SharedPtr<DirectoryWatcher>> watchers;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		watchers.swap(_watchers);
+	}
+	watchers.clear();
+#endif
 	_pInstance = 0;
 }
 
@@ -42,14 +60,48 @@ void TemplateCache::setup()
 }
 
 
+void TemplateCache::addPath(const Path& path)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_includePaths.push_back(path);
+	_resolvedPaths.clear();
+
+	// A template added to an include path can change how relative
+	// paths are resolved, so the resolved paths can only be cached
+	// if all include paths are watched.
+	Path directory(path);
+	directory.makeDirectory();
+	directory.makeAbsolute();
+	if (!File(directory).exists() || !watch(directory)) _includePathsWatched = false;
+}
+
+
 Template::Ptr TemplateCache::getTemplate(const Path& path)
 {
+	FastMutex::ScopedLock lock(_mutex);
+
 	if (_pLogger)
 	{
 		poco_trace_f1(*_pLogger, "Trying to load %s", path.toString());
 	}
 
-	Path templatePath = resolvePath(path);
+	Path templatePath;
+	std::string pathname = path.toString();
+	std::map<std::string, std::string>::const_iterator itResolved = _resolvedPaths.find(pathname);
+	if (itResolved != _resolvedPaths.end())
+	{
+		templatePath = itResolved->second;
+	}
+	else
+	{
+		templatePath = resolvePath(path);
+		templatePath.makeAbsolute();
+		if (_watchChanges && _includePathsWatched)
+		{
+			_resolvedPaths[pathname] = templatePath.toString();
+		}
+	}
 	std::string templatePathname = templatePath.toString();
 
 	if (_pLogger)
@@ -57,34 +109,17 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 		poco_trace_f1(*_pLogger, "Path resolved to %s", templatePathname);
 	}
 
-	File templateFile(templatePathname);
-
-	Template::Ptr tpl;
-
-	std::map<std::string, Template::Ptr>::iterator it = _cache.find(templatePathname);
+	std::map<std::string, Entry>::iterator it = _cache.find(templatePathname);
 	if (it == _cache.end())
 	{
+		File templateFile(templatePathname);
 		if (templateFile.exists())
 		{
 			if (_pLogger)
 			{
 				poco_information_f1(*_pLogger, "Loading template %s", templatePath.toString());
 			}
-
-			tpl = new Template(templatePath);
-
-			try
-			{
-				tpl->parse();
-				_cache[templatePathname] = tpl;
-			}
-			catch (JSONTemplateException& jte)
-			{
-				if (_pLogger)
-				{
-					poco_error_f2(*_pLogger, "Template %s contains an error: %s", templatePath.toString(), jte.message());
-				}
-			}
+			return loadTemplate(templatePath);
 		}
 		else
 		{
@@ -95,30 +130,43 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 			throw FileNotFoundException(templatePathname);
 		}
 	}
-	else
+	else if (!it->second.watched && it->second.pTemplate->parseTime() < File(templatePathname).getLastModified())
 	{
-		tpl = it->second;
-		if (tpl->parseTime() < templateFile.getLastModified())
+		if (_pLogger)
 		{
-			if (_pLogger)
-			{
-				poco_information_f1(*_pLogger, "Reloading template %s", templatePath.toString());
-			}
+			poco_information_f1(*_pLogger, "Reloading template %s", templatePath.toString());
+		}
+		return loadTemplate(templatePath);
+	}
+	else
+	{
+		return it->second.pTemplate;
+	}
+}
 
-			tpl = new Template(templatePath);
 
-			try
-			{
-				tpl->parse();
-				_cache[templatePathname] = tpl;
-			}
-			catch (JSONTemplateException& jte)
-			{
-				if (_pLogger)
-				{
-					poco_error_f2(*_pLogger, "Template %s contains an error: %s", templatePath.toString(), jte.message());
-				}
-			}
+Template::Ptr TemplateCache::loadTemplate(const Path& templatePath)
+{
+	// Start watching before parsing, so a change made
+	// while the template is being parsed is not missed.
+	Path directory(templatePath);
+	directory.makeParent();
+	bool watched = watch(directory);
+
+	Template::Ptr tpl = new Template(templatePath);
+
+	try
+	{
+		tpl->parse();
+		Entry& entry = _cache[templatePath.toString()];
+		entry.pTemplate = tpl;
+		entry.watched = watched;
+	}
+	catch (JSONTemplateException& jte)
+	{
+		if (_pLogger)
+		{
+			poco_error_f2(*_pLogger, "Template %s contains an error: %s", templatePath.toString(), jte.message());
 		}
 	}
 
@@ -126,6 +174,58 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 }
 
 
+bool TemplateCache::watch(const Path& directory)
+{
+#ifndef POCO_NO_INOTIFY
+	if (!_watchChanges) return false;
+
+	std::string directoryName = directory.toString();
+	if (_watchers.find(directoryName) != _watchers.end()) return true;
+
+	try
+	{
+		SharedPtr<DirectoryWatcher> pWatcher = new DirectoryWatcher(directoryName);
+		pWatcher->itemAdded += Poco::delegate(this, &TemplateCache::onItemChanged);
+		pWatcher->itemRemoved += Poco::delegate(this, &TemplateCache::onItemChanged);
+		pWatcher->itemModified += Poco::delegate(this, &TemplateCache::onItemChanged);
+		pWatcher->itemMovedFrom += Poco::delegate(this, &TemplateCache::onItemChanged);
+		pWatcher->itemMovedTo += Poco::delegate(this, &TemplateCache::onItemChanged);
+		_watchers[directoryName] = pWatcher;
+		return true;
+	}
+	catch (Poco::Exception& exc)
+	{
+		if (_pLogger)
+		{
+			poco_warning_f2(*_pLogger, "Cannot watch directory %s: %s", directoryName, exc.displayText());
+		}
+		return false;
+	}
+#else
+	return false;
+#endif
+}
+
+
+#ifndef POCO_NO_INOTIFY
+
+
+void TemplateCache::onItemChanged(const void*, const DirectoryWatcher::DirectoryEvent& event)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	std::string pathname = Path(event.item.path()).absolute().toString();
+	if (_cache.erase(pathname) > 0 && _pLogger)
+	{
+		poco_debug_f1(*_pLogger, "Template %s has changed", pathname);
+	}
+	_resolvedPaths.clear();
+}
+
+
+#endif
+
+
 Path TemplateCache::resolvePath(const Path& path) const
 {
 	if (path.isAbsolute())
@@ -0,0 +1,98 @@
+//
+// Writer.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Writer
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Writer.h"
+#include <cmath>
+
+
+namespace Poco {
+namespace JSON {
+
+
+Writer::Writer(Poco::Buffer<char>& buffer, int options):
+	_buffer(buffer),
+	_options(options | Poco::JSON_WRAP_STRINGS),
+	_separate(false)
+{
+}
+
+
+Writer::~Writer()
+{
+}
+
+
+void Writer::value(float f)
+{
+	separate();
+	if (std::isfinite(f))
+	{
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		floatToStr(buffer, POCO_MAX_FLT_STRING_LEN, f);
+		write(buffer, std::strlen(buffer));
+	}
+	else write("null", 4);
+}
+
+
+void Writer::value(double d)
+{
+	separate();
+	if (std::isfinite(d))
+	{
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		doubleToStr(buffer, POCO_MAX_FLT_STRING_LEN, d);
+		write(buffer, std::strlen(buffer));
+	}
+	else write("null", 4);
+}
+
+
+void Writer::writeString(std::string_view s)
+{
+	// Most strings need no escaping and are copied as they are;
+	// the others are escaped by Poco::toJSON().
+	bool escapeUnicode = (_options & Poco::JSON_ESCAPE_UNICODE) != 0;
+	std::string_view::const_iterator it = s.begin();
+	std::string_view::const_iterator end = s.end();
+	for (; it != end; ++it)
+	{
+		unsigned char c = static_cast<unsigned char>(*it);
+		if (c < 0x20 || c == '"' || c == '\\' || (escapeUnicode && c >= 0x80)) break;
+	}
+	if (it == end)
+	{
+		put('"');
+		write(s.data(), s.size());
+		put('"');
+	}
+	else
+	{
+		_escaped.clear();
+		Poco::toJSON(s.data(), s.size(), _escaped, _options);
+		write(_escaped.data(), _escaped.size());
+	}
+}
+
+
+void Writer::grow(std::size_t size)
+{
+	std::size_t capacity = _buffer.capacity()*2;
+	if (capacity < 256) capacity = 256;
+	if (capacity < size) capacity = size;
+	_buffer.setCapacity(capacity, true);
+}
+
+
+} } // namespace Poco::JSON
@@ -23,6 +23,9 @@
 #include "Poco/Dynamic/Struct.h"
 #include "Poco/DateTime.h"
 #include "Poco/DateTimeFormatter.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include <limits>
 #include <set>
 #include <iostream>
 
@@ -32,6 +35,50 @@ using namespace Poco::Dynamic;
 using Poco::DynamicStruct;
 using Poco::DateTime;
 using Poco::DateTimeFormatter;
+using Poco::Path;
+using Poco::File;
+using Poco::FileOutputStream;
+
+
+namespace
+{
+	struct Address
+	{
+		std::string street;
+		int number = 0;
+	};
+
+	struct Person
+	{
+		std::string name;
+		Poco::UInt8 age = 0;
+		double height = 0;
+		bool married = false;
+		std::vector<std::string> children;
+		std::map<std::string, Poco::Int64> scores;
+		Poco::Nullable<Address> address;
+		std::vector<Address> previousAddresses;
+	};
+}
+
+
+POCO_JSON_MAPPING_BEGIN(Address)
+	POCO_JSON_MAPPING_MEMBER(street)
+	POCO_JSON_MAPPING_MEMBER(number)
+POCO_JSON_MAPPING_END
+
+
+POCO_JSON_MAPPING_BEGIN(Person)
+	POCO_JSON_MAPPING_MEMBER(name)
+	POCO_JSON_MAPPING_MEMBER(age)
+	POCO_JSON_MAPPING_MEMBER(height)
+	POCO_JSON_MAPPING_MEMBER(married)
+	POCO_JSON_MAPPING_MEMBER_NAMED("kids", children)
+	POCO_JSON_MAPPING_MEMBER(scores)
+	POCO_JSON_MAPPING_MEMBER(address)
+	POCO_JSON_MAPPING_MEMBER(previousAddresses)
+POCO_JSON_MAPPING_END
+
 
 JSONTest::JSONTest(const std::string& name): CppUnit::TestCase("JSON")
 {
@@ -1972,6 +2019,716 @@ void JSONTest::testInvalidUnicodeJanssonFiles()
 }
 
 
+void JSONTest::testReader()
+{
+	std::string json = "{ \"name\" : \"Franky\", \"age\" : 42, \"weight\" : -71.5e0, "
+		"\"children\" : [ \"Jonas\", \"Ellen\" ], \"married\" : true, \"pet\" : null, \"address\" : {} }";
+
+	Reader reader(json);
+	assertTrue (reader.token() == Reader::TOKEN_NONE);
+	assertTrue (reader.next() == Reader::TOKEN_BEGIN_OBJECT);
+	assertTrue (reader.depth() == 1);
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.raw() == "name");
+	assertTrue (reader.next() == Reader::TOKEN_STRING);
+	assertTrue (reader.string() == "Franky");
+	assertTrue (reader.raw().data() == json.data() + 12);
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.next() == Reader::TOKEN_NUMBER);
+	assertTrue (reader.isInteger());
+	assertTrue (reader.asInt64() == 42);
+	assertTrue (reader.asUInt64() == 42);
+	assertTrue (reader.asDouble() == 42.0);
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.next() == Reader::TOKEN_NUMBER);
+	assertTrue (!reader.isInteger());
+	assertTrue (reader.raw() == "-71.5e0");
+	assertTrue (reader.asDouble() == -71.5);
+	try
+	{
+		reader.asInt64();
+		fail ("not an integer - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.string() == "children");
+	assertTrue (reader.next() == Reader::TOKEN_BEGIN_ARRAY);
+	assertTrue (reader.depth() == 2);
+	reader.skip();
+	assertTrue (reader.token() == Reader::TOKEN_END_ARRAY);
+	assertTrue (reader.depth() == 1);
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.next() == Reader::TOKEN_TRUE);
+	assertTrue (reader.asBool());
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.next() == Reader::TOKEN_NULL);
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.next() == Reader::TOKEN_BEGIN_OBJECT);
+	assertTrue (reader.next() == Reader::TOKEN_END_OBJECT);
+	assertTrue (reader.next() == Reader::TOKEN_END_OBJECT);
+	assertTrue (reader.depth() == 0);
+	assertTrue (reader.next() == Reader::TOKEN_END);
+	assertTrue (reader.next() == Reader::TOKEN_END);
+
+	Reader numbers("[0, -0, 9223372036854775807, -9223372036854775808, 18446744073709551615, 18446744073709551616, 1.5E+3, 1e-2]");
+	assertTrue (numbers.next() == Reader::TOKEN_BEGIN_ARRAY);
+	numbers.next();
+	assertTrue (numbers.asInt64() == 0);
+	numbers.next();
+	assertTrue (numbers.asInt64() == 0);
+	try
+	{
+		numbers.asUInt64();
+		fail ("negative - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+	numbers.next();
+	assertTrue (numbers.asInt64() == std::numeric_limits<Poco::Int64>::max());
+	numbers.next();
+	assertTrue (numbers.asInt64() == std::numeric_limits<Poco::Int64>::min());
+	numbers.next();
+	assertTrue (numbers.asUInt64() == std::numeric_limits<Poco::UInt64>::max());
+	try
+	{
+		numbers.asInt64();
+		fail ("out of range - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+	numbers.next();
+	try
+	{
+		numbers.asUInt64();
+		fail ("out of range - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+	assertTrue (numbers.asDouble() == 18446744073709551616.0);
+	numbers.next();
+	assertTrue (numbers.asDouble() == 1500.0);
+	numbers.next();
+	assertTrue (numbers.asDouble() == 0.01);
+	assertTrue (numbers.next() == Reader::TOKEN_END_ARRAY);
+	assertTrue (numbers.next() == Reader::TOKEN_END);
+}
+
+
+void JSONTest::testReaderEscapes()
+{
+	std::string json = "{\"a\\\"b\" : \"line\\nbreak \\u00e4\\u20AC\\ud83d\\ude00 \\/\\\\\"}";
+
+	Reader reader(json);
+	reader.next();
+	assertTrue (reader.next() == Reader::TOKEN_KEY);
+	assertTrue (reader.hasEscapes());
+	assertTrue (reader.raw() == "a\\\"b");
+	assertTrue (reader.string() == "a\"b");
+	assertTrue (reader.next() == Reader::TOKEN_STRING);
+	std::string expected("line\nbreak \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80 /\\");
+	assertTrue (reader.string() == expected);
+	assertTrue (reader.hasEscapes());
+
+	std::string buffer(json);
+	Reader inSitu(&buffer[0], buffer.size(), true);
+	inSitu.next();
+	inSitu.next();
+	assertTrue (inSitu.string() == "a\"b");
+	assertTrue (!inSitu.hasEscapes());
+	assertTrue (inSitu.raw() == "a\"b");
+	inSitu.next();
+	std::string_view value = inSitu.string();
+	assertTrue (value == expected);
+	assertTrue (value.data() >= buffer.data() && value.data() < buffer.data() + buffer.size());
+	assertTrue (inSitu.next() == Reader::TOKEN_END_OBJECT);
+	assertTrue (inSitu.next() == Reader::TOKEN_END);
+
+	// long strings are scanned in words
+	std::string longString(1000, 'x');
+	longString[997] = '\t';
+	std::string longJson = "[\"" + longString + "\"]";
+	Reader longReader(longJson);
+	longReader.next();
+	try
+	{
+		longReader.next();
+		fail ("control character - must throw");
+	}
+	catch (JSONException& exc)
+	{
+		assertTrue (exc.message().find("offset 999") != std::string::npos);
+	}
+
+	Reader surrogate("[\"\\ud83d\"]");
+	surrogate.next();
+	surrogate.next();
+	try
+	{
+		surrogate.string();
+		fail ("lone surrogate - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
+void JSONTest::testReaderErrors()
+{
+	const char* invalid[] =
+	{
+		"", " ", "{", "[", "[1,]", "{\"a\":1,}", "{\"a\" 1}", "{1:2}", "[1 2]", "01", "-", "1.", "1e", "1.e5",
+		"+1", "tru", "nul", "truex", "[1]]", "{}}", "[1] x", "\"abc", "\"a\\x\"", "\"\\u12g4\"", "[\"a\",]", "'a'",
+		"\"\xC0\xAF\"", "\"\xED\xA0\x80\"", "\"\xE2\x82\""
+	};
+	for (std::size_t i = 0; i < sizeof(invalid)/sizeof(invalid[0]); ++i)
+	{
+		Reader reader(invalid[i]);
+		try
+		{
+			while (reader.next() != Reader::TOKEN_END);
+			fail (std::string("must throw: ") + invalid[i]);
+		}
+		catch (JSONException&)
+		{
+		}
+	}
+
+	Reader overflow("[1e400]");
+	overflow.next();
+	overflow.next();
+	try
+	{
+		overflow.asDouble();
+		fail ("out of range - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	Reader utf8("[\"\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80\"]");
+	utf8.next();
+	assertTrue (utf8.next() == Reader::TOKEN_STRING);
+	assertTrue (utf8.string().size() == 9);
+
+	Reader deep("[[[[1]]]]");
+	deep.setMaxDepth(3);
+	deep.next();
+	deep.next();
+	deep.next();
+	try
+	{
+		deep.next();
+		fail ("maximum depth exceeded - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
+void JSONTest::testReaderHandler()
+{
+	std::string json = "{ \"name\" : \"Fra\\u006eky\", \"children\" : [ \"Jonas\", \"Ellen\" ], "
+		"\"numbers\" : [ 1, -2, 18446744073709551615, 1.25 ], \"flags\" : [ true, false, null ], \"empty\" : {} }";
+
+	Parser parser;
+	Var expected = parser.parse(json);
+
+	Reader reader(json);
+	Var result = reader.parse();
+	assertTrue (reader.token() == Reader::TOKEN_END);
+	assertTrue (result.type() == typeid(Object::Ptr));
+
+	std::ostringstream expectedStream;
+	Stringifier::stringify(expected, expectedStream);
+	std::ostringstream resultStream;
+	Stringifier::stringify(result, resultStream);
+	assertTrue (resultStream.str() == expectedStream.str());
+
+	// read a nested value
+	std::ostringstream ostr;
+	PrintHandler printHandler(ostr);
+	Reader nested(json);
+	nested.next();
+	nested.next();
+	nested.skip();
+	nested.next();
+	nested.read(printHandler);
+	assertTrue (ostr.str() == "[\"Jonas\",\"Ellen\"]");
+	assertTrue (nested.next() == Reader::TOKEN_KEY);
+
+	Reader excess("[] []");
+	try
+	{
+		excess.parse();
+		fail ("excess characters - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	Poco::Path pathPattern(getTestFilesPath("valid"));
+	std::set<std::string> paths;
+	Poco::Glob::glob(pathPattern, paths);
+	for (std::set<std::string>::iterator it = paths.begin(); it != paths.end(); ++it)
+	{
+		Poco::Path filePath(*it, "input");
+		if (filePath.isFile() && Poco::File(filePath).exists())
+		{
+			Poco::FileInputStream fis(filePath.toString());
+			std::string input;
+			Poco::StreamCopier::copyToString(fis, input);
+
+			Reader fileReader(input);
+			try
+			{
+				fileReader.parse();
+			}
+			catch (Poco::Exception& exc)
+			{
+				fail (filePath.toString() + ": " + exc.displayText());
+			}
+		}
+	}
+}
+
+
+void JSONTest::testDocument()
+{
+	std::string json = "{ \"name\" : \"Fra\\u006eky\", \"age\" : 42, \"big\" : 18446744073709551615, \"negative\" : -7, "
+		"\"pi\" : 3.25, \"children\" : [ \"Jonas\", \"Ellen\" ], \"flags\" : [ true, false, null ], \"empty\" : {}, \"none\" : [] }";
+
+	Document doc(json);
+	assertTrue (!doc.empty());
+	assertTrue (doc.arenaSize() >= Document::MIN_BLOCK_SIZE);
+
+	Node root = doc.root();
+	assertTrue (root.isObject());
+	assertTrue (root.size() == 9);
+	assertTrue (root.key(0) == "name");
+	assertTrue (root["name"].getString() == "Franky");
+	assertTrue (root["age"].type() == Node::NODE_INTEGER);
+	assertTrue (root["age"].getInt64() == 42);
+	assertTrue (root["age"].getDouble() == 42.0);
+	assertTrue (root["big"].type() == Node::NODE_UNSIGNED);
+	assertTrue (root["big"].getUInt64() == std::numeric_limits<Poco::UInt64>::max());
+	assertTrue (root["negative"].getInt64() == -7);
+	assertTrue (root["pi"].getDouble() == 3.25);
+	assertTrue (root["children"].isArray());
+	assertTrue (root["children"].size() == 2);
+	assertTrue (root["children"][1].getString() == "Ellen");
+	assertTrue (root["flags"][0].getBool());
+	assertTrue (!root["flags"][1].getBool());
+	assertTrue (root["flags"][2].isValid());
+	assertTrue (root["flags"][2].isNull());
+	assertTrue (root["empty"].isObject());
+	assertTrue (root["empty"].size() == 0);
+	assertTrue (root["none"].isArray());
+	assertTrue (root["none"].size() == 0);
+	assertTrue (root.at(5) == root["children"]);
+
+	// missing values
+	assertTrue (!root["missing"].isValid());
+	assertTrue (!root["missing"]["deeper"][3].isValid());
+	assertTrue (!root["children"][2].isValid());
+	assertTrue (!root["name"]["first"].isValid());
+	assertTrue (!root.has("missing"));
+	assertTrue (root.has("none"));
+
+	try
+	{
+		root["big"].getInt64();
+		fail ("value does not fit - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+
+	try
+	{
+		root["name"].getInt64();
+		fail ("not a number - must throw");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+
+	try
+	{
+		root.at(9);
+		fail ("index out of range - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+
+	// copy to Object and Array
+	Var var = root.toVar();
+	assertTrue (var.type() == typeid(Object::Ptr));
+	Object::Ptr pObject = var.extract<Object::Ptr>();
+	assertTrue (pObject->getValue<std::string>("name") == "Franky");
+	assertTrue (pObject->getValue<Poco::Int64>("age") == 42);
+	assertTrue (pObject->getArray("children")->getElement<std::string>(0) == "Jonas");
+	assertTrue (pObject->get("flags").extract<Poco::JSON::Array::Ptr>()->isNull(2));
+
+	// move
+	Document moved(std::move(doc));
+	assertTrue (doc.empty());
+	assertTrue (!doc.root().isValid());
+	assertTrue (moved.root() == root);
+	assertTrue (root["name"].getString() == "Franky");
+
+	moved.clear();
+	assertTrue (moved.empty());
+	assertTrue (moved.arenaSize() == 0);
+
+	// scalar documents
+	Document scalar(" \"text\" ");
+	assertTrue (scalar.root().getString() == "text");
+	scalar.parse("-12");
+	assertTrue (scalar.root().getInt64() == -12);
+	scalar.parse("null");
+	assertTrue (scalar.root().isValid());
+	assertTrue (scalar.root().isNull());
+
+	try
+	{
+		scalar.parse("{ \"a\" : [1, 2 }");
+		fail ("invalid JSON - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+	assertTrue (scalar.empty());
+
+	// many values, spread over several blocks
+	std::ostringstream ostr;
+	ostr << '[';
+	for (int i = 0; i < 10000; ++i)
+	{
+		if (i > 0) ostr << ',';
+		ostr << "{\"i\":" << i << ",\"s\":\"v" << i << "\"}";
+	}
+	ostr << ']';
+	Document large(ostr.str());
+	assertTrue (large.root().size() == 10000);
+	assertTrue (large.root()[9999]["i"].getInt64() == 9999);
+	assertTrue (large.root()[1234]["s"].getString() == "v1234");
+}
+
+
+void JSONTest::testDocumentLookup()
+{
+	// duplicate keys: the last one wins, as with Object
+	Document small("{ \"a\" : 1, \"b\" : 2, \"a\" : 3 }");
+	assertTrue (small.root().size() == 3);
+	assertTrue (small.root()["a"].getInt64() == 3);
+	assertTrue (small.root()["b"].getInt64() == 2);
+
+	// objects with more than LINEAR_LOOKUP_LIMIT members use the sorted index
+	std::ostringstream ostr;
+	ostr << '{';
+	for (int i = 0; i < 100; ++i)
+	{
+		ostr << "\"key" << (i*37) % 100 << "\":" << i << ',';
+	}
+	ostr << "\"key5\":\"last\",\"\":\"empty\"}";
+
+	Document doc(ostr.str());
+	Node root = doc.root();
+	assertTrue (root.size() == 102);
+	for (int i = 0; i < 100; ++i)
+	{
+		std::string key = "key" + std::to_string((i*37) % 100);
+		if (key == "key5") continue;
+		assertTrue (root[key].isValid());
+		assertTrue (root[key].getInt64() == i);
+	}
+	assertTrue (root["key5"].getString() == "last");
+	assertTrue (root[""].getString() == "empty");
+	assertTrue (!root["key100"].isValid());
+	assertTrue (!root["key"].isValid());
+	assertTrue (!root["a"].isValid());
+	assertTrue (!root["z"].isValid());
+	assertTrue (root.key(0) == "key0");
+	assertTrue (root.key(1) == "key37");
+
+	Object::Ptr pObject = root.toVar().extract<Object::Ptr>();
+	assertTrue (pObject->size() == 101);
+	assertTrue (pObject->getValue<std::string>("key5") == "last");
+}
+
+
+void JSONTest::testDocumentStringify()
+{
+	// keys in sorted order, so the output of Parser and Stringifier,
+	// which sorts the keys, is comparable
+	std::string json = "{ \"a\\\"b\" : \"line\\nbreak\", \"children\" : [ \"Jonas\", { \"age\" : 7, \"name\" : \"Ellen\" } ], "
+		"\"empty\" : {}, \"flags\" : [ true, false, null ], \"none\" : [], \"numbers\" : [ 1, -2, 18446744073709551615, 1.25, 1e20 ] }";
+
+	Var expected = Parser().parse(json);
+	Document doc(json);
+
+	for (unsigned int indent = 0; indent < 3; ++indent)
+	{
+		std::ostringstream expectedStream;
+		Stringifier::stringify(expected, expectedStream, indent);
+		std::ostringstream resultStream;
+		Stringifier::stringify(doc.root(), resultStream, indent);
+		assertEquals (expectedStream.str(), resultStream.str());
+	}
+
+	std::ostringstream expectedStream;
+	Stringifier::stringify(expected, expectedStream, 4, 2);
+	std::ostringstream resultStream;
+	doc.root().stringify(resultStream, 4, 2);
+	assertEquals (expectedStream.str(), resultStream.str());
+
+	Var node = doc.root()["children"];
+	assertTrue (node.convert<std::string>() == "[\"Jonas\",{\"age\":7,\"name\":\"Ellen\"}]");
+
+	std::ostringstream scalarStream;
+	Stringifier::stringify(doc.root()["a\"b"], scalarStream);
+	assertTrue (scalarStream.str() == "\"line\\nbreak\"");
+}
+
+
+void JSONTest::testDocumentQuery()
+{
+	std::string json = "{ \"name\" : \"Franky\", \"children\" : [ \"Jonas\", \"Ellen\" ], "
+		"\"address\" : { \"street\" : \"Main Street\", \"number\" : 12 }, \"spouse\" : null }";
+
+	Document doc(json);
+	Query query(doc.root());
+
+	assertTrue (query.find("name").type() == typeid(std::string));
+	assertTrue (query.findValue<std::string>("name", "") == "Franky");
+	assertTrue (query.findValue<std::string>("children[1]", "") == "Ellen");
+	assertTrue (query.findValue<int>("address.number", 0) == 12);
+	assertTrue (query.findValue<std::string>("address.city", "none") == "none");
+	assertTrue (query.find("children[2]").isEmpty());
+	assertTrue (query.find("missing.children[0]").isEmpty());
+	assertTrue (query.find("spouse").isEmpty());
+
+	Var address = query.find("address");
+	assertTrue (address.type() == typeid(Node));
+	assertTrue (address.extract<Node>()["street"].getString() == "Main Street");
+
+	Object::Ptr pAddress = query.findObject("address");
+	assertTrue (!pAddress.isNull());
+	assertTrue (pAddress->getValue<std::string>("street") == "Main Street");
+	assertTrue (query.findObject("children").isNull());
+
+	Poco::JSON::Array::Ptr pChildren = query.findArray("children");
+	assertTrue (!pChildren.isNull());
+	assertTrue (pChildren->size() == 2);
+	assertTrue (pChildren->getElement<std::string>(0) == "Jonas");
+	assertTrue (query.findArray("address").isNull());
+
+	Object object;
+	query.findObject("address", object);
+	assertTrue (object.getValue<int>("number") == 12);
+
+	Poco::JSON::Array array;
+	query.findArray("children", array);
+	assertTrue (array.size() == 2);
+
+	Document arrayDoc("[ { \"name\" : \"Jonas\" }, { \"name\" : \"Ellen\" } ]");
+	Query arrayQuery(arrayDoc.root());
+	assertTrue (arrayQuery.findValue<std::string>("[1].name", "") == "Ellen");
+}
+
+
+void JSONTest::testWriter()
+{
+	Poco::Buffer<char> buffer(0);
+	Writer writer(buffer);
+	writer.startObject();
+	writer.key("name");
+	writer.value("Fra\"nky");
+	writer.key("children");
+	writer.startArray();
+	writer.value(std::string("Jonas"));
+	writer.value(std::string_view("Ellen"));
+	writer.startObject();
+	writer.endObject();
+	writer.startArray();
+	writer.endArray();
+	writer.endArray();
+	writer.key("numbers");
+	writer.startArray();
+	writer.value(0);
+	writer.value(-12);
+	writer.value(std::numeric_limits<Poco::Int64>::min());
+	writer.value(std::numeric_limits<Poco::UInt64>::max());
+	writer.value(1.25);
+	writer.value(0.1f);
+	writer.value(1e20);
+	writer.value(std::numeric_limits<double>::infinity());
+	writer.endArray();
+	writer.key("flags");
+	writer.startArray();
+	writer.value(true);
+	writer.value(false);
+	writer.null();
+	writer.endArray();
+	writer.key("raw");
+	writer.raw("{\"a\":[1,2]}");
+	writer.key("line\nbreak");
+	writer.value("tab\tand \xC3\xA4");
+	writer.endObject();
+
+	std::string json(buffer.begin(), buffer.size());
+	assertEquals ("{\"name\":\"Fra\\\"nky\",\"children\":[\"Jonas\",\"Ellen\",{},[]],"
+		"\"numbers\":[0,-12,-9223372036854775808,18446744073709551615,1.25,0.1,1e+20,null],"
+		"\"flags\":[true,false,null],\"raw\":{\"a\":[1,2]},\"line\\nbreak\":\"tab\\tand \xC3\xA4\"}", json);
+
+	// the output is valid JSON and agrees with Parser and Stringifier
+	Var result = Parser().parse(json);
+	Object::Ptr pObject = result.extract<Object::Ptr>();
+	assertTrue (pObject->getValue<std::string>("name") == "Fra\"nky");
+	assertTrue (pObject->getArray("numbers")->getElement<Poco::UInt64>(3) == std::numeric_limits<Poco::UInt64>::max());
+
+	Poco::Buffer<char> escaped(0);
+	Writer unicodeWriter(escaped, Poco::JSON_ESCAPE_UNICODE);
+	unicodeWriter.value("\xC3\xA4");
+	std::ostringstream ostr;
+	Stringifier::stringify(std::string("\xC3\xA4"), ostr, 0, -1, Poco::JSON_WRAP_STRINGS | Poco::JSON_ESCAPE_UNICODE);
+	assertEquals (ostr.str(), std::string(escaped.begin(), escaped.size()));
+
+	// the writer appends to the buffer
+	Writer second(buffer);
+	second.value(42);
+	assertTrue (std::string(buffer.begin(), buffer.size()) == json + "42");
+}
+
+
+void JSONTest::testTypeMapping()
+{
+	Person person;
+	person.name = "Homer";
+	person.age = 39;
+	person.height = 1.83;
+	person.married = true;
+	person.children.push_back("Bart");
+	person.children.push_back("Lisa");
+	person.scores["bowling"] = 120;
+	person.scores["donuts"] = -3;
+	Address address;
+	address.street = "Evergreen Terrace";
+	address.number = 742;
+	person.address = address;
+	person.previousAddresses.push_back(address);
+
+	Poco::Buffer<char> buffer(0);
+	serialize(person, buffer);
+	std::string json(buffer.begin(), buffer.size());
+	assertEquals ("{\"name\":\"Homer\",\"age\":39,\"height\":1.83,\"married\":true,\"kids\":[\"Bart\",\"Lisa\"],"
+		"\"scores\":{\"bowling\":120,\"donuts\":-3},\"address\":{\"street\":\"Evergreen Terrace\",\"number\":742},"
+		"\"previousAddresses\":[{\"street\":\"Evergreen Terrace\",\"number\":742}]}", json);
+
+	Person copy;
+	deserialize(json, copy);
+	assertTrue (copy.name == "Homer");
+	assertTrue (copy.age == 39);
+	assertTrue (copy.height == 1.83);
+	assertTrue (copy.married);
+	assertTrue (copy.children == person.children);
+	assertTrue (copy.scores == person.scores);
+	assertTrue (!copy.address.isNull());
+	assertTrue (copy.address.value().street == "Evergreen Terrace");
+	assertTrue (copy.address.value().number == 742);
+	assertTrue (copy.previousAddresses.size() == 1);
+	assertTrue (copy.previousAddresses[0].number == 742);
+
+	// unknown members are skipped, missing members are left alone,
+	// members in any order, escaped keys and null
+	Person other;
+	other.height = 2.5;
+	deserialize(std::string_view("{ \"unknown\" : { \"a\" : [1, {\"b\" : null}] }, \"kids\" : [], \"na\\u006de\" : \"Marge\", "
+		"\"address\" : null, \"extra\" : 1, \"age\" : 36 }"), other);
+	assertTrue (other.name == "Marge");
+	assertTrue (other.age == 36);
+	assertTrue (other.height == 2.5);
+	assertTrue (other.children.empty());
+	assertTrue (other.address.isNull());
+
+	// top-level containers and scalars
+	std::vector<Poco::Nullable<int>> numbers;
+	deserialize(std::string_view("[1, null, -3]"), numbers);
+	assertTrue (numbers.size() == 3);
+	assertTrue (numbers[0].value() == 1);
+	assertTrue (numbers[1].isNull());
+	assertTrue (numbers[2].value() == -3);
+
+	buffer.resize(0);
+	serialize(numbers, buffer);
+	assertTrue (std::string(buffer.begin(), buffer.size()) == "[1,null,-3]");
+
+	// type errors
+	Person invalid;
+	try
+	{
+		deserialize(std::string_view("{ \"age\" : 300 }"), invalid);
+		fail ("value out of range - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	try
+	{
+		deserialize(std::string_view("{ \"age\" : -1 }"), invalid);
+		fail ("value out of range - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	try
+	{
+		deserialize(std::string_view("{ \"name\" : 12 }"), invalid);
+		fail ("not a string - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	try
+	{
+		deserialize(std::string_view("{ \"kids\" : \"Bart\" }"), invalid);
+		fail ("not an array - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	try
+	{
+		deserialize(std::string_view("[]"), invalid);
+		fail ("not an object - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	try
+	{
+		deserialize(std::string_view("{} {}"), invalid);
+		fail ("excess characters - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
 void JSONTest::testTemplate()
 {
 	Template tpl;
@@ -1989,6 +2746,136 @@ void JSONTest::testTemplate()
 }
 
 
+void JSONTest::testTemplateBlocks()
+{
+	Template tpl;
+	tpl.parse(
+		"<?for p persons?>"
+		"<?= p.name?>:"
+		"<?if p.age?><?= p.age?><?elsif p.unknown?>?<?else?>-<?endif?>"
+		"<?for c p.children?> <?= c?><?endfor?>"
+		"<?ifexist p.pet?> (<?= p.pet?>)<?endif?>;"
+		"<?endfor?>"
+		"<?= persons[1].children[0]?>");
+
+	Object::Ptr data = new Object;
+	Poco::JSON::Array::Ptr persons = new Poco::JSON::Array;
+	Object::Ptr person = new Object;
+	person->set("name", "Franky");
+	person->set("age", 42);
+	Poco::JSON::Array::Ptr children = new Poco::JSON::Array;
+	children->add("Jonas");
+	children->add("Ellen");
+	person->set("children", children);
+	person->set("pet", "Rex");
+	persons->add(person);
+	person = new Object;
+	person->set("name", "Jonas");
+	person->set("unknown", true);
+	children = new Poco::JSON::Array;
+	children->add("Tom");
+	person->set("children", children);
+	persons->add(person);
+	person = new Object;
+	person->set("name", "Ellen");
+	persons->add(person);
+	data->set("persons", persons);
+
+	const std::string expected = "Franky:42 Jonas Ellen (Rex);Jonas:? Tom;Ellen:-;Tom";
+
+	std::ostringstream ostr;
+	tpl.render(data, ostr);
+	assertEqual (expected, ostr.str());
+
+	// rendering does not change the data
+	assertTrue (!data->has("p"));
+	assertTrue (!data->has("c"));
+
+	Poco::Buffer<char> buffer(0);
+	tpl.render(data, buffer);
+	assertEqual (expected, std::string(buffer.begin(), buffer.size()));
+	tpl.render(data, buffer);
+	assertEqual (expected + expected, std::string(buffer.begin(), buffer.size()));
+
+	Template errors;
+	try
+	{
+		errors.parse("x<?else?>y");
+		fail ("else without if - must throw");
+	}
+	catch (JSONTemplateException&)
+	{
+	}
+	try
+	{
+		errors.parse("<?for x?>x<?endfor?>");
+		fail ("missing query - must throw");
+	}
+	catch (JSONTemplateException&)
+	{
+	}
+	try
+	{
+		errors.parse("<?if a?>x<?endfor?>");
+		fail ("endfor without for - must throw");
+	}
+	catch (JSONTemplateException&)
+	{
+	}
+}
+
+
+void JSONTest::testTemplateCache()
+{
+	Path dir(Path::temp());
+	dir.pushDirectory("JSONTemplateCacheTest");
+	File(dir).createDirectories();
+	Path file(dir, "test.tpl");
+	{
+		FileOutputStream ostr(file.toString());
+		ostr << "Hello <?= name?>!";
+	}
+
+	Object::Ptr data = new Object;
+	data->set("name", "Franky");
+	try
+	{
+		TemplateCache cache;
+		Template::Ptr pTemplate = cache.getTemplate(file);
+		assertTrue (!pTemplate.isNull());
+		std::ostringstream ostr;
+		pTemplate->render(data, ostr);
+		assertEqual (std::string("Hello Franky!"), ostr.str());
+		assertTrue (cache.getTemplate(file) == pTemplate);
+
+		Poco::Thread::sleep(1100);
+		{
+			FileOutputStream ostr(file.toString());
+			ostr << "Bye <?= name?>!";
+		}
+
+		// changes may be reported with a delay
+		Template::Ptr pChanged;
+		for (int i = 0; i < 100; ++i)
+		{
+			pChanged = cache.getTemplate(file);
+			if (pChanged != pTemplate) break;
+			Poco::Thread::sleep(100);
+		}
+		assertTrue (pChanged != pTemplate);
+		ostr.str("");
+		pChanged->render(data, ostr);
+		assertEqual (std::string("Bye Franky!"), ostr.str());
+	}
+	catch (...)
+	{
+		File(dir).remove(true);
+		throw;
+	}
+	File(dir).remove(true);
+}
+
+
 void JSONTest::testUnicode()
 {
 	const unsigned char supp[] = {0x61, 0xE1, 0xE9, 0x78, 0xED, 0xF3, 0xFA, 0x0};
@@ -2417,6 +3304,8 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testInvalidJanssonFiles);
 	CppUnit_addTest(pSuite, JSONTest, testInvalidUnicodeJanssonFiles);
 	CppUnit_addTest(pSuite, JSONTest, testTemplate);
+	CppUnit_addTest(pSuite, JSONTest, testTemplateBlocks);
+	CppUnit_addTest(pSuite, JSONTest, testTemplateCache);
 	CppUnit_addTest(pSuite, JSONTest, testUnicode);
 	CppUnit_addTest(pSuite, JSONTest, testEscape0);
 	CppUnit_addTest(pSuite, JSONTest, testNonEscapeUnicode);
@@ -2424,6 +3313,16 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testCopy);
 	CppUnit_addTest(pSuite, JSONTest, testMove);
 	CppUnit_addTest(pSuite, JSONTest, testRemove);
+	CppUnit_addTest(pSuite, JSONTest, testReader);
+	CppUnit_addTest(pSuite, JSONTest, testReaderEscapes);
+	CppUnit_addTest(pSuite, JSONTest, testReaderErrors);
+	CppUnit_addTest(pSuite, JSONTest, testReaderHandler);
+	CppUnit_addTest(pSuite, JSONTest, testDocument);
+	CppUnit_addTest(pSuite, JSONTest, testDocumentLookup);
+	CppUnit_addTest(pSuite, JSONTest, testDocumentStringify);
+	CppUnit_addTest(pSuite, JSONTest, testDocumentQuery);
+	CppUnit_addTest(pSuite, JSONTest, testWriter);
+	CppUnit_addTest(pSuite, JSONTest, testTypeMapping);
 
 	return pSuite;
 }
@@ -24,6 +24,10 @@
 #include "Poco/JSON/ParseHandler.h"
 #include "Poco/JSON/PrintHandler.h"
 #include "Poco/JSON/Template.h"
+#include "Poco/JSON/TemplateCache.h"
+#include "Poco/JSON/Reader.h"
+#include "Poco/JSON/Document.h"
+#include "Poco/JSON/TypeMapping.h"
 #include <sstream>
 
 
@@ -76,6 +80,8 @@ public:
 	void testValidJanssonFiles();
 	void testInvalidJanssonFiles();
 	void testTemplate();
+	void testTemplateBlocks();
+	void testTemplateCache();
 	void testUnicode();
 	void testInvalidUnicodeJanssonFiles();
 	void testEscape0();
@@ -85,6 +91,16 @@ public:
 	void testCopy();
 	void testMove();
 	void testRemove();
+	void testReader();
+	void testReaderEscapes();
+	void testReaderErrors();
+	void testReaderHandler();
+	void testDocument();
+	void testDocumentLookup();
+	void testDocumentStringify();
+	void testDocumentQuery();
+	void testWriter();
+	void testTypeMapping();
 
 	void setUp();
 	void tearDown();
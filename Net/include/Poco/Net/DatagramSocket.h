@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
+#include "Poco/Net/DatagramSocketImpl.h"
 #include "Poco/Buffer.h"
 
 
@@ -32,6 +33,9 @@ class Net_API DatagramSocket: public Socket
 	/// UDP stream socket.
 {
 public:
+	using Datagram = DatagramSocketImpl::Datagram;
+	using DatagramVec = DatagramSocketImpl::DatagramVec;
+
 	DatagramSocket();
 		/// Creates an unconnected, unbound datagram socket.
 		///
@@ -270,6 +274,37 @@ public:
 		/// The flags parameter can be used to pass system-defined flags
 		/// for recvfrom() like MSG_PEEK.
 
+	int receiveBatch(DatagramVec& datagrams, int flags = 0);
+		/// Receives up to datagrams.size() datagrams, each into
+		/// the buffer of the respective Datagram, with as few system
+		/// calls as possible (a single recvmmsg() call on Linux).
+		/// Stores the number of bytes received and the address
+		/// of the sender in each received Datagram.
+		///
+		/// Returns the number of datagrams received, which is at most
+		/// DatagramSocketImpl::MAX_BATCH_SIZE, or -1 if the socket is
+		/// non-blocking and no datagram is available.
+		///
+		/// See DatagramSocketImpl::receiveBatch() for more information.
+
+	int sendBatch(const DatagramVec& datagrams, int flags = 0);
+		/// Sends all datagrams to their respective addresses, with
+		/// as few system calls as possible (sendmmsg() on Linux).
+		///
+		/// Returns the number of datagrams sent, which may be less than
+		/// datagrams.size() if the socket is non-blocking.
+		///
+		/// See DatagramSocketImpl::sendBatch() for more information.
+
+	void setGRO(bool flag);
+		/// Enables or disables UDP generic receive offload
+		/// (Linux only).
+		///
+		/// See DatagramSocketImpl::setGRO() for more information.
+
+	bool getGRO() const;
+		/// Returns true if UDP generic receive offload is enabled.
+
 	void setBroadcast(bool flag);
 		/// Sets the value of the SO_BROADCAST socket option.
 		///
@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/SocketImpl.h"
+#include <vector>
 
 
 namespace Poco {
@@ -42,6 +43,70 @@ public:
 	DatagramSocketImpl(poco_socket_t sockfd);
 		/// Creates a StreamSocketImpl using the given native socket.
 
+	struct Datagram
+		/// A datagram sent with sendBatch() or received
+		/// with receiveBatch().
+	{
+		void*         buffer = nullptr; /// The payload.
+		int           capacity = 0;     /// The size of buffer (receiveBatch() only).
+		int           length = 0;       /// The number of bytes to send, or the number of bytes received.
+		SocketAddress address;          /// The destination, or the address of the sender.
+		int           segmentSize = 0;  /// The UDP GSO/GRO segment size, or 0 if the datagram is not segmented.
+	};
+
+	using DatagramVec = std::vector<Datagram>;
+
+	enum
+	{
+		MAX_BATCH_SIZE = 64 /// Maximum number of datagrams transferred with a single system call.
+	};
+
+	int receiveBatch(Datagram* pDatagrams, int count, int flags = 0);
+		/// Receives up to count datagrams into the given datagrams' buffers.
+		/// Stores the number of bytes received and the address of the sender
+		/// of each datagram.
+		///
+		/// On Linux, all datagrams are received with a single recvmmsg()
+		/// system call, which only blocks until the first datagram
+		/// is available. On other platforms, datagrams are received one
+		/// by one for as long as the socket is readable.
+		///
+		/// If generic receive offload is enabled (see setGRO()), a received
+		/// datagram may contain several coalesced datagrams from the same
+		/// sender, each segmentSize bytes long, except for the last one,
+		/// which may be shorter.
+		///
+		/// Returns the number of datagrams received, which is at most
+		/// MAX_BATCH_SIZE, or -1 if the socket is non-blocking and no
+		/// datagram is available.
+
+	int sendBatch(const Datagram* pDatagrams, int count, int flags = 0);
+		/// Sends count datagrams to their respective addresses.
+		///
+		/// On Linux, up to MAX_BATCH_SIZE datagrams are sent with
+		/// a single sendmmsg() system call. If a datagram has a non-zero
+		/// segmentSize, the kernel splits its payload into datagrams
+		/// of segmentSize bytes (generic segmentation offload), so
+		/// up to 64 datagrams can be sent with a single buffer.
+		/// Segmentation is not supported on other platforms.
+		///
+		/// Returns the number of datagrams sent, which may be less than
+		/// count if the socket is non-blocking.
+
+	void setGRO(bool flag);
+		/// Sets the value of the UDP_GRO socket option, which enables
+		/// generic receive offload (coalescing of received datagrams)
+		/// for receiveBatch().
+		///
+		/// Throws a NotImplementedException if not supported
+		/// by the platform.
+
+	bool getGRO();
+		/// Returns the value of the UDP_GRO socket option.
+		///
+		/// Throws a NotImplementedException if not supported
+		/// by the platform.
+
 protected:
 	void init(int af);
 
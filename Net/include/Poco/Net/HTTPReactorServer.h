@@ -0,0 +1,249 @@
+//
+// HTTPReactorServer.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServer
+//
+// Definition of the HTTPReactorServer class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPReactorServer_INCLUDED
+#define Net_HTTPReactorServer_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPReactorServerConnection.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Thread.h"
+#include "Poco/Timer.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Environment.h"
+#include <vector>
+#include <map>
+#include <atomic>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPReactorServer: public Poco::Runnable
+	/// An event-driven HTTP/1.0 and HTTP/1.1 server.
+	///
+	/// In contrast to HTTPServer, which ties up one thread for the
+	/// whole lifetime of a (persistent) connection, HTTPReactorServer
+	/// waits for requests on a number of SocketReactor instances,
+	/// each running in its own thread. Incoming data is buffered per
+	/// connection (see HTTPReactorServerConnection), and only
+	/// connections with a request ready to be handled are passed
+	/// to worker threads taken from a ThreadPool. Idle persistent
+	/// connections therefore only cost a socket and a small buffer,
+	/// but no thread.
+	///
+	/// Requests are handled by the same HTTPRequestHandlerFactory and
+	/// HTTPRequestHandler classes used with HTTPServer. As with HTTPServer,
+	/// the ServerSocket must be bound and in listening state.
+	///
+	/// The following HTTPServerParams are supported:
+	///   - maxThreads: maximum number of worker threads (defaults
+	///     to the capacity of the thread pool).
+	///   - maxQueued: maximum number of requests waiting for a
+	///     worker thread. Connections with requests exceeding this
+	///     limit are closed.
+	///   - threadIdleTime, threadPriority: as with TCPServer.
+	///   - timeout: maximum time to wait for the first request
+	///     on a new connection.
+	///   - keepAlive, keepAliveTimeout, maxKeepAliveRequests:
+	///     persistent connection handling.
+	///   - serverName, softwareVersion, autoDecodeHeaders: as with HTTPServer.
+{
+public:
+	HTTPReactorServer(HTTPRequestHandlerFactory::Ptr pFactory, const ServerSocket& socket, HTTPServerParams::Ptr pParams, unsigned reactors = Poco::Environment::processorCount());
+		/// Creates the HTTPReactorServer, using the given ServerSocket
+		/// and the given number of reactor threads.
+		///
+		/// The server takes ownership of the HTTPRequestHandlerFactory
+		/// and the HTTPServerParams.
+		///
+		/// Worker threads are taken from the default thread pool.
+
+	HTTPReactorServer(HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool, const ServerSocket& socket, HTTPServerParams::Ptr pParams, unsigned reactors = Poco::Environment::processorCount());
+		/// Creates the HTTPReactorServer, using the given ServerSocket
+		/// and the given number of reactor threads.
+		///
+		/// The server takes ownership of the HTTPRequestHandlerFactory
+		/// and the HTTPServerParams.
+		///
+		/// Worker threads are taken from the given thread pool.
+
+	~HTTPReactorServer();
+		/// Destroys the HTTPReactorServer. Stops the server,
+		/// if it is still running.
+
+	void start();
+		/// Starts the reactor threads and begins accepting connections.
+
+	void stop();
+		/// Stops the server.
+		///
+		/// No new connections are accepted, and all idle
+		/// connections are closed. Requests currently being
+		/// handled are allowed to complete; the method returns
+		/// after all worker threads have finished.
+
+	void stopAll(bool abortCurrent = false);
+		/// Stops the server. If abortCurrent is true, the sockets
+		/// of all connections with requests currently being handled
+		/// are shut down, causing these requests to abort.
+		///
+		/// Also fires the serverStopped event of the
+		/// HTTPRequestHandlerFactory.
+
+	const HTTPServerParams& params() const;
+		/// Returns a const reference to the HTTPServerParams
+		/// used by the server.
+
+	int currentThreads() const;
+		/// Returns the number of currently used worker threads.
+
+	int maxThreads() const;
+		/// Returns the maximum number of worker threads available.
+
+	int totalConnections() const;
+		/// Returns the total number of connections accepted
+		/// since the server was started.
+
+	int currentConnections() const;
+		/// Returns the number of currently open connections.
+
+	int totalRequests() const;
+		/// Returns the total number of requests handed
+		/// over to worker threads.
+
+	int queuedRequests() const;
+		/// Returns the number of requests waiting for
+		/// a worker thread.
+
+	int refusedRequests() const;
+		/// Returns the number of requests refused because
+		/// the queue was full.
+
+	const ServerSocket& socket() const;
+		/// Returns the underlying server socket.
+
+	Poco::UInt16 port() const;
+		/// Returns the port the server socket listens on.
+
+protected:
+	void run();
+		/// Worker thread main loop.
+
+	void onAccept(ReadableNotification* pNotification);
+	void onTimer(Poco::Timer& timer);
+
+	HTTPRequestHandlerFactory& factory();
+	HTTPServerParams::Ptr paramsPtr() const;
+	bool stopped() const;
+	bool dispatch(HTTPReactorServerConnection* pConnection);
+	void remove(HTTPReactorServerConnection* pConnection);
+
+private:
+	HTTPReactorServer();
+	HTTPReactorServer(const HTTPReactorServer&);
+	HTTPReactorServer& operator = (const HTTPReactorServer&);
+
+	void init();
+
+	using ReactorPtr = Poco::SharedPtr<SocketReactor>;
+	using ReactorVec = std::vector<ReactorPtr>;
+	using ConnectionMap = std::map<HTTPReactorServerConnection*, HTTPReactorServerConnection::Ptr>;
+
+	enum
+	{
+		SWEEP_INTERVAL = 1000
+	};
+
+	ServerSocket                   _socket;
+	HTTPRequestHandlerFactory::Ptr _pFactory;
+	HTTPServerParams::Ptr          _pParams;
+	Poco::ThreadPool&              _threadPool;
+	unsigned                       _reactorCount;
+	SocketReactor                  _acceptReactor;
+	Poco::Thread                   _acceptThread;
+	ReactorVec                     _reactors;
+	std::size_t                    _nextReactor;
+	Poco::Timer                    _timer;
+	ConnectionMap                  _connections;
+	Poco::NotificationQueue        _queue;
+	std::atomic<bool>              _started;
+	std::atomic<bool>              _stopped;
+	std::atomic<int>               _currentThreads;
+	std::atomic<int>               _totalConnections;
+	std::atomic<int>               _totalRequests;
+	std::atomic<int>               _refusedRequests;
+	mutable Poco::FastMutex        _mutex;
+	mutable Poco::FastMutex        _connectionsMutex;
+	Poco::Condition                _threadsDone;
+
+	friend class HTTPReactorServerConnection;
+};
+
+
+//
+// inlines
+//
+inline const HTTPServerParams& HTTPReactorServer::params() const
+{
+	return *_pParams;
+}
+
+
+inline HTTPServerParams::Ptr HTTPReactorServer::paramsPtr() const
+{
+	return _pParams;
+}
+
+
+inline HTTPRequestHandlerFactory& HTTPReactorServer::factory()
+{
+	return *_pFactory;
+}
+
+
+inline bool HTTPReactorServer::stopped() const
+{
+	return _stopped;
+}
+
+
+inline const ServerSocket& HTTPReactorServer::socket() const
+{
+	return _socket;
+}
+
+
+inline Poco::UInt16 HTTPReactorServer::port() const
+{
+	return _socket.address().port();
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPReactorServer_INCLUDED
@@ -0,0 +1,162 @@
+//
+// HTTPReactorServerConnection.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServerConnection
+//
+// Definition of the HTTPReactorServerConnection class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPReactorServerConnection_INCLUDED
+#define Net_HTTPReactorServerConnection_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Timestamp.h"
+#include <string>
+#include <atomic>
+
+
+namespace Poco {
+namespace Net {
+
+
+class SocketReactor;
+class HTTPServerSession;
+class HTTPReactorServer;
+
+
+class Net_API HTTPReactorServerConnection: public Poco::RefCountedObject
+	/// This class handles a single client connection of a
+	/// HTTPReactorServer.
+	///
+	/// While waiting for a request, the connection is registered
+	/// with a SocketReactor. Incoming data is collected in a
+	/// per-connection buffer until a request is ready to be handled,
+	/// i.e., until:
+	///
+	///   - the request header is complete and, if the request
+	///     has a Content-Length not exceeding MAX_PREREAD_SIZE,
+	///     the complete request body has been received, or
+	///   - the request header is complete and the request uses
+	///     chunked transfer encoding, has a Content-Length larger
+	///     than MAX_PREREAD_SIZE or expects a 100 Continue response, or
+	///   - MAX_PREREAD_SIZE bytes have been received without
+	///     finding the end of the header.
+	///
+	/// The connection is then removed from the reactor and handed over
+	/// to a worker thread, which handles the request using the
+	/// regular HTTPRequestHandlerFactory and HTTPRequestHandler
+	/// interfaces. Any part of the request not received yet is read
+	/// by the worker thread directly from the socket. Afterwards,
+	/// the connection is either closed or registered with the reactor
+	/// again, waiting for the next request.
+	///
+	/// This class is used internally by HTTPReactorServer.
+{
+public:
+	using Ptr = Poco::AutoPtr<HTTPReactorServerConnection>;
+
+	enum
+	{
+		MAX_PREREAD_SIZE = 65536
+			/// Maximum number of bytes collected by the reactor
+			/// thread before a request is handed over to a
+			/// worker thread.
+	};
+
+	HTTPReactorServerConnection(const StreamSocket& socket, SocketReactor& reactor, HTTPReactorServer& server);
+		/// Creates the HTTPReactorServerConnection.
+
+	void start();
+		/// Registers the connection with its SocketReactor.
+
+	void onReadable(const Poco::AutoPtr<ReadableNotification>& pNf);
+		/// Receives available data from the socket and hands the
+		/// connection over to a worker thread as soon as a
+		/// request is ready.
+		///
+		/// Called by the SocketReactor.
+
+	void process();
+		/// Handles a single request.
+		///
+		/// Called by a worker thread of the HTTPReactorServer.
+
+	void shutdown();
+		/// Shuts down the socket. The connection will be closed
+		/// by the reactor thread or worker thread currently
+		/// responsible for it.
+
+	bool expired(const Poco::Timestamp& now) const;
+		/// Returns true if the connection is waiting for a request
+		/// and has been idle for longer than the server timeout
+		/// (for the first request) or keep-alive timeout (for
+		/// subsequent requests).
+
+	const StreamSocket& socket() const;
+		/// Returns the connection's socket.
+
+	static bool requestReady(const std::string& data);
+		/// Returns true if data contains enough of a request
+		/// to hand it over to a worker thread.
+
+protected:
+	~HTTPReactorServerConnection();
+		/// Destroys the HTTPReactorServerConnection.
+
+	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
+	void enable();
+	void disable();
+	void close();
+
+private:
+	HTTPReactorServerConnection();
+	HTTPReactorServerConnection(const HTTPReactorServerConnection&);
+	HTTPReactorServerConnection& operator = (const HTTPReactorServerConnection&);
+
+	enum State
+	{
+		STATE_WAITING,
+		STATE_PROCESSING,
+		STATE_CLOSED
+	};
+
+	StreamSocket          _socket;
+	SocketReactor&        _reactor;
+	HTTPReactorServer&    _server;
+	HTTPServerParams::Ptr _pParams;
+	std::string           _buffer;
+	std::atomic<bool>     _firstRequest;
+	int                   _maxKeepAliveRequests;
+	std::atomic<int>      _state;
+	std::atomic<Poco::Timestamp::TimeVal> _lastActivity;
+};
+
+
+//
+// inlines
+//
+inline const StreamSocket& HTTPReactorServerConnection::socket() const
+{
+	return _socket;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPReactorServerConnection_INCLUDED
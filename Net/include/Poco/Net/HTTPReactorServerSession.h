@@ -0,0 +1,83 @@
+//
+// HTTPReactorServerSession.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServerSession
+//
+// Definition of the HTTPReactorServerSession class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPReactorServerSession_INCLUDED
+#define Net_HTTPReactorServerSession_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPServerSession.h"
+#include <string>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPReactorServerSession: public HTTPServerSession
+	/// This class handles the server side of a single
+	/// HTTP request/response exchange for the HTTPReactorServer.
+	///
+	/// The request data already read from the socket by the
+	/// reactor thread is handed to the session in the constructor
+	/// and is consumed before any further data is received
+	/// from the socket.
+	///
+	/// Since the HTTPReactorServer creates a new session for
+	/// every request, keep-alive bookkeeping is done by the
+	/// HTTPReactorServerConnection, not by the session.
+{
+public:
+	HTTPReactorServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, std::string& data);
+		/// Creates the HTTPReactorServerSession.
+		///
+		/// The contents of data are taken over by the session
+		/// and data is left empty.
+
+	virtual ~HTTPReactorServerSession();
+		/// Destroys the HTTPReactorServerSession.
+
+	void drainPending(std::string& data);
+		/// Appends all data that has been received, but not yet
+		/// consumed by the session (e.g., a pipelined request
+		/// following the current one) to data.
+
+	std::size_t pending() const;
+		/// Returns the number of pre-read bytes not yet
+		/// handed over to the session buffer.
+
+protected:
+	int receive(char* buffer, int length);
+
+private:
+	std::string _data;
+	std::size_t _pos;
+};
+
+
+//
+// inlines
+//
+inline std::size_t HTTPReactorServerSession::pending() const
+{
+	return _data.size() - _pos;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPReactorServerSession_INCLUDED
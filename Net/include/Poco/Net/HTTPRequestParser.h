@@ -0,0 +1,250 @@
+//
+// HTTPRequestParser.h
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPRequestParser
+//
+// Definition of the HTTPRequestParser class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPRequestParser_INCLUDED
+#define Net_HTTPRequestParser_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <string_view>
+#include <cstddef>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPRequest;
+
+
+class Net_API HTTPRequestParser
+	/// A resumable, non-allocating parser for HTTP request headers.
+	///
+	/// The parser works directly on a contiguous buffer containing
+	/// (the beginning of) a HTTP request. It does not copy any data;
+	/// the request method, URI, version and header fields are
+	/// available as std::string_view slices of the buffer passed
+	/// to the most recent call to parse(). Internally, only offsets
+	/// into the buffer are kept, so the buffer may be reallocated
+	/// between calls to parse(), as long as its contents are
+	/// preserved and only appended to.
+	///
+	/// If the buffer does not yet contain the complete header,
+	/// parse() returns PARSE_INCOMPLETE. Once more data is available,
+	/// parse() can be called again with the extended buffer and
+	/// parsing resumes with the first incomplete line.
+	///
+	/// HTTPRequest and NameValueCollection strings are only
+	/// created when apply() is called.
+	///
+	/// The parser accepts the same syntax as HTTPRequest::read()
+	/// and enforces the same (default) limits, with the exception
+	/// of folded header fields, for which it reports PARSE_ERROR.
+	/// Users should fall back to HTTPRequest::read() if parse()
+	/// fails, to get the appropriate exception.
+	///
+	/// On platforms supporting SSE2, the buffer is scanned for
+	/// line delimiters and colons 16 bytes at a time.
+{
+public:
+	enum Status
+	{
+		PARSE_INCOMPLETE, /// more data is needed to complete the header
+		PARSE_DONE,       /// the header has been parsed completely
+		PARSE_ERROR       /// the header is invalid, exceeds a limit or uses an unsupported feature
+	};
+
+	enum Limits
+	{
+		MAX_METHOD_LENGTH  = 32,
+		MAX_URI_LENGTH     = 16384,
+		MAX_VERSION_LENGTH = 8,
+		MAX_NAME_LENGTH    = 256,
+		MAX_VALUE_LENGTH   = 8192,
+		MAX_FIELDS         = 100
+	};
+
+	HTTPRequestParser();
+		/// Creates the HTTPRequestParser.
+
+	~HTTPRequestParser();
+		/// Destroys the HTTPRequestParser.
+
+	Status parse(const char* buffer, std::size_t length);
+		/// Parses the request header contained in buffer, resuming
+		/// after the last complete line found by a previous call.
+
+	void reset();
+		/// Resets the parser to its initial state, so that
+		/// it can be used for parsing another request.
+
+	Status status() const;
+		/// Returns the status of the most recent call to parse().
+
+	std::size_t consumed() const;
+		/// Returns the number of bytes (including the empty
+		/// line terminating the header) taken up by the
+		/// header, once parse() has returned PARSE_DONE.
+
+	std::string_view method() const;
+		/// Returns the request method.
+
+	std::string_view uri() const;
+		/// Returns the request URI.
+
+	std::string_view version() const;
+		/// Returns the HTTP version string.
+
+	std::size_t fieldCount() const;
+		/// Returns the number of header fields parsed so far.
+
+	std::string_view fieldName(std::size_t index) const;
+		/// Returns the name of the header field with the given index.
+
+	std::string_view fieldValue(std::size_t index) const;
+		/// Returns the value of the header field with the given index.
+
+	bool has(std::string_view name) const;
+		/// Returns true if a header field with the given name
+		/// (compared case-insensitively) exists.
+
+	std::string_view get(std::string_view name) const;
+		/// Returns the value of the first header field with the
+		/// given name (compared case-insensitively), or an empty
+		/// view if no such field exists.
+
+	void apply(HTTPRequest& request) const;
+		/// Sets method, URI and version of the given request and
+		/// adds all header fields to it. Values are decoded
+		/// if auto decoding is enabled for the request, as
+		/// with HTTPRequest::read().
+		///
+		/// Must only be called after parse() has returned
+		/// PARSE_DONE, and the buffer must still be valid.
+
+	static const char* scan(const char* begin, const char* end, char c1, char c2);
+		/// Returns a pointer to the first occurrence of c1 or c2
+		/// in the range [begin, end), or end if neither is found.
+
+private:
+	struct Slice
+	{
+		std::size_t offset;
+		std::size_t length;
+	};
+
+	struct Field
+	{
+		Slice name;
+		Slice value;
+	};
+
+	enum State
+	{
+		STATE_REQUEST_LINE,
+		STATE_HEADER,
+		STATE_DONE,
+		STATE_ERROR
+	};
+
+	Status parseRequestLine(const char* buffer, std::size_t length);
+	Status parseHeader(const char* buffer, std::size_t length);
+	std::string_view view(const Slice& slice) const;
+
+	HTTPRequestParser(const HTTPRequestParser&);
+	HTTPRequestParser& operator = (const HTTPRequestParser&);
+
+	const char* _pBuffer;
+	std::size_t _pos;
+	State       _state;
+	Slice       _method;
+	Slice       _uri;
+	Slice       _version;
+	std::size_t _fieldCount;
+	Field       _fields[MAX_FIELDS];
+};
+
+
+//
+// inlines
+//
+inline HTTPRequestParser::Status HTTPRequestParser::status() const
+{
+	switch (_state)
+	{
+	case STATE_DONE:  return PARSE_DONE;
+	case STATE_ERROR: return PARSE_ERROR;
+	default:          return PARSE_INCOMPLETE;
+	}
+}
+
+
+inline std::size_t HTTPRequestParser::consumed() const
+{
+	return _state == STATE_DONE ? _pos : 0;
+}
+
+
+inline std::string_view HTTPRequestParser::view(const Slice& slice) const
+{
+	return std::string_view(_pBuffer + slice.offset, slice.length);
+}
+
+
+inline std::string_view HTTPRequestParser::method() const
+{
+	return view(_method);
+}
+
+
+inline std::string_view HTTPRequestParser::uri() const
+{
+	return view(_uri);
+}
+
+
+inline std::string_view HTTPRequestParser::version() const
+{
+	return view(_version);
+}
+
+
+inline std::size_t HTTPRequestParser::fieldCount() const
+{
+	return _fieldCount;
+}
+
+
+inline std::string_view HTTPRequestParser::fieldName(std::size_t index) const
+{
+	poco_assert (index < _fieldCount);
+
+	return view(_fields[index].name);
+}
+
+
+inline std::string_view HTTPRequestParser::fieldValue(std::size_t index) const
+{
+	poco_assert (index < _fieldCount);
+
+	return view(_fields[index].value);
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPRequestParser_INCLUDED
@@ -30,6 +30,9 @@ namespace Poco {
 namespace Net {
 
 
+class HTTPRequest;
+
+
 class Net_API HTTPServerSession: public HTTPSession
 	/// This class handles the server side of a
 	/// HTTP session. It is used internally by
@@ -54,6 +57,15 @@ public:
 	SocketAddress serverAddress();
 		/// Returns the server's address.
 
+	bool parseRequest(HTTPRequest& request);
+		/// Tries to parse the request header directly from the
+		/// session buffer, using a HTTPRequestParser, and removes
+		/// it from the buffer if successful.
+		///
+		/// Returns false, leaving the buffer untouched, if the
+		/// buffer does not contain a complete, valid request header.
+		/// In this case, the header must be read with HTTPRequest::read().
+
 private:
 	bool           _firstRequest;
 	Poco::Timespan _keepAliveTimeout;
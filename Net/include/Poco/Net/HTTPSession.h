@@ -191,12 +191,24 @@ protected:
 	virtual int write(const char* buffer, std::streamsize length);
 		/// Writes data to the socket.
 
-	int receive(char* buffer, int length);
+	virtual int receive(char* buffer, int length);
 		/// Reads up to length bytes.
+		///
+		/// Subclasses can override this to supply data
+		/// that has already been received by other means
+		/// before reading from the socket.
 
 	int buffered() const;
 		/// Returns the number of bytes in the buffer.
 
+	const char* bufferedData() const;
+		/// Returns a pointer to the first unread byte in the buffer.
+		/// Only valid if buffered() returns a value greater than zero.
+
+	void consume(int length);
+		/// Removes the given number of bytes, which must not
+		/// exceed buffered(), from the beginning of the buffer.
+
 	void refill();
 		/// Refills the internal buffer.
 
@@ -320,6 +332,20 @@ inline int HTTPSession::buffered() const
 }
 
 
+inline const char* HTTPSession::bufferedData() const
+{
+	return _pCurrent;
+}
+
+
+inline void HTTPSession::consume(int length)
+{
+	poco_assert_dbg (length >= 0 && length <= buffered());
+
+	_pCurrent += length;
+}
+
+
 inline const Poco::Any& HTTPSession::sessionData() const
 {
 	return _data;
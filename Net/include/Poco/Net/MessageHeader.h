@@ -202,6 +202,7 @@ private:
 	bool _autoDecode;
 	bool _decodedOnRead;
 
+	friend class HTTPRequestParser;
 };
 
 
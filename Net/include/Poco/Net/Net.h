@@ -139,6 +139,13 @@ POCO_NET_FORCE_SYMBOL(pocoNetworkInitializer)
 #endif
 
 
+#if (POCO_OS == POCO_OS_LINUX) && !defined(POCO_NET_NO_IO_URING) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#define POCO_HAVE_IO_URING 1
+	#endif
+#endif
+
+
 #if defined(POCO_OS_FAMILY_BSD)
 	#ifndef POCO_HAVE_FD_POLL
 		#define POCO_HAVE_FD_POLL 1
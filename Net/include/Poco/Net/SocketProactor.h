@@ -20,6 +20,8 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/PollSet.h"
 #include "Poco/Runnable.h"
 #include "Poco/Timespan.h"
@@ -33,6 +35,7 @@
 #include <atomic>
 #include <functional>
 #include <deque>
+#include <vector>
 #include <utility>
 #include <memory>
 #include <iostream>
@@ -50,17 +53,37 @@ namespace Net {
 
 class Socket;
 class Worker;
+class IOUring;
 
 
 class Net_API SocketProactor final: public Poco::Runnable
 	/// This class implements the proactor pattern.
 	/// It may also contain a simple work executor (enabled by default),
 	/// which executes submitted workload.
+	///
+	/// On Linux, if the kernel supports it, I/O is performed
+	/// through io_uring: receive, send and accept operations are
+	/// submitted to the kernel, and their completions are harvested
+	/// in batches, so that no readiness notification and no separate
+	/// read or write system call is needed per operation. Stream
+	/// receives into an empty buffer use a pool of buffers registered
+	/// with the kernel. If io_uring is not available at runtime or
+	/// cannot be set up (e.g., because it is blocked by a seccomp
+	/// policy), the proactor falls back to polling the sockets for
+	/// readiness with PollSet. The io_uring backend can be disabled
+	/// for a proactor by passing false for ioUring to the constructor,
+	/// or for all proactors by defining POCO_NET_NO_IO_URING at build
+	/// time. usesIOUring() tells which backend a proactor uses.
+	///
+	/// With io_uring, a socket must not be closed while it has
+	/// I/O pending; call removeSocket() first, which cancels the
+	/// pending I/O.
 {
 public:
 	using Buffer = std::vector<std::uint8_t>;
 	using Work = std::function<void()>;
 	using Callback = std::function<void (const std::error_code& failure, int bytesReceived)>;
+	using AcceptCallback = std::function<void (const std::error_code& failure, StreamSocket& socket)>;
 
 	static const int POLL_READ = PollSet::POLL_READ;
 	static const int POLL_WRITE = PollSet::POLL_WRITE;
@@ -68,11 +91,17 @@ public:
 
 	static const Timestamp::TimeDiff PERMANENT_COMPLETION_HANDLER;
 
-	explicit SocketProactor(bool worker = true);
+	explicit SocketProactor(bool worker = true, bool ioUring = true);
 		/// Creates the SocketProactor.
+		///
+		/// If ioUring is true and io_uring is available, it is used
+		/// for I/O, otherwise sockets are polled for readiness.
 
-	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true);
+	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true, bool ioUring = true);
 		/// Creates the SocketProactor, using the given timeout.
+		///
+		/// If ioUring is true and io_uring is available, it is used
+		/// for I/O, otherwise sockets are polled for readiness.
 
 	SocketProactor(const SocketProactor&) = delete;
 	SocketProactor(SocketProactor&&) = delete;
@@ -165,6 +194,9 @@ public:
 
 	void removeSocket(Socket sock);
 		/// Removes the socket from the poll set.
+		///
+		/// With io_uring, pending I/O on the socket is cancelled,
+		/// and the completion handlers are called with ECANCELED.
 
 	void addReceiveFrom(Socket sock, Buffer& buf, SocketAddress& addr, Callback&& onCompletion);
 		/// Adds the datagram socket and the completion handler to the I/O receive queue.
@@ -189,6 +221,10 @@ public:
 	void addSend(Socket sock, Buffer&& message, Callback&& onCompletion);
 		/// Adds the stream socket and the completion handler to the I/O send queue.
 
+	void addAccept(ServerSocket sock, AcceptCallback&& onCompletion);
+		/// Adds the server socket and the completion handler to the I/O receive queue.
+		/// The completion handler is called with the accepted connection.
+
 	bool hasSocketHandlers() const;
 		/// Returns true if proactor had at least one I/O completion handler.
 
@@ -201,6 +237,12 @@ public:
 	bool ioCompletionInProgress() const;
 		/// Returns true if there are not executed handlers from last IO.
 
+	bool usesIOUring() const;
+		/// Returns true if the proactor performs I/O through io_uring.
+
+	static bool ioUringAvailable();
+		/// Returns true if io_uring is supported by the kernel.
+
 private:
 	void onShutdown();
 		/// Called when the SocketProactor is about to terminate.
@@ -226,7 +268,9 @@ private:
 		Buffer* _pBuf = nullptr;
 		SocketAddress* _pAddr = nullptr;
 		Callback _onCompletion = nullptr;
+		AcceptCallback _onAccept = nullptr;
 		bool _owner = false;
+		bool _submitted = false;
 	};
 
 	class IONotification: public Notification
@@ -289,7 +333,9 @@ private:
 			/// Stops the I/O completion execution.
 		{
 			_activity.stop();
-			_nq.wakeUpAll();
+			// A notification, unlike wakeUpAll(), is not lost if the
+			// completion thread is not waiting on the queue yet.
+			_nq.enqueueNotification(new Notification);
 		}
 
 		void wait()
@@ -319,14 +365,14 @@ private:
 		bool runOne()
 			/// Runs the next I/O completion handler in the queue.
 		{
-			IONotification* pNf = dynamic_cast<IONotification*>(_nq.waitDequeueNotification());
+			Notification::Ptr pNf(_nq.waitDequeueNotification());
 			if (_activity.isStopped()) return false;
-			if (pNf)
+			IONotification* pIONf = dynamic_cast<IONotification*>(pNf.get());
+			if (pIONf)
 			{
 				try
 				{
-					pNf->call();
-					pNf->release();
+					pIONf->call();
 					return true;
 				}
 				catch (Exception& exc)
@@ -434,10 +480,35 @@ private:
 		/// Reads data from the stream socket and enqueues the
 		/// accompanying completion handler.
 
+	void accept(Socket& sock, IOHandlerIt& it);
+		/// Accepts a connection on the server socket and enqueues
+		/// the accompanying completion handler.
+
 	void enqueueIONotification(Callback&& onCompletion, int n, int err);
 		/// Enqueues the completion handler into the I/O
 		/// completion handler.
 
+	void enqueueAcceptNotification(AcceptCallback&& onAccept, SocketImpl* pImpl, int err);
+		/// Enqueues the accept completion handler into the I/O
+		/// completion handler.
+
+	int pollIOUring();
+		/// Submits the scheduled I/O to io_uring, waits up to the
+		/// current timeout for completions and dispatches them.
+		/// Returns the number of completed handlers.
+
+	void scheduleIO(poco_socket_t sockfd, int op);
+		/// Schedules the next handler of the socket for submission
+		/// to io_uring by the proactor thread.
+
+	void submitIO(poco_socket_t sockfd, bool read);
+		/// Submits the first handler of the socket to io_uring,
+		/// unless it has already been submitted.
+
+	int completeIO(void* pOperation, int result);
+		/// Dispatches an io_uring completion to the handler
+		/// and submits the next handler of the socket.
+
 	Worker& worker();
 
 	std::atomic<bool> _isRunning;
@@ -455,7 +526,22 @@ private:
 	Poco::Mutex   _readMutex;
 
 	std::unique_ptr<Worker> _pWorker;
+
+	enum ScheduledOp
+	{
+		SCHEDULE_READ,
+		SCHEDULE_WRITE,
+		SCHEDULE_CANCEL
+	};
+
+	using ScheduleList = std::vector<std::pair<poco_socket_t, int>>;
+
+	std::unique_ptr<IOUring> _pIOUring;
+	ScheduleList  _scheduled;
+	Poco::Mutex   _scheduleMutex;
+
 	friend class Worker;
+	friend class IOUring;
 };
 
 //
@@ -474,12 +560,6 @@ inline void SocketProactor::updateSocket(Socket sock, int mode)
 }
 
 
-inline void SocketProactor::removeSocket(Socket sock)
-{
-	_pollSet.remove(sock);
-}
-
-
 inline void SocketProactor::enqueueIONotification(Callback&& onCompletion, int n, int err)
 {
 	if (onCompletion)
@@ -497,6 +577,12 @@ inline bool SocketProactor::isRunning() const
 }
 
 
+inline bool SocketProactor::usesIOUring() const
+{
+	return _pIOUring != nullptr;
+}
+
+
 } } // namespace Poco::Net
 
 
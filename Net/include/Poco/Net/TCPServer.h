@@ -28,6 +28,7 @@
 #include "Poco/Thread.h"
 #include "Poco/ThreadPool.h"
 #include <atomic>
+#include <vector>
 
 
 namespace Poco {
@@ -106,6 +107,26 @@ class Net_API TCPServer: public Poco::Runnable
 	/// After calling stop(), no new connections will be accepted and
 	/// all queued connections will be discarded.
 	/// Already served connections, however, will continue being served.
+	///
+	/// At high connection rates, the single accept thread and the
+	/// connection queue shared by all connection threads can become
+	/// a bottleneck. If TCPServerParams::setAcceptors() specifies
+	/// more than one acceptor, the server creates additional server
+	/// sockets bound to the same address with SO_REUSEPORT, each one
+	/// served by its own accept thread and TCPServerDispatcher (shard),
+	/// and the kernel load-balances new connections among them.
+	/// In this case, the ServerSocket passed to the constructor must
+	/// have been bound with reusePort set to true (ServerSocket's
+	/// constructors taking a port number or address do this).
+	/// The maximum number of threads and queued connections given in
+	/// TCPServerParams apply to each shard separately, and connection
+	/// threads of all shards are taken from the same thread pool.
+	/// The acceptor threads can optionally be pinned to CPU cores
+	/// (see TCPServerParams::setAcceptorAffinity()).
+	///
+	/// Multiple acceptors are only available on platforms
+	/// supporting SO_REUSEPORT, and not for UNIX local sockets.
+	/// Otherwise, a single acceptor is used.
 {
 public:
 	TCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::UInt16 portNumber = 0, TCPServerParams::Ptr pParams = 0);
@@ -171,27 +192,57 @@ public:
 
 	int currentThreads() const;
 		/// Returns the number of currently used connection threads.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// over all shards.
 
 	int maxThreads() const;
-		/// Returns the maximum number of threads available.
+		/// Returns the maximum number of threads available,
+		/// which is the capacity of the thread pool.
+		///
+		/// If the server uses multiple acceptors, all shards take
+		/// their connection threads from the same thread pool, so
+		/// this is not summed over the shards.
 
 	int totalConnections() const;
 		/// Returns the total number of handled connections.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// over all shards.
 
 	int currentConnections() const;
 		/// Returns the number of currently handled connections.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// over all shards.
 
 	int maxConcurrentConnections() const;
 		/// Returns the maximum number of concurrently handled connections.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// of the maxima of all shards.
 
 	int queuedConnections() const;
 		/// Returns the number of queued connections.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// over all shards.
 
 	int refusedConnections() const;
 		/// Returns the number of refused connections.
+		///
+		/// If the server uses multiple acceptors, this is the sum
+		/// over all shards.
+
+	int acceptors() const;
+		/// Returns the number of acceptor threads, each one
+		/// having its own server socket and TCPServerDispatcher.
 
 	const ServerSocket& socket() const;
 		/// Returns the underlying server socket.
+		///
+		/// If the server uses multiple acceptors, this is the
+		/// server socket of the first acceptor.
 
 	Poco::UInt16 port() const;
 		/// Returns the port the server socket listens on.
@@ -220,12 +271,21 @@ protected:
 		/// Returns a thread name for the server thread.
 
 private:
+	class Acceptor;
+
 	TCPServer();
 	TCPServer(const TCPServer&);
 	TCPServer& operator = (const TCPServer&);
 
+	static Poco::ThreadPool& defaultPool(TCPServerParams::Ptr pParams);
+	void init(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, TCPServerParams::Ptr pParams);
+	void acceptConnections(ServerSocket& socket, TCPServerDispatcher& dispatcher);
+
+	using AcceptorVec = std::vector<Acceptor*>;
+
 	ServerSocket _socket;
 	TCPServerDispatcher* _pDispatcher;
+	AcceptorVec _acceptors;
 	TCPServerConnectionFilter::Ptr _pConnectionFilter;
 	Poco::Thread _thread;
 	std::atomic<bool> _stopped;
@@ -253,6 +313,12 @@ inline TCPServerConnectionFilter::Ptr TCPServer::getConnectionFilter() const
 }
 
 
+inline int TCPServer::acceptors() const
+{
+	return static_cast<int>(_acceptors.size()) + 1;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -45,6 +45,8 @@ public:
 		///   - threadIdleTime:       10 seconds
 		///   - maxThreads:           0
 		///   - maxQueued:            64
+		///   - acceptors:            1
+		///   - acceptorAffinity:     false
 
 	void setThreadIdleTime(const Poco::Timespan& idleTime);
 		/// Sets the maximum idle time for a thread before
@@ -92,6 +94,35 @@ public:
 		/// Returns the priority of TCP server threads
 		/// created by TCPServer.
 
+	void setAcceptors(int count);
+		/// Sets the number of acceptor threads used by TCPServer.
+		/// Must be greater than 0.
+		///
+		/// If more than one acceptor is specified, each acceptor
+		/// thread listens on its own server socket bound to the
+		/// same address with SO_REUSEPORT, and feeds its own
+		/// TCPServerDispatcher. The kernel distributes new
+		/// connections among the listening sockets.
+		///
+		/// The default number is 1.
+
+	int getAcceptors() const;
+		/// Returns the number of acceptor threads used by TCPServer.
+
+	void setAcceptorAffinity(bool flag);
+		/// If flag is true, each acceptor thread of TCPServer
+		/// is pinned to a CPU core. Acceptor n is pinned to
+		/// core n modulo the number of available cores.
+		///
+		/// CPU pinning is only supported on Linux and
+		/// silently ignored on other platforms.
+		///
+		/// The default is false.
+
+	bool getAcceptorAffinity() const;
+		/// Returns true if the acceptor threads of TCPServer
+		/// are pinned to CPU cores.
+
 protected:
 	virtual ~TCPServerParams();
 		/// Destroys the TCPServerParams.
@@ -101,6 +132,8 @@ private:
 	int _maxThreads;
 	int _maxQueued;
 	Poco::Thread::Priority _threadPriority;
+	int _acceptors;
+	bool _acceptorAffinity;
 };
 
 
@@ -131,6 +164,18 @@ inline Poco::Thread::Priority TCPServerParams::getThreadPriority() const
 }
 
 
+inline int TCPServerParams::getAcceptors() const
+{
+	return _acceptors;
+}
+
+
+inline bool TCPServerParams::getAcceptorAffinity() const
+{
+	return _acceptorAffinity;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -97,48 +97,29 @@ public:
 		char* ret = 0;
 		if (_mutex.tryLock(10))
 		{
-			if (_buffers[sock].size() < _bufListSize) // building buffer list
-			{
-				makeNext(sock, &ret);
-			}
-			else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) != 0) // busy
-			{
-				makeNext(sock, &ret);
-			}
-			else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
-			{
-				setBusy(*_bufIt[sock]);
-				ret = *_bufIt[sock];
-				if (++_bufIt[sock] == _buffers[sock].end())
-				{
-					_bufIt[sock] = _buffers[sock].begin();
-				}
-			}
-			else // last resort, full scan
-			{
-				BufList::iterator it = _buffers[sock].begin();
-				BufList::iterator end = _buffers[sock].end();
-				for (; it != end; ++it)
-				{
-					if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
-					{
-						setBusy(*it);
-						ret = *it;
-						_bufIt[sock] = it;
-						if (++_bufIt[sock] == _buffers[sock].end())
-						{
-							_bufIt[sock] = _buffers[sock].begin();
-						}
-						break;
-					}
-				}
-				if (it == end) makeNext(sock, &ret);
-			}
+			ret = nextImpl(sock);
 			_mutex.unlock();
 		}
 		return ret;
 	}
 
+	std::size_t next(poco_socket_t sock, char** pBufs, std::size_t count)
+		/// Obtains up to count buffers for the reader with a
+		/// single lock acquisition and stores them in pBufs.
+		/// Buffers not used by the reader must be returned
+		/// with setIdle().
+		/// Returns the number of buffers obtained, which is
+		/// zero if mutex lock times out.
+	{
+		std::size_t n = 0;
+		if (_mutex.tryLock(10))
+		{
+			while (n < count && (pBufs[n] = nextImpl(sock))) ++n;
+			_mutex.unlock();
+		}
+		return n;
+	}
+
 	void notify()
 		/// Sets the data ready event.
 	{
@@ -342,6 +323,51 @@ private:
 	typedef std::map<poco_socket_t, BLIt>    BufIt;
 	typedef Poco::FastMemoryPool<char[S]>    MemPool;
 
+	char* nextImpl(poco_socket_t sock)
+		/// Returns the next available buffer, or creates a new one.
+		/// Must be called with _mutex locked.
+	{
+		char* ret = 0;
+		if (_buffers[sock].size() < _bufListSize) // building buffer list
+		{
+			makeNext(sock, &ret);
+		}
+		else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) != 0) // busy
+		{
+			makeNext(sock, &ret);
+		}
+		else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
+		{
+			setBusy(*_bufIt[sock]);
+			ret = *_bufIt[sock];
+			if (++_bufIt[sock] == _buffers[sock].end())
+			{
+				_bufIt[sock] = _buffers[sock].begin();
+			}
+		}
+		else // last resort, full scan
+		{
+			BufList::iterator it = _buffers[sock].begin();
+			BufList::iterator end = _buffers[sock].end();
+			for (; it != end; ++it)
+			{
+				if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
+				{
+					setBusy(*it);
+					ret = *it;
+					_bufIt[sock] = it;
+					if (++_bufIt[sock] == _buffers[sock].end())
+					{
+						_bufIt[sock] = _buffers[sock].begin();
+					}
+					break;
+				}
+			}
+			if (it == end) makeNext(sock, &ret);
+		}
+		return ret;
+	}
+
 	void setStatusImpl(char*& pBuf, MsgSizeT status)
 	{
 		*reinterpret_cast<MsgSizeT*>(pBuf) = status;
@@ -31,12 +31,18 @@ class Net_API UDPServerParams
 	/// A class encapsulating UDP server parameters.
 {
 public:
+	enum
+	{
+		DEFAULT_BATCH_SIZE = 32
+	};
+
 	UDPServerParams(const Poco::Net::SocketAddress& sa,
 		int nSockets = 10,
 		Poco::Timespan timeout = 250000,
 		std::size_t handlerBufListSize = 1000,
 		bool notifySender = false,
-		int  backlogThreshold = 10);
+		int  backlogThreshold = 10,
+		int  batchSize = DEFAULT_BATCH_SIZE);
 		/// Creates UDPServerParams.
 
 	~UDPServerParams();
@@ -64,6 +70,10 @@ public:
 		/// reports backlogs back to the client. Only meaningful
 		/// if notifySender() is true.
 
+	int batchSize() const;
+		/// Returns the maximum number of datagrams read
+		/// from a socket at once.
+
 private:
 	UDPServerParams();
 
@@ -73,6 +83,7 @@ private:
 	std::size_t              _handlerBufListSize;
 	bool                     _notifySender;
 	int                      _backlogThreshold;
+	int                      _batchSize;
 };
 
 
@@ -116,6 +127,12 @@ inline int UDPServerParams::backlogThreshold() const
 }
 
 
+inline int UDPServerParams::batchSize() const
+{
+	return _batchSize;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -20,6 +20,10 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/UDPHandler.h"
+#include "Poco/Net/UDPServerParams.h"
+#include <vector>
+#include <cstring>
 
 
 namespace Poco {
@@ -35,6 +39,10 @@ class UDPSocketReader
 	/// handler for handling (if any configured).
 	/// Depending on settings, data senders may be notified of the handler's
 	/// data and error backlogs.
+	///
+	/// The reader obtains a batch of buffers from the handler and fills
+	/// them with as many datagrams as are available, using a single
+	/// system call where supported (see DatagramSocket::receiveBatch()).
 {
 private:
 	class Counter
@@ -70,13 +78,14 @@ private:
 	};
 
 public:
-	UDPSocketReader(typename UDPHandlerImpl<S>::List& handlers, int backlogThreshold = 0):
+	UDPSocketReader(typename UDPHandlerImpl<S>::List& handlers, int backlogThreshold = 0, int batchSize = UDPServerParams::DEFAULT_BATCH_SIZE):
 		_handlers(handlers),
 		_handler(_handlers.begin()),
 		_backlogThreshold(backlogThreshold)
 		/// Creates the UDPSocketReader.
 	{
 		poco_assert(_handler != _handlers.end());
+		init(batchSize);
 	}
 
 	UDPSocketReader(typename UDPHandlerImpl<S>::List& handlers, const UDPServerParams& serverParams):
@@ -86,6 +95,7 @@ public:
 		/// Creates the UDPSocketReader.
 	{
 		poco_assert(_handler != _handlers.end());
+		init(serverParams.batchSize());
 	}
 
 	~UDPSocketReader()
@@ -94,59 +104,73 @@ public:
 	}
 
 	void read(DatagramSocket& sock)
-		/// Reads data from the socket and passes it to the next handler.
+		/// Reads the available datagrams (up to the batch size) from
+		/// the socket and passes them to the next handler.
 		/// Errors are also passed to the handler. If object is configured
 		/// for replying to sender and data or error backlog threshold is
 		/// exceeded, sender is notified of the current backlog size.
 	{
 		typedef typename UDPHandlerImpl<S>::MsgSizeT RT;
-		char* p = 0;
-		struct sockaddr* pSA = 0;
-		poco_socklen_t* pAL = 0;
 		poco_socket_t sockfd = sock.impl()->sockfd();
 		nextHandler();
+		std::size_t count = handler().next(sockfd, &_buffers[0], _buffers.size());
+		if (count == 0) return;
+
+		Poco::UInt16 off = handler().offset();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			_datagrams[i].buffer = _buffers[i] + off;
+			_datagrams[i].capacity = static_cast<int>(S - off - 1);
+		}
+		int received = 0;
+		std::size_t used = 0;
+		AtomicCounter::ValueType errors = 0;
 		try
 		{
-			p = handler().next(sockfd);
-			if (p)
-			{
-				Poco::UInt16 off = handler().offset();
-				poco_socklen_t* pAL = reinterpret_cast<poco_socklen_t*>(p + sizeof(RT));
-				*pAL = SocketAddress::MAX_ADDRESS_LENGTH;
-				struct sockaddr* pSA = reinterpret_cast<struct sockaddr*>(p + sizeof(RT) + sizeof(poco_socklen_t));
-				RT ret = sock.receiveFrom(p + off, S - off - 1, &pSA, &pAL);
-				if (ret < 0)
-				{
-					AtomicCounter::ValueType errors = setError(sock.impl()->sockfd(), p, Error::getMessage(Error::last()));
-					if (_backlogThreshold > 0 && errors > _backlogThreshold && errors != _errorBacklog[sockfd])
-					{
-						Poco::Int32 err = static_cast<Poco::Int32>(errors);
-						sock.sendTo(&err, sizeof(Poco::Int32), SocketAddress(pSA, *pAL));
-						_errorBacklog[sockfd] = errors;
-					}
-					return;
-				}
-				AtomicCounter::ValueType data = handler().setData(p, ret);
-				p[off + ret] = 0; // for ascii convenience, zero-terminate
-				if (_backlogThreshold > 0 && data > _backlogThreshold && data != _dataBacklog[sockfd])
-				{
-					Poco::Int32 d = static_cast<Poco::Int32>(data);
-					sock.sendTo(&d, sizeof(Poco::Int32), SocketAddress(pSA, *pAL));
-					_dataBacklog[sockfd] = data;
-				}
-			}
-			else return;
+			received = static_cast<DatagramSocketImpl*>(sock.impl())->receiveBatch(&_datagrams[0], static_cast<int>(count));
+			if (received < 0) errors = setError(sockfd, _buffers[0]);
 		}
 		catch (Poco::Exception& exc)
 		{
-			AtomicCounter::ValueType errors = setError(sock.impl()->sockfd(), p, exc.displayText());
-			if (_backlogThreshold > 0 && errors > _backlogThreshold && errors != _errorBacklog[sockfd] && pSA && pAL)
+			errors = setError(sockfd, _buffers[0], exc.displayText());
+			received = -1;
+		}
+
+		if (received < 0)
+		{
+			used = 1; // error passed in first buffer
+			// A failed receive does not yield a sender address, so the
+			// error backlog goes to the sender of the most recently
+			// received datagram, if any.
+			const SocketAddress& sender = _datagrams[0].address;
+			if (_backlogThreshold > 0 && errors > _backlogThreshold && errors != _errorBacklog[sockfd] && sender.port() != 0)
 			{
 				Poco::Int32 err = static_cast<Poco::Int32>(errors);
-				sock.sendTo(&err, sizeof(Poco::Int32), SocketAddress(pSA, *pAL));
+				sock.sendTo(&err, sizeof(Poco::Int32), sender);
 				_errorBacklog[sockfd] = errors;
 			}
 		}
+		for (int i = 0; i < received; ++i, ++used)
+		{
+			char* p = _buffers[i];
+			const DatagramSocket::Datagram& datagram = _datagrams[i];
+			poco_socklen_t* pAL = reinterpret_cast<poco_socklen_t*>(p + sizeof(RT));
+			struct sockaddr* pSA = reinterpret_cast<struct sockaddr*>(p + sizeof(RT) + sizeof(poco_socklen_t));
+			*pAL = datagram.address.length();
+			std::memcpy(pSA, datagram.address.addr(), *pAL);
+			AtomicCounter::ValueType data = handler().setData(p, datagram.length);
+			p[off + datagram.length] = 0; // for ascii convenience, zero-terminate
+			if (_backlogThreshold > 0 && data > _backlogThreshold && data != _dataBacklog[sockfd])
+			{
+				Poco::Int32 d = static_cast<Poco::Int32>(data);
+				sock.sendTo(&d, sizeof(Poco::Int32), datagram.address);
+				_dataBacklog[sockfd] = data;
+			}
+		}
+		for (std::size_t i = used; i < count; ++i)
+		{
+			handler().setIdle(_buffers[i]);
+		}
 		handler().notify();
 	}
 
@@ -189,6 +213,14 @@ public:
 	}
 
 private:
+	void init(int batchSize)
+	{
+		if (batchSize < 1) batchSize = 1;
+		else if (batchSize > DatagramSocketImpl::MAX_BATCH_SIZE) batchSize = DatagramSocketImpl::MAX_BATCH_SIZE;
+		_buffers.resize(batchSize);
+		_datagrams.resize(batchSize);
+	}
+
 	void nextHandler()
 		/// Re-points the handler iterator to the next handler in
 		/// round-robin fashion.
@@ -208,11 +240,13 @@ private:
 	typedef typename UDPHandlerImpl<S>::List::iterator HandlerIterator;
 	typedef std::map<poco_socket_t, Counter>           CounterMap;
 
-	HandlerList&    _handlers;
-	HandlerIterator _handler;
-	CounterMap      _dataBacklog;
-	CounterMap      _errorBacklog;
-	int             _backlogThreshold;
+	HandlerList&              _handlers;
+	HandlerIterator           _handler;
+	CounterMap                _dataBacklog;
+	CounterMap                _errorBacklog;
+	int                       _backlogThreshold;
+	std::vector<char*>        _buffers;
+	DatagramSocket::DatagramVec _datagrams;
 };
 
 
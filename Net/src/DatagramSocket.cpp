@@ -205,4 +205,28 @@ int DatagramSocket::receiveFrom(SocketBufVec& buffers, struct sockaddr** ppSA, p
 }
 
 
+int DatagramSocket::receiveBatch(DatagramVec& datagrams, int flags)
+{
+	return static_cast<DatagramSocketImpl*>(impl())->receiveBatch(datagrams.data(), static_cast<int>(datagrams.size()), flags);
+}
+
+
+int DatagramSocket::sendBatch(const DatagramVec& datagrams, int flags)
+{
+	return static_cast<DatagramSocketImpl*>(impl())->sendBatch(datagrams.data(), static_cast<int>(datagrams.size()), flags);
+}
+
+
+void DatagramSocket::setGRO(bool flag)
+{
+	static_cast<DatagramSocketImpl*>(impl())->setGRO(flag);
+}
+
+
+bool DatagramSocket::getGRO() const
+{
+	return static_cast<DatagramSocketImpl*>(impl())->getGRO();
+}
+
+
 } } // namespace Poco::Net
@@ -14,9 +14,17 @@
 
 #include "Poco/Net/DatagramSocketImpl.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Timespan.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <netinet/udp.h>
+#include <cstring>
+#define POCO_HAVE_MMSG 1
+#endif
+#include <algorithm>
 
 
 using Poco::InvalidArgumentException;
+using Poco::NotImplementedException;
 
 
 namespace Poco {
@@ -61,4 +69,179 @@ void DatagramSocketImpl::init(int af)
 }
 
 
+int DatagramSocketImpl::receiveBatch(Datagram* pDatagrams, int count, int flags)
+{
+	poco_check_ptr (pDatagrams);
+
+	count = std::min<int>(count, MAX_BATCH_SIZE);
+	if (count <= 0) return 0;
+	checkBrokenTimeout(SELECT_READ);
+#if defined(POCO_HAVE_MMSG)
+	struct mmsghdr msgs[MAX_BATCH_SIZE];
+	struct iovec iovs[MAX_BATCH_SIZE];
+	struct sockaddr_storage addrs[MAX_BATCH_SIZE];
+	char control[MAX_BATCH_SIZE][CMSG_SPACE(sizeof(int))];
+	for (int i = 0; i < count; ++i)
+	{
+		iovs[i].iov_base = pDatagrams[i].buffer;
+		iovs[i].iov_len = pDatagrams[i].capacity;
+		std::memset(&msgs[i], 0, sizeof(msgs[i]));
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_control = control[i];
+		msgs[i].msg_hdr.msg_controllen = sizeof(control[i]);
+	}
+	int rc;
+	do
+	{
+		if (sockfd() == POCO_INVALID_SOCKET) throw InvalidSocketException();
+		rc = recvmmsg(sockfd(), msgs, count, flags | MSG_WAITFORONE, nullptr);
+	}
+	while (getBlocking() && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN && !getBlocking())
+			;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			throw TimeoutException(err);
+		else
+			error(err);
+		return rc;
+	}
+	for (int i = 0; i < rc; ++i)
+	{
+		Datagram& datagram = pDatagrams[i];
+		datagram.length = static_cast<int>(msgs[i].msg_len);
+		datagram.address = SocketAddress(reinterpret_cast<const struct sockaddr*>(&addrs[i]), msgs[i].msg_hdr.msg_namelen);
+		datagram.segmentSize = 0;
+#if defined(UDP_GRO)
+		for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); pCmsg; pCmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, pCmsg))
+		{
+			if (pCmsg->cmsg_level == IPPROTO_UDP && pCmsg->cmsg_type == UDP_GRO)
+			{
+				int segmentSize;
+				std::memcpy(&segmentSize, CMSG_DATA(pCmsg), sizeof(segmentSize));
+				datagram.segmentSize = segmentSize;
+			}
+		}
+#endif
+	}
+	return rc;
+#else
+	int received = 0;
+	while (received < count)
+	{
+		if (received > 0 && !poll(Poco::Timespan(0), SELECT_READ)) break;
+		Datagram& datagram = pDatagrams[received];
+		int rc = receiveFrom(datagram.buffer, datagram.capacity, datagram.address, flags);
+		if (rc < 0) return received > 0 ? received : rc;
+		datagram.length = rc;
+		datagram.segmentSize = 0;
+		++received;
+	}
+	return received;
+#endif
+}
+
+
+int DatagramSocketImpl::sendBatch(const Datagram* pDatagrams, int count, int flags)
+{
+	poco_check_ptr (pDatagrams);
+
+	if (count <= 0) return 0;
+	checkBrokenTimeout(SELECT_WRITE);
+#if defined(POCO_HAVE_MMSG)
+	struct mmsghdr msgs[MAX_BATCH_SIZE];
+	struct iovec iovs[MAX_BATCH_SIZE];
+	char control[MAX_BATCH_SIZE][CMSG_SPACE(sizeof(Poco::UInt16))];
+	int sent = 0;
+	while (sent < count)
+	{
+		int n = std::min<int>(count - sent, MAX_BATCH_SIZE);
+		for (int i = 0; i < n; ++i)
+		{
+			const Datagram& datagram = pDatagrams[sent + i];
+			iovs[i].iov_base = datagram.buffer;
+			iovs[i].iov_len = datagram.length;
+			std::memset(&msgs[i], 0, sizeof(msgs[i]));
+			msgs[i].msg_hdr.msg_name = const_cast<struct sockaddr*>(datagram.address.addr());
+			msgs[i].msg_hdr.msg_namelen = datagram.address.length();
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			if (datagram.segmentSize > 0)
+			{
+#if defined(UDP_SEGMENT)
+				msgs[i].msg_hdr.msg_control = control[i];
+				msgs[i].msg_hdr.msg_controllen = sizeof(control[i]);
+				struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr);
+				pCmsg->cmsg_level = IPPROTO_UDP;
+				pCmsg->cmsg_type = UDP_SEGMENT;
+				pCmsg->cmsg_len = CMSG_LEN(sizeof(Poco::UInt16));
+				Poco::UInt16 segmentSize = static_cast<Poco::UInt16>(datagram.segmentSize);
+				std::memcpy(CMSG_DATA(pCmsg), &segmentSize, sizeof(segmentSize));
+#else
+				throw NotImplementedException("UDP generic segmentation offload");
+#endif
+			}
+		}
+		int rc;
+		do
+		{
+			if (sockfd() == POCO_INVALID_SOCKET) throw InvalidSocketException();
+			rc = sendmmsg(sockfd(), msgs, n, flags);
+		}
+		while (getBlocking() && rc < 0 && lastError() == POCO_EINTR);
+		if (rc < 0)
+		{
+			int err = lastError();
+			if (sent > 0 || (err == POCO_EAGAIN && !getBlocking()))
+				break;
+			else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+				throw TimeoutException(err);
+			else
+				error(err);
+		}
+		sent += rc;
+		if (rc < n) break;
+	}
+	return sent;
+#else
+	int sent = 0;
+	for (; sent < count; ++sent)
+	{
+		const Datagram& datagram = pDatagrams[sent];
+		if (datagram.segmentSize > 0)
+			throw NotImplementedException("UDP generic segmentation offload");
+		if (sendTo(datagram.buffer, datagram.length, datagram.address, flags) < 0) break;
+	}
+	return sent;
+#endif
+}
+
+
+void DatagramSocketImpl::setGRO(bool flag)
+{
+#if defined(POCO_HAVE_MMSG) && defined(UDP_GRO)
+	setOption(IPPROTO_UDP, UDP_GRO, flag ? 1 : 0);
+#else
+	throw NotImplementedException("UDP generic receive offload");
+#endif
+}
+
+
+bool DatagramSocketImpl::getGRO()
+{
+#if defined(POCO_HAVE_MMSG) && defined(UDP_GRO)
+	int flag;
+	getOption(IPPROTO_UDP, UDP_GRO, flag);
+	return flag != 0;
+#else
+	throw NotImplementedException("UDP generic receive offload");
+#endif
+}
+
+
 } } // namespace Poco::Net
@@ -0,0 +1,382 @@
+//
+// HTTPReactorServer.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServer
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPReactorServer.h"
+#include "Poco/Net/ParallelSocketReactor.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Notification.h"
+#include "Poco/Observer.h"
+#include "Poco/ErrorHandler.h"
+
+
+using Poco::Notification;
+using Poco::FastMutex;
+using Poco::AutoPtr;
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPReactorRequestNotification: public Notification
+{
+public:
+	HTTPReactorRequestNotification(HTTPReactorServerConnection* pConnection):
+		_pConnection(pConnection, true)
+	{
+	}
+
+	~HTTPReactorRequestNotification()
+	{
+	}
+
+	HTTPReactorServerConnection& connection()
+	{
+		return *_pConnection;
+	}
+
+private:
+	HTTPReactorServerConnection::Ptr _pConnection;
+};
+
+
+class HTTPReactorStopNotification: public Notification
+{
+};
+
+
+namespace
+{
+	static const std::string threadName("HTTPReactorServerWorker");
+}
+
+
+HTTPReactorServer::HTTPReactorServer(HTTPRequestHandlerFactory::Ptr pFactory, const ServerSocket& socket, HTTPServerParams::Ptr pParams, unsigned reactors):
+	_socket(socket),
+	_pFactory(pFactory),
+	_pParams(pParams),
+	_threadPool(Poco::ThreadPool::defaultPool()),
+	_reactorCount(reactors),
+	_nextReactor(0),
+	_timer(SWEEP_INTERVAL, SWEEP_INTERVAL),
+	_started(false),
+	_stopped(false),
+	_currentThreads(0),
+	_totalConnections(0),
+	_totalRequests(0),
+	_refusedRequests(0)
+{
+	init();
+}
+
+
+HTTPReactorServer::HTTPReactorServer(HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool, const ServerSocket& socket, HTTPServerParams::Ptr pParams, unsigned reactors):
+	_socket(socket),
+	_pFactory(pFactory),
+	_pParams(pParams),
+	_threadPool(threadPool),
+	_reactorCount(reactors),
+	_nextReactor(0),
+	_timer(SWEEP_INTERVAL, SWEEP_INTERVAL),
+	_started(false),
+	_stopped(false),
+	_currentThreads(0),
+	_totalConnections(0),
+	_totalRequests(0),
+	_refusedRequests(0)
+{
+	init();
+}
+
+
+HTTPReactorServer::~HTTPReactorServer()
+{
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void HTTPReactorServer::init()
+{
+	poco_check_ptr (_pFactory);
+
+	if (!_pParams)
+		_pParams = new HTTPServerParams;
+
+	if (_pParams->getMaxThreads() == 0)
+		_pParams->setMaxThreads(_threadPool.capacity());
+
+	if (_reactorCount == 0)
+		_reactorCount = 1;
+}
+
+
+void HTTPReactorServer::start()
+{
+	poco_assert (!_started);
+
+	_started = true;
+	for (unsigned i = 0; i < _reactorCount; ++i)
+	{
+		_reactors.push_back(new ParallelSocketReactor<SocketReactor>("HTTPReactor#" + std::to_string(i)));
+	}
+	_acceptReactor.addEventHandler(_socket, Poco::Observer<HTTPReactorServer, ReadableNotification>(*this, &HTTPReactorServer::onAccept));
+	_acceptThread.start(_acceptReactor);
+	_acceptThread.setName("HTTPReactorAcceptor");
+	_timer.start(Poco::TimerCallback<HTTPReactorServer>(*this, &HTTPReactorServer::onTimer));
+}
+
+
+void HTTPReactorServer::stop()
+{
+	if (!_started || _stopped.exchange(true)) return;
+
+	_timer.stop();
+	_acceptReactor.removeEventHandler(_socket, Poco::Observer<HTTPReactorServer, ReadableNotification>(*this, &HTTPReactorServer::onAccept));
+	_acceptReactor.stop();
+	_acceptThread.join();
+	for (auto& pReactor: _reactors)
+	{
+		pReactor->stop();
+	}
+
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		_queue.clear();
+		for (int i = 0; i < _currentThreads; ++i)
+		{
+			_queue.enqueueNotification(new HTTPReactorStopNotification);
+		}
+		while (_currentThreads > 0)
+		{
+			_threadsDone.wait(_mutex);
+		}
+	}
+
+	// Destroying a ParallelSocketReactor joins its thread. This must
+	// be done after the worker threads, which re-enable connections
+	// with their reactor, have stopped, and before the connections
+	// are released, as a reactor thread may still be calling a
+	// connection's handler.
+	_reactors.clear();
+
+	ConnectionMap connections;
+	{
+		FastMutex::ScopedLock lock(_connectionsMutex);
+		connections.swap(_connections);
+	}
+	for (auto& p: connections)
+	{
+		p.second->shutdown();
+	}
+}
+
+
+void HTTPReactorServer::stopAll(bool abortCurrent)
+{
+	_pFactory->serverStopped(this, abortCurrent);
+	if (abortCurrent)
+	{
+		FastMutex::ScopedLock lock(_connectionsMutex);
+
+		for (auto& p: _connections)
+		{
+			p.second->shutdown();
+		}
+	}
+	stop();
+}
+
+
+int HTTPReactorServer::currentThreads() const
+{
+	return _currentThreads;
+}
+
+
+int HTTPReactorServer::maxThreads() const
+{
+	return _pParams->getMaxThreads();
+}
+
+
+int HTTPReactorServer::totalConnections() const
+{
+	return _totalConnections;
+}
+
+
+int HTTPReactorServer::currentConnections() const
+{
+	FastMutex::ScopedLock lock(_connectionsMutex);
+
+	return static_cast<int>(_connections.size());
+}
+
+
+int HTTPReactorServer::totalRequests() const
+{
+	return _totalRequests;
+}
+
+
+int HTTPReactorServer::queuedRequests() const
+{
+	return _queue.size();
+}
+
+
+int HTTPReactorServer::refusedRequests() const
+{
+	return _refusedRequests;
+}
+
+
+void HTTPReactorServer::run()
+{
+	int idleTime = (int) _pParams->getThreadIdleTime().totalMilliseconds();
+
+	for (;;)
+	{
+		try
+		{
+			AutoPtr<Notification> pNf = _queue.waitDequeueNotification(idleTime);
+			if (pNf)
+			{
+				HTTPReactorRequestNotification* pRNf = dynamic_cast<HTTPReactorRequestNotification*>(pNf.get());
+				if (pRNf)
+				{
+					pRNf->connection().process();
+				}
+			}
+		}
+		catch (Poco::Exception& exc) { ErrorHandler::handle(exc); }
+		catch (std::exception& exc)  { ErrorHandler::handle(exc); }
+		catch (...)                  { ErrorHandler::handle();    }
+		FastMutex::ScopedLock lock(_mutex);
+		if (_stopped || (_currentThreads > 1 && _queue.empty()))
+		{
+			if (--_currentThreads == 0) _threadsDone.broadcast();
+			break;
+		}
+	}
+}
+
+
+void HTTPReactorServer::onAccept(ReadableNotification* pNotification)
+{
+	pNotification->release();
+	try
+	{
+		StreamSocket ss = _socket.acceptConnection();
+		if (_stopped) return;
+
+		// enable nodelay per default: OSX really needs that
+#if defined(POCO_HAS_UNIX_SOCKET)
+		if (ss.address().family() != AddressFamily::UNIX_LOCAL)
+#endif
+		{
+			ss.setNoDelay(true);
+		}
+
+		SocketReactor& reactor = *_reactors[_nextReactor];
+		if (++_nextReactor == _reactors.size()) _nextReactor = 0;
+
+		HTTPReactorServerConnection::Ptr pConnection = new HTTPReactorServerConnection(ss, reactor, *this);
+		{
+			FastMutex::ScopedLock lock(_connectionsMutex);
+			_connections[pConnection.get()] = pConnection;
+		}
+		++_totalConnections;
+		pConnection->start();
+	}
+	catch (Poco::Exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		ErrorHandler::handle();
+	}
+}
+
+
+void HTTPReactorServer::onTimer(Poco::Timer&)
+{
+	Poco::Timestamp now;
+	std::vector<HTTPReactorServerConnection::Ptr> expired;
+	{
+		FastMutex::ScopedLock lock(_connectionsMutex);
+
+		for (auto& p: _connections)
+		{
+			if (p.second->expired(now)) expired.push_back(p.second);
+		}
+	}
+	for (auto& pConnection: expired)
+	{
+		pConnection->shutdown();
+	}
+}
+
+
+bool HTTPReactorServer::dispatch(HTTPReactorServerConnection* pConnection)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_stopped || _queue.size() >= _pParams->getMaxQueued())
+	{
+		++_refusedRequests;
+		return false;
+	}
+
+	++_totalRequests;
+	_queue.enqueueNotification(new HTTPReactorRequestNotification(pConnection));
+	if (!_queue.hasIdleThreads() && _currentThreads < _pParams->getMaxThreads())
+	{
+		try
+		{
+			_threadPool.startWithPriority(_pParams->getThreadPriority(), *this, threadName);
+			++_currentThreads;
+		}
+		catch (Poco::Exception&)
+		{
+			// no problem here, request is already queued
+			// and a new thread might be available later.
+		}
+	}
+	return true;
+}
+
+
+void HTTPReactorServer::remove(HTTPReactorServerConnection* pConnection)
+{
+	HTTPReactorServerConnection::Ptr pGuard(pConnection, true);
+	FastMutex::ScopedLock lock(_connectionsMutex);
+	_connections.erase(pConnection);
+}
+
+
+} } // namespace Poco::Net
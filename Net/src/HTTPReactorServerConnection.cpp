@@ -0,0 +1,338 @@
+//
+// HTTPReactorServerConnection.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServerConnection
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPReactorServerConnection.h"
+#include "Poco/Net/HTTPReactorServer.h"
+#include "Poco/Net/HTTPReactorServerSession.h"
+#include "Poco/Net/HTTPServerRequestImpl.h"
+#include "Poco/Net/HTTPServerResponseImpl.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPBufferAllocator.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NObserver.h"
+#include "Poco/NumberParser.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/String.h"
+#include <memory>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	const std::string CONTENT_LENGTH("Content-Length");
+	const std::string TRANSFER_ENCODING("Transfer-Encoding");
+	const std::string EXPECT("Expect");
+	const std::string CHUNKED("chunked");
+}
+
+
+HTTPReactorServerConnection::HTTPReactorServerConnection(const StreamSocket& socket, SocketReactor& reactor, HTTPReactorServer& server):
+	_socket(socket),
+	_reactor(reactor),
+	_server(server),
+	_pParams(server.paramsPtr()),
+	_firstRequest(true),
+	_maxKeepAliveRequests(_pParams->getMaxKeepAliveRequests()),
+	_state(STATE_WAITING),
+	_lastActivity(Poco::Timestamp().epochMicroseconds())
+{
+}
+
+
+HTTPReactorServerConnection::~HTTPReactorServerConnection()
+{
+}
+
+
+void HTTPReactorServerConnection::start()
+{
+	enable();
+}
+
+
+void HTTPReactorServerConnection::onReadable(const Poco::AutoPtr<ReadableNotification>&)
+{
+	if (_state != STATE_WAITING) return;
+
+	char buffer[HTTPBufferAllocator::BUFFER_SIZE];
+	int n = 0;
+	try
+	{
+		n = _socket.receiveBytes(buffer, sizeof(buffer));
+		if (n < 0) return;
+	}
+	catch (Poco::Exception&)
+	{
+		n = 0;
+	}
+	if (n == 0)
+	{
+		disable();
+		close();
+		return;
+	}
+
+	_buffer.append(buffer, n);
+	_lastActivity = Poco::Timestamp().epochMicroseconds();
+	if (requestReady(_buffer))
+	{
+		_state = STATE_PROCESSING;
+		disable();
+		if (!_server.dispatch(this)) close();
+	}
+}
+
+
+void HTTPReactorServerConnection::process()
+{
+	bool keepAlive = false;
+	bool detached = false;
+	{
+		HTTPReactorServerSession session(_socket, _pParams, _buffer);
+		if (_firstRequest)
+		{
+			_firstRequest = false;
+			--_maxKeepAliveRequests;
+		}
+		else if (_maxKeepAliveRequests > 0)
+		{
+			--_maxKeepAliveRequests;
+		}
+		bool canKeepAlive = _maxKeepAliveRequests != 0 && !_server.stopped();
+
+		try
+		{
+			HTTPServerResponseImpl response(session);
+			HTTPServerRequestImpl request(response, session, _pParams);
+
+			Poco::Timestamp now;
+			response.setDate(now);
+			response.setVersion(request.getVersion());
+			response.setKeepAlive(_pParams->getKeepAlive() && request.getKeepAlive() && canKeepAlive);
+			const std::string& server = _pParams->getSoftwareVersion();
+			if (!server.empty())
+				response.set("Server"s, server);
+			try
+			{
+				std::unique_ptr<HTTPRequestHandler> pHandler(_server.factory().createRequestHandler(request));
+				if (pHandler.get())
+				{
+					if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
+						response.sendContinue();
+
+					pHandler->handleRequest(request, response);
+					session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive() && canKeepAlive);
+				}
+				else sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
+			}
+			catch (Poco::Exception&)
+			{
+				if (!response.sent())
+				{
+					try
+					{
+						sendErrorResponse(session, HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+					}
+					catch (...)
+					{
+					}
+				}
+				throw;
+			}
+		}
+		catch (NoMessageException&)
+		{
+			session.setKeepAlive(false);
+		}
+		catch (MessageException&)
+		{
+			try
+			{
+				sendErrorResponse(session, HTTPResponse::HTTP_BAD_REQUEST);
+			}
+			catch (...)
+			{
+				session.setKeepAlive(false);
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			session.setKeepAlive(false);
+			if (!session.networkException()) ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			session.setKeepAlive(false);
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			session.setKeepAlive(false);
+			ErrorHandler::handle();
+		}
+
+		// A request handler (e.g., for a WebSocket) may have taken over the socket.
+		detached = session.socket().impl() != _socket.impl();
+		keepAlive = !detached && session.getKeepAlive() && !_server.stopped();
+		if (keepAlive) session.drainPending(_buffer);
+		if (!detached) session.detachSocket();
+	}
+
+	if (detached)
+	{
+		_state = STATE_CLOSED;
+		_socket = StreamSocket();
+		_server.remove(this);
+	}
+	else if (keepAlive)
+	{
+		_lastActivity = Poco::Timestamp().epochMicroseconds();
+		if (requestReady(_buffer))
+		{
+			if (!_server.dispatch(this)) close();
+		}
+		else
+		{
+			_state = STATE_WAITING;
+			enable();
+		}
+	}
+	else close();
+}
+
+
+void HTTPReactorServerConnection::shutdown()
+{
+	try
+	{
+		_socket.shutdown();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+bool HTTPReactorServerConnection::expired(const Poco::Timestamp& now) const
+{
+	if (_state != STATE_WAITING) return false;
+
+	Poco::Timespan timeout = _firstRequest ? _pParams->getTimeout() : _pParams->getKeepAliveTimeout();
+	return now.epochMicroseconds() - _lastActivity > timeout.totalMicroseconds();
+}
+
+
+bool HTTPReactorServerConnection::requestReady(const std::string& data)
+{
+	const std::string::size_type size = data.size();
+	std::string::size_type pos = 0;
+	while (pos < size && (data[pos] == '\r' || data[pos] == '\n')) ++pos;
+
+	bool firstLine = true;
+	bool chunked = false;
+	bool expect = false;
+	bool hasLength = false;
+	Poco::UInt64 length = 0;
+	while (pos < size)
+	{
+		std::string::size_type eol = data.find('\n', pos);
+		if (eol == std::string::npos) break;
+		std::string::size_type end = eol;
+		if (end > pos && data[end - 1] == '\r') --end;
+		if (end == pos)
+		{
+			// end of header reached
+			if (chunked || expect) return true;
+			if (hasLength && length <= MAX_PREREAD_SIZE)
+				return size - (eol + 1) >= length;
+			return true;
+		}
+		if (!firstLine)
+		{
+			std::string::size_type colon = data.find(':', pos);
+			if (colon != std::string::npos && colon < end)
+			{
+				std::string::size_type n = colon - pos;
+				if (Poco::icompare(data, pos, n, CONTENT_LENGTH) == 0)
+				{
+					std::string value(data, colon + 1, end - colon - 1);
+					hasLength = Poco::NumberParser::tryParseUnsigned64(Poco::trim(value), length);
+					if (!hasLength) return true;
+				}
+				else if (Poco::icompare(data, pos, n, TRANSFER_ENCODING) == 0)
+				{
+					std::string value(data, colon + 1, end - colon - 1);
+					chunked = Poco::toLower(value).find(CHUNKED) != std::string::npos;
+					if (!chunked) return true;
+				}
+				else if (Poco::icompare(data, pos, n, EXPECT) == 0)
+				{
+					expect = true;
+				}
+			}
+		}
+		firstLine = false;
+		pos = eol + 1;
+	}
+	return size >= MAX_PREREAD_SIZE;
+}
+
+
+void HTTPReactorServerConnection::sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status)
+{
+	HTTPServerResponseImpl response(session);
+	response.setVersion(HTTPMessage::HTTP_1_1);
+	response.setStatusAndReason(status);
+	response.setKeepAlive(false);
+	response.send();
+	session.setKeepAlive(false);
+}
+
+
+void HTTPReactorServerConnection::enable()
+{
+	_reactor.addEventHandler(_socket, Poco::NObserver<HTTPReactorServerConnection, ReadableNotification>(*this, &HTTPReactorServerConnection::onReadable));
+	_reactor.wakeUp();
+}
+
+
+void HTTPReactorServerConnection::disable()
+{
+	_reactor.removeEventHandler(_socket, Poco::NObserver<HTTPReactorServerConnection, ReadableNotification>(*this, &HTTPReactorServerConnection::onReadable));
+}
+
+
+void HTTPReactorServerConnection::close()
+{
+	_state = STATE_CLOSED;
+	try
+	{
+		_socket.close();
+	}
+	catch (...)
+	{
+	}
+	_server.remove(this);
+}
+
+
+} } // namespace Poco::Net
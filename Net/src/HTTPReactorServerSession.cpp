@@ -0,0 +1,62 @@
+//
+// HTTPReactorServerSession.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPReactorServerSession
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPReactorServerSession.h"
+#include "Poco/Buffer.h"
+#include <cstring>
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTPReactorServerSession::HTTPReactorServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, std::string& data):
+	HTTPServerSession(socket, pParams),
+	_pos(0)
+{
+	_data.swap(data);
+}
+
+
+HTTPReactorServerSession::~HTTPReactorServerSession()
+{
+}
+
+
+void HTTPReactorServerSession::drainPending(std::string& data)
+{
+	Poco::Buffer<char> buffer(0);
+	drainBuffer(buffer);
+	data.append(buffer.begin(), buffer.size());
+	data.append(_data, _pos, std::string::npos);
+	_data.clear();
+	_pos = 0;
+}
+
+
+int HTTPReactorServerSession::receive(char* buffer, int length)
+{
+	if (_pos < _data.size())
+	{
+		std::size_t n = _data.size() - _pos;
+		if (n > static_cast<std::size_t>(length)) n = static_cast<std::size_t>(length);
+		std::memcpy(buffer, _data.data() + _pos, n);
+		_pos += n;
+		return static_cast<int>(n);
+	}
+	return HTTPServerSession::receive(buffer, length);
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,292 @@
+//
+// HTTPRequestParser.cpp
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPRequestParser
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPRequestParser.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Ascii.h"
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POCO_NET_HTTP_PARSER_SSE2
+#endif
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	inline bool isBlank(char c)
+	{
+		return c == ' ' || c == '\t';
+	}
+
+	bool iequals(std::string_view s1, std::string_view s2)
+	{
+		if (s1.size() != s2.size()) return false;
+		for (std::size_t i = 0; i < s1.size(); ++i)
+		{
+			if (Poco::Ascii::toLower(s1[i]) != Poco::Ascii::toLower(s2[i])) return false;
+		}
+		return true;
+	}
+}
+
+
+HTTPRequestParser::HTTPRequestParser()
+{
+	reset();
+}
+
+
+HTTPRequestParser::~HTTPRequestParser()
+{
+}
+
+
+void HTTPRequestParser::reset()
+{
+	_pBuffer = 0;
+	_pos = 0;
+	_state = STATE_REQUEST_LINE;
+	_method = Slice{0, 0};
+	_uri = Slice{0, 0};
+	_version = Slice{0, 0};
+	_fieldCount = 0;
+}
+
+
+HTTPRequestParser::Status HTTPRequestParser::parse(const char* buffer, std::size_t length)
+{
+	poco_check_ptr (buffer);
+
+	_pBuffer = buffer;
+	if (_state == STATE_REQUEST_LINE)
+	{
+		Status status = parseRequestLine(buffer, length);
+		if (status != PARSE_DONE) return status;
+	}
+	if (_state == STATE_HEADER)
+	{
+		return parseHeader(buffer, length);
+	}
+	return status();
+}
+
+
+HTTPRequestParser::Status HTTPRequestParser::parseRequestLine(const char* buffer, std::size_t length)
+{
+	std::size_t pos = _pos;
+	while (pos < length && Poco::Ascii::isSpace(buffer[pos])) ++pos;
+	_pos = pos;
+	if (pos == length) return PARSE_INCOMPLETE;
+
+	const char* begin = buffer + pos;
+	const char* end = buffer + length;
+	const char* eol = scan(begin, end, '\n', '\n');
+	if (eol == end)
+	{
+		if (length - pos > MAX_METHOD_LENGTH + MAX_URI_LENGTH + MAX_VERSION_LENGTH + 4)
+		{
+			_state = STATE_ERROR;
+			return PARSE_ERROR;
+		}
+		return PARSE_INCOMPLETE;
+	}
+
+	const char* lineEnd = eol;
+	while (lineEnd > begin && Poco::Ascii::isSpace(lineEnd[-1])) --lineEnd;
+
+	const char* it = begin;
+	const char* tokenBegin = it;
+	while (it < lineEnd && !Poco::Ascii::isSpace(*it)) ++it;
+	_method = Slice{static_cast<std::size_t>(tokenBegin - buffer), static_cast<std::size_t>(it - tokenBegin)};
+	while (it < lineEnd && isBlank(*it)) ++it;
+	tokenBegin = it;
+	while (it < lineEnd && !Poco::Ascii::isSpace(*it)) ++it;
+	_uri = Slice{static_cast<std::size_t>(tokenBegin - buffer), static_cast<std::size_t>(it - tokenBegin)};
+	while (it < lineEnd && isBlank(*it)) ++it;
+	tokenBegin = it;
+	while (it < lineEnd && !Poco::Ascii::isSpace(*it)) ++it;
+	_version = Slice{static_cast<std::size_t>(tokenBegin - buffer), static_cast<std::size_t>(it - tokenBegin)};
+
+	if (it != lineEnd ||
+		_method.length == 0 || _method.length > MAX_METHOD_LENGTH ||
+		_uri.length == 0 || _uri.length > MAX_URI_LENGTH ||
+		_version.length == 0 || _version.length > MAX_VERSION_LENGTH)
+	{
+		_state = STATE_ERROR;
+		return PARSE_ERROR;
+	}
+
+	_pos = static_cast<std::size_t>(eol - buffer) + 1;
+	_state = STATE_HEADER;
+	return PARSE_DONE;
+}
+
+
+HTTPRequestParser::Status HTTPRequestParser::parseHeader(const char* buffer, std::size_t length)
+{
+	const char* end = buffer + length;
+	while (_pos < length)
+	{
+		const char* begin = buffer + _pos;
+		if (*begin == '\n')
+		{
+			_pos += 1;
+			_state = STATE_DONE;
+			return PARSE_DONE;
+		}
+		else if (*begin == '\r')
+		{
+			if (_pos + 1 == length) return PARSE_INCOMPLETE;
+			if (begin[1] != '\n') break;
+			_pos += 2;
+			_state = STATE_DONE;
+			return PARSE_DONE;
+		}
+		else if (isBlank(*begin))
+		{
+			// folded header field values are not supported
+			break;
+		}
+
+		const char* colon = scan(begin, end, ':', '\n');
+		if (colon == end)
+		{
+			if (colon - begin > MAX_NAME_LENGTH) break;
+			return PARSE_INCOMPLETE;
+		}
+		if (*colon == '\n')
+		{
+			// ignore invalid header lines
+			_pos = static_cast<std::size_t>(colon - buffer) + 1;
+			continue;
+		}
+		if (colon - begin > MAX_NAME_LENGTH) break;
+
+		const char* valueBegin = colon + 1;
+		while (valueBegin < end && isBlank(*valueBegin)) ++valueBegin;
+		const char* eol = scan(valueBegin, end, '\r', '\n');
+		if (eol == end)
+		{
+			if (eol - valueBegin > MAX_VALUE_LENGTH) break;
+			return PARSE_INCOMPLETE;
+		}
+		const char* next = eol + 1;
+		if (*eol == '\r')
+		{
+			if (next == end) return PARSE_INCOMPLETE;
+			if (*next != '\n') break;
+			++next;
+		}
+		if (next == end) return PARSE_INCOMPLETE;
+		if (isBlank(*next)) break;
+
+		const char* valueEnd = eol;
+		while (valueEnd > valueBegin && Poco::Ascii::isSpace(valueEnd[-1])) --valueEnd;
+		if (valueEnd - valueBegin > MAX_VALUE_LENGTH) break;
+		if (_fieldCount == MAX_FIELDS) break;
+
+		Field& field = _fields[_fieldCount++];
+		field.name = Slice{static_cast<std::size_t>(begin - buffer), static_cast<std::size_t>(colon - begin)};
+		field.value = Slice{static_cast<std::size_t>(valueBegin - buffer), static_cast<std::size_t>(valueEnd - valueBegin)};
+		_pos = static_cast<std::size_t>(next - buffer);
+	}
+	if (_pos < length)
+	{
+		_state = STATE_ERROR;
+		return PARSE_ERROR;
+	}
+	return PARSE_INCOMPLETE;
+}
+
+
+bool HTTPRequestParser::has(std::string_view name) const
+{
+	for (std::size_t i = 0; i < _fieldCount; ++i)
+	{
+		if (iequals(view(_fields[i].name), name)) return true;
+	}
+	return false;
+}
+
+
+std::string_view HTTPRequestParser::get(std::string_view name) const
+{
+	for (std::size_t i = 0; i < _fieldCount; ++i)
+	{
+		if (iequals(view(_fields[i].name), name)) return view(_fields[i].value);
+	}
+	return std::string_view();
+}
+
+
+void HTTPRequestParser::apply(HTTPRequest& request) const
+{
+	poco_assert (_state == STATE_DONE);
+
+	request.setMethod(std::string(method()));
+	request.setURI(std::string(uri()));
+	request.setVersion(std::string(version()));
+	const bool autoDecode = request.getAutoDecode();
+	std::string name;
+	std::string value;
+	for (std::size_t i = 0; i < _fieldCount; ++i)
+	{
+		name.assign(fieldName(i));
+		value.assign(fieldValue(i));
+		if (autoDecode && value.find("=?") != std::string::npos)
+			request.add(name, MessageHeader::decodeWord(value));
+		else
+			request.add(name, value);
+	}
+	request._decodedOnRead = autoDecode;
+}
+
+
+const char* HTTPRequestParser::scan(const char* begin, const char* end, char c1, char c2)
+{
+#if defined(POCO_NET_HTTP_PARSER_SSE2)
+	const __m128i v1 = _mm_set1_epi8(c1);
+	const __m128i v2 = _mm_set1_epi8(c2);
+	while (end - begin >= 16)
+	{
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+		int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, v1), _mm_cmpeq_epi8(chunk, v2)));
+		if (mask)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, static_cast<unsigned long>(mask));
+			return begin + index;
+#else
+			return begin + __builtin_ctz(static_cast<unsigned>(mask));
+#endif
+		}
+		begin += 16;
+	}
+#endif
+	if (c1 == c2)
+	{
+		const void* p = std::memchr(begin, c1, static_cast<std::size_t>(end - begin));
+		return p ? static_cast<const char*>(p) : end;
+	}
+	while (begin < end && *begin != c1 && *begin != c2) ++begin;
+	return begin;
+}
+
+
+} } // namespace Poco::Net
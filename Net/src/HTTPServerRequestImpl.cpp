@@ -39,9 +39,12 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 {
 	response.attachRequest(this);
 
-	HTTPHeaderInputStream hs(session);
 	setAutoDecode(_pParams->getAutoDecodeHeaders());
-	read(hs);
+	if (!session.parseRequest(*this))
+	{
+		HTTPHeaderInputStream hs(session);
+		read(hs);
+	}
 
 	// Now that we know socket is still connected, obtain addresses
 	_clientAddress = session.clientAddress();
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPRequestParser.h"
 
 
 namespace Poco {
@@ -67,4 +68,19 @@ SocketAddress HTTPServerSession::serverAddress()
 }
 
 
+bool HTTPServerSession::parseRequest(HTTPRequest& request)
+{
+	if (peek() == std::char_traits<char>::eof()) return false;
+
+	HTTPRequestParser parser;
+	if (parser.parse(bufferedData(), buffered()) == HTTPRequestParser::PARSE_DONE)
+	{
+		parser.apply(request);
+		consume(static_cast<int>(parser.consumed()));
+		return true;
+	}
+	return false;
+}
+
+
 } } // namespace Poco::Net
@@ -84,7 +84,8 @@ public:
 	enum
 	{
 		WAITTIME_MILLISEC = 1000,
-		BUFFER_SIZE = 65536
+		BUFFER_SIZE = 65536,
+		BATCH_SIZE = 16
 	};
 
 	RemoteUDPListener(Poco::NotificationQueue& queue, Poco::UInt16 port, bool reusePort, int buffer);
@@ -119,7 +120,13 @@ RemoteUDPListener::~RemoteUDPListener()
 
 void RemoteUDPListener::run()
 {
-	Poco::Buffer<char> buffer(BUFFER_SIZE);
+	Poco::Buffer<char> buffer(BUFFER_SIZE*BATCH_SIZE);
+	DatagramSocket::DatagramVec datagrams(BATCH_SIZE);
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		datagrams[i].buffer = buffer.begin() + i*BUFFER_SIZE;
+		datagrams[i].capacity = BUFFER_SIZE;
+	}
 	Poco::Timespan waitTime(WAITTIME_MILLISEC* 1000);
 	while (!_stopped)
 	{
@@ -127,11 +134,13 @@ void RemoteUDPListener::run()
 		{
 			if (_socket.poll(waitTime, Socket::SELECT_READ))
 			{
-				Poco::Net::SocketAddress sourceAddress;
-				int n = _socket.receiveFrom(buffer.begin(), BUFFER_SIZE, sourceAddress);
-				if (n > 0)
+				int n = _socket.receiveBatch(datagrams);
+				for (int i = 0; i < n; ++i)
 				{
-					_queue.enqueueNotification(new MessageNotification(buffer.begin(), n, sourceAddress));
+					if (datagrams[i].length > 0)
+					{
+						_queue.enqueueNotification(new MessageNotification(static_cast<const char*>(datagrams[i].buffer), datagrams[i].length, datagrams[i].address));
+					}
 				}
 			}
 		}
@@ -15,14 +15,29 @@
 #include "Poco/Net/SocketProactor.h"
 #include "Poco/Net/DatagramSocket.h"
 #include "Poco/Net/DatagramSocketImpl.h"
+#include "Poco/Net/StreamSocketImpl.h"
 #include "Poco/Thread.h"
 #include "Poco/Exception.h"
+#include "Poco/Error.h"
+#if defined(POCO_HAVE_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(IORING_FEAT_EXT_ARG) && defined(__NR_io_uring_setup)
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cstring>
+#else
+#undef POCO_HAVE_IO_URING // system headers are too old
+#endif
+#endif // POCO_HAVE_IO_URING
 #ifdef POCO_OS_FAMILY_WINDOWS
 #ifdef max
 #undef max
 #endif // max
 #endif // POCO_OS_FAMILY_WINDOWS
 #include <limits>
+#include <algorithm>
 
 
 using Poco::Exception;
@@ -221,6 +236,575 @@ private:
 };
 
 
+//
+// IOUring
+//
+
+#if defined(POCO_HAVE_IO_URING)
+
+
+class IOUring
+	/// IOUring is a minimal wrapper around a Linux io_uring
+	/// instance, used by SocketProactor to submit socket I/O
+	/// and to harvest the completions in batches.
+	///
+	/// All methods, except wakeUp() and isWaiting(), must
+	/// be called from the thread polling the proactor.
+{
+public:
+	enum OpType
+	{
+		OP_RECEIVE,
+		OP_RECEIVE_FROM,
+		OP_SEND,
+		OP_SEND_TO,
+		OP_ACCEPT,
+		OP_CANCEL,
+		OP_WAKEUP
+	};
+
+	struct Operation
+		/// The state of a submitted operation, which must
+		/// remain valid until the operation completes.
+	{
+		OpType           type = OP_RECEIVE;
+		poco_socket_t    sockfd = POCO_INVALID_SOCKET;
+		int              slot = -1;
+		bool             inUse = false;
+		struct msghdr    msg;
+		struct iovec     iov;
+		sockaddr_storage addr;
+		socklen_t        addrLen = 0;
+	};
+
+	enum
+	{
+		DEFAULT_ENTRIES = 256,
+		DEFAULT_BUFFER_COUNT = 16,
+		DEFAULT_BUFFER_SIZE = 65536,
+		REQUIRED_FEATURES = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG
+	};
+
+	IOUring(unsigned entries = DEFAULT_ENTRIES, unsigned bufferCount = DEFAULT_BUFFER_COUNT, unsigned bufferSize = DEFAULT_BUFFER_SIZE):
+		_fd(-1),
+		_eventFd(-1),
+		_pRing(MAP_FAILED),
+		_ringSize(0),
+		_pSQEs(static_cast<io_uring_sqe*>(MAP_FAILED)),
+		_sqesSize(0),
+		_sqTail(0),
+		_pBuffers(MAP_FAILED),
+		_bufferCount(bufferCount),
+		_bufferSize(bufferSize),
+		_fixedBuffers(false),
+		_inFlight(0),
+		_wakeUpArmed(false),
+		_closing(false),
+		_waiting(false),
+		_wakeUpValue(0)
+	{
+		try
+		{
+			init(entries);
+		}
+		catch (...)
+		{
+			close();
+			throw;
+		}
+	}
+
+	~IOUring()
+	{
+		try
+		{
+			cancelAll();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+		close();
+	}
+
+	static IOUring* create()
+		/// Returns a new IOUring, or a null pointer
+		/// if io_uring is not available.
+	{
+		try
+		{
+			return new IOUring;
+		}
+		catch (Exception&)
+		{
+			return nullptr;
+		}
+	}
+
+	static bool supported()
+		/// Returns true if the kernel supports io_uring
+		/// with all features required by SocketProactor.
+	{
+		io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+		int fd = setup(2, &params);
+		if (fd < 0) return false;
+		::close(fd);
+		return (params.features & REQUIRED_FEATURES) == REQUIRED_FEATURES;
+	}
+
+	bool submit(SocketProactor::Handler& handler, OpType type, poco_socket_t sockfd)
+		/// Prepares the I/O operation for the given handler.
+		/// Returns false if the submission queue is full.
+	{
+		io_uring_sqe* pSQE = getSQE();
+		if (!pSQE) return false;
+
+		Operation* pOp = acquire(type, sockfd);
+		SocketProactor::Buffer* pBuf = handler._pBuf;
+		switch (type)
+		{
+		case OP_RECEIVE:
+			if (pBuf->empty() && (pOp->slot = acquireSlot()) >= 0)
+			{
+				pSQE->opcode = _fixedBuffers ? IORING_OP_READ_FIXED : IORING_OP_RECV;
+				pSQE->addr = reinterpret_cast<__u64>(slotBuffer(pOp->slot));
+				pSQE->len = _bufferSize;
+				pSQE->buf_index = static_cast<__u16>(_fixedBuffers ? pOp->slot : 0);
+			}
+			else
+			{
+				if (pBuf->empty()) pBuf->resize(_bufferSize);
+				pSQE->opcode = IORING_OP_RECV;
+				pSQE->addr = reinterpret_cast<__u64>(pBuf->data());
+				pSQE->len = static_cast<__u32>(pBuf->size());
+			}
+			break;
+		case OP_RECEIVE_FROM:
+			// a datagram is always received completely, so use a
+			// pool buffer that can hold the largest datagram
+			if ((pOp->slot = acquireSlot()) >= 0)
+			{
+				pOp->iov.iov_base = slotBuffer(pOp->slot);
+				pOp->iov.iov_len = _bufferSize;
+			}
+			else
+			{
+				if (pBuf->size() < _bufferSize) pBuf->resize(_bufferSize);
+				pOp->iov.iov_base = pBuf->data();
+				pOp->iov.iov_len = pBuf->size();
+			}
+			pOp->msg.msg_name = &pOp->addr;
+			pOp->msg.msg_namelen = sizeof(pOp->addr);
+			pOp->msg.msg_iov = &pOp->iov;
+			pOp->msg.msg_iovlen = 1;
+			pSQE->opcode = IORING_OP_RECVMSG;
+			pSQE->addr = reinterpret_cast<__u64>(&pOp->msg);
+			pSQE->len = 1;
+			break;
+		case OP_SEND:
+			pSQE->opcode = IORING_OP_SEND;
+			pSQE->addr = reinterpret_cast<__u64>(pBuf->data());
+			pSQE->len = static_cast<__u32>(pBuf->size());
+			pSQE->msg_flags = MSG_NOSIGNAL;
+			break;
+		case OP_SEND_TO:
+			std::memcpy(&pOp->addr, handler._pAddr->addr(), handler._pAddr->length());
+			pOp->iov.iov_base = pBuf->data();
+			pOp->iov.iov_len = pBuf->size();
+			pOp->msg.msg_name = &pOp->addr;
+			pOp->msg.msg_namelen = handler._pAddr->length();
+			pOp->msg.msg_iov = &pOp->iov;
+			pOp->msg.msg_iovlen = 1;
+			pSQE->opcode = IORING_OP_SENDMSG;
+			pSQE->addr = reinterpret_cast<__u64>(&pOp->msg);
+			pSQE->len = 1;
+			pSQE->msg_flags = MSG_NOSIGNAL;
+			break;
+		case OP_ACCEPT:
+			pOp->addrLen = sizeof(pOp->addr);
+			pSQE->opcode = IORING_OP_ACCEPT;
+			pSQE->addr = reinterpret_cast<__u64>(&pOp->addr);
+			pSQE->addr2 = reinterpret_cast<__u64>(&pOp->addrLen);
+			pSQE->accept_flags = SOCK_CLOEXEC;
+			break;
+		default:
+			poco_bugcheck();
+		}
+		pSQE->fd = sockfd;
+		pSQE->user_data = reinterpret_cast<__u64>(pOp);
+		return true;
+	}
+
+	void cancel(poco_socket_t sockfd)
+		/// Cancels all pending operations on the given socket.
+	{
+		std::vector<Operation*> pending;
+		for (auto& pOp: _operations)
+		{
+			if (pOp->inUse && pOp->sockfd == sockfd && pOp->type < OP_CANCEL)
+				pending.push_back(pOp.get());
+		}
+		for (auto pOp: pending) cancel(*pOp);
+	}
+
+	void enter(long timeout)
+		/// Submits all prepared operations to the kernel and, if timeout
+		/// is greater than zero, waits up to timeout milliseconds for the
+		/// first completion.
+	{
+		if (!_wakeUpArmed && !_closing) armWakeUp();
+		flush(timeout);
+	}
+
+	template <typename F>
+	int harvest(F&& onCompletion)
+		/// Calls onCompletion for all available completions
+		/// of socket operations and returns the sum of the
+		/// values returned by onCompletion.
+	{
+		int handled = 0;
+		unsigned head = *_cqHead;
+		for (;;)
+		{
+			unsigned tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+			if (head == tail) break;
+			while (head != tail)
+			{
+				const io_uring_cqe& cqe = _pCQEs[head & *_cqMask];
+				Operation* pOp = reinterpret_cast<Operation*>(cqe.user_data);
+				int result = cqe.res;
+				++head;
+				if (pOp->type == OP_WAKEUP)
+				{
+					_wakeUpArmed = false;
+				}
+				else if (pOp->type != OP_CANCEL)
+				{
+					handled += onCompletion(*pOp, result);
+				}
+				release(pOp);
+			}
+			__atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+		}
+		return handled;
+	}
+
+	bool hasCompletions() const
+		/// Returns true if completions are available.
+	{
+		return *_cqHead != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+	}
+
+	const char* buffer(int slot) const
+		/// Returns the pool buffer with the given index.
+	{
+		return static_cast<const char*>(_pBuffers) + static_cast<std::size_t>(slot)*_bufferSize;
+	}
+
+	void wakeUp()
+		/// Wakes up the thread waiting in enter().
+	{
+		Poco::UInt64 value = 1;
+		ssize_t rc = ::write(_eventFd, &value, sizeof(value));
+		(void) rc;
+	}
+
+	void setWaiting(bool waiting)
+	{
+		_waiting.store(waiting);
+	}
+
+	bool isWaiting() const
+	{
+		return _waiting.load();
+	}
+
+private:
+	static int setup(unsigned entries, io_uring_params* pParams)
+	{
+		return static_cast<int>(::syscall(__NR_io_uring_setup, entries, pParams));
+	}
+
+	static int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* pArg, std::size_t argSize)
+	{
+		return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, pArg, argSize));
+	}
+
+	static int ioUringRegister(int fd, unsigned opcode, const void* pArg, unsigned nrArgs)
+	{
+		return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, pArg, nrArgs));
+	}
+
+	void init(unsigned entries)
+	{
+		io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+		_fd = setup(entries, &params);
+		if (_fd < 0)
+			throw IOException("io_uring_setup() failed", Error::getMessage(errno), errno);
+		if ((params.features & REQUIRED_FEATURES) != REQUIRED_FEATURES)
+			throw NotImplementedException("io_uring features required by SocketProactor");
+
+		std::size_t sqSize = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+		std::size_t cqSize = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+		_ringSize = std::max(sqSize, cqSize);
+		_pRing = ::mmap(nullptr, _ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+		if (_pRing == MAP_FAILED)
+			throw IOException("cannot map io_uring", Error::getMessage(errno), errno);
+		_sqesSize = params.sq_entries*sizeof(io_uring_sqe);
+		_pSQEs = static_cast<io_uring_sqe*>(::mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES));
+		if (_pSQEs == MAP_FAILED)
+			throw IOException("cannot map io_uring", Error::getMessage(errno), errno);
+
+		char* pRing = static_cast<char*>(_pRing);
+		_sqHead = reinterpret_cast<unsigned*>(pRing + params.sq_off.head);
+		_sqTailPtr = reinterpret_cast<unsigned*>(pRing + params.sq_off.tail);
+		_sqMask = *reinterpret_cast<unsigned*>(pRing + params.sq_off.ring_mask);
+		_sqEntries = params.sq_entries;
+		unsigned* sqArray = reinterpret_cast<unsigned*>(pRing + params.sq_off.array);
+		for (unsigned i = 0; i < _sqEntries; ++i) sqArray[i] = i;
+		_sqTail = *_sqTailPtr;
+		_cqHead = reinterpret_cast<unsigned*>(pRing + params.cq_off.head);
+		_cqTail = reinterpret_cast<unsigned*>(pRing + params.cq_off.tail);
+		_cqMask = reinterpret_cast<unsigned*>(pRing + params.cq_off.ring_mask);
+		_pCQEs = reinterpret_cast<io_uring_cqe*>(pRing + params.cq_off.cqes);
+
+		_eventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+		if (_eventFd < 0)
+			throw IOException("cannot create eventfd", Error::getMessage(errno), errno);
+
+		_pBuffers = ::mmap(nullptr, static_cast<std::size_t>(_bufferCount)*_bufferSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (_pBuffers == MAP_FAILED)
+			throw OutOfMemoryException("cannot allocate io_uring buffers");
+		std::vector<struct iovec> iovecs(_bufferCount);
+		for (unsigned i = 0; i < _bufferCount; ++i)
+		{
+			iovecs[i].iov_base = static_cast<char*>(_pBuffers) + static_cast<std::size_t>(i)*_bufferSize;
+			iovecs[i].iov_len = _bufferSize;
+			_freeSlots.push_back(static_cast<int>(_bufferCount - i - 1));
+		}
+		// registering the buffers may fail if the locked memory
+		// limit is too low; the buffers can still be used,
+		// but they have to be mapped by the kernel for every
+		// receive operation
+		_fixedBuffers = ioUringRegister(_fd, IORING_REGISTER_BUFFERS, iovecs.data(), _bufferCount) == 0;
+	}
+
+	void close()
+	{
+		if (_pBuffers != MAP_FAILED) ::munmap(_pBuffers, static_cast<std::size_t>(_bufferCount)*_bufferSize);
+		if (_pSQEs != MAP_FAILED) ::munmap(_pSQEs, _sqesSize);
+		if (_pRing != MAP_FAILED) ::munmap(_pRing, _ringSize);
+		if (_eventFd >= 0) ::close(_eventFd);
+		if (_fd >= 0) ::close(_fd);
+		_pBuffers = MAP_FAILED;
+		_pSQEs = static_cast<io_uring_sqe*>(MAP_FAILED);
+		_pRing = MAP_FAILED;
+		_eventFd = -1;
+		_fd = -1;
+	}
+
+	void flush(long timeout)
+		/// Submits all prepared operations and, if timeout is
+		/// greater than zero, waits for the first completion.
+	{
+		unsigned toSubmit = publish();
+		if (timeout <= 0 && toSubmit == 0) return;
+
+		__kernel_timespec ts;
+		io_uring_getevents_arg arg;
+		unsigned flags = 0;
+		unsigned minComplete = 0;
+		const void* pArg = nullptr;
+		std::size_t argSize = 0;
+		if (timeout > 0)
+		{
+			ts.tv_sec = timeout/1000;
+			ts.tv_nsec = (timeout % 1000)*1000000;
+			std::memset(&arg, 0, sizeof(arg));
+			arg.ts = reinterpret_cast<__u64>(&ts);
+			flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+			minComplete = 1;
+			pArg = &arg;
+			argSize = sizeof(arg);
+		}
+		int rc;
+		do
+		{
+			rc = ioUringEnter(_fd, toSubmit, minComplete, flags, pArg, argSize);
+		}
+		while (rc < 0 && errno == EINTR);
+		if (rc < 0 && errno != ETIME && errno != EBUSY && errno != EAGAIN)
+			throw IOException("io_uring_enter() failed", Error::getMessage(errno), errno);
+	}
+
+	void cancelAll()
+		/// Cancels all pending operations and waits until the kernel
+		/// no longer refers to any buffer. Completions are discarded.
+	{
+		_closing = true;
+		if (_wakeUpArmed) wakeUp();
+		std::vector<Operation*> pending;
+		for (auto& pOp: _operations)
+		{
+			if (pOp->inUse && pOp->type < OP_CANCEL) pending.push_back(pOp.get());
+		}
+		for (auto pOp: pending) cancel(*pOp);
+		for (int i = 0; i < CANCEL_ATTEMPTS && _inFlight > 0; ++i)
+		{
+			enter(CANCEL_TIMEOUT);
+			harvest([](Operation&, int) { return 0; });
+		}
+	}
+
+	void cancel(Operation& op)
+	{
+		io_uring_sqe* pSQE = getSQE();
+		if (!pSQE) return;
+		Operation* pCancel = acquire(OP_CANCEL, op.sockfd);
+		pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+		pSQE->fd = -1;
+		pSQE->addr = reinterpret_cast<__u64>(&op);
+		pSQE->user_data = reinterpret_cast<__u64>(pCancel);
+	}
+
+	void armWakeUp()
+	{
+		io_uring_sqe* pSQE = getSQE();
+		if (!pSQE) return;
+		Operation* pOp = acquire(OP_WAKEUP, _eventFd);
+		pSQE->opcode = IORING_OP_READ;
+		pSQE->fd = _eventFd;
+		pSQE->addr = reinterpret_cast<__u64>(&_wakeUpValue);
+		pSQE->len = sizeof(_wakeUpValue);
+		pSQE->user_data = reinterpret_cast<__u64>(pOp);
+		_wakeUpArmed = true;
+	}
+
+	io_uring_sqe* getSQE()
+		/// Returns the next free submission queue entry, or
+		/// a null pointer if the submission queue is full.
+	{
+		if (_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+		{
+			flush(0);
+			if (_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+				return nullptr;
+		}
+		io_uring_sqe* pSQE = &_pSQEs[_sqTail & _sqMask];
+		++_sqTail;
+		std::memset(pSQE, 0, sizeof(*pSQE));
+		return pSQE;
+	}
+
+	unsigned publish()
+		/// Makes the prepared submission queue entries visible
+		/// to the kernel and returns their number.
+	{
+		__atomic_store_n(_sqTailPtr, _sqTail, __ATOMIC_RELEASE);
+		return _sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+	}
+
+	Operation* acquire(OpType type, poco_socket_t sockfd)
+	{
+		Operation* pOp;
+		if (_freeOperations.empty())
+		{
+			_operations.emplace_back(new Operation);
+			pOp = _operations.back().get();
+		}
+		else
+		{
+			pOp = _freeOperations.back();
+			_freeOperations.pop_back();
+		}
+		pOp->type = type;
+		pOp->sockfd = sockfd;
+		pOp->slot = -1;
+		pOp->inUse = true;
+		std::memset(&pOp->msg, 0, sizeof(pOp->msg));
+		++_inFlight;
+		return pOp;
+	}
+
+	void release(Operation* pOp)
+	{
+		if (pOp->slot >= 0) _freeSlots.push_back(pOp->slot);
+		pOp->slot = -1;
+		pOp->inUse = false;
+		_freeOperations.push_back(pOp);
+		--_inFlight;
+	}
+
+	int acquireSlot()
+	{
+		if (_freeSlots.empty()) return -1;
+		int slot = _freeSlots.back();
+		_freeSlots.pop_back();
+		return slot;
+	}
+
+	char* slotBuffer(int slot)
+	{
+		return static_cast<char*>(_pBuffers) + static_cast<std::size_t>(slot)*_bufferSize;
+	}
+
+	enum
+	{
+		CANCEL_ATTEMPTS = 20,
+		CANCEL_TIMEOUT = 50
+	};
+
+	using OperationVec = std::vector<std::unique_ptr<Operation>>;
+
+	int               _fd;
+	int               _eventFd;
+	void*             _pRing;
+	std::size_t       _ringSize;
+	io_uring_sqe*     _pSQEs;
+	std::size_t       _sqesSize;
+	unsigned*         _sqHead = nullptr;
+	unsigned*         _sqTailPtr = nullptr;
+	unsigned          _sqTail;
+	unsigned          _sqMask = 0;
+	unsigned          _sqEntries = 0;
+	unsigned*         _cqHead = nullptr;
+	unsigned*         _cqTail = nullptr;
+	unsigned*         _cqMask = nullptr;
+	io_uring_cqe*     _pCQEs = nullptr;
+	void*             _pBuffers;
+	unsigned          _bufferCount;
+	unsigned          _bufferSize;
+	bool              _fixedBuffers;
+	std::vector<int>  _freeSlots;
+	OperationVec      _operations;
+	std::vector<Operation*> _freeOperations;
+	int               _inFlight;
+	bool              _wakeUpArmed;
+	bool              _closing;
+	std::atomic<bool> _waiting;
+	Poco::UInt64      _wakeUpValue;
+};
+
+
+#else
+
+
+class IOUring
+	/// Placeholder for platforms without io_uring.
+{
+public:
+	static IOUring* create()
+	{
+		return nullptr;
+	}
+};
+
+
+#endif // POCO_HAVE_IO_URING
+
+
 //
 // SocketProactor
 //
@@ -229,7 +813,7 @@ const Timestamp::TimeDiff SocketProactor::PERMANENT_COMPLETION_HANDLER =
 	std::numeric_limits<Timestamp::TimeDiff>::max();
 
 
-SocketProactor::SocketProactor(bool worker):
+SocketProactor::SocketProactor(bool worker, bool ioUring):
 	_isRunning(false),
 	_isStopped(false),
 	_stop(false),
@@ -237,12 +821,13 @@ SocketProactor::SocketProactor(bool worker):
 	_maxTimeout(DEFAULT_MAX_TIMEOUT_MS),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_pIOUring(ioUring ? IOUring::create() : nullptr)
 {
 }
 
 
-SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
+SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker, bool ioUring):
 	_isRunning(false),
 	_isStopped(false),
 	_stop(false),
@@ -250,7 +835,8 @@ SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
 	_maxTimeout(static_cast<long>(timeout.totalMilliseconds())),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_pIOUring(ioUring ? IOUring::create() : nullptr)
 {
 }
 
@@ -259,6 +845,8 @@ SocketProactor::~SocketProactor()
 {
 	_ioCompletion.stop();
 	wait();
+	// cancel pending I/O before the buffers are deleted
+	_pIOUring.reset();
 	for (auto& pS : _writeHandlers)
 	{
 		for (auto& pH : pS.second)
@@ -290,9 +878,13 @@ int SocketProactor::poll(int* pHandled)
 {
 	int handled = 0;
 	int worked = 0;
-	PollSet::SocketModeMap sm = _pollSet.poll(_timeout);
-	if (sm.size() > 0)
+	if (_pIOUring)
 	{
+		handled = pollIOUring();
+	}
+	else
+	{
+		PollSet::SocketModeMap sm = _pollSet.poll(_timeout);
 		auto it = sm.begin();
 		auto end = sm.end();
 		for (; it != end; ++it)
@@ -340,6 +932,7 @@ void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketA
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	if (_pIOUring) scheduleIO(sock.impl()->sockfd(), SCHEDULE_READ);
 }
 
 
@@ -397,6 +990,7 @@ void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletio
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	if (_pIOUring) scheduleIO(sock.impl()->sockfd(), SCHEDULE_READ);
 }
 
 
@@ -447,6 +1041,26 @@ void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr
 	Poco::Mutex::ScopedLock l(_writeMutex);
 	_writeHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_WRITE);
+	if (_pIOUring) scheduleIO(sock.impl()->sockfd(), SCHEDULE_WRITE);
+}
+
+
+void SocketProactor::addAccept(ServerSocket sock, AcceptCallback&& onCompletion)
+{
+	std::unique_ptr<Handler> pHandler(new Handler);
+	pHandler->_onAccept = std::move(onCompletion);
+
+	Poco::Mutex::ScopedLock l(_readMutex);
+	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
+	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	if (_pIOUring) scheduleIO(sock.impl()->sockfd(), SCHEDULE_READ);
+}
+
+
+void SocketProactor::removeSocket(Socket sock)
+{
+	_pollSet.remove(sock);
+	if (_pIOUring) scheduleIO(sock.impl()->sockfd(), SCHEDULE_CANCEL);
 }
 
 
@@ -559,7 +1173,15 @@ int SocketProactor::receive(Socket& sock)
 	auto end = handlers.end();
 	for (; it != end;)
 	{
-		if ((avail = sock.available()))
+		if (!(*it)->_pBuf)
+		{
+			// server socket; accept one connection per poll
+			accept(sock, it);
+			++it;
+			handlers.pop_front();
+			break;
+		}
+		else if ((avail = sock.available()))
 		{
 			if (sock.isDatagram())
 				receiveFrom(*sock.impl(), it, avail);
@@ -620,6 +1242,199 @@ void SocketProactor::receive(SocketImpl& sock, IOHandlerIt& it, int available)
 }
 
 
+void SocketProactor::accept(Socket& sock, IOHandlerIt& it)
+{
+	SocketAddress clientAddr;
+	SocketImpl* pImpl = nullptr;
+	int err = 0;
+	try
+	{
+		pImpl = sock.impl()->acceptConnection(clientAddr);
+	}
+	catch(std::exception&)
+	{
+		err = Socket::lastError();
+	}
+	enqueueAcceptNotification(std::move((*it)->_onAccept), pImpl, err);
+}
+
+
+void SocketProactor::enqueueAcceptNotification(AcceptCallback&& onAccept, SocketImpl* pImpl, int err)
+{
+	StreamSocket socket;
+	if (pImpl) socket = StreamSocket(pImpl);
+	if (onAccept)
+	{
+		enqueueIONotification([onAccept = std::move(onAccept), socket](const std::error_code& failure, int) mutable
+			{
+				onAccept(failure, socket);
+			}, 0, err);
+	}
+}
+
+
+int SocketProactor::pollIOUring()
+{
+#if defined(POCO_HAVE_IO_URING)
+	ScheduleList scheduled;
+	{
+		Poco::Mutex::ScopedLock l(_scheduleMutex);
+		std::swap(scheduled, _scheduled);
+	}
+	for (const auto& s: scheduled)
+	{
+		if (s.second == SCHEDULE_CANCEL)
+			_pIOUring->cancel(s.first);
+		else
+			submitIO(s.first, s.second == SCHEDULE_READ);
+	}
+
+	long timeout = 0;
+	if (_timeout > 0 && !_pIOUring->hasCompletions())
+	{
+		// scheduleIO() only wakes up the ring if we're waiting,
+		// so check for I/O scheduled in the meantime afterwards
+		_pIOUring->setWaiting(true);
+		Poco::Mutex::ScopedLock l(_scheduleMutex);
+		if (_scheduled.empty()) timeout = _timeout;
+	}
+	try
+	{
+		_pIOUring->enter(timeout);
+	}
+	catch (...)
+	{
+		_pIOUring->setWaiting(false);
+		throw;
+	}
+	_pIOUring->setWaiting(false);
+
+	return _pIOUring->harvest([this](IOUring::Operation& op, int result)
+		{
+			return completeIO(&op, result);
+		});
+#else
+	return 0;
+#endif
+}
+
+
+void SocketProactor::scheduleIO(poco_socket_t sockfd, int op)
+{
+	{
+		Poco::Mutex::ScopedLock l(_scheduleMutex);
+		_scheduled.emplace_back(sockfd, op);
+	}
+#if defined(POCO_HAVE_IO_URING)
+	if (_pIOUring->isWaiting()) _pIOUring->wakeUp();
+#endif
+}
+
+
+void SocketProactor::submitIO(poco_socket_t sockfd, bool read)
+{
+#if defined(POCO_HAVE_IO_URING)
+	SubscriberMap& handlerMap = read ? _readHandlers : _writeHandlers;
+	Poco::Mutex::ScopedLock l(read ? _readMutex : _writeMutex);
+	auto hIt = handlerMap.find(sockfd);
+	if (hIt == handlerMap.end() || hIt->second.empty()) return;
+	Handler& handler = *hIt->second.front();
+	if (handler._submitted) return;
+
+	IOUring::OpType type;
+	if (read)
+	{
+		if (!handler._pBuf) type = IOUring::OP_ACCEPT;
+		else if (handler._pAddr) type = IOUring::OP_RECEIVE_FROM;
+		else type = IOUring::OP_RECEIVE;
+	}
+	else type = handler._pAddr ? IOUring::OP_SEND_TO : IOUring::OP_SEND;
+
+	if (_pIOUring->submit(handler, type, sockfd))
+		handler._submitted = true;
+	else // submission queue full, retry with next poll
+		scheduleIO(sockfd, read ? SCHEDULE_READ : SCHEDULE_WRITE);
+#endif
+}
+
+
+int SocketProactor::completeIO(void* pOperation, int result)
+{
+#if defined(POCO_HAVE_IO_URING)
+	IOUring::Operation& op = *static_cast<IOUring::Operation*>(pOperation);
+	bool read = op.type == IOUring::OP_RECEIVE || op.type == IOUring::OP_RECEIVE_FROM || op.type == IOUring::OP_ACCEPT;
+	SubscriberMap& handlerMap = read ? _readHandlers : _writeHandlers;
+	Poco::Mutex::ScopedLock l(read ? _readMutex : _writeMutex);
+	auto hIt = handlerMap.find(op.sockfd);
+	if (hIt == handlerMap.end() || hIt->second.empty() || !hIt->second.front()->_submitted)
+	{
+		if (op.type == IOUring::OP_ACCEPT && result >= 0) ::close(result);
+		return 0;
+	}
+
+	IOHandlerList& handlers = hIt->second;
+	Handler& handler = *handlers.front();
+	int n = result < 0 ? 0 : result;
+	int err = result < 0 ? -result : 0;
+	switch (op.type)
+	{
+	case IOUring::OP_RECEIVE:
+	case IOUring::OP_RECEIVE_FROM:
+		if (op.slot >= 0 && n > 0)
+		{
+			if (handler._pBuf->size() < static_cast<std::size_t>(n)) handler._pBuf->resize(n);
+			std::memcpy(handler._pBuf->data(), _pIOUring->buffer(op.slot), n);
+		}
+		if (op.type == IOUring::OP_RECEIVE_FROM && !err)
+			*handler._pAddr = SocketAddress(reinterpret_cast<const struct sockaddr*>(&op.addr), op.msg.msg_namelen);
+		enqueueIONotification(std::move(handler._onCompletion), n, err);
+		break;
+	case IOUring::OP_ACCEPT:
+		enqueueAcceptNotification(std::move(handler._onAccept), err ? nullptr : new StreamSocketImpl(result), err);
+		break;
+	default:
+		enqueueIONotification(std::move(handler._onCompletion), n, err);
+		break;
+	}
+	auto it = handlers.begin();
+	deleteHandler(handlers, it);
+	int handled = 1;
+
+	if (err == ECANCELED)
+	{
+		// the socket has been removed, fail all remaining handlers
+		while (!handlers.empty())
+		{
+			it = handlers.begin();
+			if ((*it)->_pBuf)
+				enqueueIONotification(std::move((*it)->_onCompletion), 0, ECANCELED);
+			else
+				enqueueAcceptNotification(std::move((*it)->_onAccept), nullptr, ECANCELED);
+			deleteHandler(handlers, it);
+			++handled;
+		}
+	}
+	else if (!handlers.empty())
+	{
+		submitIO(op.sockfd, read);
+	}
+	return handled;
+#else
+	return 0;
+#endif
+}
+
+
+bool SocketProactor::ioUringAvailable()
+{
+#if defined(POCO_HAVE_IO_URING)
+	return IOUring::supported();
+#else
+	return false;
+#endif
+}
+
+
 int SocketProactor::doWork(bool handleOne, bool expiredOnly)
 {
 	return worker().doWork(handleOne, expiredOnly);
@@ -702,6 +1517,9 @@ void SocketProactor::stop()
 void SocketProactor::wakeUp()
 {
 	if (_pThread) _pThread->wakeUp();
+#if defined(POCO_HAVE_IO_URING)
+	if (_pIOUring) _pIOUring->wakeUp();
+#endif
 }
 
 
@@ -19,6 +19,7 @@
 #include "Poco/Timespan.h"
 #include "Poco/Exception.h"
 #include "Poco/ErrorHandler.h"
+#include "Poco/Environment.h"
 
 
 using Poco::ErrorHandler;
@@ -38,6 +39,58 @@ TCPServerConnectionFilter::~TCPServerConnectionFilter()
 }
 
 
+//
+// TCPServer::Acceptor
+//
+
+
+class TCPServer::Acceptor: public Poco::Runnable
+	/// An additional accept thread with its own
+	/// SO_REUSEPORT server socket and dispatcher.
+{
+public:
+	Acceptor(TCPServer& server, const ServerSocket& socket, TCPServerDispatcher* pDispatcher):
+		_server(server),
+		_socket(socket),
+		_pDispatcher(pDispatcher),
+		_thread(threadName(socket))
+	{
+	}
+
+	~Acceptor()
+	{
+		_pDispatcher->release();
+	}
+
+	void start(int cpu)
+	{
+		_thread.start(*this);
+		if (cpu >= 0) _thread.setAffinity(cpu);
+	}
+
+	void join()
+	{
+		_thread.join();
+	}
+
+	void run()
+	{
+		_server.acceptConnections(_socket, *_pDispatcher);
+	}
+
+	TCPServerDispatcher& dispatcher()
+	{
+		return *_pDispatcher;
+	}
+
+private:
+	TCPServer& _server;
+	ServerSocket _socket;
+	TCPServerDispatcher* _pDispatcher;
+	Poco::Thread _thread;
+};
+
+
 //
 // TCPServer
 //
@@ -45,41 +98,31 @@ TCPServerConnectionFilter::~TCPServerConnectionFilter()
 
 TCPServer::TCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::UInt16 portNumber, TCPServerParams::Ptr pParams):
 	_socket(ServerSocket(portNumber)),
+	_pDispatcher(0),
 	_thread(threadName(_socket)),
 	_stopped(true)
 {
-	Poco::ThreadPool& pool = Poco::ThreadPool::defaultPool();
-	if (pParams)
-	{
-		int toAdd = pParams->getMaxThreads() - pool.capacity();
-		if (toAdd > 0) pool.addCapacity(toAdd);
-	}
-	_pDispatcher = new TCPServerDispatcher(pFactory, pool, pParams);
-
+	init(pFactory, defaultPool(pParams), pParams);
 }
 
 
 TCPServer::TCPServer(TCPServerConnectionFactory::Ptr pFactory, const ServerSocket& socket, TCPServerParams::Ptr pParams):
 	_socket(socket),
+	_pDispatcher(0),
 	_thread(threadName(socket)),
 	_stopped(true)
 {
-	Poco::ThreadPool& pool = Poco::ThreadPool::defaultPool();
-	if (pParams)
-	{
-		int toAdd = pParams->getMaxThreads() - pool.capacity();
-		if (toAdd > 0) pool.addCapacity(toAdd);
-	}
-	_pDispatcher = new TCPServerDispatcher(pFactory, pool, pParams);
+	init(pFactory, defaultPool(pParams), pParams);
 }
 
 
 TCPServer::TCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, const ServerSocket& socket, TCPServerParams::Ptr pParams):
 	_socket(socket),
-	_pDispatcher(new TCPServerDispatcher(pFactory, threadPool, pParams)),
+	_pDispatcher(0),
 	_thread(threadName(socket)),
 	_stopped(true)
 {
+	init(pFactory, threadPool, pParams);
 }
 
 
@@ -88,6 +131,7 @@ TCPServer::~TCPServer()
 	try
 	{
 		stop();
+		for (auto pAcceptor: _acceptors) delete pAcceptor;
 		_pDispatcher->release();
 	}
 	catch (...)
@@ -97,6 +141,48 @@ TCPServer::~TCPServer()
 }
 
 
+Poco::ThreadPool& TCPServer::defaultPool(TCPServerParams::Ptr pParams)
+{
+	Poco::ThreadPool& pool = Poco::ThreadPool::defaultPool();
+	if (pParams)
+	{
+		int toAdd = pParams->getMaxThreads()*pParams->getAcceptors() - pool.capacity();
+		if (toAdd > 0) pool.addCapacity(toAdd);
+	}
+	return pool;
+}
+
+
+void TCPServer::init(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, TCPServerParams::Ptr pParams)
+{
+	_pDispatcher = new TCPServerDispatcher(pFactory, threadPool, pParams);
+
+#if defined(SO_REUSEPORT)
+	int acceptors = pParams ? pParams->getAcceptors() : 1;
+#if defined(POCO_HAS_UNIX_SOCKET)
+	if (_socket.address().family() == AddressFamily::UNIX_LOCAL) acceptors = 1;
+#endif
+	try
+	{
+		SocketAddress address = _socket.address();
+		for (int i = 1; i < acceptors; ++i)
+		{
+			ServerSocket socket;
+			socket.bind(address, true, true);
+			socket.listen();
+			_acceptors.push_back(new Acceptor(*this, socket, new TCPServerDispatcher(pFactory, threadPool, pParams)));
+		}
+	}
+	catch (...)
+	{
+		for (auto pAcceptor: _acceptors) delete pAcceptor;
+		_pDispatcher->release();
+		throw;
+	}
+#endif
+}
+
+
 const TCPServerParams& TCPServer::params() const
 {
 	return _pDispatcher->params();
@@ -107,8 +193,16 @@ void TCPServer::start()
 {
 	poco_assert (_stopped);
 
+	bool affinity = _pDispatcher->params().getAcceptorAffinity();
+	int cores = static_cast<int>(Poco::Environment::processorCount());
+
 	_stopped = false;
 	_thread.start(*this);
+	if (affinity) _thread.setAffinity(0);
+	for (std::size_t i = 0; i < _acceptors.size(); ++i)
+	{
+		_acceptors[i]->start(affinity ? static_cast<int>((i + 1) % cores) : -1);
+	}
 }
 
 
@@ -118,23 +212,31 @@ void TCPServer::stop()
 	{
 		_stopped = true;
 		_thread.join();
+		for (auto pAcceptor: _acceptors) pAcceptor->join();
 		_pDispatcher->stop();
+		for (auto pAcceptor: _acceptors) pAcceptor->dispatcher().stop();
 	}
 }
 
 
 void TCPServer::run()
+{
+	acceptConnections(_socket, *_pDispatcher);
+}
+
+
+void TCPServer::acceptConnections(ServerSocket& socket, TCPServerDispatcher& dispatcher)
 {
 	while (!_stopped)
 	{
 		Poco::Timespan timeout(250000);
 		try
 		{
-			if (_socket.poll(timeout, Socket::SELECT_READ))
+			if (socket.poll(timeout, Socket::SELECT_READ))
 			{
 				try
 				{
-					StreamSocket ss = _socket.acceptConnection();
+					StreamSocket ss = socket.acceptConnection();
 
 					if (!_pConnectionFilter || _pConnectionFilter->accept(ss))
 					{
@@ -145,7 +247,7 @@ void TCPServer::run()
 						{
 							ss.setNoDelay(true);
 						}
-						_pDispatcher->enqueue(ss);
+						dispatcher.enqueue(ss);
 					}
 				}
 				catch (Poco::Exception& exc)
@@ -175,43 +277,56 @@ void TCPServer::run()
 
 int TCPServer::currentThreads() const
 {
-	return _pDispatcher->currentThreads();
+	int n = _pDispatcher->currentThreads();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().currentThreads();
+	return n;
 }
 
 
 int TCPServer::maxThreads() const
 {
+	// all shards share the same thread pool
 	return _pDispatcher->maxThreads();
 }
 
 
 int TCPServer::totalConnections() const
 {
-	return _pDispatcher->totalConnections();
+	int n = _pDispatcher->totalConnections();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().totalConnections();
+	return n;
 }
 
 
 int TCPServer::currentConnections() const
 {
-	return _pDispatcher->currentConnections();
+	int n = _pDispatcher->currentConnections();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().currentConnections();
+	return n;
 }
 
 
 int TCPServer::maxConcurrentConnections() const
 {
-	return _pDispatcher->maxConcurrentConnections();
+	int n = _pDispatcher->maxConcurrentConnections();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().maxConcurrentConnections();
+	return n;
 }
 
 
 int TCPServer::queuedConnections() const
 {
-	return _pDispatcher->queuedConnections();
+	int n = _pDispatcher->queuedConnections();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().queuedConnections();
+	return n;
 }
 
 
 int TCPServer::refusedConnections() const
 {
-	return _pDispatcher->refusedConnections();
+	int n = _pDispatcher->refusedConnections();
+	for (auto pAcceptor: _acceptors) n += pAcceptor->dispatcher().refusedConnections();
+	return n;
 }
 
 
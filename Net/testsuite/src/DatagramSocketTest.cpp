@@ -158,6 +158,112 @@ void DatagramSocketTest::testSendToReceiveFrom()
 }
 
 
+void DatagramSocketTest::testSendReceiveBatch()
+{
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	DatagramSocket sender(SocketAddress("127.0.0.1", 0), false);
+	const int count = 10;
+	std::vector<std::string> messages;
+	DatagramSocket::DatagramVec out(count);
+	for (int i = 0; i < count; ++i)
+	{
+		messages.push_back("hello " + std::to_string(i));
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		out[i].buffer = const_cast<char*>(messages[i].data());
+		out[i].length = static_cast<int>(messages[i].size());
+		out[i].address = receiver.address();
+	}
+	assertTrue (sender.sendBatch(out) == count);
+
+	char buffers[count][256];
+	DatagramSocket::DatagramVec in(count);
+	for (int i = 0; i < count; ++i)
+	{
+		in[i].buffer = buffers[i];
+		in[i].capacity = sizeof(buffers[i]);
+	}
+	int received = 0;
+	while (received < count)
+	{
+		DatagramSocket::DatagramVec batch(in.begin() + received, in.end());
+		int n = receiver.receiveBatch(batch);
+		assertTrue (n > 0);
+		std::copy(batch.begin(), batch.begin() + n, in.begin() + received);
+		received += n;
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		assertTrue (std::string(static_cast<char*>(in[i].buffer), in[i].length) == messages[i]);
+		assertTrue (in[i].address == sender.address());
+		assertTrue (in[i].segmentSize == 0);
+	}
+
+	receiver.setBlocking(false);
+	DatagramSocket::DatagramVec none(1);
+	none[0].buffer = buffers[0];
+	none[0].capacity = sizeof(buffers[0]);
+	assertTrue (receiver.receiveBatch(none) == -1);
+}
+
+
+void DatagramSocketTest::testSegmentationOffload()
+{
+#if POCO_OS == POCO_OS_LINUX
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	DatagramSocket sender(SocketAddress("127.0.0.1", 0), false);
+	try
+	{
+		receiver.setGRO(false);
+	}
+	catch (Poco::NotImplementedException&)
+	{
+		std::cout << "[UDP GRO NOT SUPPORTED]";
+		return;
+	}
+	assertFalse (receiver.getGRO());
+
+	std::string payload(3000, 'x');
+	DatagramSocket::DatagramVec out(1);
+	out[0].buffer = const_cast<char*>(payload.data());
+	out[0].length = static_cast<int>(payload.size());
+	out[0].address = receiver.address();
+	out[0].segmentSize = 1000;
+	try
+	{
+		assertTrue (sender.sendBatch(out) == 1);
+	}
+	catch (Poco::Exception&)
+	{
+		std::cout << "[UDP GSO NOT SUPPORTED]";
+		return;
+	}
+
+	// without GRO, the payload arrives as three datagrams
+	char buffers[3][2048];
+	DatagramSocket::DatagramVec in(3);
+	int received = 0;
+	while (received < 3)
+	{
+		DatagramSocket::DatagramVec batch(3 - received);
+		for (std::size_t i = 0; i < batch.size(); ++i)
+		{
+			batch[i].buffer = buffers[received + i];
+			batch[i].capacity = sizeof(buffers[received + i]);
+		}
+		int n = receiver.receiveBatch(batch);
+		assertTrue (n > 0);
+		for (int i = 0; i < n; ++i)
+		{
+			assertTrue (batch[i].length == 1000);
+		}
+		received += n;
+	}
+#endif
+}
+
+
 void DatagramSocketTest::testUnbound()
 {
 	UDPEchoServer echoServer;
@@ -823,6 +929,8 @@ CppUnit::Test* DatagramSocketTest::suite()
 	CppUnit_addTest(pSuite, DatagramSocketTest, testEchoBuffer);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReceiveFromAvailable);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testSendToReceiveFrom);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSendReceiveBatch);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSegmentationOffload);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testUnbound);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReuseAddressPortWildcard);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReuseAddressPortSpecific);
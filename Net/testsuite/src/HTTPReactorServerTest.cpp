@@ -0,0 +1,499 @@
+//
+// HTTPReactorServerTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPReactorServerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPReactorServer.h"
+#include "Poco/Net/HTTPReactorServerConnection.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include <vector>
+
+
+using Poco::Net::HTTPReactorServer;
+using Poco::Net::HTTPReactorServerConnection;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::StreamCopier;
+
+
+namespace
+{
+	class EchoBodyRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			if (request.getChunkedTransferEncoding())
+				response.setChunkedTransferEncoding(true);
+			else if (request.getContentLength() != HTTPMessage::UNKNOWN_CONTENT_LENGTH)
+				response.setContentLength(request.getContentLength());
+
+			response.setContentType(request.getContentType());
+
+			std::istream& istr = request.stream();
+			std::ostream& ostr = response.send();
+			StreamCopier::copyStream(istr, ostr);
+		}
+	};
+
+	class BufferRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string data("xxxxxxxxxx");
+			response.sendBuffer(data.data(), data.length());
+		}
+	};
+
+	class RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			if (request.getURI() == "/echoBody")
+				return new EchoBodyRequestHandler;
+			else if (request.getURI() == "/buffer")
+				return new BufferRequestHandler;
+			else
+				return 0;
+		}
+	};
+
+	std::string receiveAll(StreamSocket& socket)
+	{
+		std::string result;
+		char buffer[1024];
+		int n;
+		while ((n = socket.receiveBytes(buffer, sizeof(buffer))) > 0)
+		{
+			result.append(buffer, n);
+		}
+		return result;
+	}
+
+	int count(const std::string& str, const std::string& what)
+	{
+		int n = 0;
+		std::string::size_type pos = str.find(what);
+		while (pos != std::string::npos)
+		{
+			++n;
+			pos = str.find(what, pos + what.size());
+		}
+		return n;
+	}
+}
+
+
+HTTPReactorServerTest::HTTPReactorServerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPReactorServerTest::~HTTPReactorServerTest()
+{
+}
+
+
+void HTTPReactorServerTest::testIdentityRequest()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	std::string body(5000, 'x');
+	HTTPRequest request("POST", "/echoBody");
+	request.setContentLength((int) body.length());
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == (std::streamsize) body.size());
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (rbody == body);
+}
+
+
+void HTTPReactorServerTest::testChunkedRequest()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	std::string body(5000, 'x');
+	HTTPRequest request("POST", "/echoBody");
+	request.setContentType("text/plain");
+	request.setChunkedTransferEncoding(true);
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == HTTPMessage::UNKNOWN_CONTENT_LENGTH);
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (response.getChunkedTransferEncoding());
+	assertTrue (rbody == body);
+}
+
+
+void HTTPReactorServerTest::testClosedRequest()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	std::string body(5000, 'x');
+	HTTPRequest request("POST", "/echoBody");
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == HTTPMessage::UNKNOWN_CONTENT_LENGTH);
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (!response.getChunkedTransferEncoding());
+	assertTrue (rbody == body);
+}
+
+
+void HTTPReactorServerTest::testLargeRequest()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	std::string body(4*HTTPReactorServerConnection::MAX_PREREAD_SIZE, 'x');
+	HTTPRequest request("POST", "/echoBody");
+	request.setContentLength((int) body.length());
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == (std::streamsize) body.size());
+	assertTrue (rbody == body);
+}
+
+
+void HTTPReactorServerTest::testIdentityRequestKeepAlive()
+{
+	ServerSocket svs(0);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, new HTTPServerParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setKeepAlive(true);
+	std::string body(5000, 'x');
+	HTTPRequest request("POST", "/echoBody", HTTPMessage::HTTP_1_1);
+	request.setContentLength((int) body.length());
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == (std::streamsize) body.size());
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (response.getKeepAlive());
+	assertTrue (rbody == body);
+
+	body.assign(1000, 'y');
+	request.setContentLength((int) body.length());
+	request.setKeepAlive(false);
+	cs.sendRequest(request) << body;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getContentLength() == (std::streamsize) body.size());
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (!response.getKeepAlive());
+	assertTrue (rbody == body);
+	assertTrue (srv.totalConnections() == 1);
+	assertTrue (srv.totalRequests() == 2);
+}
+
+
+void HTTPReactorServerTest::testMaxKeepAlive()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setMaxKeepAliveRequests(4);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setKeepAlive(true);
+	HTTPRequest request("POST", "/echoBody", HTTPMessage::HTTP_1_1);
+	request.setContentType("text/plain");
+	request.setChunkedTransferEncoding(true);
+	std::string body(5000, 'x');
+	for (int i = 0; i < 3; ++i)
+	{
+		cs.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		cs.receiveResponse(response) >> rbody;
+		assertTrue (response.getChunkedTransferEncoding());
+		assertTrue (response.getKeepAlive());
+		assertTrue (rbody == body);
+	}
+
+	{
+		cs.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		cs.receiveResponse(response) >> rbody;
+		assertTrue (response.getChunkedTransferEncoding());
+		assertTrue (!response.getKeepAlive());
+		assertTrue (rbody == body);
+	}
+}
+
+
+void HTTPReactorServerTest::testKeepAliveTimeout()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setKeepAliveTimeout(Poco::Timespan(1, 0));
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setKeepAlive(true);
+	HTTPRequest request("GET", "/buffer", HTTPMessage::HTTP_1_1);
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getKeepAlive());
+	assertTrue (rbody == "xxxxxxxxxx");
+	assertTrue (srv.currentConnections() == 1);
+
+	Poco::Thread::sleep(3000);
+
+	assertTrue (srv.currentConnections() == 0);
+}
+
+
+void HTTPReactorServerTest::testPipelinedRequests()
+{
+	ServerSocket svs(0);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, new HTTPServerParams, 2);
+	srv.start();
+
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string requests(
+		"GET /buffer HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"\r\n"
+		"POST /echoBody HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"Content-Length: 5\r\n"
+		"\r\n"
+		"hello"
+		"GET /buffer HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"Connection: close\r\n"
+		"\r\n");
+	ss.sendBytes(requests.data(), (int) requests.size());
+	std::string responses = receiveAll(ss);
+	assertTrue (count(responses, "HTTP/1.1 200 OK") == 3);
+	assertTrue (count(responses, "xxxxxxxxxx") == 2);
+	assertTrue (count(responses, "hello") == 1);
+	assertTrue (responses.find("hello") < responses.rfind("xxxxxxxxxx"));
+	assertTrue (srv.totalRequests() == 3);
+}
+
+
+void HTTPReactorServerTest::testIdleConnections()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setMaxThreads(2);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	std::vector<StreamSocket> idle;
+	for (int i = 0; i < 32; ++i)
+	{
+		StreamSocket ss;
+		ss.connect(SocketAddress("127.0.0.1", svs.address().port()));
+		idle.push_back(ss);
+	}
+
+	// A partially sent request must not tie up a worker thread.
+	std::string partial("GET /buffer HTTP/1.1\r\nHost: localhost\r\n");
+	idle[0].sendBytes(partial.data(), (int) partial.size());
+
+	for (int i = 0; i < 4; ++i)
+	{
+		HTTPClientSession cs("127.0.0.1", svs.address().port());
+		HTTPRequest request("GET", "/buffer", HTTPMessage::HTTP_1_1);
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		cs.receiveResponse(response) >> rbody;
+		assertTrue (rbody == "xxxxxxxxxx");
+	}
+	assertTrue (srv.currentThreads() <= 2);
+	assertTrue (srv.currentConnections() >= 32);
+
+	std::string rest("Connection: close\r\n\r\n");
+	idle[0].sendBytes(rest.data(), (int) rest.size());
+	std::string response = receiveAll(idle[0]);
+	assertTrue (count(response, "xxxxxxxxxx") == 1);
+}
+
+
+void HTTPReactorServerTest::test100Continue()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string header(
+		"POST /echoBody HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"Content-Type: text/plain\r\n"
+		"Content-Length: 5\r\n"
+		"Expect: 100-continue\r\n"
+		"\r\n");
+	ss.sendBytes(header.data(), (int) header.size());
+	char buffer[1024];
+	int n = ss.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n).find("100 Continue") != std::string::npos);
+	ss.sendBytes("hello", 5);
+	std::string response = receiveAll(ss);
+	assertTrue (response.find("200 OK") != std::string::npos);
+	assertTrue (response.find("hello") != std::string::npos);
+}
+
+
+void HTTPReactorServerTest::testNotImpl()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, pParams, 2);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	HTTPRequest request("GET", "/notImpl");
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_NOT_IMPLEMENTED);
+	assertTrue (rbody.empty());
+}
+
+
+void HTTPReactorServerTest::testBadRequest()
+{
+	ServerSocket svs(0);
+	HTTPReactorServer srv(new RequestHandlerFactory, svs, new HTTPServerParams, 2);
+	srv.start();
+
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string request("GET /buffer HTTP/1.1\r\n");
+	request.append(1024, 'X');
+	request.append(": value\r\n\r\n");
+	ss.sendBytes(request.data(), (int) request.size());
+	std::string response = receiveAll(ss);
+	assertTrue (response.find("400 Bad Request") != std::string::npos);
+}
+
+
+void HTTPReactorServerTest::testRequestReady()
+{
+	assertTrue (!HTTPReactorServerConnection::requestReady(""));
+	assertTrue (!HTTPReactorServerConnection::requestReady("GET / HTTP/1.1\r\n"));
+	assertTrue (!HTTPReactorServerConnection::requestReady("GET / HTTP/1.1\r\nHost: localhost\r\n"));
+	assertTrue (HTTPReactorServerConnection::requestReady("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n"));
+	assertTrue (HTTPReactorServerConnection::requestReady("\r\nGET / HTTP/1.0\n\n"));
+	assertTrue (!HTTPReactorServerConnection::requestReady("POST / HTTP/1.1\r\ncontent-length: 5\r\n\r\nhell"));
+	assertTrue (HTTPReactorServerConnection::requestReady("POST / HTTP/1.1\r\ncontent-length: 5\r\n\r\nhello"));
+	assertTrue (HTTPReactorServerConnection::requestReady("POST / HTTP/1.1\r\nContent-Length: 1000000\r\n\r\n"));
+	assertTrue (HTTPReactorServerConnection::requestReady("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"));
+	assertTrue (HTTPReactorServerConnection::requestReady("POST / HTTP/1.1\r\nContent-Length: 5\r\nExpect: 100-continue\r\n\r\n"));
+	assertTrue (HTTPReactorServerConnection::requestReady(std::string(HTTPReactorServerConnection::MAX_PREREAD_SIZE, 'x')));
+}
+
+
+void HTTPReactorServerTest::setUp()
+{
+}
+
+
+void HTTPReactorServerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPReactorServerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPReactorServerTest");
+
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testIdentityRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testChunkedRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testClosedRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testLargeRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testIdentityRequestKeepAlive);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testMaxKeepAlive);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testKeepAliveTimeout);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testPipelinedRequests);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testIdleConnections);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, test100Continue);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testNotImpl);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testBadRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testRequestReady);
+
+	return pSuite;
+}
@@ -0,0 +1,50 @@
+//
+// HTTPReactorServerTest.h
+//
+// Definition of the HTTPReactorServerTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPReactorServerTest_INCLUDED
+#define HTTPReactorServerTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPReactorServerTest: public CppUnit::TestCase
+{
+public:
+	HTTPReactorServerTest(const std::string& name);
+	~HTTPReactorServerTest();
+
+	void testIdentityRequest();
+	void testChunkedRequest();
+	void testClosedRequest();
+	void testLargeRequest();
+	void testIdentityRequestKeepAlive();
+	void testMaxKeepAlive();
+	void testKeepAliveTimeout();
+	void testPipelinedRequests();
+	void testIdleConnections();
+	void test100Continue();
+	void testNotImpl();
+	void testBadRequest();
+	void testRequestReady();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPReactorServerTest_INCLUDED
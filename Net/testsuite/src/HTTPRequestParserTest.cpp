@@ -0,0 +1,217 @@
+//
+// HTTPRequestParserTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPRequestParserTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPRequestParser.h"
+#include "Poco/Net/HTTPRequest.h"
+
+
+using Poco::Net::HTTPRequestParser;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPMessage;
+
+
+HTTPRequestParserTest::HTTPRequestParserTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPRequestParserTest::~HTTPRequestParserTest()
+{
+}
+
+
+void HTTPRequestParserTest::testParse()
+{
+	std::string s("GET /test.html HTTP/1.1\r\nHost: localhost\r\nUser-Agent:  Poco  \r\nConnection: Keep-Alive\r\n\r\nbody");
+	HTTPRequestParser parser;
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_DONE);
+	assertTrue (parser.status() == HTTPRequestParser::PARSE_DONE);
+	assertTrue (parser.consumed() == s.size() - 4);
+	assertTrue (parser.method() == "GET");
+	assertTrue (parser.uri() == "/test.html");
+	assertTrue (parser.version() == "HTTP/1.1");
+	assertTrue (parser.fieldCount() == 3);
+	assertTrue (parser.fieldName(0) == "Host");
+	assertTrue (parser.fieldValue(0) == "localhost");
+	assertTrue (parser.fieldName(1) == "User-Agent");
+	assertTrue (parser.fieldValue(1) == "Poco");
+	assertTrue (parser.has("connection"));
+	assertTrue (parser.get("CONNECTION") == "Keep-Alive");
+	assertTrue (!parser.has("Content-Length"));
+	assertTrue (parser.get("Content-Length").empty());
+}
+
+
+void HTTPRequestParserTest::testParseIncremental()
+{
+	std::string s("\r\nPOST /test.cgi HTTP/1.1\r\nHost: localhost:8000\r\nContent-Length: 100\r\nContent-Type: text/plain\r\n\r\n");
+	for (std::size_t n = 0; n < s.size(); ++n)
+	{
+		HTTPRequestParser parser;
+		std::string buffer;
+		buffer.append(s, 0, n);
+		assertTrue (parser.parse(buffer.data(), buffer.size()) == HTTPRequestParser::PARSE_INCOMPLETE);
+		assertTrue (parser.consumed() == 0);
+		buffer.append(s, n, std::string::npos);
+		assertTrue (parser.parse(buffer.data(), buffer.size()) == HTTPRequestParser::PARSE_DONE);
+		assertTrue (parser.consumed() == s.size());
+		assertTrue (parser.method() == "POST");
+		assertTrue (parser.uri() == "/test.cgi");
+		assertTrue (parser.fieldCount() == 3);
+		assertTrue (parser.get("Content-Type") == "text/plain");
+	}
+}
+
+
+void HTTPRequestParserTest::testParseLF()
+{
+	std::string s("GET / HTTP/1.0\nHost: localhost\n\n");
+	HTTPRequestParser parser;
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_DONE);
+	assertTrue (parser.consumed() == s.size());
+	assertTrue (parser.version() == "HTTP/1.0");
+	assertTrue (parser.get("Host") == "localhost");
+
+	parser.reset();
+	std::string s2("GET / HTTP/1.0\r\n\r\n");
+	assertTrue (parser.parse(s2.data(), s2.size()) == HTTPRequestParser::PARSE_DONE);
+	assertTrue (parser.fieldCount() == 0);
+}
+
+
+void HTTPRequestParserTest::testInvalidLines()
+{
+	std::string s("GET / HTTP/1.1\r\nHost: localhost\r\nthis is not a header\r\nAccept: */*\r\n\r\n");
+	HTTPRequestParser parser;
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_DONE);
+	assertTrue (parser.fieldCount() == 2);
+	assertTrue (parser.fieldName(1) == "Accept");
+}
+
+
+void HTTPRequestParserTest::testInvalid()
+{
+	HTTPRequestParser parser;
+	std::string s("GET\r\n\r\n");
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET / HTTP/1.1 extra\r\n\r\n";
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET / HTTP/1.1\r\nX-Folded: first\r\n second\r\n\r\n";
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET / HTTP/1.1\r\nHost: local\rhost\r\n\r\n";
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+	assertTrue (parser.status() == HTTPRequestParser::PARSE_ERROR);
+}
+
+
+void HTTPRequestParserTest::testLimits()
+{
+	HTTPRequestParser parser;
+	std::string s("GET / HTTP/1.1\r\n");
+	s.append(HTTPRequestParser::MAX_NAME_LENGTH + 1, 'x');
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET / HTTP/1.1\r\nX-Value: ";
+	s.append(HTTPRequestParser::MAX_VALUE_LENGTH + 1, 'x');
+	s.append("\r\n\r\n");
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET / HTTP/1.1\r\n";
+	for (int i = 0; i <= HTTPRequestParser::MAX_FIELDS; ++i)
+	{
+		s.append("X-Field: value\r\n");
+	}
+	s.append("\r\n");
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+
+	parser.reset();
+	s = "GET /";
+	s.append(HTTPRequestParser::MAX_URI_LENGTH, 'x');
+	s.append(" HTTP/1.1\r\n\r\n");
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_ERROR);
+}
+
+
+void HTTPRequestParserTest::testApply()
+{
+	std::string s("HEAD /index.html HTTP/1.1\r\nHost: localhost\r\nConnection: Keep-Alive\r\nUser-Agent: Poco\r\nX-Encoded: =?UTF-8?Q?Hello_World?=\r\n\r\n");
+	HTTPRequestParser parser;
+	assertTrue (parser.parse(s.data(), s.size()) == HTTPRequestParser::PARSE_DONE);
+
+	HTTPRequest request;
+	parser.apply(request);
+	assertTrue (request.getMethod() == HTTPRequest::HTTP_HEAD);
+	assertTrue (request.getURI() == "/index.html");
+	assertTrue (request.getVersion() == HTTPMessage::HTTP_1_1);
+	assertTrue (request.getHost() == "localhost");
+	assertTrue (request.getKeepAlive());
+	assertTrue (request.get("User-Agent") == "Poco");
+	assertTrue (request.get("X-Encoded") == "Hello World");
+	assertTrue (request.size() == 4);
+
+	HTTPRequest request2;
+	request2.setAutoDecode(false);
+	parser.apply(request2);
+	assertTrue (request2.get("X-Encoded") == "=?UTF-8?Q?Hello_World?=");
+}
+
+
+void HTTPRequestParserTest::testScan()
+{
+	std::string s(100, 'a');
+	for (std::size_t i = 0; i < s.size(); ++i)
+	{
+		std::string t(s);
+		t[i] = ':';
+		assertTrue (HTTPRequestParser::scan(t.data(), t.data() + t.size(), ':', '\n') == t.data() + i);
+		t[i] = '\n';
+		assertTrue (HTTPRequestParser::scan(t.data(), t.data() + t.size(), ':', '\n') == t.data() + i);
+		assertTrue (HTTPRequestParser::scan(t.data(), t.data() + t.size(), '\n', '\n') == t.data() + i);
+		assertTrue (HTTPRequestParser::scan(t.data(), t.data() + i, ':', '\n') == t.data() + i);
+	}
+}
+
+
+void HTTPRequestParserTest::setUp()
+{
+}
+
+
+void HTTPRequestParserTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPRequestParserTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPRequestParserTest");
+
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testParse);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testParseIncremental);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testParseLF);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testInvalidLines);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testInvalid);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testLimits);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testApply);
+	CppUnit_addTest(pSuite, HTTPRequestParserTest, testScan);
+
+	return pSuite;
+}
@@ -10,6 +10,7 @@
 
 #include "HTTPTestSuite.h"
 #include "HTTPRequestTest.h"
+#include "HTTPRequestParserTest.h"
 #include "HTTPResponseTest.h"
 #include "HTTPCookieTest.h"
 #include "HTTPCredentialsTest.h"
@@ -21,6 +22,7 @@ CppUnit::Test* HTTPTestSuite::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPTestSuite");
 
 	pSuite->addTest(HTTPRequestTest::suite());
+	pSuite->addTest(HTTPRequestParserTest::suite());
 	pSuite->addTest(HTTPResponseTest::suite());
 	pSuite->addTest(HTTPCookieTest::suite());
 	pSuite->addTest(HTTPCredentialsTest::suite());
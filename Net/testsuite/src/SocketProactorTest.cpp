@@ -41,8 +41,88 @@ SocketProactorTest::~SocketProactorTest()
 
 void SocketProactorTest::testTCPSocketProactor()
 {
-	EchoServer echoServer;
+	tcpSocketProactor(true);
+}
+
+
+void SocketProactorTest::testUDPSocketProactor()
+{
+	udpSocketProactor(true);
+}
+
+
+void SocketProactorTest::testTCPSocketProactorPollSet()
+{
+	tcpSocketProactor(false);
+}
+
+
+void SocketProactorTest::testUDPSocketProactorPollSet()
+{
+	udpSocketProactor(false);
+}
+
+
+void SocketProactorTest::testAccept()
+{
+	accept(true);
+}
+
+
+void SocketProactorTest::testAcceptPollSet()
+{
+	accept(false);
+}
+
+
+void SocketProactorTest::testRemoveSocket()
+{
+	DatagramSocket s(SocketAddress("127.0.0.1", 0), false);
 	SocketProactor proactor(false);
+	SocketProactor::Buffer buf;
+	SocketAddress sa;
+	std::atomic<bool> completed(false);
+	std::atomic<int> error(0);
+	auto onRecvCompletion = [&](std::error_code err, int bytes)
+	{
+		error = err.value();
+		completed = true;
+	};
+	proactor.addReceiveFrom(s, buf, sa, onRecvCompletion);
+	proactor.poll();
+	assertTrue (proactor.has(s));
+	proactor.removeSocket(s);
+	assertFalse (proactor.has(s));
+	if (proactor.usesIOUring())
+	{
+		Stopwatch sw;
+		sw.start();
+		while (!completed)
+		{
+			if (sw.elapsedSeconds() > 1)
+				fail("SocketProactor cancellation timed out.", __LINE__, __FILE__);
+			proactor.poll();
+		}
+		assertTrue (error == ECANCELED);
+	}
+}
+
+
+void SocketProactorTest::testIOUring()
+{
+	SocketProactor proactor;
+	assertTrue (proactor.usesIOUring() == SocketProactor::ioUringAvailable());
+	SocketProactor pollSetProactor(Poco::Timespan(0, 250000), true, false);
+	assertFalse (pollSetProactor.usesIOUring());
+	SocketProactor defaultPollSetProactor(true, false);
+	assertFalse (defaultPollSetProactor.usesIOUring());
+}
+
+
+void SocketProactorTest::tcpSocketProactor(bool ioUring)
+{
+	EchoServer echoServer;
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, ioUring);
 	StreamSocket s;
 	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE | SocketProactor::POLL_ERROR;
@@ -131,11 +211,11 @@ void SocketProactorTest::testTCPSocketProactor()
 }
 
 
-void SocketProactorTest::testUDPSocketProactor()
+void SocketProactorTest::udpSocketProactor(bool ioUring)
 {
 	UDPEchoServer echoServer;
 	DatagramSocket s(SocketAddress::IPv4);
-	SocketProactor proactor(false);
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, ioUring);
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE;
 	proactor.addSocket(s, mode);
 	std::string hello = "hello proactor world";
@@ -209,6 +289,54 @@ void SocketProactorTest::testUDPSocketProactor()
 }
 
 
+void SocketProactorTest::accept(bool ioUring)
+{
+	ServerSocket server(SocketAddress("127.0.0.1", 0));
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, ioUring);
+	std::atomic<bool> accepted(false), acceptPassed(false);
+	StreamSocket connection;
+	auto onAccept = [&](std::error_code err, StreamSocket& socket)
+	{
+		acceptPassed = (err.value() == 0) &&
+			(socket.peerAddress().host().toString() == "127.0.0.1");
+		connection = socket;
+		accepted = true;
+	};
+	proactor.addAccept(server, onAccept);
+	StreamSocket client;
+	client.connect(server.address());
+	Stopwatch sw;
+	sw.start();
+	while (!accepted)
+	{
+		if (sw.elapsedSeconds() > 1)
+			fail("SocketProactor accept completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertTrue (acceptPassed);
+
+	std::string hello = "hello proactor world";
+	client.sendBytes(hello.data(), static_cast<int>(hello.size()));
+	SocketProactor::Buffer buf;
+	std::atomic<bool> received(false);
+	std::atomic<int> receivedBytes(0);
+	proactor.addReceive(connection, buf, [&](std::error_code err, int bytes)
+	{
+		receivedBytes = bytes;
+		received = true;
+	});
+	sw.restart();
+	while (!received)
+	{
+		if (sw.elapsedSeconds() > 1)
+			fail("SocketProactor receive completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertTrue (receivedBytes == static_cast<int>(hello.size()));
+	assertTrue (std::string(buf.begin(), buf.begin() + receivedBytes) == hello);
+}
+
+
 void SocketProactorTest::testSocketProactorStartStop()
 {
 	UDPEchoServer echoServer;
@@ -347,6 +475,12 @@ CppUnit::Test* SocketProactorTest::suite()
 
 	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactor);
+	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactorPollSet);
+	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactorPollSet);
+	CppUnit_addTest(pSuite, SocketProactorTest, testAccept);
+	CppUnit_addTest(pSuite, SocketProactorTest, testAcceptPollSet);
+	CppUnit_addTest(pSuite, SocketProactorTest, testRemoveSocket);
+	CppUnit_addTest(pSuite, SocketProactorTest, testIOUring);
 	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorStartStop);
 	CppUnit_addTest(pSuite, SocketProactorTest, testWork);
 	CppUnit_addTest(pSuite, SocketProactorTest, testTimedWork);
@@ -32,6 +32,12 @@ public:
 
 	void testTCPSocketProactor();
 	void testUDPSocketProactor();
+	void testTCPSocketProactorPollSet();
+	void testUDPSocketProactorPollSet();
+	void testAccept();
+	void testAcceptPollSet();
+	void testRemoveSocket();
+	void testIOUring();
 	void testSocketProactorStartStop();
 
 	void testWork();
@@ -43,6 +49,9 @@ public:
 	static CppUnit::Test* suite();
 
 private:
+	void tcpSocketProactor(bool ioUring);
+	void udpSocketProactor(bool ioUring);
+	void accept(bool ioUring);
 };
 
 
@@ -18,6 +18,9 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Thread.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/WorkStealingExecutor.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/Mutex.h"
 #include <iostream>
 
@@ -32,6 +35,8 @@ using Poco::Net::StreamSocket;
 using Poco::Net::ServerSocket;
 using Poco::Net::SocketAddress;
 using Poco::Thread;
+using Poco::ThreadPool;
+using Poco::WorkStealingExecutor;
 
 
 namespace
@@ -258,6 +263,89 @@ void TCPServerTest::testThreadCapacity()
 }
 
 
+void TCPServerTest::testWorkStealingExecutor()
+{
+	ThreadPool pool(new WorkStealingExecutor(4));
+	ServerSocket svs(0);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>(), pool, svs, new TCPServerParams);
+	srv.start();
+	assertTrue (srv.maxThreads() == 4);
+
+	SocketAddress sa("127.0.0.1", svs.address().port());
+	StreamSocket ss1(sa);
+	StreamSocket ss2(sa);
+	std::string data("hello, world");
+	ss1.sendBytes(data.data(), (int) data.size());
+	ss2.sendBytes(data.data(), (int) data.size());
+	char buffer[256];
+	int n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	n = ss2.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (srv.currentConnections() == 2);
+	assertTrue (srv.totalConnections() == 2);
+	ss1.close();
+	ss2.close();
+	Thread::sleep(1000);
+	assertTrue (srv.currentConnections() == 0);
+	srv.stop();
+}
+
+
+void TCPServerTest::testMultipleAcceptors()
+{
+	TCPServerParams* pParams = new TCPServerParams;
+	pParams->setMaxThreads(4);
+	pParams->setAcceptors(4);
+	pParams->setAcceptorAffinity(true);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>(), 0, pParams);
+#if defined(SO_REUSEPORT)
+	assertTrue (srv.acceptors() == 4);
+#else
+	assertTrue (srv.acceptors() == 1);
+#endif
+	srv.start();
+	assertTrue (srv.currentConnections() == 0);
+	assertTrue (srv.totalConnections() == 0);
+
+	SocketAddress sa("127.0.0.1", srv.port());
+	const int count = 32;
+	std::string data("hello, world");
+	char buffer[256];
+	for (int i = 0; i < count; ++i)
+	{
+		StreamSocket ss(sa);
+		ss.sendBytes(data.data(), (int) data.size());
+		int n = ss.receiveBytes(buffer, sizeof(buffer));
+		assertTrue (std::string(buffer, n) == data);
+		ss.close();
+	}
+	Thread::sleep(1000);
+	assertTrue (srv.currentConnections() == 0);
+	assertTrue (srv.queuedConnections() == 0);
+	assertTrue (srv.refusedConnections() == 0);
+	assertTrue (srv.totalConnections() == count);
+	assertTrue (srv.maxThreads() == ThreadPool::defaultPool().capacity());
+	srv.stop();
+
+#if defined(SO_REUSEPORT)
+	ServerSocket svs;
+	svs.bind(SocketAddress("127.0.0.1", 0), true, false);
+	svs.listen();
+	pParams = new TCPServerParams;
+	pParams->setAcceptors(2);
+	try
+	{
+		TCPServer srv2(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs, pParams);
+		fail("server socket without SO_REUSEPORT - must throw");
+	}
+	catch (Poco::Net::NetException&)
+	{
+	}
+#endif
+}
+
+
 void TCPServerTest::testFilter()
 {
 	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>());
@@ -300,6 +388,8 @@ CppUnit::Test* TCPServerTest::suite()
 	CppUnit_addTest(pSuite, TCPServerTest, testTwoConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testMultiConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testThreadCapacity);
+	CppUnit_addTest(pSuite, TCPServerTest, testWorkStealingExecutor);
+	CppUnit_addTest(pSuite, TCPServerTest, testMultipleAcceptors);
 	CppUnit_addTest(pSuite, TCPServerTest, testFilter);
 
 	return pSuite;
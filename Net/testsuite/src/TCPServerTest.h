@@ -28,6 +28,8 @@ public:
 	void testTwoConnections();
 	void testMultiConnections();
 	void testThreadCapacity();
+	void testWorkStealingExecutor();
+	void testMultipleAcceptors();
 	void testFilter();
 
 	void setUp();
@@ -0,0 +1,136 @@
+//
+// CacheCollector.h
+//
+// Library: Prometheus
+// Package: Collectors
+// Module:  CacheCollector
+//
+// Definition of the CacheCollector class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Prometheus_CacheCollector_INCLUDED
+#define Prometheus_CacheCollector_INCLUDED
+
+
+#include "Poco/Prometheus/Collector.h"
+#include "Poco/Prometheus/Metric.h"
+#include "Poco/ConcurrentLRUCache.h"
+#include "Poco/Mutex.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco {
+namespace Prometheus {
+
+
+class Prometheus_API CacheCollector: public Collector
+	/// This Collector provides Poco::ConcurrentLRUCache specific metrics:
+	///   - poco_cache_hits_total: Number of cache lookups that found a valid entry.
+	///   - poco_cache_misses_total: Number of cache lookups that found no valid entry.
+	///   - poco_cache_evictions_total: Number of entries evicted to make room for new entries.
+	///   - poco_cache_expirations_total: Number of entries removed because they expired.
+	///   - poco_cache_entries: Number of entries currently in the cache.
+	///   - poco_cache_bytes: Total size of all entries currently in the cache.
+	///
+	/// A single CacheCollector exports the metrics of all caches
+	/// added to it with addCache(). Every metric has one sample per
+	/// cache, with a single label "name" identifying the cache.
+	/// The statistics of every cache are obtained only once
+	/// per export.
+	///
+	/// The collector is named "poco_cache", so only one CacheCollector
+	/// can be registered with a Registry.
+{
+public:
+	CacheCollector();
+		/// Creates a CacheCollector without caches, and registers
+		/// it with the default Registry.
+
+	explicit CacheCollector(Registry* pRegistry);
+		/// Creates a CacheCollector without caches, and registers
+		/// it with the given Registry (if not nullptr).
+
+	CacheCollector(const std::string& name, const Poco::AbstractConcurrentCache& cache);
+		/// Creates a CacheCollector for the given cache, and registers
+		/// it with the default Registry. More caches can be added
+		/// with addCache().
+
+	CacheCollector(const std::string& name, const Poco::AbstractConcurrentCache& cache, Registry* pRegistry);
+		/// Creates a CacheCollector for the given cache, and registers
+		/// it with the given Registry (if not nullptr).
+
+	~CacheCollector() = default;
+		/// Destroys the CacheCollector.
+
+	void addCache(const std::string& name, const Poco::AbstractConcurrentCache& cache);
+		/// Adds a cache. The name is used as the value of the "name"
+		/// label, and must be unique within the CacheCollector.
+		///
+		/// Throws a Poco::ExistsException if a cache with the
+		/// given name has already been added.
+
+	void removeCache(const std::string& name);
+		/// Removes the cache with the given name, which must be done
+		/// before the cache is destroyed.
+
+	// Collector
+	void exportTo(Exporter& exporter) const override;
+		/// Writes the metrics of all caches to the Exporter.
+
+protected:
+	void buildMetrics();
+
+	static const std::string NAME_PREFIX;
+
+private:
+	using Statistics = Poco::AbstractConcurrentCache::Statistics;
+
+	class StatisticsMetric: public Metric
+		/// Describes one metric family. The samples are written by
+		/// CacheCollector::exportTo() from a snapshot of the statistics
+		/// of all caches.
+	{
+	public:
+		using Getter = std::function<Poco::UInt64(const Statistics&)>;
+
+		StatisticsMetric(Type type, const std::string& name, const std::string& help, Getter getter):
+			Metric(type, name, nullptr),
+			_getter(getter)
+		{
+			setHelp(help);
+		}
+
+		Poco::UInt64 value(const Statistics& statistics) const
+		{
+			return _getter(statistics);
+		}
+
+		void exportTo(Exporter&) const override
+		{
+		}
+
+	private:
+		Getter _getter;
+	};
+
+	using MetricPtr = std::unique_ptr<StatisticsMetric>;
+
+	std::map<std::string, const Poco::AbstractConcurrentCache*> _caches;
+	std::vector<MetricPtr> _metrics;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Prometheus
+
+
+#endif // Prometheus_CacheCollector_INCLUDED
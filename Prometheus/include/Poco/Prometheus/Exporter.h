@@ -33,6 +33,12 @@ class Metric;
 class Prometheus_API Exporter
 	/// The Exporter interface is used to format and write metrics
 	/// to an output stream.
+	///
+	/// Exporters may buffer their output. When writing metrics
+	/// directly with Metric::exportTo() or Collector::exportTo(),
+	/// instead of Registry::exportTo(), finish() must be called
+	/// after the last metric has been written, before the output
+	/// stream is read.
 {
 public:
 	virtual void writeHeader(const Metric& metric) = 0;
@@ -59,6 +65,16 @@ public:
 	virtual void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp = 0) = 0;
 		/// Writes a sample for the given metric and the given labels.
 
+	virtual void finish();
+		/// Called by Registry::exportTo() after all metrics
+		/// have been written. Exporters buffering their output
+		/// must write any remaining output to the output stream.
+		///
+		/// Must be called by the application after exporting
+		/// metrics without going through Registry::exportTo().
+		///
+		/// The default implementation does nothing.
+
 protected:
 	Exporter() = default;
 	virtual ~Exporter() = default;
@@ -70,6 +86,14 @@ protected:
 };
 
 
+//
+// inlines
+//
+inline void Exporter::finish()
+{
+}
+
+
 } } // namespace Poco::Prometheus
 
 
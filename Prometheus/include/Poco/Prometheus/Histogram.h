@@ -19,9 +19,12 @@
 
 
 #include "Poco/Prometheus/LabeledMetricImpl.h"
+#include "Poco/Prometheus/AtomicFloat.h"
 #include "Poco/Clock.h"
 #include "Poco/Mutex.h"
 #include <vector>
+#include <memory>
+#include <atomic>
 
 
 namespace Poco {
@@ -42,6 +45,15 @@ struct Prometheus_API HistogramData
 
 
 class Prometheus_API HistogramSample
+	/// The sample of a Histogram.
+	///
+	/// Observing a value does not take a lock. The bucket
+	/// counters and the sum are striped: each thread increments
+	/// the counter of the bucket the value falls into, and adds
+	/// the value to the sum, in one of several cache-line aligned
+	/// stripes. The stripes are only merged (and the cumulative
+	/// bucket counts computed) when data() is called, typically
+	/// when the Histogram is exported.
 {
 public:
 	explicit HistogramSample(const std::vector<double>& bucketBounds);
@@ -63,16 +75,41 @@ public:
 
 	HistogramData data() const;
 		/// Returns the histogram's data.
+		///
+		/// If values are observed concurrently, the returned
+		/// data is only a snapshot, and the sum may not
+		/// exactly match the counts.
 
 	const std::vector<double>& bucketBounds() const;
 		/// Returns the buckets upper bounds;
 
 private:
+	enum
+	{
+		CACHE_LINE_SIZE = 64,
+		COUNTERS_PER_LINE = CACHE_LINE_SIZE/sizeof(std::atomic<Poco::UInt64>),
+		MAX_STRIPES = 16
+	};
+
+	struct alignas(CACHE_LINE_SIZE) CounterLine
+	{
+		std::atomic<Poco::UInt64> counters[COUNTERS_PER_LINE];
+	};
+
+	struct alignas(CACHE_LINE_SIZE) SumLine
+	{
+		AtomicFloat<double> sum;
+	};
+
+	std::atomic<Poco::UInt64>& counter(std::size_t stripe, std::size_t bucket) const;
+	static std::size_t stripeCount();
+	static std::size_t threadStripe();
+
 	const std::vector<double>& _bucketBounds;
-	std::vector<Poco::UInt64> _bucketCounts;
-	Poco::UInt64 _count = 0;
-	double _sum = 0.0;
-	mutable Poco::FastMutex _mutex;
+	const std::size_t _stripes;
+	const std::size_t _linesPerStripe;
+	std::unique_ptr<CounterLine[]> _counters;
+	std::unique_ptr<SumLine[]> _sums;
 
 	HistogramSample() = delete;
 	HistogramSample(const HistogramSample&) = delete;
@@ -197,16 +234,9 @@ inline const std::vector<double>& HistogramSample::bucketBounds() const
 }
 
 
-inline HistogramData HistogramSample::data() const
+inline std::atomic<Poco::UInt64>& HistogramSample::counter(std::size_t stripe, std::size_t bucket) const
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
-
-	HistogramData data;
-	data.bucketCounts = _bucketCounts;
-	data.count = _count;
-	data.sum = _sum;
-
-	return data;
+	return _counters[stripe*_linesPerStripe + bucket/COUNTERS_PER_LINE].counters[bucket % COUNTERS_PER_LINE];
 }
 
 
@@ -23,10 +23,11 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/String.h"
 #include "Poco/Format.h"
-#include "Poco/Mutex.h"
+#include "Poco/RWLock.h"
 #include <functional>
 #include <memory>
 #include <map>
+#include <atomic>
 
 
 using namespace std::string_literals;
@@ -62,6 +63,14 @@ public:
 		/// If the sample does not exist yet, it is created.
 		///
 		/// The returned reference can be cached by the caller.
+		/// Looking up the sample takes a (shared) lock and
+		/// a map lookup, so code on a hot path should resolve
+		/// the label values once and keep the reference, e.g.:
+		///     static CounterSample& requests = requestCounter.labels({"GET"s});
+		///     requests.inc();
+		///
+		/// A cached reference becomes invalid if the sample
+		/// is removed with remove() or clear().
 	{
 		if (labelValues.size() != labelNames().size())
 		{
@@ -71,20 +80,21 @@ public:
 				throw Poco::InvalidArgumentException(Poco::format("Metric %s requires label values for %s"s, name(), Poco::cat(", "s, labelNames().begin(), labelNames().end())));
 		}
 
-		Poco::FastMutex::ScopedLock lock(_mutex);
-
-		const auto it = _samples.find(labelValues);
-		if (it != _samples.end())
-		{
-			return *it->second;
-		}
-		else
 		{
-			std::unique_ptr<Sample> pUniqueSample = createSample();
-			Sample* pSample = pUniqueSample.get();
-			_samples[labelValues] = std::move(pUniqueSample);
-			return *pSample;
+			Poco::RWLock::ScopedReadLock lock(_lock);
+
+			const auto it = _samples.find(labelValues);
+			if (it != _samples.end())
+			{
+				return *it->second;
+			}
 		}
+
+		Poco::RWLock::ScopedWriteLock lock(_lock);
+
+		auto& pSample = _samples[labelValues];
+		if (!pSample) pSample = createSample();
+		return *pSample;
 	}
 
 	const Sample& labels(const std::vector<std::string>& labelValues) const
@@ -97,7 +107,7 @@ public:
 		if (labelValues.size() != labelNames().size())
 			throw Poco::InvalidArgumentException(Poco::format("Metric %s requires label values for %s"s, name(), Poco::cat(", "s, labelNames().begin(), labelNames().end())));
 
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedReadLock lock(_lock);
 
 		const auto it = _samples.find(labelValues);
 		if (it != _samples.end())
@@ -119,7 +129,7 @@ public:
 		if (labelNames().empty())
 			throw Poco::InvalidAccessException("Metric has no labels"s);
 
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedWriteLock lock(_lock);
 
 		_samples.erase(labelValues);
 	}
@@ -127,15 +137,16 @@ public:
 	void clear()
 		/// Removes all samples.
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedWriteLock lock(_lock);
 
+		_pUnlabeledSample = nullptr;
 		_samples.clear();
 	}
 
 	std::size_t sampleCount() const
 		/// Returns the number of samples.
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedReadLock lock(_lock);
 
 		return _samples.size();
 	}
@@ -144,7 +155,7 @@ public:
 	void forEach(ProcessingFunction func) const
 		/// Calls the given function for each Sample.
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedReadLock lock(_lock);
 
 		for (const auto& p: _samples)
 		{
@@ -155,7 +166,7 @@ public:
 	// Collector
 	void exportTo(Exporter& exporter) const override
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		Poco::RWLock::ScopedReadLock lock(_lock);
 
 		exporter.writeHeader(*this);
 		for (const auto& p: _samples)
@@ -165,6 +176,30 @@ public:
 	}
 
 protected:
+	Sample& unlabeledSample()
+		/// Returns the Sample of a metric without labels.
+		///
+		/// In contrast to labels(), only the first call
+		/// takes a lock.
+	{
+		Sample* pSample = _pUnlabeledSample.load(std::memory_order_acquire);
+		if (!pSample)
+		{
+			if (!labelNames().empty())
+				throw Poco::InvalidArgumentException(Poco::format("Metric %s requires label values for %s"s, name(), Poco::cat(", "s, labelNames().begin(), labelNames().end())));
+
+			// the pointer is published while holding the lock,
+			// so that a concurrent clear() cannot leave it dangling
+			Poco::RWLock::ScopedWriteLock lock(_lock);
+
+			auto& pNewSample = _samples[EMPTY_LABEL];
+			if (!pNewSample) pNewSample = createSample();
+			pSample = pNewSample.get();
+			_pUnlabeledSample.store(pSample, std::memory_order_release);
+		}
+		return *pSample;
+	}
+
 	virtual std::unique_ptr<Sample> createSample() const = 0;
 		/// Creates a new Sample. Must be overridden by subclasses.
 
@@ -183,7 +218,8 @@ protected:
 
 private:
 	std::map<std::vector<std::string>, std::unique_ptr<Sample>> _samples;
-	mutable Poco::FastMutex _mutex;
+	std::atomic<Sample*> _pUnlabeledSample{nullptr};
+	mutable Poco::RWLock _lock;
 };
 
 
@@ -30,8 +30,17 @@ class Registry;
 
 
 class Prometheus_API MetricsRequestHandler: public Poco::Net::HTTPRequestHandler
-	/// This class handles incoming HTTP requests for metrics
-	/// in the Prometheus text format.
+	/// This class handles incoming HTTP requests for metrics.
+	///
+	/// The exposition format is selected based on the
+	/// request's Accept header: the Prometheus protobuf format
+	/// if it contains "application/vnd.google.protobuf",
+	/// the OpenMetrics text format if it contains
+	/// "application/openmetrics-text", and the Prometheus
+	/// text format otherwise.
+	///
+	/// The response is gzip-compressed if the client
+	/// accepts gzip encoding.
 {
 public:
 	MetricsRequestHandler();
@@ -0,0 +1,105 @@
+//
+// ProtobufExporter.h
+//
+// Library: Prometheus
+// Package: Core
+// Module:  ProtobufExporter
+//
+// Definition of the ProtobufExporter class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Prometheus_ProtobufExporter_INCLUDED
+#define Prometheus_ProtobufExporter_INCLUDED
+
+
+#include "Poco/Prometheus/Exporter.h"
+#include "Poco/Prometheus/Metric.h"
+#include <ostream>
+
+
+namespace Poco {
+namespace Prometheus {
+
+
+class Prometheus_API ProtobufExporter: public Exporter
+	/// Exporter implementation for the Prometheus protobuf format.
+	///
+	/// Writes a sequence of length-delimited io.prometheus.client.MetricFamily
+	/// messages (see https://github.com/prometheus/client_model/blob/master/io/prometheus/client/metrics.proto).
+	/// The messages are encoded directly, without depending
+	/// on a protobuf library.
+	///
+	/// The samples of a histogram, as written by Histogram
+	/// (<name>_bucket, <name>_sum and <name>_count), are combined
+	/// into a single Histogram message per label set.
+	///
+	/// As with TextExporter, output is collected in an internal
+	/// buffer that is written to the output stream whenever it
+	/// exceeds BUFFER_SIZE bytes, and by finish(), which must
+	/// be called after the last metric has been written.
+	/// Registry::exportTo() does this.
+{
+public:
+	enum
+	{
+		BUFFER_SIZE = 65536
+	};
+
+	explicit ProtobufExporter(std::ostream& ostr);
+		/// Creates the ProtobufExporter for the given output stream.
+
+	ProtobufExporter() = delete;
+	ProtobufExporter(const ProtobufExporter&) = delete;
+	ProtobufExporter& operator = (const ProtobufExporter&) = delete;
+
+	~ProtobufExporter();
+		/// Destroys the ProtobufExporter.
+
+	// Exporter
+	void writeHeader(const Metric& metric) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, float value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt32 value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int32 value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp = 0) override;
+	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp = 0) override;
+	void finish() override;
+
+	static const std::string CONTENT_TYPE;
+
+private:
+	void writeSampleImpl(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp);
+	void writeHistogramSample(const std::string& suffix, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp);
+	void writeLabels(std::string& message, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, std::size_t count);
+	void endHistogram();
+	void endFamily();
+
+	std::ostream& _stream;
+	std::string _buffer;
+	std::string _family;
+	std::string _familyName;
+	Metric::Type _familyType;
+	bool _inFamily;
+	bool _inHistogram;
+	std::vector<std::string> _histogramLabelNames;
+	std::vector<std::string> _histogramLabelValues;
+	std::string _buckets;
+	double _histogramSum;
+	Poco::UInt64 _histogramCount;
+	Poco::Timestamp _histogramTimestamp;
+	std::string _metric;
+	std::string _scratch;
+};
+
+
+} } // namespace Poco::Prometheus
+
+
+#endif // Prometheus_ProtobufExporter_INCLUDED
@@ -79,7 +79,8 @@ public:
 		/// Removes all Collector instances from the Registry.
 
 	void exportTo(Exporter& exporter) const;
-		/// Exports all registered collector's metrics through the given Exporter.
+		/// Exports all registered collector's metrics through the given Exporter,
+		/// then calls Exporter::finish().
 
 	static Registry& defaultRegistry();
 		/// Returns the default Registry.
@@ -28,20 +28,62 @@ namespace Prometheus {
 
 
 class Prometheus_API TextExporter: public Exporter
-	/// Exporter implementation for the Prometheus text format.
+	/// Exporter implementation for the Prometheus text format
+	/// and the OpenMetrics text format.
 	///
 	/// See https://github.com/prometheus/docs/blob/main/content/docs/instrumenting/exposition_formats.md
-	/// for the specification of the Prometheus text exposition format.
+	/// for the specification of the Prometheus text exposition format,
+	/// and https://github.com/OpenObservability/OpenMetrics/blob/main/specification/OpenMetrics.md
+	/// for the specification of the OpenMetrics text format.
+	///
+	/// Output is formatted directly into an internal buffer,
+	/// without going through std::ostream formatting, which is
+	/// written to the output stream whenever it exceeds
+	/// BUFFER_SIZE bytes, and by finish(). Registry::exportTo()
+	/// calls finish() after writing all metrics, so the memory
+	/// needed does not depend on the number of series exported.
+	///
+	/// Output is not written to the stream at the end of each
+	/// metric. An application that exports metrics directly,
+	/// using Metric::exportTo() or Collector::exportTo(), must
+	/// call finish() (or destroy the TextExporter) before reading
+	/// the output stream:
+	///
+	///     std::ostringstream ostr;
+	///     TextExporter exporter(ostr);
+	///     counter.exportTo(exporter);
+	///     exporter.finish();
+	///     std::string text = ostr.str();
 {
 public:
-	explicit TextExporter(std::ostream& ostr);
-		/// Creates the TextExporter for the given output stream.
+	enum Format
+	{
+		FORMAT_PROMETHEUS,  /// Prometheus text format, version 0.0.4.
+		FORMAT_OPENMETRICS  /// OpenMetrics text format, version 1.0.0.
+	};
+
+	enum
+	{
+		BUFFER_SIZE = 65536
+	};
+
+	explicit TextExporter(std::ostream& ostr, Format format = FORMAT_PROMETHEUS);
+		/// Creates the TextExporter for the given output stream
+		/// and format.
 
 	TextExporter() = delete;
 	TextExporter(const TextExporter&) = delete;
 	TextExporter& operator = (const TextExporter&) = delete;
 
-	~TextExporter() = default;
+	~TextExporter();
+		/// Destroys the TextExporter, writing any buffered output
+		/// to the output stream.
+
+	Format format() const;
+		/// Returns the output format.
+
+	const std::string& contentType() const;
+		/// Returns the HTTP Content-Type for the output format.
 
 	// Exporter
 	void writeHeader(const Metric& metric) override;
@@ -52,6 +94,13 @@ public:
 	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp = 0) override;
 	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp = 0) override;
 	void writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp = 0) override;
+	void finish() override;
+		/// Writes the buffered output to the output stream.
+		/// In OpenMetrics format, the first call also writes
+		/// the terminating "# EOF" line.
+
+	static const std::string PROMETHEUS_CONTENT_TYPE;
+	static const std::string OPENMETRICS_CONTENT_TYPE;
 
 protected:
 	static const std::string& typeToString(Metric::Type type);
@@ -61,12 +110,34 @@ protected:
 	static const std::string HISTOGRAM;
 	static const std::string SUMMARY;
 	static const std::string UNTYPED;
+	static const std::string UNKNOWN;
 
 private:
+	void writeName(const Metric& metric);
+	void writeLabels(const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues);
+	void writeEscaped(const std::string& str, bool quotes);
+	void writeTimestamp(const Poco::Timestamp& timestamp);
+	void endSample();
+	void writeInt(Poco::UInt64 value);
+	void writeInt(Poco::Int64 value);
+	void writeDouble(double value);
+
 	std::ostream& _stream;
+	Format _format;
+	std::string _buffer;
+	bool _eofWritten;
 };
 
 
+//
+// inlines
+//
+inline TextExporter::Format TextExporter::format() const
+{
+	return _format;
+}
+
+
 } } // namespace Poco::Prometheus
 
 
@@ -0,0 +1,149 @@
+//
+// ExporterBenchmark.cpp
+//
+// This sample measures the time needed to scrape a registry
+// with 100,000 series in the Prometheus text, OpenMetrics text
+// and protobuf formats, with and without gzip compression.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Prometheus/Counter.h"
+#include "Poco/Prometheus/Gauge.h"
+#include "Poco/Prometheus/Histogram.h"
+#include "Poco/Prometheus/Registry.h"
+#include "Poco/Prometheus/TextExporter.h"
+#include "Poco/Prometheus/ProtobufExporter.h"
+#include "Poco/CountingStream.h"
+#include "Poco/NullStream.h"
+#include "Poco/DeflatingStream.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <vector>
+
+
+using namespace std::string_literals;
+using namespace Poco::Prometheus;
+using Poco::Stopwatch;
+
+
+enum ExportFormat
+{
+	EXPORT_TEXT,
+	EXPORT_OPENMETRICS,
+	EXPORT_PROTOBUF
+};
+
+
+void scrape(const Registry& registry, ExportFormat format, std::ostream& ostr)
+{
+	if (format == EXPORT_PROTOBUF)
+	{
+		ProtobufExporter exporter(ostr);
+		registry.exportTo(exporter);
+	}
+	else
+	{
+		TextExporter exporter(ostr, format == EXPORT_OPENMETRICS ? TextExporter::FORMAT_OPENMETRICS : TextExporter::FORMAT_PROMETHEUS);
+		registry.exportTo(exporter);
+	}
+}
+
+
+void run(const Registry& registry, const std::string& name, ExportFormat format, bool gzip, int iterations)
+{
+	Poco::NullOutputStream nullStream;
+	Poco::CountingOutputStream countingStream(nullStream);
+	Stopwatch sw;
+	for (int i = 0; i < iterations; ++i)
+	{
+		sw.start();
+		if (gzip)
+		{
+			Poco::DeflatingOutputStream gzipStream(countingStream, Poco::DeflatingStreamBuf::STREAM_GZIP, 1);
+			scrape(registry, format, gzipStream);
+			gzipStream.close();
+		}
+		else
+		{
+			scrape(registry, format, countingStream);
+		}
+		sw.stop();
+	}
+	std::cout << std::setw(12) << name
+		<< std::setw(6) << (gzip ? "yes" : "no")
+		<< std::setw(14) << countingStream.chars()/iterations
+		<< std::setw(12) << std::fixed << std::setprecision(1) << sw.elapsed()/1000.0/iterations
+		<< std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+	int iterations = 10;
+	if (argc > 1) iterations = Poco::NumberParser::parse(argv[1]);
+
+	// 10 counters and 10 gauges with 4,000 label sets each,
+	// and 2 histograms with 200 label sets and 7 buckets each
+	// (10 series per label set), make 100,000 series.
+
+	Registry registry;
+	std::vector<std::unique_ptr<Counter>> counters;
+	std::vector<std::unique_ptr<Gauge>> gauges;
+	std::vector<std::unique_ptr<Histogram>> histograms;
+
+	for (int m = 0; m < 10; m++)
+	{
+		counters.emplace_back(new Counter("bench_requests_"s + Poco::NumberFormatter::format(m),
+			{"Requests handled"s, {"instance"s, "path"s}}, &registry));
+		gauges.emplace_back(new Gauge("bench_temperature_"s + Poco::NumberFormatter::format(m),
+			{"Current temperature"s, {"instance"s, "sensor"s}}, &registry));
+		for (int i = 0; i < 4000; i++)
+		{
+			const std::string instance = "instance-"s + Poco::NumberFormatter::format(i % 40);
+			const std::string label = "/api/v1/resource/"s + Poco::NumberFormatter::format(i);
+			counters.back()->labels({instance, label}).inc(i);
+			gauges.back()->labels({instance, label}).set(i*0.25 - 100.0);
+		}
+	}
+
+	for (int m = 0; m < 2; m++)
+	{
+		histograms.emplace_back(new Histogram("bench_latency_seconds_"s + Poco::NumberFormatter::format(m),
+			{"Request latency"s, {"handler"s}, {0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1.0}}, &registry));
+		for (int i = 0; i < 200; i++)
+		{
+			HistogramSample& sample = histograms.back()->labels({"handler-"s + Poco::NumberFormatter::format(i)});
+			for (int k = 0; k < 100; k++)
+			{
+				sample.observe(k*0.0123);
+			}
+		}
+	}
+
+	std::cout << "Prometheus Exporter Benchmark" << std::endl;
+	std::cout << "=============================" << std::endl;
+	std::cout << "100000 series, " << iterations << " scrapes per format." << std::endl << std::endl;
+	std::cout << std::setw(12) << "Format"
+		<< std::setw(6) << "gzip"
+		<< std::setw(14) << "Bytes"
+		<< std::setw(12) << "ms/scrape"
+		<< std::endl;
+
+	for (bool gzip: {false, true})
+	{
+		run(registry, "text"s, EXPORT_TEXT, gzip, iterations);
+		run(registry, "openmetrics"s, EXPORT_OPENMETRICS, gzip, iterations);
+		run(registry, "protobuf"s, EXPORT_PROTOBUF, gzip, iterations);
+	}
+
+	return 0;
+}
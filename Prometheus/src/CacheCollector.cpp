@@ -0,0 +1,163 @@
+//
+// CacheCollector.cpp
+//
+// Library: Prometheus
+// Package: Collectors
+// Module:  CacheCollector
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Prometheus/CacheCollector.h"
+#include "Poco/Prometheus/Exporter.h"
+#include "Poco/Exception.h"
+
+
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Prometheus {
+
+
+const std::string CacheCollector::NAME_PREFIX{"poco_cache"s};
+
+
+CacheCollector::CacheCollector():
+	Collector(NAME_PREFIX)
+{
+	buildMetrics();
+}
+
+
+CacheCollector::CacheCollector(Registry* pRegistry):
+	Collector(NAME_PREFIX, pRegistry)
+{
+	buildMetrics();
+}
+
+
+CacheCollector::CacheCollector(const std::string& name, const Poco::AbstractConcurrentCache& cache):
+	Collector(NAME_PREFIX)
+{
+	buildMetrics();
+	addCache(name, cache);
+}
+
+
+CacheCollector::CacheCollector(const std::string& name, const Poco::AbstractConcurrentCache& cache, Registry* pRegistry):
+	Collector(NAME_PREFIX, pRegistry)
+{
+	buildMetrics();
+	addCache(name, cache);
+}
+
+
+void CacheCollector::addCache(const std::string& name, const Poco::AbstractConcurrentCache& cache)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (!_caches.emplace(name, &cache).second)
+		throw Poco::ExistsException("cache"s, name);
+}
+
+
+void CacheCollector::removeCache(const std::string& name)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_caches.erase(name);
+}
+
+
+void CacheCollector::exportTo(Exporter& exporter) const
+{
+	std::vector<std::pair<std::string, Statistics>> snapshot;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		snapshot.reserve(_caches.size());
+		for (const auto& p: _caches)
+		{
+			snapshot.emplace_back(p.first, p.second->statistics());
+		}
+	}
+	if (snapshot.empty()) return;
+
+	const std::vector<std::string> labelNames{"name"s};
+	std::vector<std::string> labelValues(1);
+	for (const auto& pMetric: _metrics)
+	{
+		exporter.writeHeader(*pMetric);
+		for (const auto& s: snapshot)
+		{
+			labelValues[0] = s.first;
+			exporter.writeSample(*pMetric, labelNames, labelValues, pMetric->value(s.second), 0);
+		}
+	}
+}
+
+
+void CacheCollector::buildMetrics()
+{
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::COUNTER,
+		NAME_PREFIX + "_hits_total"s,
+		"Number of cache lookups that found a valid entry"s,
+		[](const Statistics& stats)
+		{
+			return stats.hits;
+		}));
+
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::COUNTER,
+		NAME_PREFIX + "_misses_total"s,
+		"Number of cache lookups that found no valid entry"s,
+		[](const Statistics& stats)
+		{
+			return stats.misses;
+		}));
+
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::COUNTER,
+		NAME_PREFIX + "_evictions_total"s,
+		"Number of entries evicted to make room for new entries"s,
+		[](const Statistics& stats)
+		{
+			return stats.evictions;
+		}));
+
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::COUNTER,
+		NAME_PREFIX + "_expirations_total"s,
+		"Number of entries removed because they expired"s,
+		[](const Statistics& stats)
+		{
+			return stats.expirations;
+		}));
+
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::GAUGE,
+		NAME_PREFIX + "_entries"s,
+		"Number of entries currently in the cache"s,
+		[](const Statistics& stats)
+		{
+			return static_cast<Poco::UInt64>(stats.entries);
+		}));
+
+	_metrics.push_back(std::make_unique<StatisticsMetric>(
+		Metric::Type::GAUGE,
+		NAME_PREFIX + "_bytes"s,
+		"Total size of all entries currently in the cache"s,
+		[](const Statistics& stats)
+		{
+			return static_cast<Poco::UInt64>(stats.bytes);
+		}));
+}
+
+
+} } // namespace Poco::Prometheus
@@ -16,6 +16,9 @@
 #include "Poco/Prometheus/Gauge.h"
 #include "Poco/Prometheus/Exporter.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/Environment.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace std::string_literals;
 
@@ -26,31 +29,88 @@ namespace Prometheus {
 
 HistogramSample::HistogramSample(const std::vector<double>& bucketBounds):
 	_bucketBounds(bucketBounds),
-	_bucketCounts(bucketBounds.size(), 0)
+	_stripes(stripeCount()),
+	_linesPerStripe((bucketBounds.size() + COUNTERS_PER_LINE)/COUNTERS_PER_LINE),
+	_counters(new CounterLine[_stripes*_linesPerStripe]),
+	_sums(new SumLine[_stripes])
 {
+	for (std::size_t i = 0; i < _stripes*_linesPerStripe; i++)
+	{
+		for (auto& c: _counters[i].counters)
+		{
+			c.store(0, std::memory_order_relaxed);
+		}
+	}
 }
 
 
 void HistogramSample::observe(double value)
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
+	// The last counter of each stripe is the implicit +Inf bucket.
+	// Buckets are not cumulative here; this is taken care of by data().
+	const std::size_t n = _bucketBounds.size();
+	std::size_t bucket = n;
+	if (!std::isnan(value))
+	{
+		bucket = std::lower_bound(_bucketBounds.begin(), _bucketBounds.end(), value) - _bucketBounds.begin();
+	}
+	const std::size_t stripe = threadStripe() % _stripes;
+	counter(stripe, bucket).fetch_add(1, std::memory_order_relaxed);
+	_sums[stripe].sum += value;
+}
+
+
+void HistogramSample::observe(Poco::Clock::ClockVal v)
+{
+	observe(double(v)/Poco::Clock::resolution());
+}
+
 
+HistogramData HistogramSample::data() const
+{
 	const std::size_t n = _bucketBounds.size();
-	for (std::size_t i = 0; i < n; i++)
+	HistogramData data;
+	data.bucketCounts.resize(n, 0);
+	data.count = 0;
+	data.sum = 0.0;
+	for (std::size_t s = 0; s < _stripes; s++)
 	{
-		if (value <= _bucketBounds[i])
+		for (std::size_t i = 0; i < n; i++)
 		{
-			_bucketCounts[i]++;
+			data.bucketCounts[i] += counter(s, i).load(std::memory_order_relaxed);
 		}
+		data.count += counter(s, n).load(std::memory_order_relaxed);
+		data.sum += _sums[s].sum.value();
+	}
+	Poco::UInt64 cumulative = 0;
+	for (std::size_t i = 0; i < n; i++)
+	{
+		cumulative += data.bucketCounts[i];
+		data.bucketCounts[i] = cumulative;
 	}
-	_sum += value;
-	_count++;
+	data.count += cumulative;
+	return data;
 }
 
 
-void HistogramSample::observe(Poco::Clock::ClockVal v)
+std::size_t HistogramSample::stripeCount()
 {
-	observe(double(v)/Poco::Clock::resolution());
+	static const std::size_t count = []()
+		{
+			std::size_t n = 1;
+			const std::size_t cpus = Poco::Environment::processorCount();
+			while (n < cpus && n < MAX_STRIPES) n <<= 1;
+			return n;
+		}();
+	return count;
+}
+
+
+std::size_t HistogramSample::threadStripe()
+{
+	static std::atomic<std::size_t> nextStripe(0);
+	thread_local std::size_t stripe = nextStripe.fetch_add(1, std::memory_order_relaxed);
+	return stripe;
 }
 
 
@@ -93,13 +153,13 @@ Histogram& Histogram::buckets(const std::vector<double>& bucketBounds)
 
 void Histogram::observe(double value)
 {
-	labels(EMPTY_LABEL).observe(value);
+	unlabeledSample().observe(value);
 }
 
 
 void Histogram::observe(Poco::Clock::ClockVal v)
 {
-	labels(EMPTY_LABEL).observe(double(v)/Poco::Clock::resolution());
+	unlabeledSample().observe(double(v)/Poco::Clock::resolution());
 }
 
 
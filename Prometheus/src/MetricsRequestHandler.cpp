@@ -15,6 +15,7 @@
 #include "Poco/Prometheus/MetricsRequestHandler.h"
 #include "Poco/Prometheus/Registry.h"
 #include "Poco/Prometheus/TextExporter.h"
+#include "Poco/Prometheus/ProtobufExporter.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/DeflatingStream.h"
@@ -43,8 +44,17 @@ void MetricsRequestHandler::handleRequest(Poco::Net::HTTPServerRequest& request,
 {
 	if (request.getMethod() == Poco::Net::HTTPRequest::HTTP_GET || request.getMethod() == Poco::Net::HTTPRequest::HTTP_HEAD)
 	{
+		const std::string accept = request.get("Accept"s, ""s);
+		const bool protobuf = accept.find("application/vnd.google.protobuf"s) != std::string::npos;
+		const bool openMetrics = !protobuf && accept.find("application/openmetrics-text"s) != std::string::npos;
+
 		response.setChunkedTransferEncoding(true);
-		response.setContentType("text/plain; version=0.0.4"s);
+		if (protobuf)
+			response.setContentType(ProtobufExporter::CONTENT_TYPE);
+		else if (openMetrics)
+			response.setContentType(TextExporter::OPENMETRICS_CONTENT_TYPE);
+		else
+			response.setContentType(TextExporter::PROMETHEUS_CONTENT_TYPE);
 		bool compressResponse(request.hasToken("Accept-Encoding"s, "gzip"s));
 		if (compressResponse) response.set("Content-Encoding"s, "gzip"s);
 		response.set("Cache-Control"s, "no-cache, no-store"s);
@@ -53,8 +63,16 @@ void MetricsRequestHandler::handleRequest(Poco::Net::HTTPServerRequest& request,
 		{
 			Poco::DeflatingOutputStream gzipStream(plainResponseStream, Poco::DeflatingStreamBuf::STREAM_GZIP, 1);
 			std::ostream& responseStream = compressResponse ? gzipStream : plainResponseStream;
-			TextExporter exporter(responseStream);
-			_registry.exportTo(exporter);
+			if (protobuf)
+			{
+				ProtobufExporter exporter(responseStream);
+				_registry.exportTo(exporter);
+			}
+			else
+			{
+				TextExporter exporter(responseStream, openMetrics ? TextExporter::FORMAT_OPENMETRICS : TextExporter::FORMAT_PROMETHEUS);
+				_registry.exportTo(exporter);
+			}
 		}
 	}
 	else
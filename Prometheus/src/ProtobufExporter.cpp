@@ -0,0 +1,370 @@
+//
+// ProtobufExporter.cpp
+//
+// Library: Prometheus
+// Package: Core
+// Module:  ProtobufExporter
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Prometheus/ProtobufExporter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/ByteOrder.h"
+#include <cstring>
+#include <limits>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Prometheus {
+
+
+const std::string ProtobufExporter::CONTENT_TYPE{"application/vnd.google.protobuf; proto=io.prometheus.client.MetricFamily; encoding=delimited"s};
+
+
+namespace
+{
+	// Field numbers from io/prometheus/client/metrics.proto
+
+	enum FamilyField
+	{
+		FAMILY_NAME = 1,
+		FAMILY_HELP = 2,
+		FAMILY_TYPE = 3,
+		FAMILY_METRIC = 4
+	};
+
+	enum FamilyType
+	{
+		TYPE_COUNTER = 0,
+		TYPE_GAUGE = 1,
+		TYPE_UNTYPED = 3,
+		TYPE_HISTOGRAM = 4
+	};
+
+	enum MetricField
+	{
+		METRIC_LABEL = 1,
+		METRIC_GAUGE = 2,
+		METRIC_COUNTER = 3,
+		METRIC_UNTYPED = 5,
+		METRIC_TIMESTAMP_MS = 6,
+		METRIC_HISTOGRAM = 7
+	};
+
+	enum HistogramField
+	{
+		HISTOGRAM_SAMPLE_COUNT = 1,
+		HISTOGRAM_SAMPLE_SUM = 2,
+		HISTOGRAM_BUCKET = 3
+	};
+
+	enum WireType
+	{
+		WIRE_VARINT = 0,
+		WIRE_FIXED64 = 1,
+		WIRE_LENGTH_DELIMITED = 2
+	};
+
+	void writeVarint(std::string& out, Poco::UInt64 value)
+	{
+		while (value >= 0x80)
+		{
+			out += static_cast<char>((value & 0x7F) | 0x80);
+			value >>= 7;
+		}
+		out += static_cast<char>(value);
+	}
+
+	void writeKey(std::string& out, int field, WireType wireType)
+	{
+		writeVarint(out, (static_cast<Poco::UInt64>(field) << 3) | wireType);
+	}
+
+	void writeVarintField(std::string& out, int field, Poco::UInt64 value)
+	{
+		writeKey(out, field, WIRE_VARINT);
+		writeVarint(out, value);
+	}
+
+	void writeDoubleField(std::string& out, int field, double value)
+	{
+		Poco::UInt64 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		bits = Poco::ByteOrder::toLittleEndian(bits);
+		writeKey(out, field, WIRE_FIXED64);
+		out.append(reinterpret_cast<const char*>(&bits), sizeof(bits));
+	}
+
+	void writeBytesField(std::string& out, int field, const std::string& value)
+	{
+		writeKey(out, field, WIRE_LENGTH_DELIMITED);
+		writeVarint(out, value.size());
+		out += value;
+	}
+
+	int familyType(Metric::Type type)
+	{
+		switch (type)
+		{
+		case Metric::Type::COUNTER:
+			return TYPE_COUNTER;
+		case Metric::Type::GAUGE:
+			return TYPE_GAUGE;
+		case Metric::Type::HISTOGRAM:
+			return TYPE_HISTOGRAM;
+		default:
+			return TYPE_UNTYPED;
+		}
+	}
+
+	int valueField(Metric::Type type)
+	{
+		switch (type)
+		{
+		case Metric::Type::COUNTER:
+			return METRIC_COUNTER;
+		case Metric::Type::GAUGE:
+			return METRIC_GAUGE;
+		default:
+			return METRIC_UNTYPED;
+		}
+	}
+}
+
+
+ProtobufExporter::ProtobufExporter(std::ostream& ostr):
+	_stream(ostr),
+	_familyType(Metric::Type::UNTYPED),
+	_inFamily(false),
+	_inHistogram(false),
+	_histogramSum(0.0),
+	_histogramCount(0),
+	_histogramTimestamp(0)
+{
+	_buffer.reserve(BUFFER_SIZE + 1024);
+}
+
+
+ProtobufExporter::~ProtobufExporter()
+{
+	try
+	{
+		if (!_buffer.empty()) _stream.write(_buffer.data(), _buffer.size());
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ProtobufExporter::writeHeader(const Metric& metric)
+{
+	endFamily();
+
+	_inFamily = true;
+	_familyName = metric.name();
+	_familyType = metric.type();
+	_family.clear();
+	writeBytesField(_family, FAMILY_NAME, metric.name());
+	if (!metric.help().empty())
+	{
+		writeBytesField(_family, FAMILY_HELP, metric.help());
+	}
+	writeVarintField(_family, FAMILY_TYPE, familyType(metric.type()));
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, float value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, value, timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, value, timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt32 value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, static_cast<double>(value), timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int32 value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, static_cast<double>(value), timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, static_cast<double>(value), timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp)
+{
+	writeSampleImpl(metric, labelNames, labelValues, static_cast<double>(value), timestamp);
+}
+
+
+void ProtobufExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp)
+{
+	double v;
+	if (value == "+Inf")
+		v = std::numeric_limits<double>::infinity();
+	else if (value == "-Inf")
+		v = -std::numeric_limits<double>::infinity();
+	else if (!Poco::NumberParser::tryParseFloat(value, v))
+		v = std::numeric_limits<double>::quiet_NaN();
+	writeSampleImpl(metric, labelNames, labelValues, v, timestamp);
+}
+
+
+void ProtobufExporter::finish()
+{
+	endFamily();
+	_stream.write(_buffer.data(), _buffer.size());
+	_buffer.clear();
+}
+
+
+void ProtobufExporter::writeSampleImpl(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp)
+{
+	poco_assert_dbg (labelNames.size() == labelValues.size());
+
+	if (_inFamily && _familyType == Metric::Type::HISTOGRAM && metric.name().size() > _familyName.size() && metric.name().compare(0, _familyName.size(), _familyName) == 0)
+	{
+		writeHistogramSample(metric.name().substr(_familyName.size()), labelNames, labelValues, value, timestamp);
+		return;
+	}
+
+	if (!_inFamily || metric.name() != _familyName)
+	{
+		writeHeader(metric);
+	}
+
+	_metric.clear();
+	writeLabels(_metric, labelNames, labelValues, labelNames.size());
+	_scratch.clear();
+	writeDoubleField(_scratch, 1, value);
+	writeBytesField(_metric, valueField(_familyType), _scratch);
+	if (timestamp != 0)
+	{
+		writeVarintField(_metric, METRIC_TIMESTAMP_MS, static_cast<Poco::UInt64>(timestamp.epochMicroseconds()/1000));
+	}
+	writeBytesField(_family, FAMILY_METRIC, _metric);
+}
+
+
+void ProtobufExporter::writeHistogramSample(const std::string& suffix, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp)
+{
+	const bool isBucket = suffix == "_bucket";
+	const std::size_t labelCount = isBucket && !labelNames.empty() ? labelNames.size() - 1 : labelNames.size();
+
+	bool sameLabels = _inHistogram && _histogramLabelValues.size() == labelCount;
+	for (std::size_t i = 0; sameLabels && i < labelCount; i++)
+	{
+		sameLabels = _histogramLabelValues[i] == labelValues[i];
+	}
+	if (!sameLabels)
+	{
+		endHistogram();
+		_inHistogram = true;
+		_histogramLabelNames.assign(labelNames.begin(), labelNames.begin() + labelCount);
+		_histogramLabelValues.assign(labelValues.begin(), labelValues.begin() + labelCount);
+		_histogramTimestamp = timestamp;
+	}
+
+	if (isBucket)
+	{
+		// The +Inf bucket is implicit in the protobuf format (sample_count).
+		double upperBound;
+		if (!labelValues.empty() && Poco::NumberParser::tryParseFloat(labelValues.back(), upperBound))
+		{
+			_scratch.clear();
+			writeVarintField(_scratch, 1, static_cast<Poco::UInt64>(value));
+			writeDoubleField(_scratch, 2, upperBound);
+			writeBytesField(_buckets, HISTOGRAM_BUCKET, _scratch);
+		}
+	}
+	else if (suffix == "_sum")
+	{
+		_histogramSum = value;
+	}
+	else if (suffix == "_count")
+	{
+		_histogramCount = static_cast<Poco::UInt64>(value);
+		endHistogram();
+	}
+}
+
+
+void ProtobufExporter::writeLabels(std::string& message, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; i++)
+	{
+		_scratch.clear();
+		writeBytesField(_scratch, 1, labelNames[i]);
+		writeBytesField(_scratch, 2, labelValues[i]);
+		writeBytesField(message, METRIC_LABEL, _scratch);
+	}
+}
+
+
+void ProtobufExporter::endHistogram()
+{
+	if (!_inHistogram) return;
+
+	std::string histogram;
+	writeVarintField(histogram, HISTOGRAM_SAMPLE_COUNT, _histogramCount);
+	writeDoubleField(histogram, HISTOGRAM_SAMPLE_SUM, _histogramSum);
+	histogram += _buckets;
+
+	_metric.clear();
+	writeLabels(_metric, _histogramLabelNames, _histogramLabelValues, _histogramLabelNames.size());
+	writeBytesField(_metric, METRIC_HISTOGRAM, histogram);
+	if (_histogramTimestamp != 0)
+	{
+		writeVarintField(_metric, METRIC_TIMESTAMP_MS, static_cast<Poco::UInt64>(_histogramTimestamp.epochMicroseconds()/1000));
+	}
+	writeBytesField(_family, FAMILY_METRIC, _metric);
+
+	_inHistogram = false;
+	_buckets.clear();
+	_histogramSum = 0.0;
+	_histogramCount = 0;
+	_histogramTimestamp = 0;
+}
+
+
+void ProtobufExporter::endFamily()
+{
+	if (!_inFamily) return;
+
+	endHistogram();
+	writeVarint(_buffer, _family.size());
+	_buffer += _family;
+	_family.clear();
+	_inFamily = false;
+
+	if (_buffer.size() >= BUFFER_SIZE)
+	{
+		_stream.write(_buffer.data(), _buffer.size());
+		_buffer.clear();
+	}
+}
+
+
+} } // namespace Poco::Prometheus
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Prometheus/Registry.h"
+#include "Poco/Prometheus/Exporter.h"
 #include "Poco/Prometheus/Collector.h"
 #include "Poco/Exception.h"
 
@@ -86,6 +87,7 @@ void Registry::exportTo(Exporter& exporter) const
 	{
 		p.second->exportTo(exporter);
 	}
+	exporter.finish();
 }
 
 
@@ -13,7 +13,7 @@
 
 
 #include "Poco/Prometheus/TextExporter.h"
-#include "Poco/NumberFormatter.h"
+#include "Poco/NumericString.h"
 #include <vector>
 #include <ostream>
 #include <cmath>
@@ -31,75 +31,75 @@ const std::string TextExporter::GAUGE{"gauge"s};
 const std::string TextExporter::HISTOGRAM{"histogram"s};
 const std::string TextExporter::SUMMARY{"summary"s};
 const std::string TextExporter::UNTYPED{"untyped"s};
+const std::string TextExporter::UNKNOWN{"unknown"s};
+const std::string TextExporter::PROMETHEUS_CONTENT_TYPE{"text/plain; version=0.0.4"s};
+const std::string TextExporter::OPENMETRICS_CONTENT_TYPE{"application/openmetrics-text; version=1.0.0; charset=utf-8"s};
 
 
 namespace
 {
-	std::string escape(const std::string& str)
+	const std::string TOTAL_SUFFIX{"_total"s};
+
+	bool endsWithTotal(const std::string& name)
 	{
-		std::string result;
-		for (char c: str)
-		{
-			switch (c)
-			{
-			case '\\':
-				result += "\\\\";
-				break;
-			case '\n':
-				result += "\\n";
-				break;
-			case '"':
-				result += "\\\"";
-				break;
-			default:
-				result += c;
-			}
-		}
-		return result;
+		return name.size() > TOTAL_SUFFIX.size() && name.compare(name.size() - TOTAL_SUFFIX.size(), TOTAL_SUFFIX.size(), TOTAL_SUFFIX) == 0;
 	}
+}
 
-	template <typename T>
-	void writeSampleImpl(std::ostream& stream, const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, T&& value, const Poco::Timestamp& timestamp)
-	{
-		poco_assert_dbg (labelNames.size() == labelValues.size());
 
-		stream << metric.name();
-		if (!labelNames.empty())
-		{
-			stream << '{';
-			for (std::size_t i = 0; i < labelNames.size(); i++)
-			{
-				if (i > 0) stream << ',';
-				stream << labelNames[i] << "=\"" << escape(labelValues[i]) << '"';
-			}
-			stream << '}';
-		}
-		stream << ' ' << value;
-		if (timestamp != 0)
-		{
-			stream << ' ' << timestamp.epochMicroseconds()/1000;
-		}
-		stream << '\n';
+TextExporter::TextExporter(std::ostream& ostr, Format format):
+	_stream(ostr),
+	_format(format),
+	_eofWritten(false)
+{
+	_buffer.reserve(BUFFER_SIZE + 1024);
+}
+
+
+TextExporter::~TextExporter()
+{
+	try
+	{
+		if (!_buffer.empty()) _stream.write(_buffer.data(), _buffer.size());
+	}
+	catch (...)
+	{
+		poco_unexpected();
 	}
 }
 
 
-TextExporter::TextExporter(std::ostream& ostr):
-	_stream(ostr)
+const std::string& TextExporter::contentType() const
 {
+	return _format == FORMAT_OPENMETRICS ? OPENMETRICS_CONTENT_TYPE : PROMETHEUS_CONTENT_TYPE;
 }
 
 
 void TextExporter::writeHeader(const Metric& metric)
 {
 	const std::string& help = metric.help();
-	const std::string& type = typeToString(metric.type());
+	const std::string& type = _format == FORMAT_OPENMETRICS && metric.type() == Metric::Type::UNTYPED ? UNKNOWN : typeToString(metric.type());
+
+	// In OpenMetrics, the name of a counter family does not include the _total suffix.
+	std::size_t nameLength = metric.name().size();
+	if (_format == FORMAT_OPENMETRICS && metric.type() == Metric::Type::COUNTER && endsWithTotal(metric.name()))
+	{
+		nameLength -= TOTAL_SUFFIX.size();
+	}
 
 	if (!help.empty())
 	{
-		_stream << "# HELP " << metric.name() << ' ' << help << '\n';
+		_buffer.append("# HELP ", 7);
+		_buffer.append(metric.name(), 0, nameLength);
+		_buffer += ' ';
+		writeEscaped(help, _format == FORMAT_OPENMETRICS);
+		_buffer += '\n';
 	}
-	_stream << "# TYPE " << metric.name() << ' ' << type << '\n';
+	_buffer.append("# TYPE ", 7);
+	_buffer.append(metric.name(), 0, nameLength);
+	_buffer += ' ';
+	_buffer += type;
+	_buffer += '\n';
 }
 
 
@@ -111,53 +111,207 @@ void TextExporter::writeSample(const Metric& metric, const std::vector<std::stri
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp)
 {
-	std::string valueString;
-	if (std::isinf(value))
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	writeDouble(value);
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt32 value, const Poco::Timestamp& timestamp)
+{
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	writeInt(static_cast<Poco::UInt64>(value));
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int32 value, const Poco::Timestamp& timestamp)
+{
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	writeInt(static_cast<Poco::Int64>(value));
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp)
+{
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	writeInt(value);
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp)
+{
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	writeInt(value);
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp)
+{
+	writeName(metric);
+	writeLabels(labelNames, labelValues);
+	_buffer += value;
+	writeTimestamp(timestamp);
+	endSample();
+}
+
+
+void TextExporter::finish()
+{
+	if (_format == FORMAT_OPENMETRICS && !_eofWritten)
 	{
-		if (value > 0)
-			valueString = "+Inf";
-		else
-			valueString = "-Inf";
+		_buffer.append("# EOF\n", 6);
+		_eofWritten = true;
 	}
-	else if (std::isnan(value))
+	_stream.write(_buffer.data(), _buffer.size());
+	_buffer.clear();
+}
+
+
+void TextExporter::writeName(const Metric& metric)
+{
+	_buffer += metric.name();
+	if (_format == FORMAT_OPENMETRICS && metric.type() == Metric::Type::COUNTER && !endsWithTotal(metric.name()))
 	{
-		valueString = "NaN";
+		_buffer += TOTAL_SUFFIX;
 	}
-	else
+}
+
+
+void TextExporter::writeLabels(const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues)
+{
+	poco_assert_dbg (labelNames.size() == labelValues.size());
+
+	if (!labelNames.empty())
 	{
-		valueString = Poco::NumberFormatter::format(value);
+		_buffer += '{';
+		for (std::size_t i = 0; i < labelNames.size(); i++)
+		{
+			if (i > 0) _buffer += ',';
+			_buffer += labelNames[i];
+			_buffer.append("=\"", 2);
+			writeEscaped(labelValues[i], true);
+			_buffer += '"';
+		}
+		_buffer += '}';
 	}
-	writeSampleImpl(_stream, metric, labelNames, labelValues, valueString, timestamp);
+	_buffer += ' ';
 }
 
 
-void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt32 value, const Poco::Timestamp& timestamp)
+void TextExporter::writeEscaped(const std::string& str, bool quotes)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	std::string::size_type start = 0;
+	for (std::string::size_type i = 0; i < str.size(); i++)
+	{
+		const char c = str[i];
+		if (c == '\\' || c == '\n' || (quotes && c == '"'))
+		{
+			_buffer.append(str, start, i - start);
+			_buffer += '\\';
+			_buffer += c == '\n' ? 'n' : c;
+			start = i + 1;
+		}
+	}
+	_buffer.append(str, start, std::string::npos);
 }
 
 
-void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int32 value, const Poco::Timestamp& timestamp)
+void TextExporter::writeTimestamp(const Poco::Timestamp& timestamp)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	if (timestamp != 0)
+	{
+		const Poco::Timestamp::TimeVal millis = timestamp.epochMicroseconds()/1000;
+		_buffer += ' ';
+		if (_format == FORMAT_OPENMETRICS)
+		{
+			// OpenMetrics timestamps are in seconds
+			writeInt(static_cast<Poco::Int64>(millis/1000));
+			_buffer += '.';
+			const int frac = static_cast<int>(millis % 1000);
+			_buffer += static_cast<char>('0' + frac/100);
+			_buffer += static_cast<char>('0' + (frac/10) % 10);
+			_buffer += static_cast<char>('0' + frac % 10);
+		}
+		else
+		{
+			writeInt(static_cast<Poco::Int64>(millis));
+		}
+	}
 }
 
 
-void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp)
+void TextExporter::endSample()
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	_buffer += '\n';
+	if (_buffer.size() >= BUFFER_SIZE)
+	{
+		_stream.write(_buffer.data(), _buffer.size());
+		_buffer.clear();
+	}
 }
 
 
-void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp)
+void TextExporter::writeInt(Poco::UInt64 value)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	char digits[24];
+	char* p = digits + sizeof(digits);
+	do
+	{
+		*--p = static_cast<char>('0' + value % 10);
+		value /= 10;
+	}
+	while (value != 0);
+	_buffer.append(p, digits + sizeof(digits) - p);
 }
 
 
-void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, const std::string& value, const Poco::Timestamp& timestamp)
+void TextExporter::writeInt(Poco::Int64 value)
+{
+	if (value < 0)
+	{
+		_buffer += '-';
+		writeInt(static_cast<Poco::UInt64>(0) - static_cast<Poco::UInt64>(value));
+	}
+	else
+	{
+		writeInt(static_cast<Poco::UInt64>(value));
+	}
+}
+
+
+void TextExporter::writeDouble(double value)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	if (std::isinf(value))
+	{
+		if (value > 0)
+			_buffer.append("+Inf", 4);
+		else
+			_buffer.append("-Inf", 4);
+	}
+	else if (std::isnan(value))
+	{
+		_buffer.append("NaN", 3);
+	}
+	else
+	{
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		Poco::doubleToStr(buffer, POCO_MAX_FLT_STRING_LEN, value);
+		_buffer += buffer;
+	}
 }
 
 
@@ -0,0 +1,156 @@
+//
+// CacheCollectorTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "CacheCollectorTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Prometheus/CacheCollector.h"
+#include "Poco/Prometheus/Registry.h"
+#include "Poco/Prometheus/TextExporter.h"
+#include "Poco/ConcurrentLRUCache.h"
+#include <sstream>
+
+
+using namespace Poco::Prometheus;
+using namespace std::string_literals;
+
+
+CacheCollectorTest::CacheCollectorTest(const std::string& name):
+	CppUnit::TestCase("CacheCollectorTest"s)
+{
+}
+
+
+void CacheCollectorTest::testExport()
+{
+	Poco::ConcurrentLRUCache<int, int> cache(2, 0, 1);
+	cache.add(1, 2);
+	cache.add(3, 4);
+	cache.get(1);
+	cache.get(5);
+	cache.add(5, 6);
+
+	CacheCollector collector("test-cache"s, cache);
+	assertEqual("poco_cache"s, collector.name());
+
+	std::ostringstream stream;
+	TextExporter exporter(stream);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string text = stream.str();
+	assertEqual(
+		"# HELP poco_cache_hits_total Number of cache lookups that found a valid entry\n"
+		"# TYPE poco_cache_hits_total counter\n"
+		"poco_cache_hits_total{name=\"test-cache\"} 1\n"
+		"# HELP poco_cache_misses_total Number of cache lookups that found no valid entry\n"
+		"# TYPE poco_cache_misses_total counter\n"
+		"poco_cache_misses_total{name=\"test-cache\"} 1\n"
+		"# HELP poco_cache_evictions_total Number of entries evicted to make room for new entries\n"
+		"# TYPE poco_cache_evictions_total counter\n"
+		"poco_cache_evictions_total{name=\"test-cache\"} 1\n"
+		"# HELP poco_cache_expirations_total Number of entries removed because they expired\n"
+		"# TYPE poco_cache_expirations_total counter\n"
+		"poco_cache_expirations_total{name=\"test-cache\"} 0\n"
+		"# HELP poco_cache_entries Number of entries currently in the cache\n"
+		"# TYPE poco_cache_entries gauge\n"
+		"poco_cache_entries{name=\"test-cache\"} 2\n"
+		"# HELP poco_cache_bytes Total size of all entries currently in the cache\n"
+		"# TYPE poco_cache_bytes gauge\n"
+		"poco_cache_bytes{name=\"test-cache\"} 8\n"s,
+		text);
+
+	Registry::defaultRegistry().unregisterCollector(&collector);
+}
+
+
+void CacheCollectorTest::testMultipleCaches()
+{
+	Poco::ConcurrentLRUCache<int, int> cache1(10, 0, 1);
+	cache1.add(1, 2);
+	cache1.get(1);
+	Poco::ConcurrentLRUCache<int, int> cache2(10, 0, 1);
+	cache2.get(1);
+
+	CacheCollector collector;
+	collector.addCache("first"s, cache1);
+	collector.addCache("second"s, cache2);
+
+	try
+	{
+		collector.addCache("first"s, cache2);
+		fail("duplicate cache name - must throw"s);
+	}
+	catch (Poco::ExistsException&)
+	{
+	}
+
+	std::ostringstream stream;
+	TextExporter exporter(stream);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string text = stream.str();
+	assertEqual(
+		"# HELP poco_cache_hits_total Number of cache lookups that found a valid entry\n"
+		"# TYPE poco_cache_hits_total counter\n"
+		"poco_cache_hits_total{name=\"first\"} 1\n"
+		"poco_cache_hits_total{name=\"second\"} 0\n"
+		"# HELP poco_cache_misses_total Number of cache lookups that found no valid entry\n"
+		"# TYPE poco_cache_misses_total counter\n"
+		"poco_cache_misses_total{name=\"first\"} 0\n"
+		"poco_cache_misses_total{name=\"second\"} 1\n"
+		"# HELP poco_cache_evictions_total Number of entries evicted to make room for new entries\n"
+		"# TYPE poco_cache_evictions_total counter\n"
+		"poco_cache_evictions_total{name=\"first\"} 0\n"
+		"poco_cache_evictions_total{name=\"second\"} 0\n"
+		"# HELP poco_cache_expirations_total Number of entries removed because they expired\n"
+		"# TYPE poco_cache_expirations_total counter\n"
+		"poco_cache_expirations_total{name=\"first\"} 0\n"
+		"poco_cache_expirations_total{name=\"second\"} 0\n"
+		"# HELP poco_cache_entries Number of entries currently in the cache\n"
+		"# TYPE poco_cache_entries gauge\n"
+		"poco_cache_entries{name=\"first\"} 1\n"
+		"poco_cache_entries{name=\"second\"} 0\n"
+		"# HELP poco_cache_bytes Total size of all entries currently in the cache\n"
+		"# TYPE poco_cache_bytes gauge\n"
+		"poco_cache_bytes{name=\"first\"} 4\n"
+		"poco_cache_bytes{name=\"second\"} 0\n"s,
+		text);
+
+	collector.removeCache("first"s);
+	collector.removeCache("second"s);
+	std::ostringstream empty;
+	TextExporter emptyExporter(empty);
+	Registry::defaultRegistry().exportTo(emptyExporter);
+	assertEqual(""s, empty.str());
+
+	Registry::defaultRegistry().unregisterCollector(&collector);
+}
+
+
+void CacheCollectorTest::setUp()
+{
+	Registry::defaultRegistry().clear();
+}
+
+
+void CacheCollectorTest::tearDown()
+{
+}
+
+
+CppUnit::Test* CacheCollectorTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("CacheCollectorTest");
+
+	CppUnit_addTest(pSuite, CacheCollectorTest, testExport);
+	CppUnit_addTest(pSuite, CacheCollectorTest, testMultipleCaches);
+
+	return pSuite;
+}
@@ -0,0 +1,36 @@
+//
+// CacheCollectorTest.h
+//
+// Definition of the CacheCollectorTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef CacheCollectorTest_INCLUDED
+#define CacheCollectorTest_INCLUDED
+
+
+#include "CppUnit/TestCase.h"
+
+
+class CacheCollectorTest: public CppUnit::TestCase
+{
+public:
+	CacheCollectorTest(const std::string& name);
+	~CacheCollectorTest() = default;
+
+	void testExport();
+	void testMultipleCaches();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // CacheCollectorTest_INCLUDED
@@ -215,6 +215,41 @@ void CounterTest::testExport()
 }
 
 
+void CounterTest::testExportOpenMetrics()
+{
+	Counter counter1("requests_total"s);
+	counter1.help("A test \"counter\""s);
+
+	Counter counter2("counter_2"s, {
+		/*.help =*/ "A test counter with one label"s,
+		/*.labelNames =*/ {"label1"s}
+	});
+
+	counter1.inc(3);
+	counter2.labels({"value11"}).inc(2);
+
+	std::ostringstream stream;
+	TextExporter exporter(stream, TextExporter::FORMAT_OPENMETRICS);
+	assertTrue (exporter.contentType() == TextExporter::OPENMETRICS_CONTENT_TYPE);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string text = stream.str();
+	const std::string family1 =
+		"# HELP requests A test \\\"counter\\\"\n"
+		"# TYPE requests counter\n"
+		"requests_total 3\n"s;
+	const std::string family2 =
+		"# HELP counter_2 A test counter with one label\n"
+		"# TYPE counter_2 counter\n"
+		"counter_2_total{label1=\"value11\"} 2\n"s;
+	assertTrue (text == family1 + family2 + "# EOF\n"s || text == family2 + family1 + "# EOF\n"s);
+
+	// the terminating line is written only once
+	exporter.finish();
+	assertTrue (stream.str() == text);
+}
+
+
 void CounterTest::setUp()
 {
 	Registry::defaultRegistry().clear();
@@ -235,6 +270,7 @@ CppUnit::Test* CounterTest::suite()
 	CppUnit_addTest(pSuite, CounterTest, testLabels);
 	CppUnit_addTest(pSuite, CounterTest, testConcurrency);
 	CppUnit_addTest(pSuite, CounterTest, testExport);
+	CppUnit_addTest(pSuite, CounterTest, testExportOpenMetrics);
 
 	return pSuite;
 }
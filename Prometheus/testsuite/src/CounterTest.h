@@ -28,6 +28,7 @@ public:
 	void testLabels();
 	void testConcurrency();
 	void testExport();
+	void testExportOpenMetrics();
 
 	void setUp();
 	void tearDown();
@@ -15,7 +15,10 @@
 #include "Poco/Prometheus/Registry.h"
 #include "Poco/Prometheus/TextExporter.h"
 #include "Poco/Exception.h"
+#include "Poco/Thread.h"
 #include <sstream>
+#include <vector>
+#include <memory>
 
 
 using namespace Poco::Prometheus;
@@ -154,6 +157,65 @@ void HistogramTest::testExport()
 }
 
 
+void HistogramTest::testConcurrentObserve()
+{
+	Histogram histo("histo"s, {
+		/*.help =*/ "A histogram with labels"s,
+		/*.labelNames =*/ {"label"s},
+		/*.buckets =*/ {1.0, 2.0, 3.0}
+	});
+
+	HistogramSample& sample = histo.labels({"value"s});
+	std::vector<std::unique_ptr<Poco::Thread>> threads;
+	for (int i = 0; i < 8; i++)
+	{
+		threads.push_back(std::make_unique<Poco::Thread>());
+		threads.back()->startFunc([&sample]()
+			{
+				for (int j = 0; j < 10000; j++)
+				{
+					sample.observe(0.5);
+					sample.observe(1.5);
+					sample.observe(2.5);
+					sample.observe(3.5);
+				}
+			});
+	}
+	for (auto& pThread: threads)
+	{
+		pThread->join();
+	}
+
+	const auto data = histo.labels({"value"s}).data();
+	assertEqual(3, data.bucketCounts.size());
+	assertEqual(80000, data.bucketCounts[0]);
+	assertEqual(160000, data.bucketCounts[1]);
+	assertEqual(240000, data.bucketCounts[2]);
+	assertEqual(320000, data.count);
+	assertEqualDelta(640000.0, data.sum, 0.001);
+}
+
+
+void HistogramTest::testClear()
+{
+	Histogram histo("histo"s);
+	histo.buckets({1.0, 2.0});
+
+	histo.observe(1.0);
+	histo.observe(3.0);
+	assertEqual(2, histo.data().count);
+
+	histo.clear();
+	assertEqual(0, histo.sampleCount());
+
+	histo.observe(2.0);
+	const auto data = histo.data();
+	assertEqual(1, data.count);
+	assertEqual(0, data.bucketCounts[0]);
+	assertEqual(1, data.bucketCounts[1]);
+}
+
+
 void HistogramTest::setUp()
 {
 	Registry::defaultRegistry().clear();
@@ -173,6 +235,8 @@ CppUnit::Test* HistogramTest::suite()
 	CppUnit_addTest(pSuite, HistogramTest, testBuckets);
 	CppUnit_addTest(pSuite, HistogramTest, testLabels);
 	CppUnit_addTest(pSuite, HistogramTest, testExport);
+	CppUnit_addTest(pSuite, HistogramTest, testConcurrentObserve);
+	CppUnit_addTest(pSuite, HistogramTest, testClear);
 
 	return pSuite;
 }
@@ -27,6 +27,8 @@ public:
 	void testBuckets();
 	void testLabels();
 	void testExport();
+	void testConcurrentObserve();
+	void testClear();
 
 	void setUp();
 	void tearDown();
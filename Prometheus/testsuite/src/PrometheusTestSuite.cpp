@@ -15,6 +15,8 @@
 #include "IntGaugeTest.h"
 #include "CallbackMetricTest.h"
 #include "HistogramTest.h"
+#include "CacheCollectorTest.h"
+#include "ProtobufExporterTest.h"
 
 
 CppUnit::Test* PrometheusTestSuite::suite()
@@ -27,6 +29,8 @@ CppUnit::Test* PrometheusTestSuite::suite()
 	pSuite->addTest(IntGaugeTest::suite());
 	pSuite->addTest(CallbackMetricTest::suite());
 	pSuite->addTest(HistogramTest::suite());
+	pSuite->addTest(CacheCollectorTest::suite());
+	pSuite->addTest(ProtobufExporterTest::suite());
 
 	return pSuite;
 }
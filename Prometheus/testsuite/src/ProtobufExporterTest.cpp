@@ -0,0 +1,186 @@
+//
+// ProtobufExporterTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ProtobufExporterTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Prometheus/ProtobufExporter.h"
+#include "Poco/Prometheus/Counter.h"
+#include "Poco/Prometheus/Gauge.h"
+#include "Poco/Prometheus/Histogram.h"
+#include "Poco/Prometheus/Registry.h"
+#include "Poco/ByteOrder.h"
+#include <sstream>
+#include <cstring>
+
+
+using namespace Poco::Prometheus;
+using namespace std::string_literals;
+
+
+namespace
+{
+	// Minimal protobuf encoder used to build the expected output.
+
+	std::string varint(Poco::UInt64 value)
+	{
+		std::string result;
+		while (value >= 0x80)
+		{
+			result += static_cast<char>((value & 0x7F) | 0x80);
+			value >>= 7;
+		}
+		result += static_cast<char>(value);
+		return result;
+	}
+
+	std::string field(int number, Poco::UInt64 value)
+	{
+		return varint(number << 3) + varint(value);
+	}
+
+	std::string field(int number, double value)
+	{
+		Poco::UInt64 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		bits = Poco::ByteOrder::toLittleEndian(bits);
+		return varint((number << 3) | 1) + std::string(reinterpret_cast<const char*>(&bits), sizeof(bits));
+	}
+
+	std::string field(int number, const std::string& value)
+	{
+		return varint((number << 3) | 2) + varint(value.size()) + value;
+	}
+
+	std::string label(const std::string& name, const std::string& value)
+	{
+		return field(1, field(1, name) + field(2, value));
+	}
+
+	std::string delimited(const std::string& message)
+	{
+		return varint(message.size()) + message;
+	}
+}
+
+
+ProtobufExporterTest::ProtobufExporterTest(const std::string& name):
+	CppUnit::TestCase("ProtobufExporterTest"s)
+{
+}
+
+
+void ProtobufExporterTest::testCounter()
+{
+	Counter counter1("counter_1"s);
+	counter1.help("A test counter"s);
+	counter1.inc(5);
+
+	std::ostringstream stream;
+	ProtobufExporter exporter(stream);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string expected = delimited(
+		field(1, "counter_1"s) +
+		field(2, "A test counter"s) +
+		field(3, Poco::UInt64(0)) +
+		field(4, field(3, field(1, 5.0))));
+
+	assertTrue (stream.str() == expected);
+}
+
+
+void ProtobufExporterTest::testGaugeWithLabels()
+{
+	Gauge gauge1("gauge_1"s, {
+		/*.help =*/ ""s,
+		/*.labelNames =*/ {"label1"s, "label2"s}
+	});
+	gauge1.labels({"value11"s, "value21"s}).set(1.5);
+
+	Counter counter1("counter_1"s);
+	counter1.inc();
+
+	std::ostringstream stream;
+	ProtobufExporter exporter(stream);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string gaugeFamily = delimited(
+		field(1, "gauge_1"s) +
+		field(3, Poco::UInt64(1)) +
+		field(4,
+			label("label1"s, "value11"s) +
+			label("label2"s, "value21"s) +
+			field(2, field(1, 1.5))));
+
+	const std::string counterFamily = delimited(
+		field(1, "counter_1"s) +
+		field(3, Poco::UInt64(0)) +
+		field(4, field(3, field(1, 1.0))));
+
+	// registry order is not defined
+	const std::string data = stream.str();
+	assertTrue (data == gaugeFamily + counterFamily || data == counterFamily + gaugeFamily);
+}
+
+
+void ProtobufExporterTest::testHistogram()
+{
+	Histogram histo1("histo_1"s, {
+		/*.help =*/ "A histogram with labels"s,
+		/*.labelNames =*/ {"label"s},
+		/*.buckets =*/ {1.0, 2.0}
+	});
+
+	histo1.labels({"value1"s}).observe(1.0);
+	histo1.labels({"value1"s}).observe(2.0);
+	histo1.labels({"value1"s}).observe(5.0);
+
+	std::ostringstream stream;
+	ProtobufExporter exporter(stream);
+	Registry::defaultRegistry().exportTo(exporter);
+
+	const std::string histogram =
+		field(1, Poco::UInt64(3)) +
+		field(2, 8.0) +
+		field(3, field(1, Poco::UInt64(1)) + field(2, 1.0)) +
+		field(3, field(1, Poco::UInt64(2)) + field(2, 2.0));
+
+	const std::string expected = delimited(
+		field(1, "histo_1"s) +
+		field(2, "A histogram with labels"s) +
+		field(3, Poco::UInt64(4)) +
+		field(4, label("label"s, "value1"s) + field(7, histogram)));
+
+	assertTrue (stream.str() == expected);
+}
+
+
+void ProtobufExporterTest::setUp()
+{
+	Registry::defaultRegistry().clear();
+}
+
+
+void ProtobufExporterTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ProtobufExporterTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ProtobufExporterTest");
+
+	CppUnit_addTest(pSuite, ProtobufExporterTest, testCounter);
+	CppUnit_addTest(pSuite, ProtobufExporterTest, testGaugeWithLabels);
+	CppUnit_addTest(pSuite, ProtobufExporterTest, testHistogram);
+
+	return pSuite;
+}
@@ -0,0 +1,37 @@
+//
+// ProtobufExporterTest.h
+//
+// Definition of the ProtobufExporterTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ProtobufExporterTest_INCLUDED
+#define ProtobufExporterTest_INCLUDED
+
+
+#include "CppUnit/TestCase.h"
+
+
+class ProtobufExporterTest: public CppUnit::TestCase
+{
+public:
+	ProtobufExporterTest(const std::string& name);
+	~ProtobufExporterTest() = default;
+
+	void testCounter();
+	void testGaugeWithLabels();
+	void testHistogram();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ProtobufExporterTest_INCLUDED